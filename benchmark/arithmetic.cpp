@@ -0,0 +1,144 @@
+// Copyright 2023 Peter Dimov
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "benchmark_common.hpp"
+#include <functional>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// Performs >, >=, <, <=, == and != between vec[i] and vec[i + 1]
+template <typename T, distribution Dist>
+struct comparisons
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_data<T, Dist>()};
+
+        for (auto _ : state)
+        {
+            std::size_t s {};
+            for (std::size_t i {}; i < data.size() - 1U; ++i)
+            {
+                const auto val1 {data[i]};
+                const auto val2 {data[i + 1U]};
+                s += static_cast<std::size_t>(val1 > val2);
+                s += static_cast<std::size_t>(val1 >= val2);
+                s += static_cast<std::size_t>(val1 < val2);
+                s += static_cast<std::size_t>(val1 <= val2);
+                s += static_cast<std::size_t>(val1 == val2);
+                s += static_cast<std::size_t>(val1 != val2);
+            }
+            benchmark::DoNotOptimize(s);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(6U * (data.size() - 1U)));
+    }
+};
+
+// Performs op(vec[i], vec[i + 1])
+template <typename Op>
+struct binary_operation
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            const Op op {};
+
+            for (auto _ : state)
+            {
+                for (std::size_t i {}; i < data.size() - 1U; ++i)
+                {
+                    auto res {op(data[i], data[i + 1U])};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size() - 1U));
+        }
+    };
+};
+
+// Number of elements of the streaming benchmarks,
+// so that the arrays of every type are much larger than the caches
+constexpr std::size_t stream_size {std::size_t{1} << 22};
+
+template <typename T, distribution Dist>
+auto get_stream_data() -> const std::vector<T>&
+{
+    static const std::vector<T> data {generate_data<T>(Dist, stream_size)};
+    return data;
+}
+
+// Sums vec[i] over the whole array, which reads one value per operation
+template <typename T, distribution Dist>
+struct stream_sum
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_stream_data<T, Dist>()};
+
+        for (auto _ : state)
+        {
+            T s {};
+            for (const auto val : data)
+            {
+                s += val;
+            }
+            benchmark::DoNotOptimize(s);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(data.size() * sizeof(T)));
+    }
+};
+
+// Stores vec[i] * factor into out[i], which reads and writes one value per operation
+template <typename T, distribution Dist>
+struct stream_scale
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_stream_data<T, Dist>()};
+        std::vector<T> out(data.size());
+        const auto factor {static_cast<T>(1.25)};
+
+        for (auto _ : state)
+        {
+            for (std::size_t i {}; i < data.size(); ++i)
+            {
+                out[i] = data[i] * factor;
+            }
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(2U * data.size() * sizeof(T)));
+    }
+};
+
+const bool registered {[]
+{
+    register_all_types<comparisons>("comparisons");
+    register_all_types<binary_operation<std::plus<>>::bench>("addition");
+    register_all_types<binary_operation<std::minus<>>::bench>("subtraction");
+    register_all_types_single<binary_operation<std::plus<>>::bench, distribution::cents>("addition");
+    register_all_types_single<binary_operation<std::minus<>>::bench, distribution::cents>("subtraction");
+    register_all_types<binary_operation<std::multiplies<>>::bench>("multiplication");
+    register_all_types<binary_operation<std::divides<>>::bench>("division");
+    register_all_types_single<stream_sum, distribution::money>("stream_sum");
+    register_all_types_single<stream_sum, distribution::cents>("stream_sum");
+    register_all_types_single<stream_scale, distribution::money>("stream_scale");
+    return true;
+}()};
+
+} // namespace
@@ -0,0 +1,249 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Shared data generation and registration helpers for the Google Benchmark based suite
+
+#ifndef BOOST_DECIMAL_BENCHMARK_COMMON_HPP
+#define BOOST_DECIMAL_BENCHMARK_COMMON_HPP
+
+#include <boost/decimal.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Number of elements in each generated data set.
+// Every benchmark iteration walks the entire data set once
+#ifndef BOOST_DECIMAL_BENCHMARK_SIZE
+#  define BOOST_DECIMAL_BENCHMARK_SIZE 20000
+#endif
+
+namespace boost {
+namespace decimal {
+namespace benchmark_detail {
+
+constexpr std::size_t benchmark_size {BOOST_DECIMAL_BENCHMARK_SIZE};
+
+enum class distribution
+{
+    uniform,    // Uniformly distributed in [0, 1)
+    bit_pattern,// Random bit patterns of the underlying storage with non-finite values removed
+    money,      // Monetary amounts with 2 - 4 decimal places, e.g. 12345.67
+    cents       // Ledger entries of either sign with exactly 2 decimal places, e.g. -123.45
+};
+
+constexpr auto distribution_name(distribution dist) noexcept -> const char*
+{
+    return dist == distribution::uniform ? "uniform" :
+           dist == distribution::bit_pattern ? "bit_pattern" :
+           dist == distribution::money ? "money" : "cents";
+}
+
+template <typename T>
+constexpr auto type_name() noexcept -> const char*;
+
+template <> constexpr auto type_name<float>() noexcept -> const char* { return "float"; }
+template <> constexpr auto type_name<double>() noexcept -> const char* { return "double"; }
+template <> constexpr auto type_name<decimal32>() noexcept -> const char* { return "decimal32"; }
+template <> constexpr auto type_name<decimal64>() noexcept -> const char* { return "decimal64"; }
+template <> constexpr auto type_name<decimal128>() noexcept -> const char* { return "decimal128"; }
+template <> constexpr auto type_name<decimal32_fast>() noexcept -> const char* { return "decimal32_fast"; }
+
+// All generators are seeded identically so that every type sees the same sequence of values
+
+template <typename T>
+auto make_value(double val) -> T
+{
+    return static_cast<T>(val);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto make_money(std::int64_t coeff, int exp) -> T
+{
+    return static_cast<T>(static_cast<double>(coeff) / std::pow(10.0, -exp));
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto make_money(std::int64_t coeff, int exp) -> T
+{
+    return T{coeff, exp};
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto is_finite_pattern(T x, std::uint64_t, std::uint64_t) -> bool
+{
+    return std::isfinite(x);
+}
+
+// Decimal infinities and NaNs have the four bits after the sign bit set.
+// These are checked directly since with BOOST_DECIMAL_FINITE_ONLY the classification functions
+// take every value to be finite
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto is_finite_pattern(T, std::uint64_t lo, std::uint64_t hi) -> bool
+{
+    const auto top_bits {sizeof(T) == sizeof(std::uint32_t) ? lo >> 27U :
+                         sizeof(T) == sizeof(std::uint64_t) ? lo >> 59U : hi >> 59U};
+
+    return (top_bits & 0xFU) != 0xFU;
+}
+
+// Reinterprets random bits as a value of type T, returning false if the result is not finite
+template <typename T>
+auto make_bit_pattern(std::uint64_t lo, std::uint64_t hi, T& val) -> bool
+{
+    // The internal state of decimal32_fast is not a bit pattern,
+    // so we draw the pattern for decimal32 and convert
+    using storage_type = std::conditional_t<std::is_same<T, decimal32_fast>::value, decimal32, T>;
+
+    std::uint64_t bits[2] {lo, hi};
+    storage_type x;
+    std::memcpy(&x, bits, sizeof(x));
+
+    if (!is_finite_pattern(x, lo, hi))
+    {
+        return false;
+    }
+
+    val = static_cast<T>(x);
+    return true;
+}
+
+template <typename T>
+auto generate_data(distribution dist, std::size_t size = benchmark_size, std::uint64_t seed = 42U) -> std::vector<T>
+{
+    std::vector<T> data;
+    data.reserve(size);
+
+    std::mt19937_64 gen(seed);
+
+    switch (dist)
+    {
+        case distribution::uniform:
+        {
+            std::uniform_real_distribution<double> dis(0, 1);
+            while (data.size() < size)
+            {
+                data.emplace_back(make_value<T>(dis(gen)));
+            }
+            break;
+        }
+        case distribution::bit_pattern:
+        {
+            while (data.size() < size)
+            {
+                T val;
+                const auto lo {gen()};
+                const auto hi {gen()};
+                if (make_bit_pattern(lo, hi, val))
+                {
+                    data.emplace_back(val);
+                }
+            }
+            break;
+        }
+        case distribution::money:
+        {
+            // Up to ten million units of currency with between 2 and 4 decimal places
+            std::uniform_int_distribution<std::int64_t> coeff_dis(1, INT64_C(100'000'000'000));
+            std::uniform_int_distribution<int> places_dis(2, 4);
+            while (data.size() < size)
+            {
+                const auto places {places_dis(gen)};
+                auto coeff {coeff_dis(gen)};
+                for (int i {places}; i < 4; ++i)
+                {
+                    coeff /= 10;
+                }
+                data.emplace_back(make_money<T>(coeff, -places));
+            }
+            break;
+        }
+        case distribution::cents:
+        {
+            // Up to 99999.99 units of currency, which every type stores with the same exponent
+            std::uniform_int_distribution<std::int64_t> coeff_dis(INT64_C(-9'999'999), INT64_C(9'999'999));
+            while (data.size() < size)
+            {
+                data.emplace_back(make_money<T>(coeff_dis(gen), -2));
+            }
+            break;
+        }
+    }
+
+    return data;
+}
+
+// Data sets are generated once per type and distribution and shared between benchmarks
+template <typename T, distribution Dist>
+auto get_data() -> const std::vector<T>&
+{
+    static const std::vector<T> data {generate_data<T>(Dist)};
+    return data;
+}
+
+template <typename Func>
+auto register_benchmark(const char* operation, const char* type, const char* dist, Func func) -> ::benchmark::internal::Benchmark*
+{
+    const std::string name {std::string(operation) + '/' + type + '/' + dist};
+    return ::benchmark::RegisterBenchmark(name.c_str(), func);
+}
+
+// Registers Bench<T, Dist> for every distribution
+template <typename T, template <typename, distribution> class Bench>
+auto register_all_distributions(const char* operation) -> void
+{
+    register_benchmark(operation, type_name<T>(), distribution_name(distribution::uniform), Bench<T, distribution::uniform>::run);
+    register_benchmark(operation, type_name<T>(), distribution_name(distribution::bit_pattern), Bench<T, distribution::bit_pattern>::run);
+    register_benchmark(operation, type_name<T>(), distribution_name(distribution::money), Bench<T, distribution::money>::run);
+}
+
+// Registers Bench for the binary floating point baselines and all the decimal types
+template <template <typename, distribution> class Bench>
+auto register_all_types(const char* operation) -> void
+{
+    register_all_distributions<float, Bench>(operation);
+    register_all_distributions<double, Bench>(operation);
+    register_all_distributions<decimal32, Bench>(operation);
+    register_all_distributions<decimal64, Bench>(operation);
+    register_all_distributions<decimal128, Bench>(operation);
+    register_all_distributions<decimal32_fast, Bench>(operation);
+}
+
+// Registers Bench for the decimal types only, using a single distribution.
+// Not every function is available for decimal32_fast, so it can be excluded
+template <template <typename, distribution> class Bench, distribution Dist = distribution::uniform, bool IncludeFast = true>
+auto register_decimal_types(const char* operation) -> void
+{
+    const auto dist {distribution_name(Dist)};
+    register_benchmark(operation, type_name<decimal32>(), dist, Bench<decimal32, Dist>::run);
+    register_benchmark(operation, type_name<decimal64>(), dist, Bench<decimal64, Dist>::run);
+    register_benchmark(operation, type_name<decimal128>(), dist, Bench<decimal128, Dist>::run);
+
+    // Bench<decimal32_fast> must not be instantiated at all when excluded
+    using fast_type = std::conditional_t<IncludeFast, decimal32_fast, decimal32>;
+    if (IncludeFast)
+    {
+        register_benchmark(operation, type_name<decimal32_fast>(), dist, Bench<fast_type, Dist>::run);
+    }
+}
+
+// Registers Bench for the binary floating point baselines and the decimal types, using a single distribution
+template <template <typename, distribution> class Bench, distribution Dist = distribution::uniform, bool IncludeFast = true>
+auto register_all_types_single(const char* operation) -> void
+{
+    const auto dist {distribution_name(Dist)};
+    register_benchmark(operation, type_name<float>(), dist, Bench<float, Dist>::run);
+    register_benchmark(operation, type_name<double>(), dist, Bench<double, Dist>::run);
+    register_decimal_types<Bench, Dist, IncludeFast>(operation);
+}
+
+} // namespace benchmark_detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_BENCHMARK_COMMON_HPP
@@ -0,0 +1,158 @@
+// Copyright 2023 Peter Dimov
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "benchmark_common.hpp"
+#include <charconv>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// The binary floating point baselines use <charconv> from the standard library where available
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define BOOST_DECIMAL_BENCHMARK_STD_CHARCONV
+#endif
+
+constexpr auto to_std_format(chars_format fmt) noexcept -> std::chars_format
+{
+    return fmt == chars_format::scientific ? std::chars_format::scientific :
+           fmt == chars_format::fixed ? std::chars_format::fixed :
+           fmt == chars_format::hex ? std::chars_format::hex : std::chars_format::general;
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto generic_to_chars(char* first, char* last, T value, chars_format fmt, int precision) -> char*
+{
+    #ifdef BOOST_DECIMAL_BENCHMARK_STD_CHARCONV
+    const auto r {precision == 0 ? std::to_chars(first, last, value, to_std_format(fmt)) :
+                                   std::to_chars(first, last, value, to_std_format(fmt), precision)};
+    return r.ptr;
+    #else
+    static_cast<void>(last);
+    static_cast<void>(value);
+    static_cast<void>(fmt);
+    static_cast<void>(precision);
+    return first;
+    #endif
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto generic_to_chars(char* first, char* last, T value, chars_format fmt, int precision) -> char*
+{
+    const auto r {precision == 0 ? to_chars(first, last, value, fmt) :
+                                   to_chars(first, last, value, fmt, precision)};
+    return r.ptr;
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto generic_from_chars(const char* first, const char* last, T& value, chars_format fmt) -> int
+{
+    #ifdef BOOST_DECIMAL_BENCHMARK_STD_CHARCONV
+    return static_cast<int>(std::from_chars(first, last, value, to_std_format(fmt)).ec);
+    #else
+    static_cast<void>(first);
+    static_cast<void>(last);
+    static_cast<void>(value);
+    static_cast<void>(fmt);
+    return 0;
+    #endif
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto generic_from_chars(const char* first, const char* last, T& value, chars_format fmt) -> int
+{
+    return static_cast<int>(from_chars(first, last, value, fmt).ec);
+}
+
+template <chars_format Fmt, int Precision>
+struct to_chars_bench
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            char buffer[256];
+
+            for (auto _ : state)
+            {
+                for (const auto val : data)
+                {
+                    auto ptr {generic_to_chars(buffer, buffer + sizeof(buffer), val, Fmt, Precision)};
+                    benchmark::DoNotOptimize(ptr);
+                    benchmark::ClobberMemory();
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+template <chars_format Fmt>
+struct from_chars_bench
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+
+            std::vector<std::string> strings;
+            strings.reserve(data.size());
+            char buffer[256];
+            for (const auto val : data)
+            {
+                strings.emplace_back(buffer, generic_to_chars(buffer, buffer + sizeof(buffer), val, Fmt, 0));
+            }
+
+            for (auto _ : state)
+            {
+                for (const auto& str : strings)
+                {
+                    T val;
+                    auto ec {generic_from_chars(str.data(), str.data() + str.size(), val, Fmt)};
+                    benchmark::DoNotOptimize(ec);
+                    benchmark::DoNotOptimize(val);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings.size()));
+        }
+    };
+};
+
+const bool registered {[]
+{
+    register_all_types<to_chars_bench<chars_format::scientific, 0>::bench>("to_chars_scientific");
+    register_all_types<to_chars_bench<chars_format::scientific, 6>::bench>("to_chars_scientific_6");
+    register_all_types<to_chars_bench<chars_format::general, 0>::bench>("to_chars_general");
+    register_all_types<to_chars_bench<chars_format::general, 6>::bench>("to_chars_general_6");
+
+    register_all_types<from_chars_bench<chars_format::scientific>::bench>("from_chars_scientific");
+    register_all_types<from_chars_bench<chars_format::general>::bench>("from_chars_general");
+
+    // Fixed format output of arbitrary bit patterns can run to hundreds of digits,
+    // so the fixed and hex formats are only measured on the bounded distributions
+    register_all_types_single<to_chars_bench<chars_format::fixed, 0>::bench, distribution::uniform>("to_chars_fixed");
+    register_all_types_single<to_chars_bench<chars_format::fixed, 0>::bench, distribution::money>("to_chars_fixed");
+    register_all_types_single<to_chars_bench<chars_format::fixed, 6>::bench, distribution::uniform>("to_chars_fixed_6");
+    register_all_types_single<to_chars_bench<chars_format::fixed, 6>::bench, distribution::money>("to_chars_fixed_6");
+    register_all_types_single<to_chars_bench<chars_format::hex, 0>::bench, distribution::uniform>("to_chars_hex");
+    register_all_types_single<to_chars_bench<chars_format::hex, 0>::bench, distribution::money>("to_chars_hex");
+
+    register_all_types_single<from_chars_bench<chars_format::fixed>::bench, distribution::uniform>("from_chars_fixed");
+    register_all_types_single<from_chars_bench<chars_format::fixed>::bench, distribution::money>("from_chars_fixed");
+    register_all_types_single<from_chars_bench<chars_format::hex>::bench, distribution::uniform>("from_chars_hex");
+    register_all_types_single<from_chars_bench<chars_format::hex>::bench, distribution::money>("from_chars_hex");
+    return true;
+}()};
+
+} // namespace
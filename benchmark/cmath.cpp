@@ -0,0 +1,644 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Benchmarks every public function of <boost/decimal/cmath.hpp>.
+// The binary floating point baselines call the equivalent function in <cmath>
+
+#include "benchmark_common.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// The generated data lies in [0, 1) so each function maps it once, before timing, into a representative domain
+struct unit_domain   { template <typename T> static auto map(T x) -> T { return x; } };                                            // [0, 1)
+struct shifted_domain{ template <typename T> static auto map(T x) -> T { return x + static_cast<T>(1); } };                        // [1, 2)
+struct scaled_domain { template <typename T> static auto map(T x) -> T { return x * static_cast<T>(10); } };                       // [0, 10)
+struct wide_domain   { template <typename T> static auto map(T x) -> T { return x * static_cast<T>(20) - static_cast<T>(10); } };  // [-10, 10)
+struct rate_domain   { template <typename T> static auto map(T x) -> T { return static_cast<T>(1) + x / static_cast<T>(100); } };     // [1, 1.01)
+struct huge_domain   { template <typename T> static auto map(T x) -> T { return x * static_cast<T>(1e10); } };                     // [0, 1e10)
+struct integral_domain{ template <typename T> static auto map(T x) -> T { return static_cast<T>(static_cast<int>(x * static_cast<T>(30)) + 1); } }; // {1, ..., 30}
+
+template <typename Domain, typename T>
+auto map_domain(const std::vector<T>& data) -> std::vector<T>
+{
+    std::vector<T> res;
+    res.reserve(data.size());
+    for (const auto val : data)
+    {
+        res.emplace_back(Domain::map(val));
+    }
+    return res;
+}
+
+// func(vec[i])
+template <typename Func, typename Domain>
+struct unary
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto data {map_domain<Domain>(get_data<T, Dist>())};
+            const Func func {};
+
+            for (auto _ : state)
+            {
+                for (const auto val : data)
+                {
+                    auto res {func(val)};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+// func(vec[i], vec[i + 1])
+template <typename Func, typename Domain>
+struct binary
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto data {map_domain<Domain>(get_data<T, Dist>())};
+            const Func func {};
+
+            for (auto _ : state)
+            {
+                for (std::size_t i {}; i < data.size() - 1U; ++i)
+                {
+                    auto res {func(data[i], data[i + 1U])};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size() - 1U));
+        }
+    };
+};
+
+// func(vec[i], vec[i + 1], vec[i + 2])
+template <typename Func, typename Domain>
+struct ternary
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto data {map_domain<Domain>(get_data<T, Dist>())};
+            const Func func {};
+
+            for (auto _ : state)
+            {
+                for (std::size_t i {}; i < data.size() - 2U; ++i)
+                {
+                    auto res {func(data[i], data[i + 1U], data[i + 2U])};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size() - 2U));
+        }
+    };
+};
+
+// func(vec.data(), out.data(), vec.size()) over the whole vector at once
+template <typename Func, typename Domain>
+struct batch
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto data {map_domain<Domain>(get_data<T, Dist>())};
+            std::vector<T> out(data.size());
+            const Func func {};
+
+            for (auto _ : state)
+            {
+                func(data.data(), out.data(), data.size());
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+// Function objects that find the <cmath> overload for float and double, and the decimal overload through ADL
+
+#define BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(name)                                    \
+struct name##_function                                                                  \
+{                                                                                       \
+    template <typename T>                                                               \
+    auto operator()(T x) const { using std::name; return name(x); }                     \
+};
+
+#define BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(name)                                   \
+struct name##_function                                                                  \
+{                                                                                       \
+    template <typename T>                                                               \
+    auto operator()(T x, T y) const { using std::name; return name(x, y); }             \
+};
+
+#define BOOST_DECIMAL_BENCHMARK_TERNARY_FUNCTION(name)                                  \
+struct name##_function                                                                  \
+{                                                                                       \
+    template <typename T>                                                               \
+    auto operator()(T x, T y, T z) const { using std::name; return name(x, y, z); }     \
+};
+
+// Basic operations
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(abs)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(fabs)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(fmod)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(remainder)
+BOOST_DECIMAL_BENCHMARK_TERNARY_FUNCTION(fma)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(fmax)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(fmin)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(fdim)
+
+// Exponential and logarithmic functions
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(exp)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(exp2)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(expm1)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(log)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(log10)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(log2)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(log1p)
+
+// Power functions
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(pow)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(sqrt)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(cbrt)
+
+struct hypot_function
+{
+    template <typename T>
+    auto operator()(T x, T y) const { using std::hypot; return hypot(x, y); }
+
+    template <typename T>
+    auto operator()(T x, T y, T z) const { using std::hypot; return hypot(x, y, z); }
+};
+
+// Trigonometric and hyperbolic functions
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(sin)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(cos)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(tan)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(asin)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(acos)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(atan)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(atan2)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(sinh)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(cosh)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(tanh)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(asinh)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(acosh)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(atanh)
+
+// Error and gamma functions
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(erf)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(erfc)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(tgamma)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(lgamma)
+
+// Nearest integer operations
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(ceil)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(floor)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(trunc)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(round)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(lround)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(llround)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(nearbyint)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(rint)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(lrint)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(llrint)
+
+// Floating point manipulation
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(ilogb)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(logb)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(nextafter)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(copysign)
+
+// Classification and comparison
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(fpclassify)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(isfinite)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(isinf)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(isnan)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(isnormal)
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(signbit)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(isgreater)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(isgreaterequal)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(isless)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(islessequal)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(islessgreater)
+BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION(isunordered)
+
+// Elliptic integrals
+BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION(comp_ellint_1)
+
+#undef BOOST_DECIMAL_BENCHMARK_UNARY_FUNCTION
+#undef BOOST_DECIMAL_BENCHMARK_BINARY_FUNCTION
+#undef BOOST_DECIMAL_BENCHMARK_TERNARY_FUNCTION
+
+// Functions with non-floating point arguments or results
+
+// The separate multiplication and addition that fma fuses
+struct mul_add_function
+{
+    template <typename T>
+    auto operator()(T x, T y, T z) const { return x * y + z; }
+};
+
+struct pow_int_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::pow; return pow(x, 7); }
+};
+
+// Monthly compounding over thirty years
+struct pow_compound_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::pow; return pow(x, 360); }
+};
+
+struct pow10_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::pow; return pow(static_cast<T>(10), static_cast<int>(x * static_cast<T>(100)) - 50); }
+};
+
+struct pow_half_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::pow; return pow(x, static_cast<T>(0.5)); }
+};
+
+struct pow_frac_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::pow; return pow(x, static_cast<T>(2.5)); }
+};
+
+// The batched functions of the decimal types and the equivalent loops over <cmath> for the baselines
+
+#define BOOST_DECIMAL_BENCHMARK_BATCH_FUNCTION(name)                                            \
+struct name##_batch_function                                                                    \
+{                                                                                               \
+    template <typename T>                                                                       \
+    void operator()(const T* x, T* out, std::size_t n) const { detail::name##_batch(x, out, n); } \
+                                                                                                \
+    template <typename T>                                                                       \
+    void loop(const T* x, T* out, std::size_t n) const                                          \
+    {                                                                                           \
+        for (std::size_t i {}; i < n; ++i) { out[i] = std::name(x[i]); }                        \
+    }                                                                                           \
+                                                                                                \
+    void operator()(const float* x, float* out, std::size_t n) const { loop(x, out, n); }       \
+    void operator()(const double* x, double* out, std::size_t n) const { loop(x, out, n); }     \
+};
+
+BOOST_DECIMAL_BENCHMARK_BATCH_FUNCTION(exp)
+BOOST_DECIMAL_BENCHMARK_BATCH_FUNCTION(log)
+BOOST_DECIMAL_BENCHMARK_BATCH_FUNCTION(sqrt)
+BOOST_DECIMAL_BENCHMARK_BATCH_FUNCTION(lgamma)
+
+struct pow_frac_batch_function
+{
+    template <typename T>
+    void operator()(const T* x, T* out, std::size_t n) const { detail::pow_batch(x, static_cast<T>(2.5), out, n); }
+
+    template <typename T>
+    void loop(const T* x, T* out, std::size_t n) const
+    {
+        for (std::size_t i {}; i < n; ++i) { out[i] = std::pow(x[i], static_cast<T>(2.5)); }
+    }
+
+    void operator()(const float* x, float* out, std::size_t n) const { loop(x, out, n); }
+    void operator()(const double* x, double* out, std::size_t n) const { loop(x, out, n); }
+};
+
+struct frexp_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::frexp; int exp {}; const auto res {frexp(x, &exp)}; return res + static_cast<T>(exp); }
+};
+
+struct ldexp_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::ldexp; return ldexp(x, 12); }
+};
+
+struct scalbn_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::scalbn; return scalbn(x, 12); }
+};
+
+struct scalbln_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::scalbln; return scalbln(x, 12L); }
+};
+
+struct modf_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::modf; T ip {}; const auto res {modf(x, &ip)}; return res + ip; }
+};
+
+struct remquo_function
+{
+    template <typename T>
+    auto operator()(T x, T y) const { using std::remquo; int quo {}; const auto res {remquo(x, y, &quo)}; return res + static_cast<T>(quo); }
+};
+
+struct nexttoward_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::nexttoward; return nexttoward(x, 0.0L); }
+};
+
+struct frexp10_function
+{
+    template <typename T>
+    auto operator()(T x) const { int exp {}; const auto res {frexp10(x, &exp)}; return res + static_cast<typename T::significand_type>(exp); }
+};
+
+struct quantexp_function
+{
+    template <typename T>
+    auto operator()(T x) const { return quantexp(x); }
+};
+
+struct samequantum_function
+{
+    template <typename T>
+    auto operator()(T x, T y) const { return samequantum(x, y); }
+};
+
+struct quantize_function
+{
+    template <typename T>
+    auto operator()(T x, T y) const { return quantize(x, y); }
+};
+
+// Rounding a column to cents: the batch kernel against the scalar function with a fixed quantum
+struct quantize_cents_batch_function
+{
+    template <typename T>
+    void operator()(const T* x, T* out, std::size_t n) const { detail::quantize_batch(x, -2, out, n); }
+};
+
+struct quantize_cents_loop_function
+{
+    template <typename T>
+    void operator()(const T* x, T* out, std::size_t n) const
+    {
+        const T quantum {1, -2};
+        for (std::size_t i {}; i < n; ++i) { out[i] = quantize(x[i], quantum); }
+    }
+};
+
+// sin and cos from one argument reduction. <cmath> has no sincos, so the baselines call both
+struct sincos_function
+{
+    template <typename T>
+    auto operator()(T x) const { T s {}; T c {}; sincos(x, &s, &c); return s + c; }
+
+    auto operator()(float x) const { return std::sin(x) + std::cos(x); }
+    auto operator()(double x) const { return std::sin(x) + std::cos(x); }
+};
+
+// The standard normal distribution. <cmath> has no equivalent, so the baselines are
+// the usual formulations through erfc and exp, which normal_cdf_erfc also times for the decimal types
+struct normal_cdf_function
+{
+    template <typename T>
+    auto operator()(T x) const { return normal_cdf(x); }
+
+    auto operator()(float x) const { return 0.5F * std::erfc(-x / std::sqrt(2.0F)); }
+    auto operator()(double x) const { return 0.5 * std::erfc(-x / std::sqrt(2.0)); }
+};
+
+struct normal_cdf_erfc_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::erfc; using std::sqrt; return static_cast<T>(0.5) * erfc(-x / sqrt(static_cast<T>(2))); }
+};
+
+struct normal_pdf_function
+{
+    template <typename T>
+    auto operator()(T x) const { return normal_pdf(x); }
+
+    auto operator()(float x) const { return 0.398942280F * std::exp(-x * x / 2); }
+    auto operator()(double x) const { return 0.3989422804014327 * std::exp(-x * x / 2); }
+};
+
+struct normal_quantile_function
+{
+    template <typename T>
+    auto operator()(T x) const { return normal_quantile(x); }
+};
+
+// The C++17 mathematical special functions of <cmath> are the baselines for the polynomials
+#if defined(__cpp_lib_math_special_functions) || (defined(__STDCPP_MATH_SPEC_FUNCS__) && __STDCPP_MATH_SPEC_FUNCS__ >= 201003L)
+#  define BOOST_DECIMAL_BENCHMARK_SPECIAL_FUNCTIONS
+#endif
+
+struct hermite_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::hermite; return hermite(5U, x); }
+};
+
+struct laguerre_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::laguerre; return laguerre(5U, x); }
+};
+
+struct assoc_laguerre_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::assoc_laguerre; return assoc_laguerre(5U, 2U, x); }
+};
+
+struct legendre_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::legendre; return legendre(5U, x); }
+};
+
+struct assoc_legendre_function
+{
+    template <typename T>
+    auto operator()(T x) const { using std::assoc_legendre; return assoc_legendre(5U, 2U, x); }
+};
+
+#define BOOST_DECIMAL_BENCHMARK_REGISTER(arity, name, domain) \
+    register_all_types_single<arity<name##_function, domain>::bench>(#name)
+
+#define BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(arity, name, domain) \
+    register_decimal_types<arity<name##_function, domain>::bench>(#name)
+
+// The following are not yet implemented for decimal32_fast
+#define BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(arity, name, domain) \
+    register_all_types_single<arity<name##_function, domain>::bench, distribution::uniform, false>(#name)
+
+#define BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(arity, name, domain) \
+    register_decimal_types<arity<name##_function, domain>::bench, distribution::uniform, false>(#name)
+
+const bool registered {[]
+{
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, abs, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, fabs, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, fmod, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, remainder, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, remquo, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(ternary, fma, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(ternary, mul_add, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, fmax, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, fmin, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, fdim, wide_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, exp, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, exp2, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, expm1, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, log, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, log10, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, log2, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, log1p, scaled_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(binary, pow, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, pow_int, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, pow_compound, rate_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, pow10, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, pow_half, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, pow_frac, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, sqrt, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, cbrt, wide_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(batch, exp_batch, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(batch, log_batch, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(batch, sqrt_batch, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(batch, lgamma_batch, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(batch, pow_frac_batch, scaled_domain);
+    register_all_types_single<binary<hypot_function, wide_domain>::bench>("hypot");
+    register_all_types_single<ternary<hypot_function, wide_domain>::bench>("hypot3");
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, sin, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, cos, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, tan, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, sincos, wide_domain);
+    register_all_types_single<unary<sin_function, huge_domain>::bench, distribution::uniform, false>("sin_huge");
+    register_all_types_single<unary<cos_function, huge_domain>::bench, distribution::uniform, false>("cos_huge");
+    register_all_types_single<unary<tan_function, huge_domain>::bench, distribution::uniform, false>("tan_huge");
+    register_all_types_single<unary<sincos_function, huge_domain>::bench, distribution::uniform, false>("sincos_huge");
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, asin, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, acos, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, atan, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(binary, atan2, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, sinh, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, cosh, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, tanh, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, asinh, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, acosh, shifted_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, atanh, unit_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, erf, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, erfc, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, tgamma, scaled_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, lgamma, scaled_domain);
+    register_all_types_single<unary<tgamma_function, integral_domain>::bench, distribution::uniform, false>("tgamma_int");
+    register_all_types_single<unary<lgamma_function, integral_domain>::bench, distribution::uniform, false>("lgamma_int");
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, normal_cdf, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, normal_cdf_erfc, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, normal_pdf, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(unary, normal_quantile, unit_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, ceil, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, floor, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, trunc, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, round, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, lround, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, llround, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, nearbyint, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, rint, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, lrint, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, llrint, wide_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, frexp, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, ldexp, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, scalbn, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, scalbln, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, modf, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, ilogb, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, logb, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, nextafter, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, nexttoward, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(binary, copysign, wide_domain);
+
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, fpclassify, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, isfinite, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, isinf, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, isnan, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, isnormal, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, signbit, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, isgreater, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, isgreaterequal, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, isless, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, islessequal, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, islessgreater, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(binary, isunordered, wide_domain);
+
+    // Decimal specific functions have no binary floating point equivalent
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(unary, frexp10, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(unary, quantexp, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(binary, samequantum, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(binary, quantize, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(batch, quantize_cents_batch, wide_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(batch, quantize_cents_loop, wide_domain);
+
+    #ifdef BOOST_DECIMAL_BENCHMARK_SPECIAL_FUNCTIONS
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, hermite, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, laguerre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, assoc_laguerre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER(unary, legendre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, assoc_legendre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST(unary, comp_ellint_1, unit_domain);
+    #else
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(unary, hermite, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(unary, laguerre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(unary, assoc_laguerre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL(unary, legendre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(unary, assoc_legendre, unit_domain);
+    BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST(unary, comp_ellint_1, unit_domain);
+    #endif
+
+    return true;
+}()};
+
+#undef BOOST_DECIMAL_BENCHMARK_REGISTER
+#undef BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL
+#undef BOOST_DECIMAL_BENCHMARK_REGISTER_NO_FAST
+#undef BOOST_DECIMAL_BENCHMARK_REGISTER_DECIMAL_NO_FAST
+
+} // namespace
@@ -0,0 +1,675 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Runs the same workloads against this library and the other decimal floating point
+// implementations that are available on the system, and prints the throughput side-by-side.
+//
+// The competitors are enabled by the build system:
+//
+// BOOST_DECIMAL_COMPARISON_GCC        GCC's decimal floating point builtins through <decimal/decimal>
+// BOOST_DECIMAL_COMPARISON_LIBDFP     libdfp, which provides the math and string functions for the GCC builtins
+// BOOST_DECIMAL_COMPARISON_INTEL_BID  Intel's Decimal Floating-Point Math Library
+// BOOST_DECIMAL_COMPARISON_DECNUMBER  IBM's decNumber library (libdecnumber)
+
+#include <boost/decimal.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef BOOST_DECIMAL_COMPARISON_GCC
+#  include <decimal/decimal>
+#endif
+
+#ifdef BOOST_DECIMAL_COMPARISON_INTEL_BID
+extern "C" {
+#  include <bid_conf.h>
+#  include <bid_functions.h>
+}
+#endif
+
+#ifdef BOOST_DECIMAL_COMPARISON_DECNUMBER
+#  define DECNUMDIGITS 34
+extern "C" {
+#  include <decContext.h>
+#  include <decNumber.h>
+#  include <decDouble.h>
+#  include <decQuad.h>
+}
+#endif
+
+#ifndef BOOST_DECIMAL_COMPARISON_SIZE
+#  define BOOST_DECIMAL_COMPARISON_SIZE 20000
+#endif
+
+#ifndef BOOST_DECIMAL_COMPARISON_REPETITIONS
+#  define BOOST_DECIMAL_COMPARISON_REPETITIONS 10
+#endif
+
+namespace {
+
+constexpr std::size_t comparison_size {BOOST_DECIMAL_COMPARISON_SIZE};
+constexpr int comparison_repetitions {BOOST_DECIMAL_COMPARISON_REPETITIONS};
+
+// Every backend provides:
+//
+// value_type, name,
+// add, sub, mul, div, less, equal,
+// from_double and to_double if has_double_conversion,
+// from_string if has_from_string, to_string if has_to_string,
+// sqrt, exp, and log if has_cmath
+//
+// At least one of from_double or from_string is required to create the input data
+
+template <typename T>
+struct boost_backend
+{
+    using value_type = T;
+    static constexpr const char* name {"Boost.Decimal"};
+    static constexpr bool has_double_conversion {true};
+    static constexpr bool has_from_string {true};
+    static constexpr bool has_to_string {true};
+    static constexpr bool has_cmath {true};
+
+    static auto add(T a, T b) -> T { return a + b; }
+    static auto sub(T a, T b) -> T { return a - b; }
+    static auto mul(T a, T b) -> T { return a * b; }
+    static auto div(T a, T b) -> T { return a / b; }
+    static auto less(T a, T b) -> bool { return a < b; }
+    static auto equal(T a, T b) -> bool { return a == b; }
+
+    static auto from_double(double x) -> T { return static_cast<T>(x); }
+    static auto to_double(T x) -> double { return static_cast<double>(x); }
+
+    static auto from_string(const char* str) -> T
+    {
+        return boost::decimal::strtod<T>(str, nullptr);
+    }
+
+    static auto to_string(char* buffer, std::size_t size, T x) -> void
+    {
+        *boost::decimal::to_chars(buffer, buffer + size - 1, x).ptr = '\0';
+    }
+
+    static auto sqrt(T x) -> T { return boost::decimal::sqrt(x); }
+    static auto exp(T x) -> T { return boost::decimal::exp(x); }
+    static auto log(T x) -> T { return boost::decimal::log(x); }
+};
+
+#ifdef BOOST_DECIMAL_COMPARISON_GCC
+
+#ifdef BOOST_DECIMAL_COMPARISON_LIBDFP
+
+using gcc_decfloat64 = std::decimal::decimal64::__decfloat64;
+using gcc_decfloat128 = std::decimal::decimal128::__decfloat128;
+
+extern "C" {
+gcc_decfloat64 sqrtd64(gcc_decfloat64);
+gcc_decfloat64 expd64(gcc_decfloat64);
+gcc_decfloat64 logd64(gcc_decfloat64);
+gcc_decfloat64 strtod64(const char*, char**);
+gcc_decfloat128 sqrtd128(gcc_decfloat128);
+gcc_decfloat128 expd128(gcc_decfloat128);
+gcc_decfloat128 logd128(gcc_decfloat128);
+gcc_decfloat128 strtod128(const char*, char**);
+}
+
+inline auto libdfp_sqrt(gcc_decfloat64 x) -> gcc_decfloat64 { return sqrtd64(x); }
+inline auto libdfp_exp(gcc_decfloat64 x) -> gcc_decfloat64 { return expd64(x); }
+inline auto libdfp_log(gcc_decfloat64 x) -> gcc_decfloat64 { return logd64(x); }
+inline auto libdfp_sqrt(gcc_decfloat128 x) -> gcc_decfloat128 { return sqrtd128(x); }
+inline auto libdfp_exp(gcc_decfloat128 x) -> gcc_decfloat128 { return expd128(x); }
+inline auto libdfp_log(gcc_decfloat128 x) -> gcc_decfloat128 { return logd128(x); }
+
+template <typename T>
+auto libdfp_strtod(const char* str) -> T;
+
+template <>
+auto libdfp_strtod<std::decimal::decimal64>(const char* str) -> std::decimal::decimal64 { return strtod64(str, nullptr); }
+
+template <>
+auto libdfp_strtod<std::decimal::decimal128>(const char* str) -> std::decimal::decimal128 { return strtod128(str, nullptr); }
+
+#endif // BOOST_DECIMAL_COMPARISON_LIBDFP
+
+// Arithmetic and conversions are provided by libgcc, libdfp adds the math and string functions
+template <typename T>
+struct gcc_backend
+{
+    using value_type = T;
+
+    #ifdef BOOST_DECIMAL_COMPARISON_LIBDFP
+    static constexpr const char* name {"GCC + libdfp"};
+    static constexpr bool has_from_string {true};
+    static constexpr bool has_cmath {true};
+    #else
+    static constexpr const char* name {"GCC builtins"};
+    static constexpr bool has_from_string {false};
+    static constexpr bool has_cmath {false};
+    #endif
+
+    static constexpr bool has_double_conversion {true};
+    static constexpr bool has_to_string {false};
+
+    static auto add(T a, T b) -> T { return a + b; }
+    static auto sub(T a, T b) -> T { return a - b; }
+    static auto mul(T a, T b) -> T { return a * b; }
+    static auto div(T a, T b) -> T { return a / b; }
+    static auto less(T a, T b) -> bool { return a < b; }
+    static auto equal(T a, T b) -> bool { return a == b; }
+
+    static auto from_double(double x) -> T { return T{x}; }
+    static auto to_double(T x) -> double { return std::decimal::decimal_to_double(x); }
+
+    #ifdef BOOST_DECIMAL_COMPARISON_LIBDFP
+    static auto from_string(const char* str) -> T { return libdfp_strtod<T>(str); }
+    static auto sqrt(T x) -> T { return libdfp_sqrt(x.__getval()); }
+    static auto exp(T x) -> T { return libdfp_exp(x.__getval()); }
+    static auto log(T x) -> T { return libdfp_log(x.__getval()); }
+    #endif
+};
+
+#endif // BOOST_DECIMAL_COMPARISON_GCC
+
+#ifdef BOOST_DECIMAL_COMPARISON_INTEL_BID
+
+// The library is assumed to be built with its default configuration,
+// i.e. arguments are passed by value with per-call rounding modes and status flags
+struct bid64_backend
+{
+    using value_type = BID_UINT64;
+    static constexpr const char* name {"Intel BID"};
+    static constexpr bool has_double_conversion {true};
+    static constexpr bool has_from_string {true};
+    static constexpr bool has_to_string {true};
+    static constexpr bool has_cmath {true};
+
+    static auto add(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid64_add(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto sub(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid64_sub(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto mul(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid64_mul(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto div(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid64_div(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto less(value_type a, value_type b) -> bool { _IDEC_flags f {}; return bid64_quiet_less(a, b, &f) != 0; }
+    static auto equal(value_type a, value_type b) -> bool { _IDEC_flags f {}; return bid64_quiet_equal(a, b, &f) != 0; }
+
+    static auto from_double(double x) -> value_type { _IDEC_flags f {}; return binary64_to_bid64(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto to_double(value_type x) -> double { _IDEC_flags f {}; return bid64_to_binary64(x, BID_ROUNDING_TO_NEAREST, &f); }
+
+    static auto from_string(const char* str) -> value_type
+    {
+        _IDEC_flags f {};
+        return bid64_from_string(const_cast<char*>(str), BID_ROUNDING_TO_NEAREST, &f);
+    }
+
+    static auto to_string(char* buffer, std::size_t, value_type x) -> void
+    {
+        _IDEC_flags f {};
+        bid64_to_string(buffer, x, &f);
+    }
+
+    static auto sqrt(value_type x) -> value_type { _IDEC_flags f {}; return bid64_sqrt(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto exp(value_type x) -> value_type { _IDEC_flags f {}; return bid64_exp(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto log(value_type x) -> value_type { _IDEC_flags f {}; return bid64_log(x, BID_ROUNDING_TO_NEAREST, &f); }
+};
+
+struct bid128_backend
+{
+    using value_type = BID_UINT128;
+    static constexpr const char* name {"Intel BID"};
+    static constexpr bool has_double_conversion {true};
+    static constexpr bool has_from_string {true};
+    static constexpr bool has_to_string {true};
+    static constexpr bool has_cmath {true};
+
+    static auto add(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid128_add(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto sub(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid128_sub(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto mul(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid128_mul(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto div(value_type a, value_type b) -> value_type { _IDEC_flags f {}; return bid128_div(a, b, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto less(value_type a, value_type b) -> bool { _IDEC_flags f {}; return bid128_quiet_less(a, b, &f) != 0; }
+    static auto equal(value_type a, value_type b) -> bool { _IDEC_flags f {}; return bid128_quiet_equal(a, b, &f) != 0; }
+
+    static auto from_double(double x) -> value_type { _IDEC_flags f {}; return binary64_to_bid128(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto to_double(value_type x) -> double { _IDEC_flags f {}; return bid128_to_binary64(x, BID_ROUNDING_TO_NEAREST, &f); }
+
+    static auto from_string(const char* str) -> value_type
+    {
+        _IDEC_flags f {};
+        return bid128_from_string(const_cast<char*>(str), BID_ROUNDING_TO_NEAREST, &f);
+    }
+
+    static auto to_string(char* buffer, std::size_t, value_type x) -> void
+    {
+        _IDEC_flags f {};
+        bid128_to_string(buffer, x, &f);
+    }
+
+    static auto sqrt(value_type x) -> value_type { _IDEC_flags f {}; return bid128_sqrt(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto exp(value_type x) -> value_type { _IDEC_flags f {}; return bid128_exp(x, BID_ROUNDING_TO_NEAREST, &f); }
+    static auto log(value_type x) -> value_type { _IDEC_flags f {}; return bid128_log(x, BID_ROUNDING_TO_NEAREST, &f); }
+};
+
+#endif // BOOST_DECIMAL_COMPARISON_INTEL_BID
+
+#ifdef BOOST_DECIMAL_COMPARISON_DECNUMBER
+
+// decNumber has no conversions to and from binary floating point,
+// and its math functions operate on the arbitrary precision decNumber type,
+// so the cmath workloads include the conversions to and from decNumber
+template <typename T>
+struct decnumber_traits;
+
+template <>
+struct decnumber_traits<decDouble>
+{
+    static constexpr int kind {DEC_INIT_DECIMAL64};
+    static auto add(decDouble* r, const decDouble* a, const decDouble* b, decContext* c) -> void { decDoubleAdd(r, a, b, c); }
+    static auto sub(decDouble* r, const decDouble* a, const decDouble* b, decContext* c) -> void { decDoubleSubtract(r, a, b, c); }
+    static auto mul(decDouble* r, const decDouble* a, const decDouble* b, decContext* c) -> void { decDoubleMultiply(r, a, b, c); }
+    static auto div(decDouble* r, const decDouble* a, const decDouble* b, decContext* c) -> void { decDoubleDivide(r, a, b, c); }
+    static auto compare(decDouble* r, const decDouble* a, const decDouble* b, decContext* c) -> void { decDoubleCompare(r, a, b, c); }
+    static auto is_negative(const decDouble* a) -> bool { return decDoubleIsNegative(a) != 0; }
+    static auto is_zero(const decDouble* a) -> bool { return decDoubleIsZero(a) != 0; }
+    static auto from_string(decDouble* r, const char* str, decContext* c) -> void { decDoubleFromString(r, str, c); }
+    static auto to_string(const decDouble* a, char* str) -> void { decDoubleToString(a, str); }
+    static auto to_number(const decDouble* a, decNumber* n) -> void { decDoubleToNumber(a, n); }
+    static auto from_number(decDouble* r, const decNumber* n, decContext* c) -> void { decDoubleFromNumber(r, n, c); }
+};
+
+template <>
+struct decnumber_traits<decQuad>
+{
+    static constexpr int kind {DEC_INIT_DECIMAL128};
+    static auto add(decQuad* r, const decQuad* a, const decQuad* b, decContext* c) -> void { decQuadAdd(r, a, b, c); }
+    static auto sub(decQuad* r, const decQuad* a, const decQuad* b, decContext* c) -> void { decQuadSubtract(r, a, b, c); }
+    static auto mul(decQuad* r, const decQuad* a, const decQuad* b, decContext* c) -> void { decQuadMultiply(r, a, b, c); }
+    static auto div(decQuad* r, const decQuad* a, const decQuad* b, decContext* c) -> void { decQuadDivide(r, a, b, c); }
+    static auto compare(decQuad* r, const decQuad* a, const decQuad* b, decContext* c) -> void { decQuadCompare(r, a, b, c); }
+    static auto is_negative(const decQuad* a) -> bool { return decQuadIsNegative(a) != 0; }
+    static auto is_zero(const decQuad* a) -> bool { return decQuadIsZero(a) != 0; }
+    static auto from_string(decQuad* r, const char* str, decContext* c) -> void { decQuadFromString(r, str, c); }
+    static auto to_string(const decQuad* a, char* str) -> void { decQuadToString(a, str); }
+    static auto to_number(const decQuad* a, decNumber* n) -> void { decQuadToNumber(a, n); }
+    static auto from_number(decQuad* r, const decNumber* n, decContext* c) -> void { decQuadFromNumber(r, n, c); }
+};
+
+template <typename T>
+struct decnumber_backend
+{
+    using value_type = T;
+    using traits = decnumber_traits<T>;
+    static constexpr const char* name {"decNumber"};
+    static constexpr bool has_double_conversion {false};
+    static constexpr bool has_from_string {true};
+    static constexpr bool has_to_string {true};
+    static constexpr bool has_cmath {true};
+
+    static auto context() -> decContext*
+    {
+        static decContext ctx {[]
+        {
+            decContext c;
+            decContextDefault(&c, traits::kind);
+            return c;
+        }()};
+        return &ctx;
+    }
+
+    template <typename Func>
+    static auto binary(T a, T b, Func func) -> T
+    {
+        T r;
+        func(&r, &a, &b, context());
+        return r;
+    }
+
+    static auto add(T a, T b) -> T { return binary(a, b, traits::add); }
+    static auto sub(T a, T b) -> T { return binary(a, b, traits::sub); }
+    static auto mul(T a, T b) -> T { return binary(a, b, traits::mul); }
+    static auto div(T a, T b) -> T { return binary(a, b, traits::div); }
+    static auto less(T a, T b) -> bool { const auto r {binary(a, b, traits::compare)}; return traits::is_negative(&r); }
+    static auto equal(T a, T b) -> bool { const auto r {binary(a, b, traits::compare)}; return traits::is_zero(&r); }
+
+    static auto from_string(const char* str) -> T
+    {
+        T r;
+        traits::from_string(&r, str, context());
+        return r;
+    }
+
+    static auto to_string(char* buffer, std::size_t, T x) -> void
+    {
+        traits::to_string(&x, buffer);
+    }
+
+    template <typename Func>
+    static auto unary_number(T x, Func func) -> T
+    {
+        decNumber n;
+        decNumber res;
+        traits::to_number(&x, &n);
+        func(&res, &n, context());
+        T r;
+        traits::from_number(&r, &res, context());
+        return r;
+    }
+
+    static auto sqrt(T x) -> T { return unary_number(x, decNumberSquareRoot); }
+    static auto exp(T x) -> T { return unary_number(x, decNumberExp); }
+    static auto log(T x) -> T { return unary_number(x, decNumberLn); }
+};
+
+#endif // BOOST_DECIMAL_COMPARISON_DECNUMBER
+
+enum class workload
+{
+    add,
+    subtract,
+    multiply,
+    divide,
+    compare,
+    from_double,
+    to_double,
+    from_string,
+    to_string,
+    sqrt,
+    exp,
+    log
+};
+
+constexpr workload all_workloads[] {
+    workload::add, workload::subtract, workload::multiply, workload::divide, workload::compare,
+    workload::from_double, workload::to_double, workload::from_string, workload::to_string,
+    workload::sqrt, workload::exp, workload::log
+};
+
+constexpr auto workload_name(workload w) noexcept -> const char*
+{
+    switch (w)
+    {
+        case workload::add: return "add";
+        case workload::subtract: return "subtract";
+        case workload::multiply: return "multiply";
+        case workload::divide: return "divide";
+        case workload::compare: return "compare";
+        case workload::from_double: return "from_double";
+        case workload::to_double: return "to_double";
+        case workload::from_string: return "from_string";
+        case workload::to_string: return "to_string";
+        case workload::sqrt: return "sqrt";
+        case workload::exp: return "exp";
+        case workload::log: return "log";
+    }
+
+    return "";
+}
+
+// The inputs are the same for every backend: values in [1, 10) so that
+// division, sqrt, and log are well-defined, and exp does not overflow
+struct input_data
+{
+    std::vector<double> values;
+    std::vector<std::string> strings;
+};
+
+auto make_input(int digits) -> input_data
+{
+    input_data input;
+    input.values.reserve(comparison_size);
+    input.strings.reserve(comparison_size);
+
+    std::mt19937_64 gen(42U);
+    std::uniform_real_distribution<double> dis(1, 10);
+    char buffer[64];
+    while (input.values.size() < comparison_size)
+    {
+        const auto val {dis(gen)};
+        input.values.emplace_back(val);
+        std::snprintf(buffer, sizeof(buffer), "%.*g", digits, val);
+        input.strings.emplace_back(buffer);
+    }
+
+    return input;
+}
+
+template <typename Backend>
+auto convert_input(const input_data& input) -> std::vector<typename Backend::value_type>
+{
+    std::vector<typename Backend::value_type> data;
+    data.reserve(input.values.size());
+    for (std::size_t i {}; i < input.values.size(); ++i)
+    {
+        if constexpr (Backend::has_double_conversion)
+        {
+            data.emplace_back(Backend::from_double(input.values[i]));
+        }
+        else
+        {
+            data.emplace_back(Backend::from_string(input.strings[i].c_str()));
+        }
+    }
+
+    return data;
+}
+
+template <typename Backend>
+constexpr auto supports(workload w) noexcept -> bool
+{
+    switch (w)
+    {
+        case workload::from_double:
+        case workload::to_double:
+            return Backend::has_double_conversion;
+        case workload::from_string:
+            return Backend::has_from_string;
+        case workload::to_string:
+            return Backend::has_to_string;
+        case workload::sqrt:
+        case workload::exp:
+        case workload::log:
+            return Backend::has_cmath;
+        default:
+            return true;
+    }
+}
+
+// Runs a single pass over the data set
+template <typename Backend, workload W>
+auto run_once(const std::vector<typename Backend::value_type>& data, const input_data& input) -> void
+{
+    const auto n {data.size()};
+
+    if constexpr (W == workload::add)
+    {
+        for (std::size_t i {}; i < n - 1; ++i) { benchmark::DoNotOptimize(Backend::add(data[i], data[i + 1])); }
+    }
+    else if constexpr (W == workload::subtract)
+    {
+        for (std::size_t i {}; i < n - 1; ++i) { benchmark::DoNotOptimize(Backend::sub(data[i], data[i + 1])); }
+    }
+    else if constexpr (W == workload::multiply)
+    {
+        for (std::size_t i {}; i < n - 1; ++i) { benchmark::DoNotOptimize(Backend::mul(data[i], data[i + 1])); }
+    }
+    else if constexpr (W == workload::divide)
+    {
+        for (std::size_t i {}; i < n - 1; ++i) { benchmark::DoNotOptimize(Backend::div(data[i], data[i + 1])); }
+    }
+    else if constexpr (W == workload::compare)
+    {
+        for (std::size_t i {}; i < n - 1; ++i)
+        {
+            benchmark::DoNotOptimize(Backend::less(data[i], data[i + 1]));
+            benchmark::DoNotOptimize(Backend::equal(data[i], data[i + 1]));
+        }
+    }
+    else if constexpr (W == workload::from_double)
+    {
+        for (const auto val : input.values) { benchmark::DoNotOptimize(Backend::from_double(val)); }
+    }
+    else if constexpr (W == workload::to_double)
+    {
+        for (const auto& val : data) { benchmark::DoNotOptimize(Backend::to_double(val)); }
+    }
+    else if constexpr (W == workload::from_string)
+    {
+        for (const auto& str : input.strings) { benchmark::DoNotOptimize(Backend::from_string(str.c_str())); }
+    }
+    else if constexpr (W == workload::to_string)
+    {
+        char buffer[128];
+        for (const auto& val : data)
+        {
+            Backend::to_string(buffer, sizeof(buffer), val);
+            benchmark::DoNotOptimize(buffer);
+            benchmark::ClobberMemory();
+        }
+    }
+    else if constexpr (W == workload::sqrt)
+    {
+        for (const auto& val : data) { benchmark::DoNotOptimize(Backend::sqrt(val)); }
+    }
+    else if constexpr (W == workload::exp)
+    {
+        for (const auto& val : data) { benchmark::DoNotOptimize(Backend::exp(val)); }
+    }
+    else if constexpr (W == workload::log)
+    {
+        for (const auto& val : data) { benchmark::DoNotOptimize(Backend::log(val)); }
+    }
+}
+
+// Returns the throughput in millions of operations per second of the fastest repetition
+template <typename Backend, workload W>
+auto measure(const std::vector<typename Backend::value_type>& data, const input_data& input) -> double
+{
+    using clock = std::chrono::steady_clock;
+
+    // Warm up the caches and branch predictors
+    run_once<Backend, W>(data, input);
+
+    auto best {clock::duration::max()};
+    for (int rep {}; rep < comparison_repetitions; ++rep)
+    {
+        const auto start {clock::now()};
+        run_once<Backend, W>(data, input);
+        best = std::min(best, clock::now() - start);
+    }
+
+    const auto ns {std::chrono::duration<double, std::nano>(best).count()};
+    return static_cast<double>(data.size()) / ns * 1000.0;
+}
+
+// Unsupported workloads are reported as a negative throughput
+template <typename Backend, workload W>
+auto measure_if_supported(const std::vector<typename Backend::value_type>& data, const input_data& input) -> double
+{
+    if constexpr (supports<Backend>(W))
+    {
+        return measure<Backend, W>(data, input);
+    }
+    else
+    {
+        static_cast<void>(data);
+        static_cast<void>(input);
+        return -1.0;
+    }
+}
+
+template <typename Backend, std::size_t... I>
+auto measure_all(const input_data& input, std::index_sequence<I...>) -> std::vector<double>
+{
+    const auto data {convert_input<Backend>(input)};
+    return {measure_if_supported<Backend, all_workloads[I]>(data, input)...};
+}
+
+struct column
+{
+    const char* name;
+    std::vector<double> results;
+};
+
+template <typename... Backends>
+auto run_comparison(const char* title, int digits) -> void
+{
+    const auto input {make_input(digits)};
+    const auto indices {std::make_index_sequence<sizeof(all_workloads) / sizeof(all_workloads[0])>{}};
+    const std::vector<column> columns {{Backends::name, measure_all<Backends>(input, indices)}...};
+
+    std::printf("\n%s: throughput in millions of operations per second (higher is better)\n\n", title);
+    std::printf("%-14s", "workload");
+    for (const auto& col : columns)
+    {
+        std::printf("%16s", col.name);
+    }
+    std::printf("\n");
+
+    for (std::size_t i {}; i < sizeof(all_workloads) / sizeof(all_workloads[0]); ++i)
+    {
+        std::printf("%-14s", workload_name(all_workloads[i]));
+        for (const auto& col : columns)
+        {
+            if (col.results[i] < 0)
+            {
+                std::printf("%16s", "-");
+            }
+            else
+            {
+                std::printf("%16.2f", col.results[i]);
+            }
+        }
+        std::printf("\n");
+    }
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("Comparing Boost.Decimal with:");
+    #ifdef BOOST_DECIMAL_COMPARISON_GCC
+    #  ifdef BOOST_DECIMAL_COMPARISON_LIBDFP
+    std::printf(" [GCC decimal builtins with libdfp]");
+    #  else
+    std::printf(" [GCC decimal builtins]");
+    #  endif
+    #endif
+    #ifdef BOOST_DECIMAL_COMPARISON_INTEL_BID
+    std::printf(" [Intel BID]");
+    #endif
+    #ifdef BOOST_DECIMAL_COMPARISON_DECNUMBER
+    std::printf(" [decNumber]");
+    #endif
+    std::printf("\n%zu elements per pass, fastest of %d passes\n", comparison_size, comparison_repetitions);
+
+    run_comparison<boost_backend<boost::decimal::decimal64>
+        #ifdef BOOST_DECIMAL_COMPARISON_GCC
+        , gcc_backend<std::decimal::decimal64>
+        #endif
+        #ifdef BOOST_DECIMAL_COMPARISON_INTEL_BID
+        , bid64_backend
+        #endif
+        #ifdef BOOST_DECIMAL_COMPARISON_DECNUMBER
+        , decnumber_backend<decDouble>
+        #endif
+        >("decimal64", 16);
+
+    run_comparison<boost_backend<boost::decimal::decimal128>
+        #ifdef BOOST_DECIMAL_COMPARISON_GCC
+        , gcc_backend<std::decimal::decimal128>
+        #endif
+        #ifdef BOOST_DECIMAL_COMPARISON_INTEL_BID
+        , bid128_backend
+        #endif
+        #ifdef BOOST_DECIMAL_COMPARISON_DECNUMBER
+        , decnumber_backend<decQuad>
+        #endif
+        >("decimal128", 17);
+
+    return 0;
+}
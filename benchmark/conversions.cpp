@@ -0,0 +1,318 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "benchmark_common.hpp"
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// Conversion from T to Target, e.g. decimal64 -> double (to_float) or decimal32 -> decimal128 (to_decimal).
+// For the binary floating point baselines this is the equivalent built-in conversion
+template <typename Target>
+struct to_type
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+
+            for (auto _ : state)
+            {
+                for (const auto val : data)
+                {
+                    auto res {static_cast<Target>(val)};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+// Construction of T from Source, with the source values converted from the data set before timing
+template <typename Source>
+struct from_type
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+
+            std::vector<Source> sources;
+            sources.reserve(data.size());
+            for (const auto val : data)
+            {
+                sources.emplace_back(static_cast<Source>(val));
+            }
+
+            for (auto _ : state)
+            {
+                for (const auto src : sources)
+                {
+                    auto res {static_cast<T>(src)};
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sources.size()));
+        }
+    };
+};
+
+template <typename Target, typename T, std::enable_if_t<std::is_integral<Target>::value, bool> = true>
+auto try_convert(T val) noexcept -> conversion_result<Target>
+{
+    return try_to_integral<Target>(val);
+}
+
+template <typename Target, typename T, std::enable_if_t<std::is_floating_point<Target>::value, bool> = true>
+auto try_convert(T val) noexcept -> conversion_result<Target>
+{
+    return try_to_float<Target>(val);
+}
+
+// Conversion of the whole data set into an array of Target in one loop, e.g. a column of a table.
+// The status API (try_to_integral and try_to_float) collects the failures in a flag that is checked once,
+// while the conversion operators (_errno) report them through errno. Its thread local stores
+// are side effects that keep the compiler from vectorizing or otherwise reordering the loop
+template <typename Target, bool Errno>
+struct to_array
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            const auto n {data.size()};
+            std::vector<Target> out(n);
+
+            for (auto _ : state)
+            {
+                bool failed {};
+                BOOST_DECIMAL_IF_CONSTEXPR (Errno)
+                {
+                    errno = 0;
+                    for (std::size_t i {}; i < n; ++i)
+                    {
+                        out[i] = static_cast<Target>(data[i]);
+                    }
+                    failed = errno != 0;
+                }
+                else
+                {
+                    for (std::size_t i {}; i < n; ++i)
+                    {
+                        const auto r {try_convert<Target>(data[i])};
+                        out[i] = r.value;
+                        failed |= r.ec != std::errc{};
+                    }
+                }
+
+                benchmark::DoNotOptimize(failed);
+                benchmark::DoNotOptimize(out.data());
+                benchmark::ClobberMemory();
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+        }
+    };
+};
+
+// Every value of the money data has an exponent of at least -4, and every value of the cents data an exponent of -2
+template <distribution Dist>
+constexpr int scaled_exponent {Dist == distribution::cents ? -2 : -4};
+
+// to_scaled_integer(val, exp) against the manual conversion through multiplication by 10^-exp and to_integral
+template <bool Manual>
+struct to_scaled
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            constexpr auto exp {scaled_exponent<Dist>};
+            const T scale {1, -exp};
+
+            for (auto _ : state)
+            {
+                for (const auto val : data)
+                {
+                    std::int64_t res {};
+                    BOOST_DECIMAL_IF_CONSTEXPR (Manual)
+                    {
+                        res = static_cast<std::int64_t>(val * scale);
+                    }
+                    else
+                    {
+                        res = to_scaled_integer(val, exp).value;
+                    }
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+// from_scaled_integer<T>(ticks, exp) against the constructor T{ticks, exp}
+template <bool Manual>
+struct from_scaled
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            constexpr auto exp {scaled_exponent<Dist>};
+
+            std::vector<std::int64_t> ticks;
+            ticks.reserve(data.size());
+            for (const auto val : data)
+            {
+                ticks.emplace_back(to_scaled_integer(val, exp).value);
+            }
+
+            for (auto _ : state)
+            {
+                for (const auto val : ticks)
+                {
+                    T res {};
+                    BOOST_DECIMAL_IF_CONSTEXPR (Manual)
+                    {
+                        res = T{val, exp};
+                    }
+                    else
+                    {
+                        res = from_scaled_integer<T>(val, exp);
+                    }
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ticks.size()));
+        }
+    };
+};
+
+// from_components_unchecked<T>(sig, exp, sign) against the constructor T{sig, exp, sign},
+// with the components of the data set taken apart before timing
+template <bool Checked>
+struct from_components
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        struct components
+        {
+            typename T::significand_type sig;
+            int exp;
+            bool sign;
+        };
+
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+
+            std::vector<components> parts;
+            parts.reserve(data.size());
+            for (const auto val : data)
+            {
+                int exp {};
+                const auto sig {frexp10(val, &exp)};
+                parts.push_back({sig, exp, signbit(val)});
+            }
+
+            for (auto _ : state)
+            {
+                for (const auto& part : parts)
+                {
+                    T res {};
+                    BOOST_DECIMAL_IF_CONSTEXPR (Checked)
+                    {
+                        res = T{part.sig, part.exp, part.sign};
+                    }
+                    else
+                    {
+                        res = from_components_unchecked<T>(part.sig, part.exp, part.sign);
+                    }
+                    benchmark::DoNotOptimize(res);
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(parts.size()));
+        }
+    };
+};
+
+template <template <typename, distribution> class Bench>
+auto register_scaled(const char* operation) -> void
+{
+    register_decimal_types<Bench, distribution::money>(operation);
+    register_decimal_types<Bench, distribution::cents>(operation);
+}
+
+// decimal32_fast does not yet provide conversions to the binary floating point types
+template <template <typename, distribution> class Bench>
+auto register_binary_float_conversion(const char* operation) -> void
+{
+    register_all_types_single<Bench, distribution::uniform, false>(operation);
+    register_all_types_single<Bench, distribution::bit_pattern, false>(operation);
+    register_all_types_single<Bench, distribution::money, false>(operation);
+}
+
+template <template <typename, distribution> class Bench>
+auto register_bounded(const char* operation) -> void
+{
+    register_all_types_single<Bench, distribution::uniform>(operation);
+    register_all_types_single<Bench, distribution::money>(operation);
+}
+
+const bool registered {[]
+{
+    register_binary_float_conversion<to_type<float>::bench>("to_float");
+    register_binary_float_conversion<to_type<double>::bench>("to_double");
+    register_binary_float_conversion<from_type<double>::bench>("from_double");
+
+    // Random bit patterns are almost always out of range of the integer types
+    // and values in [0, 1) truncate to zero, so only the money data is meaningful
+    register_all_types_single<to_type<long long>::bench, distribution::money>("to_integral");
+    register_all_types_single<from_type<long long>::bench, distribution::money>("from_integral");
+
+    register_decimal_types<to_array<long long, false>::bench, distribution::money>("try_to_integral_array");
+    register_decimal_types<to_array<long long, true>::bench, distribution::money>("to_integral_array_errno");
+    register_decimal_types<to_array<double, false>::bench, distribution::money, false>("try_to_double_array");
+    register_decimal_types<to_array<double, true>::bench, distribution::money, false>("to_double_array_errno");
+
+    register_bounded<to_type<decimal32>::bench>("to_decimal32");
+    register_bounded<to_type<decimal64>::bench>("to_decimal64");
+    register_bounded<to_type<decimal128>::bench>("to_decimal128");
+
+    register_scaled<to_scaled<false>::bench>("to_scaled_integer");
+    register_scaled<to_scaled<true>::bench>("to_scaled_integer_manual");
+    register_scaled<from_scaled<false>::bench>("from_scaled_integer");
+    register_scaled<from_scaled<true>::bench>("from_scaled_integer_manual");
+
+    register_scaled<from_components<false>::bench>("from_components_unchecked");
+    register_scaled<from_components<true>::bench>("from_components_checked");
+    return true;
+}()};
+
+} // namespace
@@ -0,0 +1,182 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "benchmark_common.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// Length modifiers of the <cstdio> style functions: H for decimal32, D for decimal64 and DD for decimal128
+template <typename T>
+constexpr auto length_modifier() noexcept -> const char*
+{
+    return std::is_floating_point<T>::value ? "" :
+           std::is_same<T, decimal128>::value ? "DD" :
+           std::is_same<T, decimal64>::value ? "D" : "H";
+}
+
+template <typename T>
+auto make_format(char conversion) -> std::string
+{
+    return std::string("%") + length_modifier<T>() + conversion;
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto generic_snprintf(char* buffer, std::size_t size, const char* format, T value) -> int
+{
+    return std::snprintf(buffer, size, format, static_cast<double>(value));
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto generic_snprintf(char* buffer, std::size_t size, const char* format, T value) -> int
+{
+    return boost::decimal::snprintf(buffer, size, format, value);
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>::value, bool> = true>
+auto generic_strtod(const char* str, char** endptr) -> T
+{
+    return std::is_same<T, float>::value ? static_cast<T>(std::strtof(str, endptr)) : static_cast<T>(std::strtod(str, endptr));
+}
+
+template <typename T, std::enable_if_t<!std::is_floating_point<T>::value, bool> = true>
+auto generic_strtod(const char* str, char** endptr) -> T
+{
+    return boost::decimal::strtod<T>(str, endptr);
+}
+
+// Strings in the general format are generated once, before timing
+template <typename T, distribution Dist>
+auto make_strings(const std::vector<T>& data) -> std::vector<std::string>
+{
+    std::vector<std::string> strings;
+    strings.reserve(data.size());
+    char buffer[256];
+    const auto format {make_format<T>('g')};
+    for (const auto val : data)
+    {
+        generic_snprintf(buffer, sizeof(buffer), format.c_str(), val);
+        strings.emplace_back(buffer);
+    }
+
+    return strings;
+}
+
+template <char Conversion>
+struct snprintf_bench
+{
+    template <typename T, distribution Dist>
+    struct bench
+    {
+        static void run(benchmark::State& state)
+        {
+            const auto& data {get_data<T, Dist>()};
+            const auto format {make_format<T>(Conversion)};
+            char buffer[256];
+
+            for (auto _ : state)
+            {
+                for (const auto val : data)
+                {
+                    auto r {generic_snprintf(buffer, sizeof(buffer), format.c_str(), val)};
+                    benchmark::DoNotOptimize(r);
+                    benchmark::ClobberMemory();
+                }
+            }
+
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+        }
+    };
+};
+
+template <typename T, distribution Dist>
+struct strtod_bench
+{
+    static void run(benchmark::State& state)
+    {
+        const auto strings {make_strings<T, Dist>(get_data<T, Dist>())};
+
+        for (auto _ : state)
+        {
+            for (const auto& str : strings)
+            {
+                char* endptr {};
+                auto val {generic_strtod<T>(str.c_str(), &endptr)};
+                benchmark::DoNotOptimize(val);
+                benchmark::DoNotOptimize(endptr);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings.size()));
+    }
+};
+
+// Stream insertion reuses a single stream so that the cost of constructing it is not measured
+template <typename T, distribution Dist>
+struct ostream_bench
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_data<T, Dist>()};
+        std::ostringstream os;
+
+        for (auto _ : state)
+        {
+            for (const auto val : data)
+            {
+                os.str(std::string{});
+                os << val;
+                benchmark::ClobberMemory();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+    }
+};
+
+template <typename T, distribution Dist>
+struct istream_bench
+{
+    static void run(benchmark::State& state)
+    {
+        const auto strings {make_strings<T, Dist>(get_data<T, Dist>())};
+        std::istringstream is;
+
+        for (auto _ : state)
+        {
+            for (const auto& str : strings)
+            {
+                is.clear();
+                is.str(str);
+                T val;
+                is >> val;
+                benchmark::DoNotOptimize(val);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings.size()));
+    }
+};
+
+const bool registered {[]
+{
+    register_all_types<snprintf_bench<'g'>::bench>("snprintf_general");
+    register_all_types<snprintf_bench<'e'>::bench>("snprintf_scientific");
+    register_all_types_single<snprintf_bench<'f'>::bench, distribution::uniform>("snprintf_fixed");
+    register_all_types_single<snprintf_bench<'f'>::bench, distribution::money>("snprintf_fixed");
+
+    register_all_types<strtod_bench>("strtod");
+    register_all_types<ostream_bench>("ostream");
+    register_all_types<istream_bench>("istream");
+    return true;
+}()};
+
+} // namespace
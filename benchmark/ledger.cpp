@@ -0,0 +1,164 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "benchmark_common.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace boost::decimal;
+using namespace boost::decimal::benchmark_detail;
+
+namespace {
+
+// Ledger workloads on amounts in cents, comparing three ways of keeping exactly 2 decimal places:
+// decimal64 as is, decimal64 quantized after every operation, and scaled_decimal
+
+using cents = scaled_decimal<std::int64_t, -2>;
+
+struct decimal64_plain
+{
+    using type = decimal64;
+    static constexpr const char* name {"decimal64"};
+
+    static auto round(decimal64 val) noexcept -> decimal64 { return val; }
+};
+
+struct decimal64_quantized
+{
+    using type = decimal64;
+    static constexpr const char* name {"decimal64_quantize"};
+
+    static auto round(decimal64 val) noexcept -> decimal64 { return quantize(val, decimal64{1, -2}); }
+};
+
+struct scaled_cents
+{
+    using type = cents;
+    static constexpr const char* name {"scaled_decimal64"};
+
+    static auto round(cents val) noexcept -> cents { return val; }
+};
+
+template <typename Policy>
+auto get_ledger_data() -> const std::vector<typename Policy::type>&
+{
+    static const std::vector<typename Policy::type> data {[]
+    {
+        std::vector<typename Policy::type> res;
+        for (const auto val : get_data<decimal64, distribution::cents>())
+        {
+            res.emplace_back(static_cast<typename Policy::type>(val));
+        }
+        return res;
+    }()};
+
+    return data;
+}
+
+// Running total of all the entries
+template <typename Policy>
+struct ledger_sum
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_ledger_data<Policy>()};
+
+        for (auto _ : state)
+        {
+            typename Policy::type s {};
+            for (const auto val : data)
+            {
+                s = Policy::round(s + val);
+            }
+            benchmark::DoNotOptimize(s);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+    }
+};
+
+// Counts the entries that are larger than the next one
+template <typename Policy>
+struct ledger_compare
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_ledger_data<Policy>()};
+
+        for (auto _ : state)
+        {
+            std::size_t s {};
+            for (std::size_t i {}; i < data.size() - 1U; ++i)
+            {
+                s += static_cast<std::size_t>(data[i] > data[i + 1U]);
+            }
+            benchmark::DoNotOptimize(s);
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size() - 1U));
+    }
+};
+
+// Price times a rate in cents, e.g. an amount times an exchange rate, rounded back to cents
+template <typename Policy>
+struct ledger_extend
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_ledger_data<Policy>()};
+
+        for (auto _ : state)
+        {
+            for (std::size_t i {}; i < data.size() - 1U; ++i)
+            {
+                auto res {Policy::round(data[i] * data[i + 1U])};
+                benchmark::DoNotOptimize(res);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size() - 1U));
+    }
+};
+
+// Splits every entry in three parts, rounded to cents
+template <typename Policy>
+struct ledger_split
+{
+    static void run(benchmark::State& state)
+    {
+        const auto& data {get_ledger_data<Policy>()};
+        const typename Policy::type parts {3};
+
+        for (auto _ : state)
+        {
+            for (const auto val : data)
+            {
+                auto res {Policy::round(val / parts)};
+                benchmark::DoNotOptimize(res);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(data.size()));
+    }
+};
+
+template <template <typename> class Bench>
+auto register_ledger(const char* operation) -> void
+{
+    const auto dist {distribution_name(distribution::cents)};
+    register_benchmark(operation, decimal64_plain::name, dist, Bench<decimal64_plain>::run);
+    register_benchmark(operation, decimal64_quantized::name, dist, Bench<decimal64_quantized>::run);
+    register_benchmark(operation, scaled_cents::name, dist, Bench<scaled_cents>::run);
+}
+
+const bool registered {[]
+{
+    register_ledger<ledger_sum>("ledger_sum");
+    register_ledger<ledger_compare>("ledger_compare");
+    register_ledger<ledger_extend>("ledger_extend");
+    register_ledger<ledger_split>("ledger_split");
+    return true;
+}()};
+
+} // namespace
@@ -28,6 +28,7 @@
 #include <boost/decimal/decimal32_fast.hpp>
 #include <boost/decimal/decimal64.hpp>
 #include <boost/decimal/decimal128.hpp>
+#include <boost/decimal/scaled_decimal.hpp>
 #include <boost/decimal/cmath.hpp>
 #include <boost/decimal/cstdlib.hpp>
 #include <boost/decimal/fenv.hpp>
@@ -38,6 +39,8 @@
 #include <boost/decimal/type_traits.hpp>
 #include <boost/decimal/detail/io.hpp>
 #include <boost/decimal/cstdio.hpp>
+#include <boost/decimal/instrumentation.hpp>
+#include <boost/decimal/detail/explicit_instantiations.hpp>
 
 #if defined(__clang__) && !defined(__GNUC__)
 #  pragma clang diagnostic pop
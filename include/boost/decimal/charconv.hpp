@@ -74,8 +74,8 @@ constexpr auto from_chars_general_impl(const char* first, const char* last, Targ
         }
         else
         {
+            // The status is only reported in r.ec, so errno is left alone as std::from_chars does
             value = std::numeric_limits<TargetDecimalType>::signaling_NaN();
-            errno = static_cast<int>(r.ec);
         }
     }
     else
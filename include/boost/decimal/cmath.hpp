@@ -48,6 +48,7 @@
 #include <boost/decimal/detail/cmath/rint.hpp>
 #include <boost/decimal/detail/cmath/round.hpp>
 #include <boost/decimal/detail/cmath/sin.hpp>
+#include <boost/decimal/detail/cmath/sincos.hpp>
 #include <boost/decimal/detail/cmath/sinh.hpp>
 #include <boost/decimal/detail/cmath/sqrt.hpp>
 #include <boost/decimal/detail/cmath/tan.hpp>
@@ -69,6 +70,8 @@
 #include <boost/decimal/detail/cmath/legendre.hpp>
 #include <boost/decimal/detail/cmath/assoc_legendre.hpp>
 #include <boost/decimal/detail/cmath/ellint_1.hpp>
+#include <boost/decimal/detail/cmath/normal.hpp>
+#include <boost/decimal/detail/cmath/batch.hpp>
 #include <boost/decimal/numbers.hpp>
 
 // Macros from 3.6.2
@@ -7,9 +7,11 @@
 
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/bit_cast.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/emulated128.hpp>
 #include <boost/decimal/detail/emulated256.hpp>
 #include <boost/decimal/detail/fenv_rounding.hpp>
@@ -23,6 +25,8 @@
 #include <boost/decimal/detail/comparison.hpp>
 #include <boost/decimal/detail/mixed_decimal_arithmetic.hpp>
 #include <boost/decimal/detail/to_integral.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/to_scaled_integer.hpp>
 #include <boost/decimal/detail/to_float.hpp>
 #include <boost/decimal/detail/to_decimal.hpp>
 #include <boost/decimal/detail/promotion.hpp>
@@ -167,20 +171,27 @@ private:
     constexpr auto edit_exponent(T exp) noexcept -> void;
     constexpr auto edit_sign(bool sign) noexcept -> void;
 
-    // Attempts conversion to integral type:
-    // If this is nan sets errno to EINVAL and returns 0
-    // If this is not representable sets errno to ERANGE and returns 0
-    template <typename Decimal, typename TargetType>
-    friend constexpr auto to_integral_128(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType);
+    // Sets all the bits from components that are known to be in range
+    constexpr auto pack_components(detail::uint128 sig, std::uint64_t biased_exp, bool sign) noexcept -> void;
 
-    template <typename Decimal, typename TargetType>
-    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_floating_point_v, TargetType, TargetType);
+    // Attempts conversion to integral type, reporting nan and values that are not representable in the result
+    template <typename TargetType, typename Decimal>
+    friend constexpr auto try_to_integral(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_integral_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
+
+    template <typename TargetType, typename Decimal>
+    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto try_to_float(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_floating_point_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetType, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
     friend constexpr auto to_decimal(Decimal val) noexcept -> TargetType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto to_scaled_integer(Decimal val, int exp) noexcept -> conversion_result<std::int64_t>;
+
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto from_components_unchecked(typename Decimal::significand_type sig, int exp, bool sign) noexcept -> Decimal;
+
     // Equality template between any integer type and decimal128
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal, BOOST_DECIMAL_INTEGRAL Integer>
     friend constexpr auto mixed_equality_impl(Decimal lhs, Integer rhs) noexcept
@@ -580,6 +591,9 @@ public:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
     friend constexpr auto frexp10(T num, int* expptr) noexcept -> typename T::significand_type;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+    friend constexpr auto rescale_finite_impl(T x, int exp) noexcept -> T;
+
     friend constexpr auto copysignd128(decimal128 mag, decimal128 sgn) noexcept -> decimal128;
     friend constexpr auto scalblnd128(decimal128 num, long exp) noexcept -> decimal128;
     friend constexpr auto scalbnd128(decimal128 num, int exp) noexcept -> decimal128;
@@ -701,6 +715,77 @@ constexpr auto decimal128::edit_sign(bool sign) noexcept -> void
 #  pragma GCC diagnostic ignored "-Wduplicated-branches"
 #endif
 
+// Packs a significand of at most precision_v<decimal128> digits and a biased exponent of at most d128_max_biased_exp,
+// which is the last step of every constructor, without any checks
+constexpr auto decimal128::pack_components(detail::uint128 sig, std::uint64_t biased_exp, bool sign) noexcept -> void
+{
+    bits_ = detail::uint128 {sign ? detail::d128_sign_mask.high : UINT64_C(0), UINT64_C(0)};
+    bool big_combination {false};
+
+    if (sig <= detail::d128_no_combination)
+    {
+        // If the coefficient fits directly we don't need to use the combination field
+        bits_ |= (sig & detail::d128_significand_mask);
+    }
+    else if (sig <= detail::d128_big_combination)
+    {
+        // Break the number into 3 bits for the combination field and 110 bits for the significand field
+
+        // Use the least significant 110 bits to set the significand
+        bits_ |= (sig & detail::d128_significand_mask);
+
+        // Now set the combination field (maximum of 3 bits)
+        auto remaining_bits {sig & detail::d128_small_combination_field_mask};
+        remaining_bits <<= detail::d128_exponent_bits;
+        bits_ |= remaining_bits;
+    }
+    else
+    {
+        // Have to use the full combination field
+        bits_ |= detail::d128_comb_11_mask;
+        big_combination = true;
+
+        bits_ |= (sig & detail::d128_significand_mask);
+        const auto remaining_bit {sig & detail::d128_big_combination_field_mask};
+
+        if (remaining_bit)
+        {
+            bits_ |= detail::d128_comb_11_significand_bits;
+        }
+    }
+
+    // If the exponent fits we do not need to use the combination field
+    const auto biased_exp_low_twelve_bits {detail::uint128(biased_exp & detail::d128_max_exp_no_combination) <<
+                                           detail::d128_significand_bits};
+
+    if (biased_exp <= detail::d128_max_exp_no_combination)
+    {
+        bits_ |= biased_exp_low_twelve_bits;
+    }
+    else if (biased_exp <= detail::d128_exp_one_combination)
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d128_comb_1101_mask | biased_exp_low_twelve_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d128_comb_01_mask | biased_exp_low_twelve_bits);
+        }
+    }
+    else
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d128_comb_1110_mask | biased_exp_low_twelve_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d128_comb_10_mask | biased_exp_low_twelve_bits);
+        }
+    }
+}
+
 // TODO(mborland): Rather than doing bitwise operations on the whole uint128 we should
 // be able to only operate on the affected word
 //
@@ -759,78 +844,23 @@ constexpr decimal128::decimal128(T1 coeff, T2 exp, bool sign) noexcept
     // Round as required
     if (reduced)
     {
+        BOOST_DECIMAL_INSTRUMENT(constructor_renormalizations);
+
         exp += detail::fenv_round<decimal128>(unsigned_coeff, isneg);
     }
 
     auto reduced_coeff {static_cast<detail::uint128>(unsigned_coeff)};
-    bool big_combination {false};
 
-    if (reduced_coeff == detail::uint128{0, 0})
+    if (reduced_coeff == 0)
     {
         exp = 0;
     }
-    else if (reduced_coeff <= detail::d128_no_combination)
-    {
-        // If the coefficient fits directly we don't need to use the combination field
-        bits_ |= (reduced_coeff & detail::d128_significand_mask);
-    }
-    else if (reduced_coeff <= detail::d128_big_combination)
-    {
-        // Break the number into 3 bits for the combination field and 110 bits for the significand field
-
-        // Use the least significant 110 bits to set the significand
-        bits_ |= (reduced_coeff & detail::d128_significand_mask);
-
-        // Now set the combination field (maximum of 3 bits)
-        auto remaining_bits {reduced_coeff & detail::d128_small_combination_field_mask};
-        remaining_bits <<= detail::d128_exponent_bits;
-        bits_ |= remaining_bits;
-    }
-    else
-    {
-        // Have to use the full combination field
-        bits_ |= detail::d128_comb_11_mask;
-        big_combination = true;
-
-        bits_ |= (reduced_coeff & detail::d128_significand_mask);
-        const auto remaining_bit {reduced_coeff & detail::d128_big_combination_field_mask};
-
-        if (remaining_bit)
-        {
-            bits_ |= detail::d128_comb_11_significand_bits;
-        }
-    }
 
-    // If the exponent fits we do not need to use the combination field
     auto biased_exp {static_cast<std::uint64_t>(exp + detail::bias_v<decimal128>)};
-    const auto biased_exp_low_twelve_bits {detail::uint128(biased_exp & detail::d128_max_exp_no_combination) <<
-                                           detail::d128_significand_bits};
 
-    if (biased_exp <= detail::d128_max_exp_no_combination)
-    {
-        bits_ |= biased_exp_low_twelve_bits;
-    }
-    else if (biased_exp <= detail::d128_exp_one_combination)
-    {
-        if (big_combination)
-        {
-            bits_ |= (detail::d128_comb_1101_mask | biased_exp_low_twelve_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d128_comb_01_mask | biased_exp_low_twelve_bits);
-        }
-    }
-    else if (biased_exp <= detail::d128_max_biased_exp)
+    if (biased_exp <= detail::d128_max_biased_exp)
     {
-        if (big_combination)
-        {
-            bits_ |= (detail::d128_comb_1110_mask | biased_exp_low_twelve_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d128_comb_10_mask | biased_exp_low_twelve_bits);
-        }
+        pack_components(reduced_coeff, biased_exp, isneg);
     }
     else
     {
@@ -1109,17 +1139,35 @@ constexpr auto signbit BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal128 rhs)
 
 constexpr auto isnan BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal128 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_.high & detail::d128_nan_mask.high) == detail::d128_nan_mask.high;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_.high & detail::d128_nan_mask.high) != detail::d128_nan_mask.high, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isinf BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal128 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return ((rhs.bits_.high & detail::d128_nan_mask.high) == detail::d128_inf_mask.high);
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_.high & detail::d128_nan_mask.high) != detail::d128_inf_mask.high, "An infinity with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto issignaling BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal128 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_.high & detail::d128_snan_mask.high) == detail::d128_snan_mask.high;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_.high & detail::d128_snan_mask.high) != detail::d128_snan_mask.high, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isnormal BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal128 rhs) noexcept -> bool
@@ -1156,6 +1204,12 @@ constexpr auto operator==(decimal128 lhs, decimal128 rhs) noexcept -> bool
         return false;
     }
 
+    // Identical encodings are equal without decoding them
+    if (lhs.bits_ == rhs.bits_)
+    {
+        return true;
+    }
+
     return equal_parts_impl<decimal128>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
                                         rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
@@ -1428,6 +1482,11 @@ constexpr auto d128_add_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
 
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
 
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
+
     if (delta_exp > detail::precision_v<decimal128> + 1)
     {
         // If the difference in exponents is more than the digits of accuracy
@@ -1511,14 +1570,22 @@ constexpr auto d128_sub_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
 {
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
 
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
+
     if (delta_exp > detail::precision_v<decimal128> + 1)
     {
         // If the difference in exponents is more than the digits of accuracy
         // we return the larger of the two
         //
         // e.g. 1e20 - 1e-20 = 1e20
-        return abs_lhs_bigger ? detail::decimal128_components{detail::shrink_significand<detail::uint128>(lhs_sig, lhs_exp), lhs_exp, false} :
-                                detail::decimal128_components{detail::shrink_significand<detail::uint128>(rhs_sig, rhs_exp), rhs_exp, true};
+        //
+        // The larger keeps its own sign, unless it is rhs of a subtraction,
+        // which is every case but a positive lhs and a negative rhs (the addition of the two)
+        return abs_lhs_bigger ? detail::decimal128_components{detail::shrink_significand<detail::uint128>(lhs_sig, lhs_exp), lhs_exp, lhs_sign} :
+                                detail::decimal128_components{detail::shrink_significand<detail::uint128>(rhs_sig, rhs_exp), rhs_exp, !(lhs_sign && rhs_sign)};
     }
 
     // The two numbers can be subtracted together without special handling
@@ -1591,7 +1658,7 @@ constexpr auto d128_mul_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
     if (sig_dig > std::numeric_limits<detail::uint128>::digits10)
     {
         const auto digit_delta {sig_dig - std::numeric_limits<detail::uint128>::digits10};
-        res_sig /= detail::uint256_t(pow10(detail::uint128(digit_delta)));
+        res_sig = detail::div_pow10(res_sig, digit_delta);
         res_exp += digit_delta;
     }
 
@@ -1608,7 +1675,7 @@ constexpr auto d128_generic_div_impl(detail::decimal128_components lhs, detail::
 {
     bool sign {lhs.sign != rhs.sign};
 
-    const auto big_sig_lhs {detail::uint256_t(lhs.sig) * detail::uint256_t(pow10(detail::uint128(detail::precision_v<decimal128>)))};
+    const auto big_sig_lhs {detail::umul256(lhs.sig, detail::powers_of_10_u128[detail::precision_v<decimal128>])};
     lhs.exp -= detail::precision_v<decimal128>;
 
     auto res_sig {big_sig_lhs / detail::uint256_t(rhs.sig)};
@@ -1619,7 +1686,7 @@ constexpr auto d128_generic_div_impl(detail::decimal128_components lhs, detail::
     if (sig_dig > std::numeric_limits<detail::uint128>::digits10)
     {
         const auto digit_delta {sig_dig - std::numeric_limits<detail::uint128>::digits10};
-        res_sig /= detail::uint256_t(pow10(detail::uint128(digit_delta)));
+        res_sig = detail::div_pow10(res_sig, digit_delta);
         res_exp += digit_delta;
     }
 
@@ -1725,6 +1792,18 @@ constexpr auto operator+(decimal128 lhs, decimal128 rhs) noexcept -> decimal128
         return res;
     }
 
+    // Operands with the same exponent, such as amounts in cents,
+    // add as integers as long as the exact sum fits in the precision
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal128>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                     rhs.full_significand(), rhs.biased_exponent(), rhs.isneg(),
+                                                     res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign};
+    }
+
     bool lhs_bigger {lhs > rhs};
     if (lhs.isneg() && rhs.isneg())
     {
@@ -1839,6 +1918,17 @@ constexpr auto operator-(decimal128 lhs, decimal128 rhs) noexcept -> decimal128
         return res;
     }
 
+    // As in operator+, except that the difference of two zeros is +0 as on the general path
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal128>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                     rhs.full_significand(), rhs.biased_exponent(), !rhs.isneg(),
+                                                     res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign && res_sig != 0U};
+    }
+
     if (!lhs.isneg() && rhs.isneg())
     {
         return lhs + (-rhs);
@@ -2081,7 +2171,11 @@ constexpr auto operator/(Integer lhs, decimal128 rhs) noexcept
     auto rhs_exp {rhs.biased_exponent()};
     detail::normalize<decimal128>(rhs_sig, rhs_exp);
 
-    detail::decimal128_components lhs_components {detail::make_positive_unsigned(lhs), 0, lhs < 0};
+    std::int32_t lhs_exp {};
+    auto lhs_sig {detail::shrink_significand<detail::uint128>(lhs, lhs_exp)};
+    detail::normalize<decimal128>(lhs_sig, lhs_exp);
+
+    detail::decimal128_components lhs_components {lhs_sig, lhs_exp, lhs < 0};
     detail::decimal128_components rhs_components {rhs_sig, rhs_exp, rhs.isneg()};
     detail::decimal128_components q_components {};
 
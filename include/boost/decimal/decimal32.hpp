@@ -22,6 +22,8 @@
 #include <boost/decimal/detail/comparison.hpp>
 #include <boost/decimal/detail/mixed_decimal_arithmetic.hpp>
 #include <boost/decimal/detail/to_integral.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/to_scaled_integer.hpp>
 #include <boost/decimal/detail/to_float.hpp>
 #include <boost/decimal/detail/to_decimal.hpp>
 #include <boost/decimal/detail/promotion.hpp>
@@ -157,20 +159,24 @@ private:
     constexpr auto full_significand() const noexcept -> std::uint32_t;
     constexpr auto isneg() const noexcept -> bool;
 
-    // Attempts conversion to integral type:
-    // If this is nan sets errno to EINVAL and returns 0
-    // If this is not representable sets errno to ERANGE and returns 0
-    template <typename Decimal, typename TargetType>
-    friend constexpr auto to_integral(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType);
+    // Attempts conversion to integral type, reporting nan and values that are not representable in the result
+    template <typename TargetType, typename Decimal>
+    friend constexpr auto try_to_integral(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_integral_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
 
-    template <typename Decimal, typename TargetType>
-    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_floating_point_v, TargetType, TargetType);
+    template <typename TargetType, typename Decimal>
+    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto try_to_float(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_floating_point_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetType, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
     friend constexpr auto to_decimal(Decimal val) noexcept -> TargetType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto to_scaled_integer(Decimal val, int exp) noexcept -> conversion_result<std::int64_t>;
+
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto from_components_unchecked(typename Decimal::significand_type sig, int exp, bool sign) noexcept -> Decimal;
+
     friend constexpr auto div_impl(decimal32 lhs, decimal32 rhs, decimal32& q, decimal32& r) noexcept -> void;
     friend constexpr auto mod_impl(decimal32 lhs, decimal32 rhs, const decimal32& q, decimal32& r) noexcept -> void;
 
@@ -557,6 +563,9 @@ public:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
     friend constexpr auto frexp10(T num, int* expptr) noexcept -> typename T::significand_type;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+    friend constexpr auto rescale_finite_impl(T x, int exp) noexcept -> T;
+
     friend constexpr auto scalbnd32(decimal32 num, int exp) noexcept -> decimal32;
     friend constexpr auto scalblnd32(decimal32 num, long exp) noexcept -> decimal32;
 
@@ -576,6 +585,9 @@ private:
 
     // Replaces the current sign with the one provided
     constexpr auto edit_sign(bool sign) noexcept -> void;
+
+    // Sets all the bits from components that are known to be in range
+    constexpr auto pack_components(std::uint32_t sig, std::uint32_t biased_exp, bool sign) noexcept -> void;
 };
 
 #if defined(__GNUC__) && __GNUC__ >= 8
@@ -587,6 +599,84 @@ private:
 #  pragma GCC diagnostic ignored "-Wduplicated-branches"
 #endif
 
+// Packs a significand of at most precision_v<decimal32> digits and a biased exponent of at most d32_max_biased_exp,
+// which is the last step of every constructor, without any checks
+constexpr auto decimal32::pack_components(std::uint32_t sig, std::uint32_t biased_exp, bool sign) noexcept -> void
+{
+    bits_ = sign ? detail::d32_sign_mask : UINT32_C(0);
+    bool big_combination {false};
+
+    if (sig <= detail::d32_no_combination)
+    {
+        // If the coefficient fits directly we don't need to use the combination field
+        // bits_.significand = sig;
+        bits_ |= (sig & detail::d32_significand_mask);
+    }
+    else if (sig <= detail::d32_big_combination)
+    {
+        // Break the number into 3 bits for the combination field and 20 bits for the significand field
+
+        // Use the least significant 20 bits to set the significand
+        bits_ |= (sig & detail::d32_significand_mask);
+
+        // Now set the combination field (maximum of 3 bits)
+        std::uint32_t remaining_bits {sig & detail::d32_small_combination_field_mask};
+        remaining_bits <<= detail::d32_exponent_bits;
+        bits_ |= remaining_bits;
+    }
+    else
+    {
+        // Have to use the full combination field
+        bits_ |= detail::d32_comb_11_mask;
+        big_combination = true;
+
+        bits_ |= (sig & detail::d32_significand_mask);
+        const auto remaining_bit {sig & detail::d32_big_combination_field_mask};
+
+        if (remaining_bit)
+        {
+            bits_ |= detail::d32_comb_11_significand_bits;
+        }
+    }
+
+    // If the exponent fits we do not need to use the combination field
+    const std::uint32_t biased_exp_low_six_bits {(biased_exp & detail::d32_max_exp_no_combination) << detail::d32_significand_bits};
+
+    #ifdef BOOST_DECIMAL_DEBUG_D32_CONSTRUCTOR
+    if (biased_exp_low_six_bits > 0b111111'0000000000'0000000000)
+    {
+        return;
+    }
+    #endif
+
+    if (biased_exp <= detail::d32_max_exp_no_combination)
+    {
+        bits_ |= biased_exp_low_six_bits;
+    }
+    else if (biased_exp <= detail::d32_exp_one_combination)
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d32_comb_1101_mask | biased_exp_low_six_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d32_comb_01_mask | biased_exp_low_six_bits);
+        }
+    }
+    else
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d32_comb_1110_mask | biased_exp_low_six_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d32_comb_10_mask | biased_exp_low_six_bits);
+        }
+    }
+}
+
 #ifdef BOOST_DECIMAL_HAS_CONCEPTS
 template <BOOST_DECIMAL_INTEGRAL T, BOOST_DECIMAL_INTEGRAL T2>
 #else
@@ -644,85 +734,23 @@ constexpr decimal32::decimal32(T coeff, T2 exp, bool sign) noexcept // NOLINT(re
     // Round as required
     if (reduced)
     {
+        BOOST_DECIMAL_INSTRUMENT(constructor_renormalizations);
+
         exp += static_cast<T2>(detail::fenv_round(unsigned_coeff, isneg));
     }
 
     auto reduced_coeff {static_cast<std::uint32_t>(unsigned_coeff)};
-    bool big_combination {false};
 
     if (reduced_coeff == 0)
     {
         exp = 0;
     }
-    else if (reduced_coeff <= detail::d32_no_combination)
-    {
-        // If the coefficient fits directly we don't need to use the combination field
-        // bits_.significand = reduced_coeff;
-        bits_ |= (reduced_coeff & detail::d32_significand_mask);
-    }
-    else if (reduced_coeff <= detail::d32_big_combination)
-    {
-        // Break the number into 3 bits for the combination field and 20 bits for the significand field
-
-        // Use the least significant 20 bits to set the significand
-        bits_ |= (reduced_coeff & detail::d32_significand_mask);
-
-        // Now set the combination field (maximum of 3 bits)
-        std::uint32_t remaining_bits {reduced_coeff & detail::d32_small_combination_field_mask};
-        remaining_bits <<= detail::d32_exponent_bits;
-        bits_ |= remaining_bits;
-    }
-    else
-    {
-        // Have to use the full combination field
-        bits_ |= detail::d32_comb_11_mask;
-        big_combination = true;
-
-        bits_ |= (reduced_coeff & detail::d32_significand_mask);
-        const auto remaining_bit {reduced_coeff & detail::d32_big_combination_field_mask};
-
-        if (remaining_bit)
-        {
-            bits_ |= detail::d32_comb_11_significand_bits;
-        }
-    }
 
-    // If the exponent fits we do not need to use the combination field
     auto biased_exp {static_cast<std::uint32_t>(exp + detail::bias)};
-    const std::uint32_t biased_exp_low_six_bits {(biased_exp & detail::d32_max_exp_no_combination) << detail::d32_significand_bits};
 
-    #ifdef BOOST_DECIMAL_DEBUG_D32_CONSTRUCTOR
-    if (biased_exp_low_six_bits > 0b111111'0000000000'0000000000)
+    if (biased_exp <= detail::d32_max_biased_exp)
     {
-        return;
-    }
-    #endif
-
-    if (biased_exp <= detail::d32_max_exp_no_combination)
-    {
-        bits_ |= biased_exp_low_six_bits;
-    }
-    else if (biased_exp <= detail::d32_exp_one_combination)
-    {
-        if (big_combination)
-        {
-            bits_ |= (detail::d32_comb_1101_mask | biased_exp_low_six_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d32_comb_01_mask | biased_exp_low_six_bits);
-        }
-    }
-    else if (biased_exp <= detail::d32_max_biased_exp)
-    {
-        if (big_combination)
-        {
-            bits_ |= (detail::d32_comb_1110_mask | biased_exp_low_six_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d32_comb_10_mask | biased_exp_low_six_bits);
-        }
+        pack_components(reduced_coeff, biased_exp, isneg);
     }
     else
     {
@@ -785,17 +813,35 @@ constexpr auto signbit BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal32 rhs)
 
 constexpr auto isnan BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal32 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_ & detail::d32_nan_mask) == detail::d32_nan_mask;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d32_nan_mask) != detail::d32_nan_mask, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto issignaling BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal32 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_ & detail::d32_snan_mask) == detail::d32_snan_mask;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d32_snan_mask) != detail::d32_snan_mask, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isinf BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal32 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return ((rhs.bits_ & detail::d32_nan_mask) == detail::d32_inf_mask);
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d32_nan_mask) != detail::d32_inf_mask, "An infinity with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isnormal BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal32 rhs) noexcept -> bool
@@ -836,6 +882,18 @@ constexpr auto operator+(decimal32 lhs, decimal32 rhs) noexcept -> decimal32
         return res;
     }
 
+    // Operands with the same exponent, such as amounts in cents,
+    // add as integers as long as the exact sum fits in the precision
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal32>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                    rhs.full_significand(), rhs.biased_exponent(), rhs.isneg(),
+                                                    res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign};
+    }
+
     bool lhs_bigger {lhs > rhs};
     if (lhs.isneg() && rhs.isneg())
     {
@@ -969,6 +1027,17 @@ constexpr auto operator-(decimal32 lhs, decimal32 rhs) noexcept -> decimal32
         return res;
     }
 
+    // As in operator+, except that the difference of two zeros is +0 as on the general path
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal32>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                    rhs.full_significand(), rhs.biased_exponent(), !rhs.isneg(),
+                                                    res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign && res_sig != 0U};
+    }
+
     if (!lhs.isneg() && rhs.isneg())
     {
         return lhs + (-rhs);
@@ -1100,6 +1169,12 @@ constexpr auto operator==(decimal32 lhs, decimal32 rhs) noexcept -> bool
         return false;
     }
 
+    // Identical encodings are equal without decoding them
+    if (lhs.bits_ == rhs.bits_)
+    {
+        return true;
+    }
+
     return equal_parts_impl(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
                             rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
@@ -1853,6 +1928,8 @@ constexpr auto operator/(Integer lhs, decimal32 rhs) noexcept
 
     std::int32_t lhs_exp {};
     auto lhs_sig {detail::make_positive_unsigned(detail::shrink_significand(lhs, lhs_exp))};
+    detail::normalize(lhs_sig, lhs_exp);
+
     detail::decimal32_components lhs_components {lhs_sig, lhs_exp, lhs < 0};
     detail::decimal32_components rhs_components {sig_rhs, exp_rhs, rhs.isneg()};
     detail::decimal32_components q_components {};
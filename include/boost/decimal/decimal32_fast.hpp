@@ -14,6 +14,8 @@
 #include <boost/decimal/detail/sub_impl.hpp>
 #include <boost/decimal/detail/mul_impl.hpp>
 #include <boost/decimal/detail/div_impl.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/to_scaled_integer.hpp>
 #include <boost/decimal/detail/ryu/ryu_generic_128.hpp>
 #include <limits>
 #include <cstdint>
@@ -23,9 +25,9 @@ namespace decimal {
 
 namespace detail {
 
-BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_inf = std::numeric_limits<std::uint_fast32_t>::max();
-BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_qnan = std::numeric_limits<std::uint_fast32_t>::max() - 1;
-BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_snan = std::numeric_limits<std::uint_fast32_t>::max() - 2;
+BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_inf = std::numeric_limits<std::uint32_t>::max();
+BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_qnan = std::numeric_limits<std::uint32_t>::max() - 1;
+BOOST_DECIMAL_CONSTEXPR_VARIABLE auto d32_fast_snan = std::numeric_limits<std::uint32_t>::max() - 2;
 
 struct decimal32_fast_components
 {
@@ -45,11 +47,13 @@ public:
 
 private:
     // In regular decimal32 we have to decode the 24 bits of the significand and the 8 bits of the exp
-    // Here we just use them directly at the cost of at least 2 extra bytes of internal state
-    // since the fast integer types will be at least 32 and 8 bits respectively
+    // Here we just use them directly at the cost of 4 extra bytes of internal state.
+    // The fields are stored in exact width types so that a value is 8 bytes wide,
+    // where std::uint_fast32_t alone is 8 bytes on some platforms (e.g. glibc x86-64).
+    // The arithmetic still operates on significand_type
 
-    std::uint_fast32_t significand_ {};
-    std::uint_fast8_t exponent_ {};
+    std::uint32_t significand_ {};
+    std::uint8_t exponent_ {};
     bool sign_ {};
 
     constexpr auto isneg() const noexcept -> bool
@@ -72,16 +76,26 @@ private:
         return static_cast<std::int32_t>(exponent_) - detail::bias_v<decimal32>;
     }
 
+    // Sets all the fields from components that are known to be in range
+    constexpr auto pack_components(std::uint_fast32_t sig, std::uint32_t biased_exp, bool sign) noexcept -> void
+    {
+        significand_ = static_cast<std::uint32_t>(sig);
+        exponent_ = static_cast<std::uint8_t>(biased_exp);
+        sign_ = sign;
+    }
+
     friend constexpr auto div_impl(decimal32_fast lhs, decimal32_fast rhs, decimal32_fast& q, decimal32_fast& r) noexcept -> void;
 
     friend constexpr auto mod_impl(decimal32_fast lhs, decimal32_fast rhs, const decimal32_fast& q, decimal32_fast& r) noexcept -> void;
 
-    // Attempts conversion to integral type:
-    // If this is nan sets errno to EINVAL and returns 0
-    // If this is not representable sets errno to ERANGE and returns 0
-    template <typename Decimal, typename TargetType>
-    friend constexpr auto to_integral(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType);
+    // Attempts conversion to integral type, reporting nan and values that are not representable in the result
+    template <typename TargetType, typename Decimal>
+    friend constexpr auto try_to_integral(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_integral_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
+
+    template <typename TargetType, typename Decimal>
+    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto try_to_float(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_floating_point_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
     friend constexpr auto frexp10(T num, int* expptr) noexcept -> typename T::significand_type;
@@ -89,6 +103,12 @@ private:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetType, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
     friend constexpr auto to_decimal(Decimal val) noexcept -> TargetType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto to_scaled_integer(Decimal val, int exp) noexcept -> conversion_result<std::int64_t>;
+
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto from_components_unchecked(typename Decimal::significand_type sig, int exp, bool sign) noexcept -> Decimal;
+
     // Equality template between any integer type and decimal32
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal, BOOST_DECIMAL_INTEGRAL Integer>
     friend constexpr auto mixed_equality_impl(Decimal lhs, Integer rhs) noexcept
@@ -317,6 +337,8 @@ constexpr decimal32_fast::decimal32_fast(T1 coeff, T2 exp, bool sign) noexcept
     // Strip digits and round as required
     if (reduced)
     {
+        BOOST_DECIMAL_INSTRUMENT(constructor_renormalizations);
+
         const auto digits_to_remove {static_cast<Unsigned_Integer>(unsigned_coeff_digits - (detail::precision_v<decimal32> + 1))};
 
         #if defined(__GNUC__) && !defined(__clang__)
@@ -334,7 +356,7 @@ constexpr decimal32_fast::decimal32_fast(T1 coeff, T2 exp, bool sign) noexcept
         exp += static_cast<T2>(detail::fenv_round(unsigned_coeff, isneg));
     }
 
-    significand_ = static_cast<std::uint_fast32_t>(unsigned_coeff);
+    significand_ = static_cast<std::uint32_t>(unsigned_coeff);
 
     // Normalize the handling of zeros
     if (significand_ == UINT32_C(0))
@@ -349,7 +371,7 @@ constexpr decimal32_fast::decimal32_fast(T1 coeff, T2 exp, bool sign) noexcept
     }
     else
     {
-        exponent_ = static_cast<std::uint_fast8_t>(biased_exp);
+        exponent_ = static_cast<std::uint8_t>(biased_exp);
     }
 }
 
@@ -395,8 +417,8 @@ BOOST_DECIMAL_CXX20_CONSTEXPR decimal32_fast::decimal32_fast(Float val) noexcept
 constexpr auto direct_init(std::uint_fast32_t significand, std::uint_fast8_t exponent, bool sign = false) noexcept -> decimal32_fast
 {
     decimal32_fast val;
-    val.significand_ = significand;
-    val.exponent_ = exponent;
+    val.significand_ = static_cast<std::uint32_t>(significand);
+    val.exponent_ = static_cast<std::uint8_t>(exponent);
     val.sign_ = sign;
 
     return val;
@@ -409,17 +431,35 @@ constexpr auto signbit(decimal32_fast val) noexcept -> bool
 
 constexpr auto isinf(decimal32_fast val) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return val.significand_ == detail::d32_fast_inf;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG(val.significand_ != detail::d32_fast_inf, "An infinity with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(val);
+    return false;
+    #endif
 }
 
 constexpr auto isnan(decimal32_fast val) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return val.significand_ == detail::d32_fast_qnan || val.significand_ == detail::d32_fast_snan;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG(val.significand_ != detail::d32_fast_qnan && val.significand_ != detail::d32_fast_snan, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(val);
+    return false;
+    #endif
 }
 
 constexpr auto issignaling(decimal32_fast val) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return val.significand_ == detail::d32_fast_snan;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG(val.significand_ != detail::d32_fast_snan, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(val);
+    return false;
+    #endif
 }
 
 constexpr auto isnormal(decimal32_fast val) noexcept -> bool
@@ -439,8 +479,8 @@ constexpr auto operator==(decimal32_fast lhs, decimal32_fast rhs) noexcept -> bo
         return false;
     }
 
-    return equal_parts_impl(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
-                            rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
+    return equal_parts_impl<decimal32_fast>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                            rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
 
 constexpr auto operator!=(decimal32_fast lhs, decimal32_fast rhs) noexcept -> bool
@@ -468,8 +508,8 @@ constexpr auto operator<(decimal32_fast lhs, decimal32_fast rhs) noexcept -> boo
         return signbit(rhs);
     }
 
-    return less_parts_impl(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
-                           rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
+    return less_parts_impl<decimal32_fast>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                           rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
 
 constexpr auto operator<=(decimal32_fast lhs, decimal32_fast rhs) noexcept -> bool
@@ -664,6 +704,18 @@ constexpr auto operator+(decimal32_fast lhs, decimal32_fast rhs) noexcept -> dec
         return res;
     }
 
+    // Operands with the same exponent, such as amounts in cents,
+    // add as integers as long as the exact sum fits in the precision
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal32_fast>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                         rhs.full_significand(), rhs.biased_exponent(), rhs.isneg(),
+                                                         res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign};
+    }
+
     bool lhs_bigger {lhs > rhs};
     if (lhs.isneg() && rhs.isneg())
     {
@@ -762,6 +814,17 @@ constexpr auto operator-(decimal32_fast lhs, decimal32_fast rhs) noexcept -> dec
         return res;
     }
 
+    // As in operator+, except that the difference of two zeros is +0 as on the general path
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal32_fast>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                         rhs.full_significand(), rhs.biased_exponent(), !rhs.isneg(),
+                                                         res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign && res_sig != 0U};
+    }
+
     if (!lhs.isneg() && rhs.isneg())
     {
         return lhs + (-rhs);
@@ -1075,7 +1138,9 @@ constexpr auto operator/(Integer lhs, decimal32_fast rhs) noexcept
     detail::normalize(sig_rhs, exp_rhs);
 
     std::int32_t lhs_exp {};
-    const auto lhs_sig {detail::make_positive_unsigned(detail::shrink_significand<std::uint_fast32_t>(lhs, lhs_exp))};
+    auto lhs_sig {detail::make_positive_unsigned(detail::shrink_significand<std::uint_fast32_t>(lhs, lhs_exp))};
+    detail::normalize(lhs_sig, lhs_exp);
+
     const detail::decimal32_fast_components lhs_components {lhs_sig, lhs_exp, lhs < 0};
     const detail::decimal32_fast_components rhs_components {sig_rhs, exp_rhs, rhs.isneg()};
     detail::decimal32_fast_components q_components {};
@@ -7,6 +7,7 @@
 
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/add_impl.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/bit_cast.hpp>
 #include <boost/decimal/detail/config.hpp>
@@ -22,6 +23,8 @@
 #include <boost/decimal/detail/utilities.hpp>
 #include <boost/decimal/detail/normalize.hpp>
 #include <boost/decimal/detail/to_integral.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/to_scaled_integer.hpp>
 #include <boost/decimal/detail/to_float.hpp>
 #include <boost/decimal/detail/to_decimal.hpp>
 #include <boost/decimal/detail/promotion.hpp>
@@ -155,20 +158,27 @@ private:
     constexpr auto isneg() const noexcept -> bool;
     constexpr auto edit_sign(bool sign) noexcept -> void;
 
-    // Attempts conversion to integral type:
-    // If this is nan sets errno to EINVAL and returns 0
-    // If this is not representable sets errno to ERANGE and returns 0
-    template <typename Decimal, typename TargetType>
-    friend constexpr auto to_integral(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType);
+    // Sets all the bits from components that are known to be in range
+    constexpr auto pack_components(std::uint64_t sig, std::uint64_t biased_exp, bool sign) noexcept -> void;
 
-    template <typename Decimal, typename TargetType>
-    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
-        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_floating_point_v, TargetType, TargetType);
+    // Attempts conversion to integral type, reporting nan and values that are not representable in the result
+    template <typename TargetType, typename Decimal>
+    friend constexpr auto try_to_integral(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_integral_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
+
+    template <typename TargetType, typename Decimal>
+    friend BOOST_DECIMAL_CXX20_CONSTEXPR auto try_to_float(Decimal val) noexcept
+        BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_floating_point_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>);
 
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE TargetType, BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
     friend constexpr auto to_decimal(Decimal val) noexcept -> TargetType;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto to_scaled_integer(Decimal val, int exp) noexcept -> conversion_result<std::int64_t>;
+
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+    friend constexpr auto from_components_unchecked(typename Decimal::significand_type sig, int exp, bool sign) noexcept -> Decimal;
+
     // Debug bit pattern
     friend constexpr auto from_bits(std::uint64_t bits) noexcept -> decimal64;
     friend constexpr auto to_bits(decimal64 rhs) noexcept -> std::uint64_t;
@@ -568,6 +578,9 @@ public:
     template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
     friend constexpr auto frexp10(T num, int* expptr) noexcept -> typename T::significand_type;
 
+    template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+    friend constexpr auto rescale_finite_impl(T x, int exp) noexcept -> T;
+
     friend constexpr auto copysignd64(decimal64 mag, decimal64 sgn) noexcept -> decimal64;
     friend constexpr auto fmad64(decimal64 x, decimal64 y, decimal64 z) noexcept -> decimal64;
     friend constexpr auto scalbnd64(decimal64 num, int exp) noexcept -> decimal64;
@@ -596,6 +609,76 @@ constexpr auto to_bits(decimal64 rhs) noexcept -> std::uint64_t
 #  pragma GCC diagnostic ignored "-Wduplicated-branches"
 #endif
 
+// Packs a significand of at most precision_v<decimal64> digits and a biased exponent of at most d64_max_biased_exp,
+// which is the last step of every constructor, without any checks
+constexpr auto decimal64::pack_components(std::uint64_t sig, std::uint64_t biased_exp, bool sign) noexcept -> void
+{
+    bits_ = sign ? detail::d64_sign_mask : UINT64_C(0);
+    bool big_combination {false};
+
+    if (sig <= detail::d64_no_combination)
+    {
+        // If the coefficient fits directly we don't need to use the combination field
+        bits_ |= (sig & detail::d64_significand_mask);
+    }
+    else if (sig <= detail::d64_big_combination)
+    {
+        // Break the number into 3 bits for the combination field and 50 bits for the significand field
+
+        // Use the least significant 50 bits to set the significand
+        bits_ |= (sig & detail::d64_significand_mask);
+
+        // Now set the combination field (maximum of 3 bits)
+        std::uint64_t remaining_bits {sig & detail::d64_small_combination_field_mask};
+        remaining_bits <<= detail::d64_exponent_bits;
+        bits_ |= remaining_bits;
+    }
+    else
+    {
+        // Have to use the full combination field
+        bits_ |= detail::d64_comb_11_mask;
+        big_combination = true;
+
+        bits_ |= (sig & detail::d64_significand_mask);
+        const auto remaining_bit {sig & detail::d64_big_combination_field_mask};
+
+        if (remaining_bit)
+        {
+            bits_ |= detail::d64_comb_11_significand_bits;
+        }
+    }
+
+    // If the exponent fits we do not need to use the combination field
+    const std::uint64_t biased_exp_low_eight_bits {(biased_exp & detail::d64_max_exp_no_combination) << detail::d64_significand_bits};
+
+    if (biased_exp <= detail::d64_max_exp_no_combination)
+    {
+        bits_ |= biased_exp_low_eight_bits;
+    }
+    else if (biased_exp <= detail::d64_exp_one_combination)
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d64_comb_1101_mask | biased_exp_low_eight_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d64_comb_01_mask | biased_exp_low_eight_bits);
+        }
+    }
+    else
+    {
+        if (big_combination)
+        {
+            bits_ |= (detail::d64_comb_1110_mask | biased_exp_low_eight_bits);
+        }
+        else
+        {
+            bits_ |= (detail::d64_comb_10_mask | biased_exp_low_eight_bits);
+        }
+    }
+}
+
 // 3.2.5 initialization from coefficient and exponent:
 #ifdef BOOST_DECIMAL_HAS_CONCEPTS
 template <BOOST_DECIMAL_INTEGRAL T1, BOOST_DECIMAL_INTEGRAL T2>
@@ -651,77 +734,23 @@ constexpr decimal64::decimal64(T1 coeff, T2 exp, bool sign) noexcept
     // Round as required
     if (reduced)
     {
+        BOOST_DECIMAL_INSTRUMENT(constructor_renormalizations);
+
         exp += detail::fenv_round<decimal64>(unsigned_coeff, isneg);
     }
 
     auto reduced_coeff {static_cast<std::uint64_t>(unsigned_coeff)};
-    bool big_combination {false};
 
     if (reduced_coeff == 0)
     {
         exp = 0;
     }
-    else if (reduced_coeff <= detail::d64_no_combination)
-    {
-        // If the coefficient fits directly we don't need to use the combination field
-        bits_ |= (reduced_coeff & detail::d64_significand_mask);
-    }
-    else if (reduced_coeff <= detail::d64_big_combination)
-    {
-        // Break the number into 3 bits for the combination field and 50 bits for the significand field
-
-        // Use the least significant 50 bits to set the significand
-        bits_ |= (reduced_coeff & detail::d64_significand_mask);
-
-        // Now set the combination field (maximum of 3 bits)
-        std::uint64_t remaining_bits {reduced_coeff & detail::d64_small_combination_field_mask};
-        remaining_bits <<= detail::d64_exponent_bits;
-        bits_ |= remaining_bits;
-    }
-    else
-    {
-        // Have to use the full combination field
-        bits_ |= detail::d64_comb_11_mask;
-        big_combination = true;
-
-        bits_ |= (reduced_coeff & detail::d64_significand_mask);
-        const auto remaining_bit {reduced_coeff & detail::d64_big_combination_field_mask};
-
-        if (remaining_bit)
-        {
-            bits_ |= detail::d64_comb_11_significand_bits;
-        }
-    }
 
-    // If the exponent fits we do not need to use the combination field
     auto biased_exp {static_cast<std::uint64_t>(exp + detail::bias_v<decimal64>)};
-    const std::uint64_t biased_exp_low_eight_bits {(biased_exp & detail::d64_max_exp_no_combination) << detail::d64_significand_bits};
 
-    if (biased_exp <= detail::d64_max_exp_no_combination)
-    {
-        bits_ |= biased_exp_low_eight_bits;
-    }
-    else if (biased_exp <= detail::d64_exp_one_combination)
+    if (biased_exp <= detail::d64_max_biased_exp)
     {
-        if (big_combination)
-        {
-            bits_ |= (detail::d64_comb_1101_mask | biased_exp_low_eight_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d64_comb_01_mask | biased_exp_low_eight_bits);
-        }
-    }
-    else if (biased_exp <= detail::d64_max_biased_exp)
-    {
-        if (big_combination)
-        {
-            bits_ |= (detail::d64_comb_1110_mask | biased_exp_low_eight_bits);
-        }
-        else
-        {
-            bits_ |= (detail::d64_comb_10_mask | biased_exp_low_eight_bits);
-        }
+        pack_components(reduced_coeff, biased_exp, isneg);
     }
     else
     {
@@ -1068,17 +1097,35 @@ constexpr auto signbit BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal64 rhs)
 
 constexpr auto isnan BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal64 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_ & detail::d64_nan_mask) == detail::d64_nan_mask;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d64_nan_mask) != detail::d64_nan_mask, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isinf BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal64 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return ((rhs.bits_ & detail::d64_nan_mask) == detail::d64_inf_mask);
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d64_nan_mask) != detail::d64_inf_mask, "An infinity with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto issignaling BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal64 rhs) noexcept -> bool
 {
+    #ifndef BOOST_DECIMAL_FINITE_ONLY
     return (rhs.bits_ & detail::d64_snan_mask) == detail::d64_snan_mask;
+    #else
+    BOOST_DECIMAL_ASSERT_MSG((rhs.bits_ & detail::d64_snan_mask) != detail::d64_snan_mask, "A NaN with BOOST_DECIMAL_FINITE_ONLY");
+    static_cast<void>(rhs);
+    return false;
+    #endif
 }
 
 constexpr auto isnormal BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (decimal64 rhs) noexcept -> bool
@@ -1114,6 +1161,11 @@ constexpr auto d64_add_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
 
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
 
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
+
     if (delta_exp > detail::precision_v<decimal64> + 1)
     {
         // If the difference in exponents is more than the digits of accuracy
@@ -1192,6 +1244,11 @@ constexpr auto d64_sub_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
                             bool abs_lhs_bigger) noexcept -> detail::decimal64_components
 {
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
+
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
     auto signed_sig_lhs {detail::make_signed_value(lhs_sig, lhs_sign)};
     auto signed_sig_rhs {detail::make_signed_value(rhs_sig, rhs_sign)};
 
@@ -1201,8 +1258,11 @@ constexpr auto d64_sub_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
         // we return the larger of the two
         //
         // e.g. 1e20 - 1e-20 = 1e20
-        return abs_lhs_bigger ? detail::decimal64_components{detail::shrink_significand<std::uint64_t>(lhs_sig, lhs_exp), lhs_exp, false} :
-                                detail::decimal64_components{detail::shrink_significand<std::uint64_t>(rhs_sig, rhs_exp), rhs_exp, true};
+        //
+        // The larger keeps its own sign, unless it is rhs of a subtraction,
+        // which is every case but a positive lhs and a negative rhs (the addition of the two)
+        return abs_lhs_bigger ? detail::decimal64_components{detail::shrink_significand<std::uint64_t>(lhs_sig, lhs_exp), lhs_exp, lhs_sign} :
+                                detail::decimal64_components{detail::shrink_significand<std::uint64_t>(rhs_sig, rhs_exp), rhs_exp, !(lhs_sign && rhs_sign)};
     }
 
     // The two numbers can be subtracted together without special handling
@@ -1433,6 +1493,18 @@ constexpr auto operator+(decimal64 lhs, decimal64 rhs) noexcept -> decimal64
         return res;
     }
 
+    // Operands with the same exponent, such as amounts in cents,
+    // add as integers as long as the exact sum fits in the precision
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal64>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                    rhs.full_significand(), rhs.biased_exponent(), rhs.isneg(),
+                                                    res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign};
+    }
+
     bool lhs_bigger {lhs > rhs};
     if (lhs.isneg() && rhs.isneg())
     {
@@ -1540,6 +1612,17 @@ constexpr auto operator-(decimal64 lhs, decimal64 rhs) noexcept -> decimal64
         return res;
     }
 
+    // As in operator+, except that the difference of two zeros is +0 as on the general path
+    auto res_sig {lhs.full_significand()};
+    std::int32_t res_exp {};
+    bool res_sign {};
+    if (detail::add_aligned_significands<decimal64>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
+                                                    rhs.full_significand(), rhs.biased_exponent(), !rhs.isneg(),
+                                                    res_sig, res_exp, res_sign))
+    {
+        return {res_sig, res_exp, res_sign && res_sig != 0U};
+    }
+
     if (!lhs.isneg() && rhs.isneg())
     {
         return lhs + (-rhs);
@@ -1774,7 +1857,11 @@ constexpr auto operator/(Integer lhs, decimal64 rhs) noexcept
     auto rhs_exp {rhs.biased_exponent()};
     detail::normalize<decimal64>(rhs_sig, rhs_exp);
 
-    detail::decimal64_components lhs_components {detail::make_positive_unsigned(lhs), 0, lhs < 0};
+    std::int32_t lhs_exp {};
+    auto lhs_sig {detail::shrink_significand<std::uint64_t>(lhs, lhs_exp)};
+    detail::normalize<decimal64>(lhs_sig, lhs_exp);
+
+    detail::decimal64_components lhs_components {lhs_sig, lhs_exp, lhs < 0};
     detail::decimal64_components rhs_components {rhs_sig, rhs_exp, rhs.isneg()};
     detail::decimal64_components q_components {};
 
@@ -1919,6 +2006,12 @@ constexpr auto operator==(decimal64 lhs, decimal64 rhs) noexcept -> bool
         return false;
     }
 
+    // Identical encodings are equal without decoding them
+    if (lhs.bits_ == rhs.bits_)
+    {
+        return true;
+    }
+
     return equal_parts_impl<decimal64>(lhs.full_significand(), lhs.biased_exponent(), lhs.isneg(),
                                        rhs.full_significand(), rhs.biased_exponent(), rhs.isneg());
 }
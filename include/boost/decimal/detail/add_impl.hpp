@@ -8,6 +8,7 @@
 #include <boost/decimal/detail/attributes.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cstdint>
@@ -25,6 +26,11 @@ constexpr auto add_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
 
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
 
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
+
     #ifdef BOOST_DECIMAL_DEBUG_ADD
     std::cerr << "Starting sig lhs: " << lhs_sig
               << "\nStarting exp lhs: " << lhs_exp
@@ -91,6 +97,57 @@ constexpr auto add_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
     return {res_sig, new_exp, sign};
 }
 
+// Adds two values whose exponents are equal, such as two amounts in cents, without aligning
+// or rounding their significands. For a subtraction rhs_sign is the flipped sign of the subtrahend.
+// Returns false if the exponents differ, or if the exact sum has more digits than the precision
+// of DecimalType, in which case the outputs are unspecified and the caller takes the general path
+template <typename DecimalType, typename T>
+constexpr auto add_aligned_significands(T lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
+                                        T rhs_sig, std::int32_t rhs_exp, bool rhs_sign,
+                                        T& res_sig, std::int32_t& res_exp, bool& res_sign) noexcept -> bool
+{
+    constexpr T max_sig {static_cast<T>(pow10(static_cast<T>(precision_v<DecimalType>)) - 1U)};
+
+    if (lhs_exp != rhs_exp)
+    {
+        // Adding zero is exact whatever the exponents, so the result keeps the exponent of the other value.
+        // This lets a running total that starts from T{} pick up the exponent of its addends
+        if (lhs_sig == 0U && rhs_sig != 0U)
+        {
+            lhs_exp = rhs_exp;
+        }
+        else if (rhs_sig == 0U && lhs_sig != 0U)
+        {
+            rhs_exp = lhs_exp;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    res_exp = lhs_exp;
+
+    if (lhs_sign == rhs_sign)
+    {
+        // Two significands below 10^precision can not overflow T
+        res_sig = lhs_sig + rhs_sig;
+        res_sign = lhs_sign;
+    }
+    else if (lhs_sig >= rhs_sig)
+    {
+        res_sig = lhs_sig - rhs_sig;
+        res_sign = lhs_sign && res_sig != 0U;
+    }
+    else
+    {
+        res_sig = rhs_sig - lhs_sig;
+        res_sign = rhs_sign;
+    }
+
+    return res_sig <= max_sig;
+}
+
 } // namespace detail
 } // namespace decimal
 } // namespace boost
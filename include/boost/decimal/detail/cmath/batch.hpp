@@ -0,0 +1,339 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_BATCH_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_BATCH_HPP
+
+#include <boost/decimal/decimal32.hpp>
+#include <boost/decimal/decimal64.hpp>
+#include <boost/decimal/decimal128.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/promotion.hpp>
+#include <boost/decimal/detail/cmath/exp.hpp>
+#include <boost/decimal/detail/cmath/fpclassify.hpp>
+#include <boost/decimal/detail/cmath/lgamma.hpp>
+#include <boost/decimal/detail/cmath/log.hpp>
+#include <boost/decimal/detail/cmath/pow.hpp>
+#include <boost/decimal/detail/cmath/impl/quantize_impl.hpp>
+#include <boost/decimal/detail/cmath/sqrt.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/to_scaled_integer.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+#if BOOST_DECIMAL_DEC_EVAL_METHOD == 0
+
+template <typename T>
+using batch_evaluation_t = T;
+
+#elif BOOST_DECIMAL_DEC_EVAL_METHOD == 1
+
+template <typename T>
+using batch_evaluation_t = promote_args_t<T, decimal64>;
+
+#else // BOOST_DECIMAL_DEC_EVAL_METHOD == 2
+
+template <typename T>
+using batch_evaluation_t = promote_args_t<T, decimal128>;
+
+#endif
+
+// The batched functions give the same results as the scalar functions applied to each element.
+// The decimal arithmetic is done in software, so there are no vector lanes to fill,
+// but sorting each block into special and regular arguments before any evaluation
+// leaves the kernels a dense run of arguments that skip the classification of the scalar path.
+// Every out[i] is only computed from x[i], so x and out may be the same range.
+template <typename T, typename Regular, typename Kernel, typename Special>
+void batch_apply(const T* x, T* out, std::size_t n, Regular is_regular, Kernel kernel, Special special) noexcept
+{
+    constexpr std::size_t block_size { 64U };
+
+    std::size_t regular_index[block_size];
+
+    for (std::size_t first { }; first < n; first += block_size)
+    {
+        const std::size_t last { (n - first > block_size) ? first + block_size : n };
+
+        std::size_t count { };
+
+        for (std::size_t i { first }; i < last; ++i)
+        {
+            if (is_regular(x[i]))
+            {
+                regular_index[count++] = i;
+            }
+            else
+            {
+                out[i] = special(x[i]);
+            }
+        }
+
+        for (std::size_t k { }; k < count; ++k)
+        {
+            const std::size_t i { regular_index[k] };
+
+            out[i] = kernel(x[i]);
+        }
+    }
+}
+
+template <typename T>
+constexpr auto batch_is_normal(T x) noexcept -> bool
+{
+    return fpclassify(x) == FP_NORMAL;
+}
+
+template <typename T>
+constexpr auto batch_is_positive_finite(T x) noexcept -> bool
+{
+    return isfinite(x) && !signbit(x) && (fpclassify(x) != FP_ZERO);
+}
+
+template <typename T>
+void exp_batch(const T* x, T* out, std::size_t n) noexcept
+{
+    using evaluation_type = batch_evaluation_t<T>;
+
+    batch_apply(x, out, n,
+                [](T val) { return batch_is_normal(val); },
+                [](T val) { return static_cast<T>(exp_normal_impl(static_cast<evaluation_type>(val))); },
+                [](T val) { return exp(val); });
+}
+
+template <typename T>
+void log_batch(const T* x, T* out, std::size_t n) noexcept
+{
+    using evaluation_type = batch_evaluation_t<T>;
+
+    batch_apply(x, out, n,
+                [](T val) { return batch_is_positive_finite(val); },
+                [](T val) { return static_cast<T>(log_normal_impl(static_cast<evaluation_type>(val))); },
+                [](T val) { return log(val); });
+}
+
+template <typename T>
+void sqrt_batch(const T* x, T* out, std::size_t n) noexcept
+{
+    using evaluation_type = batch_evaluation_t<T>;
+
+    batch_apply(x, out, n,
+                [](T val) { return batch_is_positive_finite(val); },
+                [](T val) { return static_cast<T>(sqrt_normal_impl(static_cast<evaluation_type>(val))); },
+                [](T val) { return sqrt(val); });
+}
+
+// Integral arguments are looked up in the tables of gamma_lookup.hpp, see lgamma_positive_impl
+template <typename T>
+void lgamma_batch(const T* x, T* out, std::size_t n) noexcept
+{
+    using evaluation_type = batch_evaluation_t<T>;
+
+    batch_apply(x, out, n,
+                [](T val) { return batch_is_normal(val) && !signbit(val); },
+                [](T val) { return static_cast<T>(lgamma_positive_impl(static_cast<evaluation_type>(val))); },
+                [](T val) { return lgamma(val); });
+}
+
+// pow with a common exponent: the exponent is analyzed once for the whole range
+// instead of once per element as in pow(x, a)
+template <typename T>
+void pow_batch(const T* x, T a, T* out, std::size_t n) noexcept
+{
+    using evaluation_type = batch_evaluation_t<T>;
+
+    constexpr T half { 5, -1 };
+
+    const auto na = static_cast<int>(a);
+
+    if ((na == a) || ((na == 0) && (na == abs(a))))
+    {
+        for (std::size_t i { }; i < n; ++i)
+        {
+            out[i] = pow(x[i], na);
+        }
+    }
+    else if (fpclassify(a) != FP_NORMAL)
+    {
+        for (std::size_t i { }; i < n; ++i)
+        {
+            out[i] = pow(x[i], a);
+        }
+    }
+    else if (a == half)
+    {
+        batch_apply(x, out, n,
+                    [](T val) { return batch_is_normal(val); },
+                    [](T val) { return sqrt(val); },
+                    [a](T val) { return pow(val, a); });
+    }
+    else
+    {
+        batch_apply(x, out, n,
+                    [](T val) { return batch_is_normal(val) && !signbit(val); },
+                    [a](T val) { return exp(a * static_cast<T>(log_normal_impl(static_cast<evaluation_type>(val)))); },
+                    [a](T val) { return pow(val, a); });
+    }
+}
+
+template <typename T>
+void pow_batch(const T* x, const T* a, T* out, std::size_t n) noexcept
+{
+    for (std::size_t i { }; i < n; ++i)
+    {
+        out[i] = pow(x[i], a[i]);
+    }
+}
+
+// Rescaling is cheap enough that sorting the arguments as in batch_apply would cost more than it saves,
+// so every element is only tested for being finite before taking the rescaling kernel
+template <typename T>
+void quantize_batch(const T* x, int exp, T* out, std::size_t n) noexcept
+{
+    for (std::size_t i { }; i < n; ++i)
+    {
+        const auto val { x[i] };
+
+        if (BOOST_DECIMAL_LIKELY(isfinite(val)))
+        {
+            out[i] = rescale_finite_impl(val, exp);
+        }
+        else
+        {
+            out[i] = isnan(val) ? val : std::numeric_limits<T>::signaling_NaN();
+        }
+    }
+}
+
+// Every element is converted, and the status of the first one that failed is returned
+template <typename T>
+auto to_scaled_integer_batch(const T* x, int exp, std::int64_t* out, std::size_t n) noexcept -> std::errc
+{
+    std::errc ec { };
+
+    for (std::size_t i { }; i < n; ++i)
+    {
+        const auto res { to_scaled_integer(x[i], exp) };
+        out[i] = res.value;
+
+        if (BOOST_DECIMAL_UNLIKELY(res.ec != std::errc{} && ec == std::errc{}))
+        {
+            ec = res.ec;
+        }
+    }
+
+    return ec;
+}
+
+template <typename T>
+void from_scaled_integer_batch(const std::int64_t* ticks, int exp, T* out, std::size_t n) noexcept
+{
+    for (std::size_t i { }; i < n; ++i)
+    {
+        out[i] = from_scaled_integer<T>(ticks[i], exp);
+    }
+}
+
+template <typename T>
+void from_components_unchecked_batch(const typename T::significand_type* sig, const int* exp, const bool* sign, T* out, std::size_t n) noexcept
+{
+    for (std::size_t i { }; i < n; ++i)
+    {
+        out[i] = from_components_unchecked<T>(sig[i], exp[i], sign[i]);
+    }
+}
+
+} //namespace detail
+
+#ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+// Elementwise exp, log, sqrt, lgamma, pow, quantize (to the exponent exp), conversions to and from
+// the integer number of units of 10^exp, and construction from components known to be in range over contiguous ranges.
+// out must hold at least as many elements as the input, and may be the same range as x when the types agree
+
+#define BOOST_DECIMAL_DETAIL_BATCH_FUNCTIONS(decimal_type)                                                                                 \
+BOOST_DECIMAL_EXPORT inline void exp(std::span<const decimal_type> x, std::span<decimal_type> out) noexcept                                \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::exp_batch(x.data(), out.data(), x.size());                                                                                      \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void log(std::span<const decimal_type> x, std::span<decimal_type> out) noexcept                                \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::log_batch(x.data(), out.data(), x.size());                                                                                      \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void sqrt(std::span<const decimal_type> x, std::span<decimal_type> out) noexcept                               \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::sqrt_batch(x.data(), out.data(), x.size());                                                                                     \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void lgamma(std::span<const decimal_type> x, std::span<decimal_type> out) noexcept                             \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::lgamma_batch(x.data(), out.data(), x.size());                                                                                   \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void pow(std::span<const decimal_type> x, decimal_type a, std::span<decimal_type> out) noexcept                 \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::pow_batch(x.data(), a, out.data(), x.size());                                                                                   \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void pow(std::span<const decimal_type> x, std::span<const decimal_type> a, std::span<decimal_type> out) noexcept \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(a.size() >= x.size());                                                                                             \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::pow_batch(x.data(), a.data(), out.data(), x.size());                                                                            \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void quantize(std::span<const decimal_type> x, int exp, std::span<decimal_type> out) noexcept                  \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    detail::quantize_batch(x.data(), exp, out.data(), x.size());                                                                            \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline auto to_scaled_integer(std::span<const decimal_type> x, int exp, std::span<std::int64_t> out) noexcept -> std::errc \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= x.size());                                                                                           \
+    return detail::to_scaled_integer_batch(x.data(), exp, out.data(), x.size());                                                            \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void from_scaled_integer(std::span<const std::int64_t> ticks, int exp, std::span<decimal_type> out) noexcept     \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= ticks.size());                                                                                       \
+    detail::from_scaled_integer_batch(ticks.data(), exp, out.data(), ticks.size());                                                         \
+}                                                                                                                                           \
+                                                                                                                                            \
+BOOST_DECIMAL_EXPORT inline void from_components_unchecked(std::span<const decimal_type::significand_type> sig, std::span<const int> exp,   \
+                                                           std::span<const bool> sign, std::span<decimal_type> out) noexcept                \
+{                                                                                                                                           \
+    BOOST_DECIMAL_ASSERT(exp.size() >= sig.size() && sign.size() >= sig.size());                                                           \
+    BOOST_DECIMAL_ASSERT(out.size() >= sig.size());                                                                                         \
+    detail::from_components_unchecked_batch(sig.data(), exp.data(), sign.data(), out.data(), sig.size());                                   \
+}
+
+BOOST_DECIMAL_DETAIL_BATCH_FUNCTIONS(decimal32)
+BOOST_DECIMAL_DETAIL_BATCH_FUNCTIONS(decimal64)
+BOOST_DECIMAL_DETAIL_BATCH_FUNCTIONS(decimal128)
+
+#undef BOOST_DECIMAL_DETAIL_BATCH_FUNCTIONS
+
+#endif // BOOST_DECIMAL_HAS_STD_SPAN
+
+} //namespace decimal
+} //namespace boost
+
+#endif //BOOST_DECIMAL_DETAIL_CMATH_BATCH_HPP
@@ -11,8 +11,10 @@
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/cmath/abs.hpp>
+#include <boost/decimal/detail/cmath/impl/integer_roots.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <algorithm>
 #include <type_traits>
 #include <cstdint>
 #include <cmath>
@@ -45,128 +47,51 @@ constexpr auto cbrt_impl(T x) noexcept
     }
     else
     {
+        // With x = gn * 10^exp10val, the significand is shifted by a power of ten
+        // that leaves an exponent divisible by three and gives the root one digit more than T.
+        // The integer cube root is then exact up to that guard digit,
+        // and the result is rounded only once when it is converted to T.
+
+        using integer_type = icbrt_integer_t<T>;
+
+        constexpr int digits { std::numeric_limits<T>::digits10 };
+
+        constexpr int integer_digits { std::is_same<integer_type, uint256_t>::value ? std::numeric_limits<uint256_t>::digits10 : std::numeric_limits<uint128>::digits10 };
+
+        // The scaled significand has between scaled_digits and scaled_digits + 2 digits.
+        // When the integer is too narrow for 3 * digits + 1 of them, the missing digits of the root
+        // are supplied by icbrt_extend
+        constexpr int scaled_digits { (std::min)(3 * digits + 1, 3 * ((integer_digits - 3) / 3) + 1) };
+        constexpr int extra_digits { (3 * digits + 1 - scaled_digits) / 3 };
+
         int exp10val { };
 
         const auto gn { frexp10(x, &exp10val) };
 
-        const auto
-            zeros_removal
-            {
-                remove_trailing_zeros(gn)
-            };
+        int shift { scaled_digits - digits };
 
-        const bool is_pure { static_cast<unsigned>(zeros_removal.trimmed_number) == 1U };
+        const int shift_mod3 { (exp10val - shift) % 3 };
 
-        if(is_pure)
-        {
-            // Here, a pure power-of-10 argument gets a straightforward result.
-            // For argument 10^n where n is a multiple of 3, the result is exact.
-
-            const int p10 { exp10val + static_cast<int>(zeros_removal.number_of_removed_zeros) };
-
-            if (p10 == 0)
-            {
-                result = T { 1 };
-            }
-            else
-            {
-                const int p10_mod3 = (p10 % 3);
-                const int p10_div3 = (p10 / 3);
-
-                result = T { 1, p10_div3 };
-
-                switch (p10_mod3)
-                {
-                    case 2:
-                        result *= numbers::cbrt10_v<T>;
-                        // fallthrough
-
-                    case 1:
-                        result *= numbers::cbrt10_v<T>;
-                        break;
-
-                    case -2:
-                        result /= numbers::cbrt10_v<T>;
-                        // fallthrough
-
-                    case -1:
-                        result /= numbers::cbrt10_v<T>;
-                        break;
-                }
-            }
-        }
-        else
+        shift += (shift_mod3 < 0) ? shift_mod3 + 3 : shift_mod3;
+
+        const auto n { mul_pow10<integer_type>(gn, shift) };
+
+        bool exact { };
+
+        const auto root { icbrt_extend(n, icbrt(n), extra_digits, exact) };
+
+        // Mark an inexact root that ends with 0 or 5, so that the final rounding
+        // does not mistake it for an exact or a halfway value
+        const auto last_digit { static_cast<unsigned>(narrow_root(root % UINT64_C(10))) };
+
+        auto sig { narrow_root(root) };
+
+        if (((last_digit == 0U) || (last_digit == 5U)) && !exact)
         {
-            // Scale the argument to the interval 1/10 <= x < 1.
-            T gx { gn, -std::numeric_limits<T>::digits10 };
-
-            exp10val += std::numeric_limits<T>::digits10;
-
-            // For this work we perform an order-2 Pade approximation of the cube-root
-            // at argument x = 1/2. This results in slightly more than 2 decimal digits
-            // of accuracy over the interval 1/10 <= x < 1.
-
-            // PadeApproximant[x^(1/3), {x, 1/2, {2, 2}}]
-            // FullSimplify[%]
-
-            // HornerForm[Numerator[Out[2]]]
-            // Results in:
-            //   5 + x (70 + 56 x)
-
-            // HornerForm[Denominator[Out[2]]]
-            // Results in:
-            //   2^(1/3) (14 + x (70 + 20 x))
-
-            constexpr T five     {  5 };
-            constexpr T fourteen { 14 };
-            constexpr T seventy  {  7, 1 };
-
-            result =
-                  (five + gx * (seventy + gx * 56))
-                / (numbers::cbrt2_v<T> * (fourteen + gx * (seventy + gx * 20)));
-
-            // Perform 2, 3 or 4 Newton-Raphson iterations depending on precision.
-            // Note from above, we start with slightly more than 2 decimal digits
-            // of accuracy.
-
-            constexpr int iter_loops
-            {
-                  std::numeric_limits<T>::digits10 < 10 ? 2
-                : std::numeric_limits<T>::digits10 < 20 ? 3 : 4
-            };
-
-            for (int idx = 0; idx < iter_loops; ++idx)
-            {
-                result = ((result + result) + gx / (result * result)) / 3;
-            }
-
-            if (exp10val != 0)
-            {
-                const int exp10val_mod3 = (exp10val % 3);
-                const int exp10val_div3 = (exp10val / 3);
-
-                result *= T { 1, exp10val_div3 };
-
-                switch (exp10val_mod3)
-                {
-                    case 2:
-                        result *= numbers::cbrt10_v<T>;
-                        // fallthrough
-
-                    case 1:
-                        result *= numbers::cbrt10_v<T>;
-                        break;
-
-                    case -2:
-                        result /= numbers::cbrt10_v<T>;
-                        // fallthrough
-
-                    case -1:
-                        result /= numbers::cbrt10_v<T>;
-                        break;
-                }
-            }
+            ++sig;
         }
+
+        result = T { sig, (exp10val - shift) / 3 - extra_digits };
     }
 
     return result;
@@ -7,15 +7,19 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_EXP_HPP
 
 #include <boost/decimal/fwd.hpp> // NOLINT(llvm-include-order)
-#include <boost/decimal/detail/cmath/impl/expm1_impl.hpp>
-#include <boost/decimal/detail/cmath/impl/pow_impl.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+#include <boost/decimal/detail/cmath/impl/exp_impl.hpp>
+#include <boost/decimal/detail/cmath/impl/fma_impl.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/numbers.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
-#include <array>
+#include <cstddef>
+#include <limits>
 #include <type_traits>
 #endif
 
@@ -24,6 +28,62 @@ namespace decimal {
 
 namespace detail {
 
+// 10^(k/64) * exp(r) for the reduction multiple k = 64n + j and |r| <= log(10)/128.
+// The factor 10^(j/64) is taken from a table and the factor 10^n only changes the exponent of the result,
+// which the final fma applies before its single rounding, so that results below the normal range are rounded once as well
+template <typename T>
+constexpr auto exp_reconstruct(int k, T r) noexcept -> T
+{
+    const auto j = static_cast<std::size_t>(static_cast<unsigned>(k) & 63U);
+    const int  n { (k - static_cast<int>(j)) / 64 };
+
+    // Adding the table value last keeps the rounding error of exp(r) - 1 out of the leading digits
+    const T table_value { detail::exp_table_value<T>(j) };
+
+    return fma_impl(table_value, r * detail::exp_series_expansion(r), table_value, n);
+}
+
+// exp of a normal argument, shared by exp_impl and the batched exp
+template <typename T>
+constexpr auto exp_normal_impl(T x) noexcept -> T
+{
+    constexpr T zero { 0, 0 };
+
+    T result { };
+
+    // Reduce the argument to x = k * log(10)/64 + r with |r| <= log(10)/128
+
+    constexpr T half { 5, -1 };
+
+    // Beyond this bound the result overflows or underflows for any of the types,
+    // and the reduction multiple would no longer fit into an int.
+    constexpr T bound { 3 * (std::numeric_limits<T>::max_exponent10 + std::numeric_limits<T>::digits10) };
+
+    if (x > bound)
+    {
+        result = std::numeric_limits<T>::infinity();
+    }
+    else if (x < -bound)
+    {
+        result = zero;
+    }
+    else
+    {
+        const auto reduction = detail::exp_reduction_constants<T>();
+
+        const T   y { x * reduction[0U] };
+        const int k { static_cast<int>(signbit(y) ? y - half : y + half) };
+        const T   t { k };
+
+        // The leading part of log(10)/64 has few enough digits that t * reduction[1U] is exact
+        const T r { (x - t * reduction[1U]) - t * reduction[2U] };
+
+        result = exp_reconstruct(k, r);
+    }
+
+    return result;
+}
+
 template <typename T>
 constexpr auto exp_impl(T x) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
@@ -52,37 +112,7 @@ constexpr auto exp_impl(T x) noexcept
     } // LCOV_EXCL_LINE
     else
     {
-        if (signbit(x))
-        {
-            result = one / exp(-x);
-        }
-        else
-        {
-            // Scale the argument to 0 < x < log(2).
-
-            int nf2 { };
-
-            if (x > numbers::ln2_v<T>)
-            {
-                nf2 = static_cast<int>(x / numbers::ln2_v<T>);
-
-                x -= numbers::ln2_v<T> * nf2;
-            }
-
-            result = fma(x, detail::expm1_series_expansion(x), one);
-
-            if (nf2 > 0)
-            {
-                if (nf2 < 64)
-                {
-                    result *= T { static_cast<std::uint64_t>(UINT64_C(1) << static_cast<unsigned>(nf2)), 0 };
-                }
-                else
-                {
-                    result *= detail::pow_2_impl<T>(nf2);
-                }
-            }
-        }
+        result = exp_normal_impl(x);
     }
 
     return result;
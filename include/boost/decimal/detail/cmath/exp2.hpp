@@ -8,7 +8,14 @@
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/cmath/exp.hpp>
 #include <boost/decimal/detail/cmath/pow.hpp>
+#include <boost/decimal/detail/cmath/trunc.hpp>
+#include <boost/decimal/numbers.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <limits>
+#endif
 
 namespace boost {
 namespace decimal {
@@ -19,9 +26,49 @@ template <typename T>
 constexpr auto exp2_impl(T num) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
 {
+    constexpr T zero {0, 0};
+    constexpr T half {5, -1};
     constexpr T two {2, 0};
 
-    return pow(two, num);
+    // Beyond this bound the result overflows or underflows for any of the types
+    constexpr T bound {4 * (std::numeric_limits<T>::max_exponent10 + std::numeric_limits<T>::digits10)};
+
+    T result {};
+
+    if (isnan(num))
+    {
+        result = num;
+    }
+    else if (num == trunc(num))
+    {
+        // Integral powers of two, and the infinities, are exact through pow
+        result = pow(two, num);
+    }
+    else if (num > bound)
+    {
+        result = std::numeric_limits<T>::infinity();
+    }
+    else if (num < -bound)
+    {
+        result = zero;
+    }
+    else
+    {
+        // Reduce the argument to num = k * log2(10)/64 + s, so that 2^num = 10^(k/64) * exp(s * log(2)).
+        // Rounding num * log(2) first would cost the digits of its integral part, while the leading part
+        // of log2(10)/64 has few enough digits that t * reduction[1U] is exact and s keeps all digits of num
+        const auto reduction = detail::exp2_reduction_constants<T>();
+
+        const T   y { num * reduction[0U] };
+        const int k { static_cast<int>(signbit(y) ? y - half : y + half) };
+        const T   t { k };
+
+        const T r { ((num - t * reduction[1U]) - t * reduction[2U]) * numbers::ln2_v<T> };
+
+        result = exp_reconstruct(k, r);
+    }
+
+    return result;
 }
 
 } //namespace detail
@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/instrumentation.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <type_traits>
@@ -27,10 +28,12 @@ constexpr auto fpclassify BOOST_DECIMAL_PREVENT_MACRO_SUBSTITUTION (T rhs) noexc
 
     if (isinf(rhs))
     {
+        BOOST_DECIMAL_INSTRUMENT(non_finite_classifications);
         return FP_INFINITE;
     }
     else if (isnan(rhs))
     {
+        BOOST_DECIMAL_INSTRUMENT(non_finite_classifications);
         return FP_NAN;
     }
     else if (abs(rhs) == zero)
@@ -7,8 +7,8 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_IMPL_ATAN_IMPL_HPP
 
 #include <boost/decimal/detail/concepts.hpp>
-#include <boost/decimal/detail/cmath/impl/remez_series_result.hpp>
-#include <boost/decimal/detail/cmath/impl/taylor_series_result.hpp>
+#include <boost/decimal/detail/cmath/fma.hpp>
+#include <boost/decimal/detail/cmath/impl/fixed_point_series.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <array>
@@ -41,48 +41,95 @@ struct atan_table_imp
 
     static constexpr std::array<::boost::decimal::decimal128, 3> d128_atan_values =
     {{
-        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(251343872473191), UINT64_C(15780610568723885484) }, -34 }, // atan_half
-        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(425765197510819), UINT64_C(5970600460659265246)  }, -34 }, // atan_one
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(251343872473191), UINT64_C(15780610568723885488) }, -34 }, // atan_half
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(425765197510819), UINT64_C(5970600460659265253)  }, -34 }, // atan_one
         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(532773544924935), UINT64_C(16408933314882201700) }, -34 }, // atan_three_halves
     }};
 
-    // 10th degree remez polynomial calculated from 0, 0.4375
-    // Estimated max error: 2.3032664387910605e-12
-    static constexpr std::array<::boost::decimal::decimal32, 11> d32_coeffs =
+    // atan(j/16) for j = 1, ..., 7
+    static constexpr std::array<::boost::decimal::decimal32, 7> d32_fraction_values =
     {{
-        ::boost::decimal::decimal32 { UINT64_C(61037779951304161), -18, true },
-        ::boost::decimal::decimal32 { UINT64_C(10723099589331457), -17 },
-        ::boost::decimal::decimal32 { UINT64_C(22515613909953665), -18 },
-        ::boost::decimal::decimal32 { UINT64_C(15540713402718176), -17, true },
-        ::boost::decimal::decimal32 { UINT64_C(35999727706986597), -19 },
-        ::boost::decimal::decimal32 { UINT64_C(19938867353282852), -17 },
-        ::boost::decimal::decimal32 { UINT64_C(62252075283915644), -22 },
-        ::boost::decimal::decimal32 { UINT64_C(33333695504913247), -17, true },
-        ::boost::decimal::decimal32 { UINT64_C(10680927642397763), -24 },
-        ::boost::decimal::decimal32 { UINT64_C(99999999877886492), -17 },
-        ::boost::decimal::decimal32 { UINT64_C(23032664387910606), -29 },
+        ::boost::decimal::decimal32 { UINT64_C(6241880999595734847), -20 }, // atan(1/16)
+        ::boost::decimal::decimal32 { UINT64_C(1243549945467614350), -19 }, // atan(2/16)
+        ::boost::decimal::decimal32 { UINT64_C(1853479499956947649), -19 }, // atan(3/16)
+        ::boost::decimal::decimal32 { UINT64_C(2449786631268641542), -19 }, // atan(4/16)
+        ::boost::decimal::decimal32 { UINT64_C(3028848683749714056), -19 }, // atan(5/16)
+        ::boost::decimal::decimal32 { UINT64_C(3587706702705722204), -19 }, // atan(6/16)
+        ::boost::decimal::decimal32 { UINT64_C(4124104415973873069), -19 }, // atan(7/16)
     }};
 
-    static constexpr std::array<::boost::decimal::decimal64, 11> d64_coeffs =
+    // Series[ArcTan[r]/r, {r, 0, 4}], the coefficients of r^0, r^2, ..., which are enough for 0 <= r < 1/16
+    static constexpr std::array<::boost::decimal::decimal32, 3> d32_coeffs =
     {{
-        ::boost::decimal::decimal64 { UINT64_C(61037779951304161), -18, true },
-        ::boost::decimal::decimal64 { UINT64_C(10723099589331457), -17 },
-        ::boost::decimal::decimal64 { UINT64_C(22515613909953665), -18 },
-        ::boost::decimal::decimal64 { UINT64_C(15540713402718176), -17, true },
-        ::boost::decimal::decimal64 { UINT64_C(35999727706986597), -19 },
-        ::boost::decimal::decimal64 { UINT64_C(19938867353282852), -17 },
-        ::boost::decimal::decimal64 { UINT64_C(62252075283915644), -22 },
-        ::boost::decimal::decimal64 { UINT64_C(33333695504913247), -17, true },
-        ::boost::decimal::decimal64 { UINT64_C(10680927642397763), -24 },
-        ::boost::decimal::decimal64 { UINT64_C(99999999877886492), -17 },
-        ::boost::decimal::decimal64 { UINT64_C(23032664387910606), -29 },
+        ::boost::decimal::decimal32 { 1 }, // +1
+        ::boost::decimal::decimal32 { UINT64_C(3333333333333333333), -19, true }, // -1/3
+        ::boost::decimal::decimal32 { UINT64_C(2000000000000000000), -19 }, // +1/5
+    }};
+
+    static constexpr std::array<::boost::decimal::decimal64, 7> d64_fraction_values =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(6241880999595734847), -20 }, // atan(1/16)
+        ::boost::decimal::decimal64 { UINT64_C(1243549945467614350), -19 }, // atan(2/16)
+        ::boost::decimal::decimal64 { UINT64_C(1853479499956947649), -19 }, // atan(3/16)
+        ::boost::decimal::decimal64 { UINT64_C(2449786631268641542), -19 }, // atan(4/16)
+        ::boost::decimal::decimal64 { UINT64_C(3028848683749714056), -19 }, // atan(5/16)
+        ::boost::decimal::decimal64 { UINT64_C(3587706702705722204), -19 }, // atan(6/16)
+        ::boost::decimal::decimal64 { UINT64_C(4124104415973873069), -19 }, // atan(7/16)
+    }};
+
+    // Series[ArcTan[r]/r, {r, 0, 12}], the coefficients of r^0, r^2, ..., which are enough for 0 <= r < 1/16
+    static constexpr std::array<::boost::decimal::decimal64, 7> d64_coeffs =
+    {{
+        ::boost::decimal::decimal64 { 1 }, // +1
+        ::boost::decimal::decimal64 { UINT64_C(3333333333333333333), -19, true }, // -1/3
+        ::boost::decimal::decimal64 { UINT64_C(2000000000000000000), -19 }, // +1/5
+        ::boost::decimal::decimal64 { UINT64_C(1428571428571428571), -19, true }, // -1/7
+        ::boost::decimal::decimal64 { UINT64_C(1111111111111111111), -19 }, // +1/9
+        ::boost::decimal::decimal64 { UINT64_C(9090909090909090909), -20, true }, // -1/11
+        ::boost::decimal::decimal64 { UINT64_C(7692307692307692308), -20 }, // +1/13
+    }};
+
+    static constexpr std::array<::boost::decimal::decimal128, 7> d128_fraction_values =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(338373047007884), UINT64_C(7143811091241609967) }, -35 }, // atan(1/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(67412977623510), UINT64_C(16645145185131546550) }, -34 }, // atan(2/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(100477325025533), UINT64_C(8359101126430874118) }, -34 }, // atan(3/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(132803199387370), UINT64_C(6038427536218622838) }, -34 }, // atan(4/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(164194216152565), UINT64_C(506699410146760542) }, -34 }, // atan(5/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(194489970065717), UINT64_C(9041157938515715933) }, -34 }, // atan(6/16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(223568148367796), UINT64_C(14440964307482512933) }, -34 }, // atan(7/16)
+    }};
+
+    // Series[ArcTan[r]/r, {r, 0, 28}], the coefficients of r^0, r^2, ..., which are enough for 0 <= r < 1/16
+    static constexpr std::array<::boost::decimal::decimal128, 15> d128_coeffs =
+    {{
+        ::boost::decimal::decimal128 { 1 }, // +1
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(180700362080917), UINT64_C(7483252092553221461) }, -34, true }, // -1/3
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(108420217248550), UINT64_C(8179300070273843200) }, -34 }, // +1/5
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(77443012320393), UINT64_C(3207108039665666341) }, -34, true }, // -1/7
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(60233454026972), UINT64_C(8643332055420924359) }, -34 }, // +1/9
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(492819169311592), UINT64_C(17054915875379776419) }, -35, true }, // -1/11
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(417000835571347), UINT64_C(15850062977145160940) }, -35 }, // +1/13
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(361400724161834), UINT64_C(14966504185106442923) }, -35, true }, // -1/15
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(318882991907501), UINT64_C(5610020838860575443) }, -35 }, // +1/17
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(285316361180395), UINT64_C(16670067533954968522) }, -35, true }, // -1/19
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(258143374401310), UINT64_C(10690360132218887802) }, -35 }, // +1/21
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(235696124453370), UINT64_C(9760763598982462776) }, -35, true }, // -1/23
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(216840434497100), UINT64_C(16358600140547686400) }, -35 }, // +1/25
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(200778180089908), UINT64_C(4215448086457012376) }, -35, true }, // -1/27
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(186931409049224), UINT64_C(16646619993397598844) }, -35 }, // +1/29
     }};
 };
 
 #if !(defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L) && (!defined(_MSC_VER) || _MSC_VER != 1900)
 
-template <bool b> constexpr std::array<decimal32, 11> atan_table_imp<b>::d32_coeffs;
-template <bool b> constexpr std::array<decimal64, 11> atan_table_imp<b>::d64_coeffs;
+template <bool b> constexpr std::array<decimal32,   3> atan_table_imp<b>::d32_coeffs;
+template <bool b> constexpr std::array<decimal64,   7> atan_table_imp<b>::d64_coeffs;
+template <bool b> constexpr std::array<decimal128, 15> atan_table_imp<b>::d128_coeffs;
+
+template <bool b> constexpr std::array<decimal32,  7> atan_table_imp<b>::d32_fraction_values;
+template <bool b> constexpr std::array<decimal64,  7> atan_table_imp<b>::d64_fraction_values;
+template <bool b> constexpr std::array<decimal128, 7> atan_table_imp<b>::d128_fraction_values;
 
 template <bool b> constexpr std::array<decimal32,  3> atan_table_imp<b>::d32_atan_values;
 template <bool b> constexpr std::array<decimal64,  3> atan_table_imp<b>::d64_atan_values;
@@ -94,57 +141,43 @@ using atan_table = atan_table_imp<true>;
 
 } //namespace atan_detail
 
+// atan(x) for |x| <= 7/16. |x| is reduced against c = j/16 with j = floor(16 |x|) to
+// atan(|x|) = atan(c) + atan(r), where r = (|x| - c)/(1 + |x| c) lies in [0, 1/16) and |x| - c is exact.
+// Both terms are positive, and atan(r) = r * P(r^2) is the Taylor series evaluated in scaled integers,
+// so the result is within about two ulp
+template <typename T, typename CoeffsArray, typename ValuesArray>
+constexpr auto atan_series_impl(T x, const CoeffsArray& coeffs, const ValuesArray& fraction_values) noexcept -> T
+{
+    constexpr T one { 1, 0 };
+    constexpr T sixteen { 16, 0 };
+
+    if (signbit(x))
+    {
+        return -atan_series_impl(-x, coeffs, fraction_values);
+    }
+
+    const auto j { static_cast<int>(x * sixteen) };
+
+    if (j == 0)
+    {
+        return x * fixed_point_horner(x * x, coeffs, false);
+    }
+
+    const T c { j * 625, -4 };
+    const T r { (x - c) / fma(x, c, one) };
+
+    return fma(r, fixed_point_horner(r * r, coeffs, false), fraction_values[static_cast<std::size_t>(j - 1)]);
+}
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
 constexpr auto atan_series(T x) noexcept;
 
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
 constexpr auto atan_values(std::size_t idx) noexcept -> T;
 
-template <> constexpr auto atan_series<decimal32> (decimal32 x) noexcept { return remez_series_result(x, atan_detail::atan_table::d32_coeffs); }
-template <> constexpr auto atan_series<decimal64> (decimal64 x) noexcept { return remez_series_result(x, atan_detail::atan_table::d64_coeffs); }
-
-template <>
-constexpr auto atan_series<decimal128>(decimal128 x) noexcept
-{
-    // PadeApproximant[ArcTan[x]/x, {x, 0, {18, 18}}]
-    // FullSimplify[%]
-    // HornerForm[Numerator[Out[2]]]
-    // HornerForm[Denominator[Out[2]]]
-
-    const decimal128 x2 { x * x };
-
-    const decimal128
-        top
-        {
-                    decimal128 { UINT64_C(21427381364263875) }
-            + x2 * (decimal128 { UINT64_C(91886788553059500) }
-            + x2 * (decimal128 { UINT64_C(163675410390191700) }
-            + x2 * (decimal128 { UINT64_C(156671838074852100) }
-            + x2 * (decimal128 { UINT64_C(87054123957610810) }
-            + x2 * (decimal128 { UINT64_C(28283323008669300) }
-            + x2 * (decimal128 { UINT64_C(5134145876036100) }
-            + x2 * (decimal128 { UINT64_C(463911017673180) }
-            + x2 * (decimal128 { UINT64_C(16016872057515) }
-            + x2 *  decimal128 { UINT64_C(90194313216) }))))))))
-        };
-
-    const decimal128
-        bot
-        {
-                    decimal128 { UINT64_C(21427381364263875) }
-            + x2 * (decimal128 { UINT64_C(99029249007814125) }
-            + x2 * (decimal128 { UINT64_C(192399683786610300) }
-            + x2 * (decimal128 { UINT64_C(204060270682768500) }
-            + x2 * (decimal128 { UINT64_C(128360492848838250) }
-            + x2 * (decimal128 { UINT64_C(48688462804731750) }
-            + x2 * (decimal128 { UINT64_C(10819658401051500) }
-            + x2 * (decimal128 { UINT64_C(1298359008126180) }
-            + x2 * (decimal128 { UINT64_C(70562989572075) }
-            + x2 *  decimal128 { UINT64_C(1120047453525) }))))))))
-        };
-
-    return (x * top) / bot;
-}
+template <> constexpr auto atan_series<decimal32> (decimal32 x)  noexcept { return atan_series_impl(x, atan_detail::atan_table::d32_coeffs,  atan_detail::atan_table::d32_fraction_values); }
+template <> constexpr auto atan_series<decimal64> (decimal64 x)  noexcept { return atan_series_impl(x, atan_detail::atan_table::d64_coeffs,  atan_detail::atan_table::d64_fraction_values); }
+template <> constexpr auto atan_series<decimal128>(decimal128 x) noexcept { return atan_series_impl(x, atan_detail::atan_table::d128_coeffs, atan_detail::atan_table::d128_fraction_values); }
 
 template <> constexpr auto atan_values<decimal32> (std::size_t idx) noexcept -> decimal32  { return atan_detail::atan_table::d32_atan_values [idx]; }
 template <> constexpr auto atan_values<decimal64> (std::size_t idx) noexcept -> decimal64  { return atan_detail::atan_table::d64_atan_values [idx]; }
@@ -8,6 +8,12 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_IMPL_HPP
 
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/cmath/impl/fixed_point_series.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <type_traits>
+#endif
 
 namespace boost {
 namespace decimal {
@@ -18,7 +24,7 @@ namespace tools {
 // This requires a for-loop which may be more expensive than
 // the loop expanded versions above:
 //
-template <typename T, typename U>
+template <typename T, typename U, std::enable_if_t<!detail::is_decimal_floating_point_v<U>, bool> = true>
 constexpr U evaluate_polynomial(const T& poly, const U& z) noexcept
 {
     const auto count {poly.size()};
@@ -32,6 +38,13 @@ constexpr U evaluate_polynomial(const T& poly, const U& z) noexcept
     return sum;
 }
 
+// The decimal types evaluate the polynomial in scaled integers, see fixed_point_series.hpp
+template <typename T, typename U, std::enable_if_t<detail::is_decimal_floating_point_v<U>, bool> = true>
+constexpr U evaluate_polynomial(const T& poly, const U& z) noexcept
+{
+    return detail::fixed_point_horner(z, poly, false);
+}
+
 } //namespace tools
 } //namespace decimal
 } //namespace boost
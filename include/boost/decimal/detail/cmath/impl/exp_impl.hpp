@@ -0,0 +1,467 @@
+// Copyright 2024 Matt Borland
+// Copyright 2024 Christopher Kormanyos
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_EXP_IMPL_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_EXP_IMPL_HPP
+
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/cmath/impl/taylor_series_result.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+namespace exp_detail {
+
+template <bool b>
+struct exp_table_imp
+{
+private:
+    using d32_coeffs_t  = std::array<decimal32,   3>;
+    using d64_coeffs_t  = std::array<decimal64,   7>;
+    using d128_coeffs_t = std::array<decimal128, 13>;
+
+    using d32_values_t  = std::array<decimal32,  64>;
+    using d64_values_t  = std::array<decimal64,  64>;
+    using d128_values_t = std::array<decimal128, 64>;
+
+    using d32_reduction_t  = std::array<decimal32,  3>;
+    using d64_reduction_t  = std::array<decimal64,  3>;
+    using d128_reduction_t = std::array<decimal128, 3>;
+
+public:
+    // The series of (Exp[r] - 1)/r is only evaluated for |r| <= Log[10]/128,
+    // so it is truncated once the remaining terms are below the precision of each type
+    static constexpr d32_coeffs_t d32_coeffs =
+    {{
+        // Series[(Exp[r] - 1)/r, {r, 0, 2}]
+        ::boost::decimal::decimal32 { UINT64_C(1000000000000000000), -18 }, // * r^0
+        ::boost::decimal::decimal32 { UINT64_C(5000000000000000000), -19 }, // * r^1
+        ::boost::decimal::decimal32 { UINT64_C(1666666666666666667), -19 }, // * r^2
+    }};
+
+    static constexpr d64_coeffs_t d64_coeffs =
+    {{
+        // Series[(Exp[r] - 1)/r, {r, 0, 6}]
+        ::boost::decimal::decimal64 { UINT64_C(1000000000000000000), -18 }, // * r^0
+        ::boost::decimal::decimal64 { UINT64_C(5000000000000000000), -19 }, // * r^1
+        ::boost::decimal::decimal64 { UINT64_C(1666666666666666667), -19 }, // * r^2
+        ::boost::decimal::decimal64 { UINT64_C(4166666666666666667), -20 }, // * r^3
+        ::boost::decimal::decimal64 { UINT64_C(8333333333333333333), -21 }, // * r^4
+        ::boost::decimal::decimal64 { UINT64_C(1388888888888888889), -21 }, // * r^5
+        ::boost::decimal::decimal64 { UINT64_C(1984126984126984127), -22 }, // * r^6
+    }};
+
+    static constexpr d128_coeffs_t d128_coeffs =
+    {{
+        // Series[(Exp[r] - 1)/r, {r, 0, 12}]
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(54210108624275), UINT64_C(4089650035136921600) }, -33 }, // * r^0
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(271050543121376), UINT64_C(2001506101975056384) }, -34 }, // * r^1
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(90350181040458), UINT64_C(12964998083131386539) }, -34 }, // * r^2
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(225875452601146), UINT64_C(13965751134118914731) }, -35 }, // * r^3
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(451750905202293), UINT64_C(9484758194528277845) }, -36 }, // * r^4
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(75291817533715), UINT64_C(10804165069276155449) }, -36 }, // * r^5
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(107559739333879), UINT64_C(7528774067376128520) }, -37 }, // * r^6
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(134449674167349), UINT64_C(4799281565792772746) }, -38 }, // * r^7
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(149388526852610), UINT64_C(5332535073103080829) }, -39 }, // * r^8
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(149388526852610), UINT64_C(5332535073103080829) }, -40 }, // * r^9
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(135807751684191), UINT64_C(3170782423392841516) }, -41 }, // * r^10
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(113173126403492), UINT64_C(11865690723015477071) }, -42 }, // * r^11
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(87056251079609), UINT64_C(13384395342406417351) }, -43 }, // * r^12
+    }};
+
+    // 10^(j/64) for j = 0, ..., 63
+    static constexpr d32_values_t d32_values =
+    {{
+        ::boost::decimal::decimal32 { UINT64_C(1000000000000000000), -18 }, // 10^(0/64)
+        ::boost::decimal::decimal32 { UINT64_C(1036632928437697997), -18 }, // 10^(1/64)
+        ::boost::decimal::decimal32 { UINT64_C(1074607828321317497), -18 }, // 10^(2/64)
+        ::boost::decimal::decimal32 { UINT64_C(1113973859994802376), -18 }, // 10^(3/64)
+        ::boost::decimal::decimal32 { UINT64_C(1154781984689458180), -18 }, // 10^(4/64)
+        ::boost::decimal::decimal32 { UINT64_C(1197085030495729966), -18 }, // 10^(5/64)
+        ::boost::decimal::decimal32 { UINT64_C(1240937760751719566), -18 }, // 10^(6/64)
+        ::boost::decimal::decimal32 { UINT64_C(1286396944936974507), -18 }, // 10^(7/64)
+        ::boost::decimal::decimal32 { UINT64_C(1333521432163324026), -18 }, // 10^(8/64)
+        ::boost::decimal::decimal32 { UINT64_C(1382372227357899619), -18 }, // 10^(9/64)
+        ::boost::decimal::decimal32 { UINT64_C(1433012570236962742), -18 }, // 10^(10/64)
+        ::boost::decimal::decimal32 { UINT64_C(1485508017172775073), -18 }, // 10^(11/64)
+        ::boost::decimal::decimal32 { UINT64_C(1539926526059491990), -18 }, // 10^(12/64)
+        ::boost::decimal::decimal32 { UINT64_C(1596338544287942240), -18 }, // 10^(13/64)
+        ::boost::decimal::decimal32 { UINT64_C(1654817099943181423), -18 }, // 10^(14/64)
+        ::boost::decimal::decimal32 { UINT64_C(1715437896342878923), -18 }, // 10^(15/64)
+        ::boost::decimal::decimal32 { UINT64_C(1778279410038922801), -18 }, // 10^(16/64)
+        ::boost::decimal::decimal32 { UINT64_C(1843422992409110474), -18 }, // 10^(17/64)
+        ::boost::decimal::decimal32 { UINT64_C(1910952974970440516), -18 }, // 10^(18/64)
+        ::boost::decimal::decimal32 { UINT64_C(1980956778550338756), -18 }, // 10^(19/64)
+        ::boost::decimal::decimal32 { UINT64_C(2053525026457146075), -18 }, // 10^(20/64)
+        ::boost::decimal::decimal32 { UINT64_C(2128751661796372593), -18 }, // 10^(21/64)
+        ::boost::decimal::decimal32 { UINT64_C(2206734069084589800), -18 }, // 10^(22/64)
+        ::boost::decimal::decimal32 { UINT64_C(2287573200318395687), -18 }, // 10^(23/64)
+        ::boost::decimal::decimal32 { UINT64_C(2371373705661655262), -18 }, // 10^(24/64)
+        ::boost::decimal::decimal32 { UINT64_C(2458244068920197393), -18 }, // 10^(25/64)
+        ::boost::decimal::decimal32 { UINT64_C(2548296747979346528), -18 }, // 10^(26/64)
+        ::boost::decimal::decimal32 { UINT64_C(2641648320386092458), -18 }, // 10^(27/64)
+        ::boost::decimal::decimal32 { UINT64_C(2738419634264361294), -18 }, // 10^(28/64)
+        ::boost::decimal::decimal32 { UINT64_C(2838735964758754764), -18 }, // 10^(29/64)
+        ::boost::decimal::decimal32 { UINT64_C(2942727176209281811), -18 }, // 10^(30/64)
+        ::boost::decimal::decimal32 { UINT64_C(3050527890267025536), -18 }, // 10^(31/64)
+        ::boost::decimal::decimal32 { UINT64_C(3162277660168379332), -18 }, // 10^(32/64)
+        ::boost::decimal::decimal32 { UINT64_C(3278121151393458639), -18 }, // 10^(33/64)
+        ::boost::decimal::decimal32 { UINT64_C(3398208328942559372), -18 }, // 10^(34/64)
+        ::boost::decimal::decimal32 { UINT64_C(3522694651473101445), -18 }, // 10^(35/64)
+        ::boost::decimal::decimal32 { UINT64_C(3651741272548377058), -18 }, // 10^(36/64)
+        ::boost::decimal::decimal32 { UINT64_C(3785515249258629973), -18 }, // 10^(37/64)
+        ::boost::decimal::decimal32 { UINT64_C(3924189758484535862), -18 }, // 10^(38/64)
+        ::boost::decimal::decimal32 { UINT64_C(4067944321083047251), -18 }, // 10^(39/64)
+        ::boost::decimal::decimal32 { UINT64_C(4216965034285822486), -18 }, // 10^(40/64)
+        ::boost::decimal::decimal32 { UINT64_C(4371444812611089702), -18 }, // 10^(41/64)
+        ::boost::decimal::decimal32 { UINT64_C(4531583637600817883), -18 }, // 10^(42/64)
+        ::boost::decimal::decimal32 { UINT64_C(4697588816706491820), -18 }, // 10^(43/64)
+        ::boost::decimal::decimal32 { UINT64_C(4869675251658631149), -18 }, // 10^(44/64)
+        ::boost::decimal::decimal32 { UINT64_C(5048065716667470770), -18 }, // 10^(45/64)
+        ::boost::decimal::decimal32 { UINT64_C(5232991146814946881), -18 }, // 10^(46/64)
+        ::boost::decimal::decimal32 { UINT64_C(5424690937011326004), -18 }, // 10^(47/64)
+        ::boost::decimal::decimal32 { UINT64_C(5623413251903490804), -18 }, // 10^(48/64)
+        ::boost::decimal::decimal32 { UINT64_C(5829415347136073964), -18 }, // 10^(49/64)
+        ::boost::decimal::decimal32 { UINT64_C(6042963902381328190), -18 }, // 10^(50/64)
+        ::boost::decimal::decimal32 { UINT64_C(6264335366568855612), -18 }, // 10^(51/64)
+        ::boost::decimal::decimal32 { UINT64_C(6493816315762113151), -18 }, // 10^(52/64)
+        ::boost::decimal::decimal32 { UINT64_C(6731703824144982304), -18 }, // 10^(53/64)
+        ::boost::decimal::decimal32 { UINT64_C(6978305848598663384), -18 }, // 10^(54/64)
+        ::boost::decimal::decimal32 { UINT64_C(7233941627366747615), -18 }, // 10^(55/64)
+        ::boost::decimal::decimal32 { UINT64_C(7498942093324558273), -18 }, // 10^(56/64)
+        ::boost::decimal::decimal32 { UINT64_C(7773650302387758033), -18 }, // 10^(57/64)
+        ::boost::decimal::decimal32 { UINT64_C(8058421877614818170), -18 }, // 10^(58/64)
+        ::boost::decimal::decimal32 { UINT64_C(8353625469578261733), -18 }, // 10^(59/64)
+        ::boost::decimal::decimal32 { UINT64_C(8659643233600653524), -18 }, // 10^(60/64)
+        ::boost::decimal::decimal32 { UINT64_C(8976871324473141945), -18 }, // 10^(61/64)
+        ::boost::decimal::decimal32 { UINT64_C(9305720409296989793), -18 }, // 10^(62/64)
+        ::boost::decimal::decimal32 { UINT64_C(9646616199111992137), -18 }, // 10^(63/64)
+    }};
+
+    // 10^(j/64) for j = 0, ..., 63
+    static constexpr d64_values_t d64_values =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(1000000000000000000), -18 }, // 10^(0/64)
+        ::boost::decimal::decimal64 { UINT64_C(1036632928437697997), -18 }, // 10^(1/64)
+        ::boost::decimal::decimal64 { UINT64_C(1074607828321317497), -18 }, // 10^(2/64)
+        ::boost::decimal::decimal64 { UINT64_C(1113973859994802376), -18 }, // 10^(3/64)
+        ::boost::decimal::decimal64 { UINT64_C(1154781984689458180), -18 }, // 10^(4/64)
+        ::boost::decimal::decimal64 { UINT64_C(1197085030495729966), -18 }, // 10^(5/64)
+        ::boost::decimal::decimal64 { UINT64_C(1240937760751719566), -18 }, // 10^(6/64)
+        ::boost::decimal::decimal64 { UINT64_C(1286396944936974507), -18 }, // 10^(7/64)
+        ::boost::decimal::decimal64 { UINT64_C(1333521432163324026), -18 }, // 10^(8/64)
+        ::boost::decimal::decimal64 { UINT64_C(1382372227357899619), -18 }, // 10^(9/64)
+        ::boost::decimal::decimal64 { UINT64_C(1433012570236962742), -18 }, // 10^(10/64)
+        ::boost::decimal::decimal64 { UINT64_C(1485508017172775073), -18 }, // 10^(11/64)
+        ::boost::decimal::decimal64 { UINT64_C(1539926526059491990), -18 }, // 10^(12/64)
+        ::boost::decimal::decimal64 { UINT64_C(1596338544287942240), -18 }, // 10^(13/64)
+        ::boost::decimal::decimal64 { UINT64_C(1654817099943181423), -18 }, // 10^(14/64)
+        ::boost::decimal::decimal64 { UINT64_C(1715437896342878923), -18 }, // 10^(15/64)
+        ::boost::decimal::decimal64 { UINT64_C(1778279410038922801), -18 }, // 10^(16/64)
+        ::boost::decimal::decimal64 { UINT64_C(1843422992409110474), -18 }, // 10^(17/64)
+        ::boost::decimal::decimal64 { UINT64_C(1910952974970440516), -18 }, // 10^(18/64)
+        ::boost::decimal::decimal64 { UINT64_C(1980956778550338756), -18 }, // 10^(19/64)
+        ::boost::decimal::decimal64 { UINT64_C(2053525026457146075), -18 }, // 10^(20/64)
+        ::boost::decimal::decimal64 { UINT64_C(2128751661796372593), -18 }, // 10^(21/64)
+        ::boost::decimal::decimal64 { UINT64_C(2206734069084589800), -18 }, // 10^(22/64)
+        ::boost::decimal::decimal64 { UINT64_C(2287573200318395687), -18 }, // 10^(23/64)
+        ::boost::decimal::decimal64 { UINT64_C(2371373705661655262), -18 }, // 10^(24/64)
+        ::boost::decimal::decimal64 { UINT64_C(2458244068920197393), -18 }, // 10^(25/64)
+        ::boost::decimal::decimal64 { UINT64_C(2548296747979346528), -18 }, // 10^(26/64)
+        ::boost::decimal::decimal64 { UINT64_C(2641648320386092458), -18 }, // 10^(27/64)
+        ::boost::decimal::decimal64 { UINT64_C(2738419634264361294), -18 }, // 10^(28/64)
+        ::boost::decimal::decimal64 { UINT64_C(2838735964758754764), -18 }, // 10^(29/64)
+        ::boost::decimal::decimal64 { UINT64_C(2942727176209281811), -18 }, // 10^(30/64)
+        ::boost::decimal::decimal64 { UINT64_C(3050527890267025536), -18 }, // 10^(31/64)
+        ::boost::decimal::decimal64 { UINT64_C(3162277660168379332), -18 }, // 10^(32/64)
+        ::boost::decimal::decimal64 { UINT64_C(3278121151393458639), -18 }, // 10^(33/64)
+        ::boost::decimal::decimal64 { UINT64_C(3398208328942559372), -18 }, // 10^(34/64)
+        ::boost::decimal::decimal64 { UINT64_C(3522694651473101445), -18 }, // 10^(35/64)
+        ::boost::decimal::decimal64 { UINT64_C(3651741272548377058), -18 }, // 10^(36/64)
+        ::boost::decimal::decimal64 { UINT64_C(3785515249258629973), -18 }, // 10^(37/64)
+        ::boost::decimal::decimal64 { UINT64_C(3924189758484535862), -18 }, // 10^(38/64)
+        ::boost::decimal::decimal64 { UINT64_C(4067944321083047251), -18 }, // 10^(39/64)
+        ::boost::decimal::decimal64 { UINT64_C(4216965034285822486), -18 }, // 10^(40/64)
+        ::boost::decimal::decimal64 { UINT64_C(4371444812611089702), -18 }, // 10^(41/64)
+        ::boost::decimal::decimal64 { UINT64_C(4531583637600817883), -18 }, // 10^(42/64)
+        ::boost::decimal::decimal64 { UINT64_C(4697588816706491820), -18 }, // 10^(43/64)
+        ::boost::decimal::decimal64 { UINT64_C(4869675251658631149), -18 }, // 10^(44/64)
+        ::boost::decimal::decimal64 { UINT64_C(5048065716667470770), -18 }, // 10^(45/64)
+        ::boost::decimal::decimal64 { UINT64_C(5232991146814946881), -18 }, // 10^(46/64)
+        ::boost::decimal::decimal64 { UINT64_C(5424690937011326004), -18 }, // 10^(47/64)
+        ::boost::decimal::decimal64 { UINT64_C(5623413251903490804), -18 }, // 10^(48/64)
+        ::boost::decimal::decimal64 { UINT64_C(5829415347136073964), -18 }, // 10^(49/64)
+        ::boost::decimal::decimal64 { UINT64_C(6042963902381328190), -18 }, // 10^(50/64)
+        ::boost::decimal::decimal64 { UINT64_C(6264335366568855612), -18 }, // 10^(51/64)
+        ::boost::decimal::decimal64 { UINT64_C(6493816315762113151), -18 }, // 10^(52/64)
+        ::boost::decimal::decimal64 { UINT64_C(6731703824144982304), -18 }, // 10^(53/64)
+        ::boost::decimal::decimal64 { UINT64_C(6978305848598663384), -18 }, // 10^(54/64)
+        ::boost::decimal::decimal64 { UINT64_C(7233941627366747615), -18 }, // 10^(55/64)
+        ::boost::decimal::decimal64 { UINT64_C(7498942093324558273), -18 }, // 10^(56/64)
+        ::boost::decimal::decimal64 { UINT64_C(7773650302387758033), -18 }, // 10^(57/64)
+        ::boost::decimal::decimal64 { UINT64_C(8058421877614818170), -18 }, // 10^(58/64)
+        ::boost::decimal::decimal64 { UINT64_C(8353625469578261733), -18 }, // 10^(59/64)
+        ::boost::decimal::decimal64 { UINT64_C(8659643233600653524), -18 }, // 10^(60/64)
+        ::boost::decimal::decimal64 { UINT64_C(8976871324473141945), -18 }, // 10^(61/64)
+        ::boost::decimal::decimal64 { UINT64_C(9305720409296989793), -18 }, // 10^(62/64)
+        ::boost::decimal::decimal64 { UINT64_C(9646616199111992137), -18 }, // 10^(63/64)
+    }};
+
+    // 10^(j/64) for j = 0, ..., 63
+    static constexpr d128_values_t d128_values =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(54210108624275), UINT64_C(4089650035136921600) }, -33 }, // 10^(0/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(56195983654108), UINT64_C(2415175285808486816) }, -33 }, // 10^(1/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(58254607101795), UINT64_C(2222696382813213624) }, -33 }, // 10^(2/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(60388643954921), UINT64_C(7280447269259535328) }, -33 }, // 10^(3/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(62600856827371), UINT64_C(12062119554161213972) }, -33 }, // 10^(4/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(64894109535667), UINT64_C(6230886666359433844) }, -33 }, // 10^(5/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(67271370806315), UINT64_C(10599011556324096032) }, -33 }, // 10^(6/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(69735718118969), UINT64_C(3306379435115424161) }, -33 }, // 10^(7/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(72290341690372), UINT64_C(15804743180091054179) }, -33 }, // 10^(8/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(74938548604253), UINT64_C(400547259141347495) }, -33 }, // 10^(9/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(77683767092497), UINT64_C(10621560636576723466) }, -33 }, // 10^(10/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(80529550973167), UINT64_C(15460377081668114549) }, -33 }, // 10^(11/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(83479584251087), UINT64_C(15654604768064338804) }, -33 }, // 10^(12/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(86537685886966), UINT64_C(13476455013414942274) }, -33 }, // 10^(13/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(89707814741227), UINT64_C(17907030576700590014) }, -33 }, // 10^(14/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(92994074698945), UINT64_C(11888548381609672461) }, -33 }, // 10^(15/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(96400719982522), UINT64_C(1147486153218337133) }, -33 }, // 10^(16/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(99932160658984), UINT64_C(6571511501098958780) }, -33 }, // 10^(17/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(103592968349029), UINT64_C(8657115465957100746) }, -33 }, // 10^(18/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(107387882145208), UINT64_C(3311225585598167159) }, -33 }, // 10^(19/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(111321814746909), UINT64_C(9910235673436340668) }, -33 }, // 10^(20/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(115399858820087), UINT64_C(13796404530877680905) }, -33 }, // 10^(21/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(119627293589964), UINT64_C(8751514486384321994) }, -33 }, // 10^(22/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(124009591675241), UINT64_C(2423169922506789780) }, -33 }, // 10^(23/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(128552426172668), UINT64_C(7176323451483047402) }, -33 }, // 10^(24/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(133261678001144), UINT64_C(3784814756501697022) }, -33 }, // 10^(25/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(138143443514847), UINT64_C(12439337662182676010) }, -33 }, // 10^(26/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(143204042395264), UINT64_C(4882636460143005886) }, -33 }, // 10^(27/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(148450025832319), UINT64_C(933368846295911654) }, -33 }, // 10^(28/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(153888185005208), UINT64_C(15005620410354579226) }, -33 }, // 10^(29/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(159525559873911), UINT64_C(15825982861923814907) }, -33 }, // 10^(30/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(165369448292756), UINT64_C(10665385796366485963) }, -33 }, // 10^(31/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(171427415457846), UINT64_C(13450487317535253583) }, -33 }, // 10^(32/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(177707303700573), UINT64_C(10179710953806082723) }, -33 }, // 10^(33/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(184217242639892), UINT64_C(17104936293743458389) }, -33 }, // 10^(34/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(190965659706510), UINT64_C(3190596214514669161) }, -33 }, // 10^(35/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(197961291052596), UINT64_C(10110014628733249970) }, -33 }, // 10^(36/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(205213192861160), UINT64_C(11478639531507882455) }, -33 }, // 10^(37/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(212730753069715), UINT64_C(680003704701691934) }, -33 }, // 10^(38/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(220523703523415), UINT64_C(9433110709412906496) }, -33 }, // 10^(39/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(228602132573404), UINT64_C(16998667136548273200) }, -33 }, // 10^(40/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(236976498136671), UINT64_C(11331977148346166647) }, -33 }, // 10^(41/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(245657641234328), UINT64_C(10668746383430011839) }, -33 }, // 10^(42/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(254656800025839), UINT64_C(7856112976508543614) }, -33 }, // 10^(43/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(263985624357359), UINT64_C(3155806234810401822) }, -33 }, // 10^(44/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(273656190843023), UINT64_C(6178843732221453365) }, -33 }, // 10^(45/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(283681018498708), UINT64_C(15398714737347322972) }, -33 }, // 10^(46/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(294073084948505), UINT64_C(5852589013799408793) }, -33 }, // 10^(47/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(304845843224876), UINT64_C(18384098468980565196) }, -33 }, // 10^(48/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(316013239184263), UINT64_C(11409156960131464688) }, -33 }, // 10^(49/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(327589729560665), UINT64_C(16385679427992593026) }, -33 }, // 10^(50/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(339590300680586), UINT64_C(11103990112603426970) }, -33 }, // 10^(51/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(352030487863554), UINT64_C(16167520033278774953) }, -33 }, // 10^(52/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(364926395533348), UINT64_C(7297149816714680160) }, -33 }, // 10^(53/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(378294718065948), UINT64_C(11463494155819298491) }, -33 }, // 10^(54/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(392152761401217), UINT64_C(12119908377489067767) }, -33 }, // 10^(55/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(406518465446274), UINT64_C(2229496596878272580) }, -33 }, // 10^(56/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(421410427299570), UINT64_C(5290285211478304479) }, -33 }, // 10^(57/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(436847925325735), UINT64_C(3313045976361770019) }, -33 }, // 10^(58/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(452850944112349), UINT64_C(12451885116933091202) }, -33 }, // 10^(59/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(469440200340961), UINT64_C(6564890246205659324) }, -33 }, // 10^(60/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(486637169605830), UINT64_C(7456574310878820073) }, -33 }, // 10^(61/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(504464114215124), UINT64_C(12771491061359150907) }, -33 }, // 10^(62/64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(522944112010554), UINT64_C(1184410866960622858) }, -33 }, // 10^(63/64)
+    }};
+
+    // 64/Log[10], followed by Log[10]/64 split into a leading part with few enough digits
+    // that its product with the reduction multiple is exact, and the remainder
+    static constexpr d32_reduction_t d32_reduction =
+    {{
+        ::boost::decimal::decimal32 { UINT64_C(2779484684180811697), -17 },
+        ::boost::decimal::decimal32 { UINT64_C(359), -4 },
+        ::boost::decimal::decimal32 { UINT64_C(7789207803196381278), -23 },
+    }};
+
+    static constexpr d64_reduction_t d64_reduction =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(2779484684180811697), -17 },
+        ::boost::decimal::decimal64 { UINT64_C(35977892078), -12 },
+        ::boost::decimal::decimal64 { UINT64_C(3196381278111647944), -32 },
+    }};
+
+    static constexpr d128_reduction_t d128_reduction =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(150676166648951), UINT64_C(2048511353594311457) }, -32 },
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(195036543), UINT64_C(14061148248013408159) }, -29 },
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(511916395979370), UINT64_C(15076026509864358828) }, -63 },
+    }};
+
+    // 64 Log[10, 2], followed by Log[2, 10]/64 split in the same way for exp2,
+    // whose reduction multiples have one more digit than those of exp
+    static constexpr d32_reduction_t d32_exp2_reduction =
+    {{
+        ::boost::decimal::decimal32 { UINT64_C(1926591972249479649), -17 },
+        ::boost::decimal::decimal32 { UINT64_C(519), -4 },
+        ::boost::decimal::decimal32 { UINT64_C(5126482615036685474), -24 },
+    }};
+
+    static constexpr d64_reduction_t d64_exp2_reduction =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(1926591972249479649), -17 },
+        ::boost::decimal::decimal64 { UINT64_C(51905126482), -12 },
+        ::boost::decimal::decimal64 { UINT64_C(6150366854737410858), -31 },
+    }};
+
+    static constexpr d128_reduction_t d128_exp2_reduction =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(104440760090300), UINT64_C(17069477688255311955) }, -32 },
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(281378254), UINT64_C(8816262731714415644) }, -29 },
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(312885649349572), UINT64_C(8401803117901847217) }, -63 },
+    }};
+};
+
+#if !(defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L) && (!defined(_MSC_VER) || _MSC_VER != 1900)
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d32_coeffs_t exp_table_imp<b>::d32_coeffs;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d64_coeffs_t exp_table_imp<b>::d64_coeffs;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d128_coeffs_t exp_table_imp<b>::d128_coeffs;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d32_values_t exp_table_imp<b>::d32_values;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d64_values_t exp_table_imp<b>::d64_values;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d128_values_t exp_table_imp<b>::d128_values;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d32_reduction_t exp_table_imp<b>::d32_reduction;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d64_reduction_t exp_table_imp<b>::d64_reduction;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d128_reduction_t exp_table_imp<b>::d128_reduction;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d32_reduction_t exp_table_imp<b>::d32_exp2_reduction;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d64_reduction_t exp_table_imp<b>::d64_exp2_reduction;
+
+template <bool b>
+constexpr typename exp_table_imp<b>::d128_reduction_t exp_table_imp<b>::d128_exp2_reduction;
+
+#endif
+
+} //namespace exp_detail
+
+using exp_table = exp_detail::exp_table_imp<true>;
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto exp_series_expansion(T x) noexcept;
+
+template <>
+constexpr auto exp_series_expansion<decimal32>(decimal32 x) noexcept
+{
+    return taylor_series_result(x, exp_table::d32_coeffs);
+}
+
+template <>
+constexpr auto exp_series_expansion<decimal64>(decimal64 x) noexcept
+{
+    return taylor_series_result(x, exp_table::d64_coeffs);
+}
+
+template <>
+constexpr auto exp_series_expansion<decimal128>(decimal128 x) noexcept
+{
+    return taylor_series_result(x, exp_table::d128_coeffs);
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto exp_table_value(std::size_t j) noexcept;
+
+template <>
+constexpr auto exp_table_value<decimal32>(std::size_t j) noexcept
+{
+    return exp_table::d32_values[j];
+}
+
+template <>
+constexpr auto exp_table_value<decimal64>(std::size_t j) noexcept
+{
+    return exp_table::d64_values[j];
+}
+
+template <>
+constexpr auto exp_table_value<decimal128>(std::size_t j) noexcept
+{
+    return exp_table::d128_values[j];
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto exp_reduction_constants() noexcept;
+
+template <>
+constexpr auto exp_reduction_constants<decimal32>() noexcept
+{
+    return exp_table::d32_reduction;
+}
+
+template <>
+constexpr auto exp_reduction_constants<decimal64>() noexcept
+{
+    return exp_table::d64_reduction;
+}
+
+template <>
+constexpr auto exp_reduction_constants<decimal128>() noexcept
+{
+    return exp_table::d128_reduction;
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto exp2_reduction_constants() noexcept;
+
+template <>
+constexpr auto exp2_reduction_constants<decimal32>() noexcept
+{
+    return exp_table::d32_exp2_reduction;
+}
+
+template <>
+constexpr auto exp2_reduction_constants<decimal64>() noexcept
+{
+    return exp_table::d64_exp2_reduction;
+}
+
+template <>
+constexpr auto exp2_reduction_constants<decimal128>() noexcept
+{
+    return exp_table::d128_exp2_reduction;
+}
+
+} //namespace detail
+} //namespace decimal
+} //namespace boost
+
+#endif //BOOST_DECIMAL_DETAIL_CMATH_IMPL_EXP_IMPL_HPP
@@ -0,0 +1,265 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_FIXED_POINT_SERIES_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_FIXED_POINT_SERIES_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/utilities.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+#include <boost/decimal/detail/cmath/impl/fma_impl.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Polynomials are evaluated with Horner's scheme in scaled integers instead of in T.
+// Every intermediate value is a significand of working_digits digits, a sign and a power of ten,
+// so the steps need neither the decoding and encoding of T nor a rounding of their own:
+// the product of two significands is exact in the wide integer of fma_wide_traits
+// (64 bits for decimal32, 128 bits for decimal64 and 256 bits for decimal128)
+// and only truncated back to the working digits, and the value is rounded to T once at the end.
+//
+// The working digits leave room for the carry of a sum within sig_type,
+// and for the product of that sum with a significand within the wide integer.
+template <typename T>
+struct fixed_point_series_traits
+{
+    using wide_traits = fma_wide_traits<T>;
+    using sig_type = typename wide_traits::result_type;
+
+    static constexpr int working_digits {std::numeric_limits<T>::digits10 < 9 ? 9 :
+                                         std::numeric_limits<T>::digits10 < 19 ? 18 : 37};
+};
+
+template <typename T>
+struct fixed_point_value
+{
+    typename fixed_point_series_traits<T>::sig_type sig;
+    int exp;
+    bool sign;
+};
+
+// The significand of a finite value of T scaled to exactly the working digits, or zero
+template <typename T>
+constexpr auto to_fixed_point(T x) noexcept -> fixed_point_value<T>
+{
+    using traits = fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    constexpr int shift {traits::working_digits - std::numeric_limits<T>::digits10};
+
+    int exp {};
+    const auto sig {frexp10(x, &exp)};
+
+    return {static_cast<sig_type>(sig) * pow10(static_cast<sig_type>(shift)), exp - shift, signbit(x)};
+}
+
+// Brings a non-zero significand of fewer or one more than the working digits back to exactly the working digits
+template <typename T>
+constexpr auto normalize_fixed_point(fixed_point_value<T>& val) noexcept -> void
+{
+    using traits = fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    constexpr auto upper {pow10(static_cast<sig_type>(traits::working_digits))};
+    constexpr auto lower {pow10(static_cast<sig_type>(traits::working_digits - 1))};
+
+    if (val.sig >= upper)
+    {
+        val.sig /= UINT64_C(10);
+        ++val.exp;
+    }
+    else
+    {
+        while (val.sig < lower)
+        {
+            val.sig *= UINT64_C(10);
+            --val.exp;
+        }
+    }
+}
+
+// acc = acc * x, where x has exactly the working digits. The product of two such significands has
+// twice the working digits or one digit fewer, so it is truncated to the working digits by its actual length
+// instead of dropping one of them to the later normalization
+template <typename T>
+constexpr auto fixed_point_mul(fixed_point_value<T>& acc, const fixed_point_value<T>& x) noexcept -> void
+{
+    using traits = fixed_point_series_traits<T>;
+    using wide_traits = typename traits::wide_traits;
+    using sig_type = typename traits::sig_type;
+
+    constexpr auto min_full_product {wide_traits::mul(pow10(static_cast<sig_type>(traits::working_digits - 1)),
+                                                      pow10(static_cast<sig_type>(traits::working_digits)))};
+
+    const auto prod {wide_traits::mul(acc.sig, x.sig)};
+    const int shift {prod < min_full_product ? traits::working_digits - 1 : traits::working_digits};
+
+    bool sticky {};
+
+    acc.sig = wide_traits::narrow(wide_traits::div_pow10(prod, shift, sticky));
+    acc.exp += x.exp + shift;
+    acc.sign = acc.sign != x.sign;
+}
+
+// acc = acc * x / divisor, where x has exactly the working digits. The quotient of the exact product
+// by the small integer divisor is truncated to the working digits only once, so it keeps all of them
+template <typename T>
+constexpr auto fixed_point_mul_div(fixed_point_value<T>& acc, const fixed_point_value<T>& x, std::uint32_t divisor) noexcept -> void
+{
+    using traits = fixed_point_series_traits<T>;
+    using wide_traits = typename traits::wide_traits;
+
+    const auto quotient {wide_traits::mul(acc.sig, x.sig) / static_cast<std::uint64_t>(divisor)};
+    const int shift {wide_traits::count_digits(quotient) - traits::working_digits};
+
+    bool sticky {};
+
+    acc.sig = wide_traits::narrow(wide_traits::div_pow10(quotient, shift, sticky));
+    acc.exp += x.exp + shift;
+    acc.sign = acc.sign != x.sign;
+}
+
+// acc = acc + c, where both have exactly the working digits.
+// The operand with the smaller exponent is truncated to the digits of the other
+template <typename T>
+constexpr auto fixed_point_add(fixed_point_value<T>& acc, fixed_point_value<T> c) noexcept -> void
+{
+    using traits = fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    if (c.sig == 0U)
+    {
+        return;
+    }
+    else if (acc.sig == 0U)
+    {
+        acc = c;
+        return;
+    }
+
+    if (acc.exp < c.exp)
+    {
+        swap(acc, c);
+    }
+
+    const int shift {acc.exp - c.exp};
+
+    if (shift > traits::working_digits)
+    {
+        return;
+    }
+
+    c.sig /= pow10(static_cast<sig_type>(shift));
+
+    if (acc.sign == c.sign)
+    {
+        acc.sig += c.sig;
+    }
+    else if (acc.sig >= c.sig)
+    {
+        acc.sig -= c.sig;
+    }
+    else
+    {
+        acc.sig = c.sig - acc.sig;
+        acc.sign = c.sign;
+    }
+
+    if (acc.sig != 0U)
+    {
+        normalize_fixed_point(acc);
+    }
+}
+
+template <typename T, typename Array>
+constexpr auto series_coefficient(const Array& coeffs, std::size_t k, bool highest_first) noexcept -> T
+{
+    return static_cast<T>(coeffs[highest_first ? k : coeffs.size() - 1U - k]);
+}
+
+// Evaluates the polynomial with the coefficients in coeffs at x, starting from
+// coeffs[0] when highest_first is set (remez_series_result) and from coeffs[size - 1] otherwise
+template <typename T, typename Array>
+constexpr auto fixed_point_horner(T x, const Array& coeffs, bool highest_first) noexcept -> T
+{
+    const std::size_t n {coeffs.size()};
+
+    if (!isfinite(x))
+    {
+        auto result {series_coefficient<T>(coeffs, 0U, highest_first)};
+
+        for (std::size_t k {1U}; k < n; ++k)
+        {
+            result = fma_impl(result, x, series_coefficient<T>(coeffs, k, highest_first));
+        }
+
+        return result;
+    }
+
+    const auto fixed_x {to_fixed_point(x)};
+
+    auto acc {to_fixed_point(series_coefficient<T>(coeffs, 0U, highest_first))};
+
+    for (std::size_t k {1U}; k < n; ++k)
+    {
+        if (acc.sig != 0U)
+        {
+            fixed_point_mul(acc, fixed_x);
+
+            if (acc.sig != 0U)
+            {
+                normalize_fixed_point(acc);
+            }
+        }
+
+        fixed_point_add(acc, to_fixed_point(series_coefficient<T>(coeffs, k, highest_first)));
+    }
+
+    return T {acc.sig, acc.exp, acc.sig != 0U && acc.sign};
+}
+
+// Evaluates the series sum of (-x)^k / ((first + 1) * (first + 2) * ... * (first + 2k)) for k < terms
+// in the nested form 1 - x / ((first + 1) * (first + 2)) * (1 - x / ((first + 3) * (first + 4)) * (...)).
+// Each step divides by a small integer instead of multiplying by a rounded coefficient, so the factorials
+// of the Taylor series of sin(r) / r (first = 1) and cos(r) (first = 0) at x = r^2 are exact
+template <typename T>
+constexpr auto fixed_point_factorial_series(const fixed_point_value<T>& x, int first, int terms) noexcept -> fixed_point_value<T>
+{
+    using traits = fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    constexpr fixed_point_value<T> one {pow10(static_cast<sig_type>(traits::working_digits - 1)), 1 - traits::working_digits, false};
+
+    if (x.sig == 0U)
+    {
+        return one;
+    }
+
+    auto acc {one};
+
+    for (int k {terms - 1}; k > 0; --k)
+    {
+        fixed_point_mul_div(acc, x, static_cast<std::uint32_t>((first + 2 * k - 1) * (first + 2 * k)));
+        acc.sign = !acc.sign;
+
+        fixed_point_add(acc, one);
+    }
+
+    return acc;
+}
+
+} //namespace detail
+} //namespace decimal
+} //namespace boost
+
+#endif //BOOST_DECIMAL_DETAIL_CMATH_IMPL_FIXED_POINT_SERIES_HPP
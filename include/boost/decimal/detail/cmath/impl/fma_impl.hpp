@@ -0,0 +1,435 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_FMA_IMPL_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_FMA_IMPL_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/countl.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/emulated256.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/utilities.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+#include <boost/decimal/detail/cmath/impl/pow_impl.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// The product of two significands of T and the addend aligned to it are held in an integer
+// with room for digits decimal digits plus the carry of their sum:
+// 64 bits for decimal32, 128 bits for decimal64 and 256 bits for decimal128.
+// The result is passed to the constructor of T as a significand of result_type
+template <typename T, int = (std::numeric_limits<T>::digits10 < 9 ? 0 : (std::numeric_limits<T>::digits10 < 19 ? 1 : 2))>
+struct fma_wide_traits
+{
+    using integer_type = std::uint64_t;
+    using result_type = std::uint64_t;
+
+    static constexpr int digits {18};
+
+    template <typename Unsigned>
+    static constexpr auto mul(Unsigned lhs, Unsigned rhs) noexcept -> integer_type
+    {
+        return static_cast<integer_type>(lhs) * static_cast<integer_type>(rhs);
+    }
+
+    template <typename Unsigned>
+    static constexpr auto widen(Unsigned sig) noexcept -> integer_type
+    {
+        return static_cast<integer_type>(sig);
+    }
+
+    static constexpr auto mul_pow10(integer_type sig, int shift) noexcept -> integer_type
+    {
+        return sig * pow10(static_cast<std::uint64_t>(shift));
+    }
+
+    static constexpr auto div_pow10(integer_type sig, int shift, bool& sticky) noexcept -> integer_type
+    {
+        if (shift > std::numeric_limits<integer_type>::digits10)
+        {
+            sticky = sticky || (sig != 0U);
+            return 0U;
+        }
+
+        const auto divisor {pow10(static_cast<std::uint64_t>(shift))};
+        const auto res {sig / divisor};
+        sticky = sticky || (res * divisor != sig);
+
+        return res;
+    }
+
+    static constexpr auto count_digits(integer_type sig) noexcept -> int
+    {
+        return num_digits(sig);
+    }
+
+    static constexpr auto narrow(integer_type sig) noexcept -> result_type
+    {
+        return sig;
+    }
+};
+
+template <typename T>
+struct fma_wide_traits<T, 1>
+{
+    #ifdef BOOST_DECIMAL_HAS_INT128
+    using integer_type = uint128_t;
+    #else
+    using integer_type = uint128;
+    #endif
+
+    using result_type = std::uint64_t;
+
+    static constexpr int digits {37};
+
+    static constexpr auto mul(std::uint64_t lhs, std::uint64_t rhs) noexcept -> integer_type
+    {
+        #ifdef BOOST_DECIMAL_HAS_INT128
+        return static_cast<integer_type>(lhs) * rhs;
+        #else
+        return umul128(lhs, rhs);
+        #endif
+    }
+
+    static constexpr auto widen(std::uint64_t sig) noexcept -> integer_type
+    {
+        return static_cast<integer_type>(sig);
+    }
+
+    static constexpr auto mul_pow10(integer_type sig, int shift) noexcept -> integer_type
+    {
+        return sig * pow10(static_cast<integer_type>(shift));
+    }
+
+    static constexpr auto div_pow10(integer_type sig, int shift, bool& sticky) noexcept -> integer_type
+    {
+        if (shift > std::numeric_limits<uint128>::digits10)
+        {
+            sticky = sticky || (sig != 0U);
+            return 0U;
+        }
+
+        const auto divisor {pow10(static_cast<integer_type>(shift))};
+        const auto res {sig / divisor};
+        sticky = sticky || (res * divisor != sig);
+
+        return res;
+    }
+
+    static constexpr auto count_digits(integer_type sig) noexcept -> int
+    {
+        return num_digits(sig);
+    }
+
+    static constexpr auto narrow(integer_type sig) noexcept -> result_type
+    {
+        return static_cast<result_type>(sig);
+    }
+};
+
+template <typename T>
+struct fma_wide_traits<T, 2>
+{
+    using integer_type = uint256_t;
+    using result_type = uint128;
+
+    static constexpr int digits {75};
+
+    static constexpr auto mul(const uint128& lhs, const uint128& rhs) noexcept -> integer_type
+    {
+        return umul256(lhs, rhs);
+    }
+
+    static constexpr auto widen(const uint128& sig) noexcept -> integer_type
+    {
+        return integer_type {sig};
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_INT128
+
+    // Steps of 10^19 use a single 128 by 64-bit operation per limb
+    static constexpr int max_step {std::numeric_limits<std::uint64_t>::digits10};
+
+    static constexpr auto mul_small(integer_type& sig, std::uint64_t factor) noexcept -> void
+    {
+        std::uint64_t limbs[4] {sig.low.low, sig.low.high, sig.high.low, sig.high.high};
+        uint128_t carry {};
+
+        for (auto& limb : limbs)
+        {
+            const auto current {static_cast<uint128_t>(limb) * factor + carry};
+            limb = static_cast<std::uint64_t>(current);
+            carry = current >> 64U;
+        }
+
+        sig = integer_type {uint128 {limbs[3], limbs[2]}, uint128 {limbs[1], limbs[0]}};
+    }
+
+    // Returns whether the division left a remainder
+    static constexpr auto div_small(integer_type& sig, std::uint64_t divisor) noexcept -> bool
+    {
+        std::uint64_t limbs[4] {sig.high.high, sig.high.low, sig.low.high, sig.low.low};
+        uint128_t remainder {};
+
+        for (auto& limb : limbs)
+        {
+            const auto current {(remainder << 64U) | limb};
+            limb = static_cast<std::uint64_t>(current / divisor);
+            remainder = current % divisor;
+        }
+
+        sig = integer_type {uint128 {limbs[0], limbs[1]}, uint128 {limbs[2], limbs[3]}};
+
+        return remainder != 0U;
+    }
+
+    #else
+
+    // Steps of 10^9 keep the divisor within the 32-bit fast path of the emulated division
+    static constexpr int max_step {9};
+
+    static constexpr auto mul_small(integer_type& sig, std::uint64_t factor) noexcept -> void
+    {
+        sig = sig * factor;
+    }
+
+    static constexpr auto div_small(integer_type& sig, std::uint64_t divisor) noexcept -> bool
+    {
+        const auto res {divide(sig, divisor)};
+        sig = std::get<0>(res);
+
+        return std::get<1>(res) != integer_type {};
+    }
+
+    #endif
+
+    static constexpr auto mul_pow10(integer_type sig, int shift) noexcept -> integer_type
+    {
+        for (; shift > 0; shift -= max_step)
+        {
+            mul_small(sig, pow10(static_cast<std::uint64_t>(shift < max_step ? shift : max_step)));
+        }
+
+        return sig;
+    }
+
+    static constexpr auto div_pow10(integer_type sig, int shift, bool& sticky) noexcept -> integer_type
+    {
+        if (shift > std::numeric_limits<integer_type>::digits10 + 1)
+        {
+            sticky = sticky || (sig != integer_type {});
+            return integer_type {};
+        }
+
+        for (; shift > 0; shift -= max_step)
+        {
+            const bool remainder {div_small(sig, pow10(static_cast<std::uint64_t>(shift < max_step ? shift : max_step)))};
+            sticky = sticky || remainder;
+        }
+
+        return sig;
+    }
+
+    // Counts the digits from the bit width, which is off by at most one,
+    // instead of the division by ten per digit of num_digits
+    static constexpr auto count_digits(const integer_type& sig) noexcept -> int
+    {
+        if (sig.high == 0U)
+        {
+            return num_digits(sig.low);
+        }
+
+        const int bits {sig.high.high != 0U ? 256 - countl_zero(sig.high.high) : 192 - countl_zero(sig.high.low)};
+
+        // 2^(bits - 1) <= sig < 2^bits, so sig has either estimate or estimate + 1 digits
+        const int estimate {(((bits - 1) * 1233) >> 12) + 1};
+
+        // The aligned sums stay below 10^76
+        if (estimate >= 2 * std::numeric_limits<uint128>::digits10)
+        {
+            return estimate;
+        }
+
+        const auto threshold {umul256(pow10(static_cast<uint128>(std::numeric_limits<uint128>::digits10)),
+                                      pow10(static_cast<uint128>(estimate - std::numeric_limits<uint128>::digits10)))};
+
+        return sig < threshold ? estimate : estimate + 1;
+    }
+
+    static constexpr auto narrow(const integer_type& sig) noexcept -> result_type
+    {
+        return sig.low;
+    }
+};
+
+// Calculates x * y + z with the exact product of the significands, rounding only once to T.
+// When the addend and the product are far apart, the smaller of the two is truncated to the
+// digits below the larger one, with the truncation recorded as a sticky digit.
+// The cancellation in a subtraction can then remove at most a few leading digits,
+// so at least two digits beyond the precision of T are left for the final rounding.
+// A non-zero scale gives (x * y + z) * 10^scale with the same single rounding, also below the normal range
+template <typename T>
+constexpr auto fma_impl(T x, T y, T z, int scale = 0) noexcept -> T
+{
+    using traits = fma_wide_traits<T>;
+    using integer_type = typename traits::integer_type;
+
+    if (!isfinite(x) || !isfinite(y))
+    {
+        return x * y + z;
+    }
+    else if (!isfinite(z))
+    {
+        // The exact product is finite, even if it would overflow as a separate multiplication
+        return z;
+    }
+
+    int exp_x {};
+    int exp_y {};
+    int exp_z {};
+
+    const auto sig_x {frexp10(x, &exp_x)};
+    const auto sig_y {frexp10(y, &exp_y)};
+    const auto sig_z {frexp10(z, &exp_z)};
+
+    const bool sign_p {signbit(x) != signbit(y)};
+    const bool sign_z {signbit(z)};
+
+    if (sig_x == 0U || sig_y == 0U)
+    {
+        if (sig_z == 0U)
+        {
+            return T {0, 0, sign_p && sign_z};
+        }
+
+        return scale == 0 ? z : make_decimal_with_underflow<T>(sig_z, static_cast<std::int64_t>(exp_z) + scale, sign_z);
+    }
+
+    auto big_sig {traits::mul(sig_x, sig_y)};
+    auto big_exp {exp_x + exp_y};
+    auto big_sign {sign_p};
+
+    auto small_sig {traits::widen(sig_z)};
+    auto small_exp {sig_z == 0U ? big_exp : exp_z};
+    auto small_sign {sign_z};
+
+    bool sticky {false};
+
+    // The product has at most twice the digits of T and the addend the digits of T
+    constexpr int product_digits {2 * std::numeric_limits<T>::digits10};
+    constexpr int addend_digits {std::numeric_limits<T>::digits10};
+
+    if (small_exp >= big_exp && small_exp - big_exp <= traits::digits - addend_digits)
+    {
+        // Fast path: the addend aligned to the product fits without loss
+        small_sig = traits::mul_pow10(small_sig, small_exp - big_exp);
+    }
+    else if (small_exp < big_exp && big_exp - small_exp <= traits::digits - product_digits)
+    {
+        // Fast path: the product aligned to the addend fits without loss
+        big_sig = traits::mul_pow10(big_sig, big_exp - small_exp);
+        big_exp = small_exp;
+    }
+    else
+    {
+        const auto big_digits {traits::count_digits(big_sig)};
+        const auto small_digits {traits::count_digits(small_sig)};
+
+        if (small_exp + small_digits > big_exp + big_digits)
+        {
+            detail::swap(big_sig, small_sig);
+            detail::swap(big_exp, small_exp);
+            detail::swap(big_sign, small_sign);
+        }
+
+        // Move the operand with the leading digit of higher magnitude to the top of the wide integer
+        const auto shift {traits::digits - traits::count_digits(big_sig)};
+        big_sig = traits::mul_pow10(big_sig, shift);
+        big_exp -= shift;
+
+        if (small_exp >= big_exp)
+        {
+            small_sig = traits::mul_pow10(small_sig, small_exp - big_exp);
+        }
+        else
+        {
+            small_sig = traits::div_pow10(small_sig, big_exp - small_exp, sticky);
+        }
+    }
+
+    integer_type res_sig {};
+    bool res_sign {big_sign};
+
+    if (big_sign == small_sign)
+    {
+        res_sig = big_sig + small_sig;
+    }
+    else if (big_sig < small_sig)
+    {
+        // Only possible without truncation
+        res_sig = small_sig - big_sig;
+        res_sign = small_sign;
+    }
+    else
+    {
+        res_sig = big_sig - small_sig;
+
+        if (sticky)
+        {
+            // big - (small + f) = (big - small - 1) + (1 - f) for the truncated fraction 0 < f < 1
+            res_sig = res_sig - integer_type {1U};
+        }
+    }
+
+    if (res_sig == 0U && !sticky)
+    {
+        return T {0, 0, sign_p && sign_z};
+    }
+
+    auto res_exp {static_cast<std::int64_t>(big_exp) + scale};
+
+    // The constructor of T rounds from one guard digit, so the result is reduced to it here
+    constexpr int result_digits {std::numeric_limits<T>::digits10 + 1};
+
+    const auto res_digits {traits::count_digits(res_sig)};
+    if (res_digits > result_digits)
+    {
+        res_sig = traits::div_pow10(res_sig, res_digits - result_digits, sticky);
+        res_exp += res_digits - result_digits;
+    }
+
+    auto result_sig {traits::narrow(res_sig)};
+
+    // Mark an inexact guard digit of 0 or 5, so that the rounding
+    // does not mistake the result for an exact or a halfway value
+    if (sticky)
+    {
+        const auto guard_digit {static_cast<unsigned>(result_sig % UINT64_C(10))};
+
+        if (guard_digit == 0U || guard_digit == 5U)
+        {
+            ++result_sig;
+        }
+    }
+
+    return make_decimal_with_underflow<T>(result_sig, res_exp, res_sign);
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CMATH_IMPL_FMA_IMPL_HPP
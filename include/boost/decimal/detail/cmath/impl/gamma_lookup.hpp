@@ -0,0 +1,1592 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_GAMMA_LOOKUP_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_GAMMA_LOOKUP_HPP
+
+#include <boost/decimal/fwd.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <cstdint>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+namespace gamma_lookup_detail {
+
+// n!, log(n!) and tgamma(n + 1/2) = (2n)! sqrt(pi) / (4^n n!) for n = 0, 1, ..., correctly rounded to each type.
+// The tables of decimal32 and decimal64 run up to the largest finite factorial (68! and 204!).
+// decimal128 could hold factorials up to 2123!, but its tables stop at the range of decimal64
+// to keep the header small
+template <bool b>
+struct gamma_lookup_imp
+{
+    static constexpr std::array<decimal32, 69> d32_factorials =
+    {{
+        decimal32{UINT32_C(1000000),-6},
+        decimal32{UINT32_C(1000000),-6},
+        decimal32{UINT32_C(2000000),-6},
+        decimal32{UINT32_C(6000000),-6},
+        decimal32{UINT32_C(2400000),-5},
+        decimal32{UINT32_C(1200000),-4},
+        decimal32{UINT32_C(7200000),-4},
+        decimal32{UINT32_C(5040000),-3},
+        decimal32{UINT32_C(4032000),-2},
+        decimal32{UINT32_C(3628800),-1},
+        decimal32{UINT32_C(3628800),0},
+        decimal32{UINT32_C(3991680),1},
+        decimal32{UINT32_C(4790016),2},
+        decimal32{UINT32_C(6227021),3},
+        decimal32{UINT32_C(8717829),4},
+        decimal32{UINT32_C(1307674),6},
+        decimal32{UINT32_C(2092279),7},
+        decimal32{UINT32_C(3556874),8},
+        decimal32{UINT32_C(6402374),9},
+        decimal32{UINT32_C(1216451),11},
+        decimal32{UINT32_C(2432902),12},
+        decimal32{UINT32_C(5109094),13},
+        decimal32{UINT32_C(1124001),15},
+        decimal32{UINT32_C(2585202),16},
+        decimal32{UINT32_C(6204484),17},
+        decimal32{UINT32_C(1551121),19},
+        decimal32{UINT32_C(4032915),20},
+        decimal32{UINT32_C(1088887),22},
+        decimal32{UINT32_C(3048883),23},
+        decimal32{UINT32_C(8841762),24},
+        decimal32{UINT32_C(2652529),26},
+        decimal32{UINT32_C(8222839),27},
+        decimal32{UINT32_C(2631308),29},
+        decimal32{UINT32_C(8683318),30},
+        decimal32{UINT32_C(2952328),32},
+        decimal32{UINT32_C(1033315),34},
+        decimal32{UINT32_C(3719933),35},
+        decimal32{UINT32_C(1376375),37},
+        decimal32{UINT32_C(5230226),38},
+        decimal32{UINT32_C(2039788),40},
+        decimal32{UINT32_C(8159153),41},
+        decimal32{UINT32_C(3345253),43},
+        decimal32{UINT32_C(1405006),45},
+        decimal32{UINT32_C(6041526),46},
+        decimal32{UINT32_C(2658272),48},
+        decimal32{UINT32_C(1196222),50},
+        decimal32{UINT32_C(5502622),51},
+        decimal32{UINT32_C(2586232),53},
+        decimal32{UINT32_C(1241392),55},
+        decimal32{UINT32_C(6082819),56},
+        decimal32{UINT32_C(3041409),58},
+        decimal32{UINT32_C(1551119),60},
+        decimal32{UINT32_C(8065818),61},
+        decimal32{UINT32_C(4274883),63},
+        decimal32{UINT32_C(2308437),65},
+        decimal32{UINT32_C(1269640),67},
+        decimal32{UINT32_C(7109986),68},
+        decimal32{UINT32_C(4052692),70},
+        decimal32{UINT32_C(2350561),72},
+        decimal32{UINT32_C(1386831),74},
+        decimal32{UINT32_C(8320987),75},
+        decimal32{UINT32_C(5075802),77},
+        decimal32{UINT32_C(3146997),79},
+        decimal32{UINT32_C(1982608),81},
+        decimal32{UINT32_C(1268869),83},
+        decimal32{UINT32_C(8247651),84},
+        decimal32{UINT32_C(5443449),86},
+        decimal32{UINT32_C(3647111),88},
+        decimal32{UINT32_C(2480036),90}
+    }};
+
+    static constexpr std::array<decimal32, 69> d32_log_factorials =
+    {{
+        decimal32{UINT32_C(0),0},
+        decimal32{UINT32_C(0),0},
+        decimal32{UINT32_C(6931472),-7},
+        decimal32{UINT32_C(1791759),-6},
+        decimal32{UINT32_C(3178054),-6},
+        decimal32{UINT32_C(4787492),-6},
+        decimal32{UINT32_C(6579251),-6},
+        decimal32{UINT32_C(8525161),-6},
+        decimal32{UINT32_C(1060460),-5},
+        decimal32{UINT32_C(1280183),-5},
+        decimal32{UINT32_C(1510441),-5},
+        decimal32{UINT32_C(1750231),-5},
+        decimal32{UINT32_C(1998721),-5},
+        decimal32{UINT32_C(2255216),-5},
+        decimal32{UINT32_C(2519122),-5},
+        decimal32{UINT32_C(2789927),-5},
+        decimal32{UINT32_C(3067186),-5},
+        decimal32{UINT32_C(3350507),-5},
+        decimal32{UINT32_C(3639545),-5},
+        decimal32{UINT32_C(3933988),-5},
+        decimal32{UINT32_C(4233562),-5},
+        decimal32{UINT32_C(4538014),-5},
+        decimal32{UINT32_C(4847118),-5},
+        decimal32{UINT32_C(5160668),-5},
+        decimal32{UINT32_C(5478473),-5},
+        decimal32{UINT32_C(5800361),-5},
+        decimal32{UINT32_C(6126170),-5},
+        decimal32{UINT32_C(6455754),-5},
+        decimal32{UINT32_C(6788974),-5},
+        decimal32{UINT32_C(7125704),-5},
+        decimal32{UINT32_C(7465824),-5},
+        decimal32{UINT32_C(7809222),-5},
+        decimal32{UINT32_C(8155796),-5},
+        decimal32{UINT32_C(8505447),-5},
+        decimal32{UINT32_C(8858083),-5},
+        decimal32{UINT32_C(9213618),-5},
+        decimal32{UINT32_C(9571969),-5},
+        decimal32{UINT32_C(9933061),-5},
+        decimal32{UINT32_C(1029682),-4},
+        decimal32{UINT32_C(1066318),-4},
+        decimal32{UINT32_C(1103206),-4},
+        decimal32{UINT32_C(1140342),-4},
+        decimal32{UINT32_C(1177719),-4},
+        decimal32{UINT32_C(1215331),-4},
+        decimal32{UINT32_C(1253173),-4},
+        decimal32{UINT32_C(1291239),-4},
+        decimal32{UINT32_C(1329526),-4},
+        decimal32{UINT32_C(1368027),-4},
+        decimal32{UINT32_C(1406739),-4},
+        decimal32{UINT32_C(1445657),-4},
+        decimal32{UINT32_C(1484778),-4},
+        decimal32{UINT32_C(1524096),-4},
+        decimal32{UINT32_C(1563608),-4},
+        decimal32{UINT32_C(1603311),-4},
+        decimal32{UINT32_C(1643201),-4},
+        decimal32{UINT32_C(1683274),-4},
+        decimal32{UINT32_C(1723528),-4},
+        decimal32{UINT32_C(1763958),-4},
+        decimal32{UINT32_C(1804563),-4},
+        decimal32{UINT32_C(1845338),-4},
+        decimal32{UINT32_C(1886282),-4},
+        decimal32{UINT32_C(1927390),-4},
+        decimal32{UINT32_C(1968662),-4},
+        decimal32{UINT32_C(2010093),-4},
+        decimal32{UINT32_C(2051682),-4},
+        decimal32{UINT32_C(2093426),-4},
+        decimal32{UINT32_C(2135322),-4},
+        decimal32{UINT32_C(2177369),-4},
+        decimal32{UINT32_C(2219564),-4}
+    }};
+
+    static constexpr std::array<decimal32, 69> d32_half_integer_gammas =
+    {{
+        decimal32{UINT32_C(1772454),-6},
+        decimal32{UINT32_C(8862269),-7},
+        decimal32{UINT32_C(1329340),-6},
+        decimal32{UINT32_C(3323351),-6},
+        decimal32{UINT32_C(1163173),-5},
+        decimal32{UINT32_C(5234278),-5},
+        decimal32{UINT32_C(2878853),-4},
+        decimal32{UINT32_C(1871254),-3},
+        decimal32{UINT32_C(1403441),-2},
+        decimal32{UINT32_C(1192925),-1},
+        decimal32{UINT32_C(1133278),0},
+        decimal32{UINT32_C(1189942),1},
+        decimal32{UINT32_C(1368434),2},
+        decimal32{UINT32_C(1710542),3},
+        decimal32{UINT32_C(2309232),4},
+        decimal32{UINT32_C(3348386),5},
+        decimal32{UINT32_C(5189998),6},
+        decimal32{UINT32_C(8563497),7},
+        decimal32{UINT32_C(1498612),9},
+        decimal32{UINT32_C(2772432),10},
+        decimal32{UINT32_C(5406243),11},
+        decimal32{UINT32_C(1108280),13},
+        decimal32{UINT32_C(2382802),14},
+        decimal32{UINT32_C(5361304),15},
+        decimal32{UINT32_C(1259906),17},
+        decimal32{UINT32_C(3086771),18},
+        decimal32{UINT32_C(7871265),19},
+        decimal32{UINT32_C(2085885),21},
+        decimal32{UINT32_C(5736184),22},
+        decimal32{UINT32_C(1634813),24},
+        decimal32{UINT32_C(4822697),25},
+        decimal32{UINT32_C(1470923),27},
+        decimal32{UINT32_C(4633406),28},
+        decimal32{UINT32_C(1505857),30},
+        decimal32{UINT32_C(5044621),31},
+        decimal32{UINT32_C(1740394),33},
+        decimal32{UINT32_C(6178399),34},
+        decimal32{UINT32_C(2255116),36},
+        decimal32{UINT32_C(8456684),37},
+        decimal32{UINT32_C(3255823),39},
+        decimal32{UINT32_C(1286050),41},
+        decimal32{UINT32_C(5208504),42},
+        decimal32{UINT32_C(2161529),44},
+        decimal32{UINT32_C(9186498),45},
+        decimal32{UINT32_C(3996127),47},
+        decimal32{UINT32_C(1778276),49},
+        decimal32{UINT32_C(8091157),50},
+        decimal32{UINT32_C(3762388),52},
+        decimal32{UINT32_C(1787134),54},
+        decimal32{UINT32_C(8667602),55},
+        decimal32{UINT32_C(4290463),57},
+        decimal32{UINT32_C(2166684),59},
+        decimal32{UINT32_C(1115842),61},
+        decimal32{UINT32_C(5858171),62},
+        decimal32{UINT32_C(3134122),64},
+        decimal32{UINT32_C(1708096),66},
+        decimal32{UINT32_C(9479934),67},
+        decimal32{UINT32_C(5356163),69},
+        decimal32{UINT32_C(3079794),71},
+        decimal32{UINT32_C(1801679),73},
+        decimal32{UINT32_C(1071999),75},
+        decimal32{UINT32_C(6485595),76},
+        decimal32{UINT32_C(3988641),78},
+        decimal32{UINT32_C(2492901),80},
+        decimal32{UINT32_C(1582992),82},
+        decimal32{UINT32_C(1021030),84},
+        decimal32{UINT32_C(6687745),85},
+        decimal32{UINT32_C(4447350),87},
+        decimal32{UINT32_C(3001962),89}
+    }};
+
+    static constexpr std::array<decimal64, 205> d64_factorials =
+    {{
+        decimal64{UINT64_C(1000000000000000),-15},
+        decimal64{UINT64_C(1000000000000000),-15},
+        decimal64{UINT64_C(2000000000000000),-15},
+        decimal64{UINT64_C(6000000000000000),-15},
+        decimal64{UINT64_C(2400000000000000),-14},
+        decimal64{UINT64_C(1200000000000000),-13},
+        decimal64{UINT64_C(7200000000000000),-13},
+        decimal64{UINT64_C(5040000000000000),-12},
+        decimal64{UINT64_C(4032000000000000),-11},
+        decimal64{UINT64_C(3628800000000000),-10},
+        decimal64{UINT64_C(3628800000000000),-9},
+        decimal64{UINT64_C(3991680000000000),-8},
+        decimal64{UINT64_C(4790016000000000),-7},
+        decimal64{UINT64_C(6227020800000000),-6},
+        decimal64{UINT64_C(8717829120000000),-5},
+        decimal64{UINT64_C(1307674368000000),-3},
+        decimal64{UINT64_C(2092278988800000),-2},
+        decimal64{UINT64_C(3556874280960000),-1},
+        decimal64{UINT64_C(6402373705728000),0},
+        decimal64{UINT64_C(1216451004088320),2},
+        decimal64{UINT64_C(2432902008176640),3},
+        decimal64{UINT64_C(5109094217170944),4},
+        decimal64{UINT64_C(1124000727777608),6},
+        decimal64{UINT64_C(2585201673888498),7},
+        decimal64{UINT64_C(6204484017332394),8},
+        decimal64{UINT64_C(1551121004333099),10},
+        decimal64{UINT64_C(4032914611266056),11},
+        decimal64{UINT64_C(1088886945041835),13},
+        decimal64{UINT64_C(3048883446117139),14},
+        decimal64{UINT64_C(8841761993739702),15},
+        decimal64{UINT64_C(2652528598121911),17},
+        decimal64{UINT64_C(8222838654177923),18},
+        decimal64{UINT64_C(2631308369336935),20},
+        decimal64{UINT64_C(8683317618811886),21},
+        decimal64{UINT64_C(2952327990396041),23},
+        decimal64{UINT64_C(1033314796638614),25},
+        decimal64{UINT64_C(3719933267899012),26},
+        decimal64{UINT64_C(1376375309122635),28},
+        decimal64{UINT64_C(5230226174666011),29},
+        decimal64{UINT64_C(2039788208119744),31},
+        decimal64{UINT64_C(8159152832478977),32},
+        decimal64{UINT64_C(3345252661316381),34},
+        decimal64{UINT64_C(1405006117752880),36},
+        decimal64{UINT64_C(6041526306337384),37},
+        decimal64{UINT64_C(2658271574788449),39},
+        decimal64{UINT64_C(1196222208654802),41},
+        decimal64{UINT64_C(5502622159812089),42},
+        decimal64{UINT64_C(2586232415111682),44},
+        decimal64{UINT64_C(1241391559253607),46},
+        decimal64{UINT64_C(6082818640342676),47},
+        decimal64{UINT64_C(3041409320171338),49},
+        decimal64{UINT64_C(1551118753287382),51},
+        decimal64{UINT64_C(8065817517094388),52},
+        decimal64{UINT64_C(4274883284060026),54},
+        decimal64{UINT64_C(2308436973392414),56},
+        decimal64{UINT64_C(1269640335365828),58},
+        decimal64{UINT64_C(7109985878048635),59},
+        decimal64{UINT64_C(4052691950487722),61},
+        decimal64{UINT64_C(2350561331282879),63},
+        decimal64{UINT64_C(1386831185456898),65},
+        decimal64{UINT64_C(8320987112741390),66},
+        decimal64{UINT64_C(5075802138772248),68},
+        decimal64{UINT64_C(3146997326038794),70},
+        decimal64{UINT64_C(1982608315404440),72},
+        decimal64{UINT64_C(1268869321858842),74},
+        decimal64{UINT64_C(8247650592082471),75},
+        decimal64{UINT64_C(5443449390774431),77},
+        decimal64{UINT64_C(3647111091818869),79},
+        decimal64{UINT64_C(2480035542436831),81},
+        decimal64{UINT64_C(1711224524281413),83},
+        decimal64{UINT64_C(1197857166996989),85},
+        decimal64{UINT64_C(8504785885678623),86},
+        decimal64{UINT64_C(6123445837688609),88},
+        decimal64{UINT64_C(4470115461512684),90},
+        decimal64{UINT64_C(3307885441519386),92},
+        decimal64{UINT64_C(2480914081139540),94},
+        decimal64{UINT64_C(1885494701666050),96},
+        decimal64{UINT64_C(1451830920282859),98},
+        decimal64{UINT64_C(1132428117820630),100},
+        decimal64{UINT64_C(8946182130782975),101},
+        decimal64{UINT64_C(7156945704626380),103},
+        decimal64{UINT64_C(5797126020747368),105},
+        decimal64{UINT64_C(4753643337012842),107},
+        decimal64{UINT64_C(3945523969720659),109},
+        decimal64{UINT64_C(3314240134565353),111},
+        decimal64{UINT64_C(2817104114380550),113},
+        decimal64{UINT64_C(2422709538367273),115},
+        decimal64{UINT64_C(2107757298379528),117},
+        decimal64{UINT64_C(1854826422573984),119},
+        decimal64{UINT64_C(1650795516090846),121},
+        decimal64{UINT64_C(1485715964481761),123},
+        decimal64{UINT64_C(1352001527678403),125},
+        decimal64{UINT64_C(1243841405464131),127},
+        decimal64{UINT64_C(1156772507081642),129},
+        decimal64{UINT64_C(1087366156656743),131},
+        decimal64{UINT64_C(1032997848823906),133},
+        decimal64{UINT64_C(9916779348709497),134},
+        decimal64{UINT64_C(9619275968248212),136},
+        decimal64{UINT64_C(9426890448883248),138},
+        decimal64{UINT64_C(9332621544394415),140},
+        decimal64{UINT64_C(9332621544394415),142},
+        decimal64{UINT64_C(9425947759838359),144},
+        decimal64{UINT64_C(9614466715035127),146},
+        decimal64{UINT64_C(9902900716486180),148},
+        decimal64{UINT64_C(1029901674514563),151},
+        decimal64{UINT64_C(1081396758240291),153},
+        decimal64{UINT64_C(1146280563734708),155},
+        decimal64{UINT64_C(1226520203196138),157},
+        decimal64{UINT64_C(1324641819451829),159},
+        decimal64{UINT64_C(1443859583202494),161},
+        decimal64{UINT64_C(1588245541522743),163},
+        decimal64{UINT64_C(1762952551090245),165},
+        decimal64{UINT64_C(1974506857221074),167},
+        decimal64{UINT64_C(2231192748659814),169},
+        decimal64{UINT64_C(2543559733472188),171},
+        decimal64{UINT64_C(2925093693493016),173},
+        decimal64{UINT64_C(3393108684451898),175},
+        decimal64{UINT64_C(3969937160808721),177},
+        decimal64{UINT64_C(4684525849754291),179},
+        decimal64{UINT64_C(5574585761207606),181},
+        decimal64{UINT64_C(6689502913449127),183},
+        decimal64{UINT64_C(8094298525273444),185},
+        decimal64{UINT64_C(9875044200833601),187},
+        decimal64{UINT64_C(1214630436702533),190},
+        decimal64{UINT64_C(1506141741511141),192},
+        decimal64{UINT64_C(1882677176888926),194},
+        decimal64{UINT64_C(2372173242880047),196},
+        decimal64{UINT64_C(3012660018457660),198},
+        decimal64{UINT64_C(3856204823625804),200},
+        decimal64{UINT64_C(4974504222477287),202},
+        decimal64{UINT64_C(6466855489220474),204},
+        decimal64{UINT64_C(8471580690878821),206},
+        decimal64{UINT64_C(1118248651196004),209},
+        decimal64{UINT64_C(1487270706090686),211},
+        decimal64{UINT64_C(1992942746161519),213},
+        decimal64{UINT64_C(2690472707318050),215},
+        decimal64{UINT64_C(3659042881952549),217},
+        decimal64{UINT64_C(5012888748274992),219},
+        decimal64{UINT64_C(6917786472619488),221},
+        decimal64{UINT64_C(9615723196941089),223},
+        decimal64{UINT64_C(1346201247571752),226},
+        decimal64{UINT64_C(1898143759076171),228},
+        decimal64{UINT64_C(2695364137888163),230},
+        decimal64{UINT64_C(3854370717180073),232},
+        decimal64{UINT64_C(5550293832739305),234},
+        decimal64{UINT64_C(8047926057471992),236},
+        decimal64{UINT64_C(1174997204390911),239},
+        decimal64{UINT64_C(1727245890454639),241},
+        decimal64{UINT64_C(2556323917872866),243},
+        decimal64{UINT64_C(3808922637630570),245},
+        decimal64{UINT64_C(5713383956445855),247},
+        decimal64{UINT64_C(8627209774233240),249},
+        decimal64{UINT64_C(1311335885683453),252},
+        decimal64{UINT64_C(2006343905095682),254},
+        decimal64{UINT64_C(3089769613847351),256},
+        decimal64{UINT64_C(4789142901463394),258},
+        decimal64{UINT64_C(7471062926282894),260},
+        decimal64{UINT64_C(1172956879426414),263},
+        decimal64{UINT64_C(1853271869493735),265},
+        decimal64{UINT64_C(2946702272495038),267},
+        decimal64{UINT64_C(4714723635992061),269},
+        decimal64{UINT64_C(7590705053947219),271},
+        decimal64{UINT64_C(1229694218739449),274},
+        decimal64{UINT64_C(2004401576545303),276},
+        decimal64{UINT64_C(3287218585534296),278},
+        decimal64{UINT64_C(5423910666131589),280},
+        decimal64{UINT64_C(9003691705778437),282},
+        decimal64{UINT64_C(1503616514864999),285},
+        decimal64{UINT64_C(2526075744973198),287},
+        decimal64{UINT64_C(4269068009004705),289},
+        decimal64{UINT64_C(7257415615307999),291},
+        decimal64{UINT64_C(1241018070217668),294},
+        decimal64{UINT64_C(2134551080774389),296},
+        decimal64{UINT64_C(3692773369739692),298},
+        decimal64{UINT64_C(6425425663347065),300},
+        decimal64{UINT64_C(1124449491085736),303},
+        decimal64{UINT64_C(1979031104310896),305},
+        decimal64{UINT64_C(3502885054630286),307},
+        decimal64{UINT64_C(6235135397241909),309},
+        decimal64{UINT64_C(1116089236106302),312},
+        decimal64{UINT64_C(2008960624991343),314},
+        decimal64{UINT64_C(3636218731234331),316},
+        decimal64{UINT64_C(6617918090846482),318},
+        decimal64{UINT64_C(1211079010624906),321},
+        decimal64{UINT64_C(2228385379549827),323},
+        decimal64{UINT64_C(4122512952167181),325},
+        decimal64{UINT64_C(7667874091030956),327},
+        decimal64{UINT64_C(1433892455022789),330},
+        decimal64{UINT64_C(2695717815442843),332},
+        decimal64{UINT64_C(5094906671186973),334},
+        decimal64{UINT64_C(9680322675255249),336},
+        decimal64{UINT64_C(1848941630973753),339},
+        decimal64{UINT64_C(3549967931469605),341},
+        decimal64{UINT64_C(6851438107736338),343},
+        decimal64{UINT64_C(1329178992900849),346},
+        decimal64{UINT64_C(2591899036156657),348},
+        decimal64{UINT64_C(5080122110867047),350},
+        decimal64{UINT64_C(1000784055840808),353},
+        decimal64{UINT64_C(1981552430564800),355},
+        decimal64{UINT64_C(3943289336823953),357},
+        decimal64{UINT64_C(7886578673647905),359},
+        decimal64{UINT64_C(1585202313403229),362},
+        decimal64{UINT64_C(3202108673074522),364},
+        decimal64{UINT64_C(6500280606341280),366},
+        decimal64{UINT64_C(1326057243693621),369}
+    }};
+
+    static constexpr std::array<decimal64, 205> d64_log_factorials =
+    {{
+        decimal64{UINT64_C(0),0},
+        decimal64{UINT64_C(0),0},
+        decimal64{UINT64_C(6931471805599453),-16},
+        decimal64{UINT64_C(1791759469228055),-15},
+        decimal64{UINT64_C(3178053830347946),-15},
+        decimal64{UINT64_C(4787491742782046),-15},
+        decimal64{UINT64_C(6579251212010101),-15},
+        decimal64{UINT64_C(8525161361065414),-15},
+        decimal64{UINT64_C(1060460290274525),-14},
+        decimal64{UINT64_C(1280182748008147),-14},
+        decimal64{UINT64_C(1510441257307552),-14},
+        decimal64{UINT64_C(1750230784587389),-14},
+        decimal64{UINT64_C(1998721449566189),-14},
+        decimal64{UINT64_C(2255216385312342),-14},
+        decimal64{UINT64_C(2519122118273868),-14},
+        decimal64{UINT64_C(2789927138384089),-14},
+        decimal64{UINT64_C(3067186010608067),-14},
+        decimal64{UINT64_C(3350507345013689),-14},
+        decimal64{UINT64_C(3639544520803305),-14},
+        decimal64{UINT64_C(3933988418719949),-14},
+        decimal64{UINT64_C(4233561646075349),-14},
+        decimal64{UINT64_C(4538013889847691),-14},
+        decimal64{UINT64_C(4847118135183522),-14},
+        decimal64{UINT64_C(5160667556776437),-14},
+        decimal64{UINT64_C(5478472939811232),-14},
+        decimal64{UINT64_C(5800360522298052),-14},
+        decimal64{UINT64_C(6126170176100200),-14},
+        decimal64{UINT64_C(6455753862700633),-14},
+        decimal64{UINT64_C(6788974313718153),-14},
+        decimal64{UINT64_C(7125703896716801),-14},
+        decimal64{UINT64_C(7465823634883016),-14},
+        decimal64{UINT64_C(7809222355331531),-14},
+        decimal64{UINT64_C(8155795945611504),-14},
+        decimal64{UINT64_C(8505446701758152),-14},
+        decimal64{UINT64_C(8858082754219768),-14},
+        decimal64{UINT64_C(9213617560368709),-14},
+        decimal64{UINT64_C(9571969454214320),-14},
+        decimal64{UINT64_C(9933061245478743),-14},
+        decimal64{UINT64_C(1029681986145138),-13},
+        decimal64{UINT64_C(1066317602606435),-13},
+        decimal64{UINT64_C(1103206397147574),-13},
+        decimal64{UINT64_C(1140342117814617),-13},
+        decimal64{UINT64_C(1177718813997451),-13},
+        decimal64{UINT64_C(1215330815154386),-13},
+        decimal64{UINT64_C(1253172711493569),-13},
+        decimal64{UINT64_C(1291239336391272),-13},
+        decimal64{UINT64_C(1329525750356163),-13},
+        decimal64{UINT64_C(1368027226373264),-13},
+        decimal64{UINT64_C(1406739236482343),-13},
+        decimal64{UINT64_C(1445657439463449),-13},
+        decimal64{UINT64_C(1484777669517730),-13},
+        decimal64{UINT64_C(1524095925844974),-13},
+        decimal64{UINT64_C(1563608363030788),-13},
+        decimal64{UINT64_C(1603311282166309),-13},
+        decimal64{UINT64_C(1643201122631952),-13},
+        decimal64{UINT64_C(1683274454484277),-13},
+        decimal64{UINT64_C(1723527971391628),-13},
+        decimal64{UINT64_C(1763958484069974),-13},
+        decimal64{UINT64_C(1804562914175438),-13},
+        decimal64{UINT64_C(1845338288614495),-13},
+        decimal64{UINT64_C(1886281734236716),-13},
+        decimal64{UINT64_C(1927390472878449),-13},
+        decimal64{UINT64_C(1968661816728900),-13},
+        decimal64{UINT64_C(2010093163992815),-13},
+        decimal64{UINT64_C(2051681994826412),-13},
+        decimal64{UINT64_C(2093425867525368),-13},
+        decimal64{UINT64_C(2135322414945633),-13},
+        decimal64{UINT64_C(2177369341139542),-13},
+        decimal64{UINT64_C(2219564418191303),-13},
+        decimal64{UINT64_C(2261905483237276),-13},
+        decimal64{UINT64_C(2304390435657770),-13},
+        decimal64{UINT64_C(2347017234428183),-13},
+        decimal64{UINT64_C(2389783895618343),-13},
+        decimal64{UINT64_C(2432688490029827),-13},
+        decimal64{UINT64_C(2475729140961869),-13},
+        decimal64{UINT64_C(2518904022097232),-13},
+        decimal64{UINT64_C(2562211355500095),-13},
+        decimal64{UINT64_C(2605649409718632),-13},
+        decimal64{UINT64_C(2649216497985528),-13},
+        decimal64{UINT64_C(2692910976510198),-13},
+        decimal64{UINT64_C(2736731242856937),-13},
+        decimal64{UINT64_C(2780675734403661),-13},
+        decimal64{UINT64_C(2824742926876304),-13},
+        decimal64{UINT64_C(2868931332954270),-13},
+        decimal64{UINT64_C(2913239500942703),-13},
+        decimal64{UINT64_C(2957666013507606),-13},
+        decimal64{UINT64_C(3002209486470141),-13},
+        decimal64{UINT64_C(3046868567656687),-13},
+        decimal64{UINT64_C(3091641935801469),-13},
+        decimal64{UINT64_C(3136528299498791),-13},
+        decimal64{UINT64_C(3181526396202093),-13},
+        decimal64{UINT64_C(3226634991267262),-13},
+        decimal64{UINT64_C(3271852877037752),-13},
+        decimal64{UINT64_C(3317178871969285),-13},
+        decimal64{UINT64_C(3362611819791985),-13},
+        decimal64{UINT64_C(3408150588707990),-13},
+        decimal64{UINT64_C(3453794070622669),-13},
+        decimal64{UINT64_C(3499541180407702),-13},
+        decimal64{UINT64_C(3545390855194408),-13},
+        decimal64{UINT64_C(3591342053695754),-13},
+        decimal64{UINT64_C(3637393755555635),-13},
+        decimal64{UINT64_C(3683544960724047),-13},
+        decimal64{UINT64_C(3729794688856890),-13},
+        decimal64{UINT64_C(3776141978739187),-13},
+        decimal64{UINT64_C(3822585887730600),-13},
+        decimal64{UINT64_C(3869125491232176),-13},
+        decimal64{UINT64_C(3915759882173296),-13},
+        decimal64{UINT64_C(3962488170517915),-13},
+        decimal64{UINT64_C(4009309482789157),-13},
+        decimal64{UINT64_C(4056222961611449),-13},
+        decimal64{UINT64_C(4103227765269373),-13},
+        decimal64{UINT64_C(4150323067282496),-13},
+        decimal64{UINT64_C(4197508055995447),-13},
+        decimal64{UINT64_C(4244781934182571),-13},
+        decimal64{UINT64_C(4292143918666516),-13},
+        decimal64{UINT64_C(4339593239950148),-13},
+        decimal64{UINT64_C(4387129141861212),-13},
+        decimal64{UINT64_C(4434750881209189),-13},
+        decimal64{UINT64_C(4482457727453846),-13},
+        decimal64{UINT64_C(4530248962384961),-13},
+        decimal64{UINT64_C(4578123879812782),-13},
+        decimal64{UINT64_C(4626081785268749),-13},
+        decimal64{UINT64_C(4674121995716082),-13},
+        decimal64{UINT64_C(4722243839269806),-13},
+        decimal64{UINT64_C(4770446654925856),-13},
+        decimal64{UINT64_C(4818729792298879),-13},
+        decimal64{UINT64_C(4867092611368394),-13},
+        decimal64{UINT64_C(4915534482232980),-13},
+        decimal64{UINT64_C(4964054784872176),-13},
+        decimal64{UINT64_C(5012652908915793),-13},
+        decimal64{UINT64_C(5061328253420349),-13},
+        decimal64{UINT64_C(5110080226652360),-13},
+        decimal64{UINT64_C(5158908245878224),-13},
+        decimal64{UINT64_C(5207811737160442),-13},
+        decimal64{UINT64_C(5256790135159951),-13},
+        decimal64{UINT64_C(5305842882944335),-13},
+        decimal64{UINT64_C(5354969431801695),-13},
+        decimal64{UINT64_C(5404169241059977),-13},
+        decimal64{UINT64_C(5453441777911549),-13},
+        decimal64{UINT64_C(5502786517242856),-13},
+        decimal64{UINT64_C(5552202941468949),-13},
+        decimal64{UINT64_C(5601690540372730),-13},
+        decimal64{UINT64_C(5651248810948743),-13},
+        decimal64{UINT64_C(5700877257251342),-13},
+        decimal64{UINT64_C(5750575390247102),-13},
+        decimal64{UINT64_C(5800342727671308),-13},
+        decimal64{UINT64_C(5850178793888391),-13},
+        decimal64{UINT64_C(5900083119756179),-13},
+        decimal64{UINT64_C(5950055242493820),-13},
+        decimal64{UINT64_C(6000094705553274),-13},
+        decimal64{UINT64_C(6050201058494237),-13},
+        decimal64{UINT64_C(6100373856862386),-13},
+        decimal64{UINT64_C(6150612662070849),-13},
+        decimal64{UINT64_C(6200917041284773),-13},
+        decimal64{UINT64_C(6251286567308909),-13},
+        decimal64{UINT64_C(6301720818478102),-13},
+        decimal64{UINT64_C(6352219378550597),-13},
+        decimal64{UINT64_C(6402781836604080),-13},
+        decimal64{UINT64_C(6453407786934350),-13},
+        decimal64{UINT64_C(6504096828956552),-13},
+        decimal64{UINT64_C(6554848567108891),-13},
+        decimal64{UINT64_C(6605662610758735),-13},
+        decimal64{UINT64_C(6656538574111059),-13},
+        decimal64{UINT64_C(6707476076119127),-13},
+        decimal64{UINT64_C(6758474740397369),-13},
+        decimal64{UINT64_C(6809534195136375),-13},
+        decimal64{UINT64_C(6860654073019940),-13},
+        decimal64{UINT64_C(6911834011144108),-13},
+        decimal64{UINT64_C(6963073650938140),-13},
+        decimal64{UINT64_C(7014372638087371),-13},
+        decimal64{UINT64_C(7065730622457873),-13},
+        decimal64{UINT64_C(7117147258022900),-13},
+        decimal64{UINT64_C(7168622202791035),-13},
+        decimal64{UINT64_C(7220155118736012),-13},
+        decimal64{UINT64_C(7271745671728158),-13},
+        decimal64{UINT64_C(7323393531467393),-13},
+        decimal64{UINT64_C(7375098371417774),-13},
+        decimal64{UINT64_C(7426859868743513),-13},
+        decimal64{UINT64_C(7478677704246433),-13},
+        decimal64{UINT64_C(7530551562304841),-13},
+        decimal64{UINT64_C(7582481130813743),-13},
+        decimal64{UINT64_C(7634466101126401),-13},
+        decimal64{UINT64_C(7686506167997169),-13},
+        decimal64{UINT64_C(7738601029525584),-13},
+        decimal64{UINT64_C(7790750387101673),-13},
+        decimal64{UINT64_C(7842953945352457),-13},
+        decimal64{UINT64_C(7895211412089589),-13},
+        decimal64{UINT64_C(7947522498258135),-13},
+        decimal64{UINT64_C(7999886917886434),-13},
+        decimal64{UINT64_C(8052304388037030),-13},
+        decimal64{UINT64_C(8104774628758635),-13},
+        decimal64{UINT64_C(8157297363039102),-13},
+        decimal64{UINT64_C(8209872316759379),-13},
+        decimal64{UINT64_C(8262499218648428),-13},
+        decimal64{UINT64_C(8315177800239062),-13},
+        decimal64{UINT64_C(8367907795824699),-13},
+        decimal64{UINT64_C(8420688942417004),-13},
+        decimal64{UINT64_C(8473520979704384),-13},
+        decimal64{UINT64_C(8526403650011329),-13},
+        decimal64{UINT64_C(8579336698258574),-13},
+        decimal64{UINT64_C(8632319871924055),-13},
+        decimal64{UINT64_C(8685352921004645),-13},
+        decimal64{UINT64_C(8738435597978658),-13},
+        decimal64{UINT64_C(8791567657769075),-13},
+        decimal64{UINT64_C(8844748857707518),-13}
+    }};
+
+    static constexpr std::array<decimal64, 205> d64_half_integer_gammas =
+    {{
+        decimal64{UINT64_C(1772453850905516),-15},
+        decimal64{UINT64_C(8862269254527580),-16},
+        decimal64{UINT64_C(1329340388179137),-15},
+        decimal64{UINT64_C(3323350970447843),-15},
+        decimal64{UINT64_C(1163172839656745),-14},
+        decimal64{UINT64_C(5234277778455352),-14},
+        decimal64{UINT64_C(2878852778150444),-13},
+        decimal64{UINT64_C(1871254305797788),-12},
+        decimal64{UINT64_C(1403440729348341),-11},
+        decimal64{UINT64_C(1192924619946090),-10},
+        decimal64{UINT64_C(1133278388948786),-9},
+        decimal64{UINT64_C(1189942308396225),-8},
+        decimal64{UINT64_C(1368433654655659),-7},
+        decimal64{UINT64_C(1710542068319573),-6},
+        decimal64{UINT64_C(2309231792231424),-5},
+        decimal64{UINT64_C(3348386098735565),-4},
+        decimal64{UINT64_C(5189998453040125),-3},
+        decimal64{UINT64_C(8563497447516206),-2},
+        decimal64{UINT64_C(1498612053315336),0},
+        decimal64{UINT64_C(2772432298633372),1},
+        decimal64{UINT64_C(5406242982335075),2},
+        decimal64{UINT64_C(1108279811378690),4},
+        decimal64{UINT64_C(2382801594464184),5},
+        decimal64{UINT64_C(5361303587544415),6},
+        decimal64{UINT64_C(1259906343072937),8},
+        decimal64{UINT64_C(3086770540528697),9},
+        decimal64{UINT64_C(7871264878348177),10},
+        decimal64{UINT64_C(2085885192762267),12},
+        decimal64{UINT64_C(5736184280096234),13},
+        decimal64{UINT64_C(1634812519827427),15},
+        decimal64{UINT64_C(4822696933490909),16},
+        decimal64{UINT64_C(1470922564714727),18},
+        decimal64{UINT64_C(4633406078851390),19},
+        decimal64{UINT64_C(1505856975626702),21},
+        decimal64{UINT64_C(5044620868349451),22},
+        decimal64{UINT64_C(1740394199580561),24},
+        decimal64{UINT64_C(6178399408510991),25},
+        decimal64{UINT64_C(2255115784106512),27},
+        decimal64{UINT64_C(8456684190399418),28},
+        decimal64{UINT64_C(3255823413303776),30},
+        decimal64{UINT64_C(1286050248254992),32},
+        decimal64{UINT64_C(5208503505432716),33},
+        decimal64{UINT64_C(2161528954754577),35},
+        decimal64{UINT64_C(9186498057706952),36},
+        decimal64{UINT64_C(3996126655102524),38},
+        decimal64{UINT64_C(1778276361520623),40},
+        decimal64{UINT64_C(8091157444918836),41},
+        decimal64{UINT64_C(3762388211887259),43},
+        decimal64{UINT64_C(1787134400646448),45},
+        decimal64{UINT64_C(8667601843135272),46},
+        decimal64{UINT64_C(4290462912351960),48},
+        decimal64{UINT64_C(2166683770737740),50},
+        decimal64{UINT64_C(1115842141929936),52},
+        decimal64{UINT64_C(5858171245132164),53},
+        decimal64{UINT64_C(3134121616145708),55},
+        decimal64{UINT64_C(1708096280799411),57},
+        decimal64{UINT64_C(9479934358436729),58},
+        decimal64{UINT64_C(5356162912516752),60},
+        decimal64{UINT64_C(3079793674697132),62},
+        decimal64{UINT64_C(1801679299697822),64},
+        decimal64{UINT64_C(1071999183320204),66},
+        decimal64{UINT64_C(6485595059087236),67},
+        decimal64{UINT64_C(3988640961338650),69},
+        decimal64{UINT64_C(2492900600836656),71},
+        decimal64{UINT64_C(1582991881531277),73},
+        decimal64{UINT64_C(1021029763587674),75},
+        decimal64{UINT64_C(6687744951499262),76},
+        decimal64{UINT64_C(4447350392747009),78},
+        decimal64{UINT64_C(3001961515104231),80},
+        decimal64{UINT64_C(2056343637846398),82},
+        decimal64{UINT64_C(1429158828303247),84},
+        decimal64{UINT64_C(1007556973953789),86},
+        decimal64{UINT64_C(7204032363769592),87},
+        decimal64{UINT64_C(5222923463732954),89},
+        decimal64{UINT64_C(3838848745843721),91},
+        decimal64{UINT64_C(2859942315653572),93},
+        decimal64{UINT64_C(2159256448318447),95},
+        decimal64{UINT64_C(1651831182963612),97},
+        decimal64{UINT64_C(1280169166796799),99},
+        decimal64{UINT64_C(1004932795935487),101},
+        decimal64{UINT64_C(7989215727687125),102},
+        decimal64{UINT64_C(6431318660788136),104},
+        decimal64{UINT64_C(5241524708542331),106},
+        decimal64{UINT64_C(4324257884547423),108},
+        decimal64{UINT64_C(3610755333597098),110},
+        decimal64{UINT64_C(3051088256889548),112},
+        decimal64{UINT64_C(2608680459640563),114},
+        decimal64{UINT64_C(2256508597589087),116},
+        decimal64{UINT64_C(1974445022890451),118},
+        decimal64{UINT64_C(1747383845258049),120},
+        decimal64{UINT64_C(1563908541505954),122},
+        decimal64{UINT64_C(1415337230062889),124},
+        decimal64{UINT64_C(1295033565507543),126},
+        decimal64{UINT64_C(1197906048094477),128},
+        decimal64{UINT64_C(1120042154968336),130},
+        decimal64{UINT64_C(1058439836445078),132},
+        decimal64{UINT64_C(1010810043805049),134},
+        decimal64{UINT64_C(9754316922718726),135},
+        decimal64{UINT64_C(9510458999650758),137},
+        decimal64{UINT64_C(9367802114655997),139},
+        decimal64{UINT64_C(9320963104082717),141},
+        decimal64{UINT64_C(9367567919603130),143},
+        decimal64{UINT64_C(9508081438397177),145},
+        decimal64{UINT64_C(9745783474357107),147},
+        decimal64{UINT64_C(1008688589595961),150},
+        decimal64{UINT64_C(1054079576127779),152},
+        decimal64{UINT64_C(1112053952814807),154},
+        decimal64{UINT64_C(1184337459747769),156},
+        decimal64{UINT64_C(1273162769228852),158},
+        decimal64{UINT64_C(1381381604613304),160},
+        decimal64{UINT64_C(1512612857051568),162},
+        decimal64{UINT64_C(1671437207041983),164},
+        decimal64{UINT64_C(1863652485851811),166},
+        decimal64{UINT64_C(2096609046583287),168},
+        decimal64{UINT64_C(2379651267872031),170},
+        decimal64{UINT64_C(2724700701713475),172},
+        decimal64{UINT64_C(3147029310479064),174},
+        decimal64{UINT64_C(3666289146708109),176},
+        decimal64{UINT64_C(4307889747382028),178},
+        decimal64{UINT64_C(5104849350647704),180},
+        decimal64{UINT64_C(6100294974024006),182},
+        decimal64{UINT64_C(7350855443698927),184},
+        decimal64{UINT64_C(8931289364094196),186},
+        decimal64{UINT64_C(1094082947101539),189},
+        decimal64{UINT64_C(1351192439670401),191},
+        decimal64{UINT64_C(1682234587389649),193},
+        decimal64{UINT64_C(2111204407174009),195},
+        decimal64{UINT64_C(2670673575075122),197},
+        decimal64{UINT64_C(3405108808220780),199},
+        decimal64{UINT64_C(4375564818563703),201},
+        decimal64{UINT64_C(5666356440039995),203},
+        decimal64{UINT64_C(7394595154252194),205},
+        decimal64{UINT64_C(9723892627841635),207},
+        decimal64{UINT64_C(1288415773189017),210},
+        decimal64{UINT64_C(1720035057207337),212},
+        decimal64{UINT64_C(2313447151943868),214},
+        decimal64{UINT64_C(3134720890883942),216},
+        decimal64{UINT64_C(4278894016056581),218},
+        decimal64{UINT64_C(5883479272077798),220},
+        decimal64{UINT64_C(8148618791827751),222},
+        decimal64{UINT64_C(1136732321459971),225},
+        decimal64{UINT64_C(1597108911651260),227},
+        decimal64{UINT64_C(2259909109986532),229},
+        decimal64{UINT64_C(3220370481730808),231},
+        decimal64{UINT64_C(4621231641283710),233},
+        decimal64{UINT64_C(6677679721654961),235},
+        decimal64{UINT64_C(9716023995007968),237},
+        decimal64{UINT64_C(1423397515268667),240},
+        decimal64{UINT64_C(2099511335021284),242},
+        decimal64{UINT64_C(3117774332506607),244},
+        decimal64{UINT64_C(4661072627097378),246},
+        decimal64{UINT64_C(7014914303781554),248},
+        decimal64{UINT64_C(1062759517022905),251},
+        decimal64{UINT64_C(1620708263459931),253},
+        decimal64{UINT64_C(2487787184410994),255},
+        decimal64{UINT64_C(3843631199914985),257},
+        decimal64{UINT64_C(5976846515867802),259},
+        decimal64{UINT64_C(9353764797333110),261},
+        decimal64{UINT64_C(1473217955579965),264},
+        decimal64{UINT64_C(2335050459594244),266},
+        decimal64{UINT64_C(3724405483052820),268},
+        decimal64{UINT64_C(5977670800299776),270},
+        decimal64{UINT64_C(9653938342484137),272},
+        decimal64{UINT64_C(1568764980653672),275},
+        decimal64{UINT64_C(2564930743368754),277},
+        decimal64{UINT64_C(4219311072841601),279},
+        decimal64{UINT64_C(6982959825552849),281},
+        decimal64{UINT64_C(1162662810954549),284},
+        decimal64{UINT64_C(1947460208348870),286},
+        decimal64{UINT64_C(3281470451067846),288},
+        decimal64{UINT64_C(5562092414560000),290},
+        decimal64{UINT64_C(9483367566824799),292},
+        decimal64{UINT64_C(1626397537710453),295},
+        decimal64{UINT64_C(2805535752550532),297},
+        decimal64{UINT64_C(4867604530675172),299},
+        decimal64{UINT64_C(8493969906028176),301},
+        decimal64{UINT64_C(1490691718507945),304},
+        decimal64{UINT64_C(2631070883166523),306},
+        decimal64{UINT64_C(4670150817620578),308},
+        decimal64{UINT64_C(8336219209452731),310},
+        decimal64{UINT64_C(1496351348096765),313},
+        decimal64{UINT64_C(2700914183314661),315},
+        decimal64{UINT64_C(4902159242716110),317},
+        decimal64{UINT64_C(8946440617956901),319},
+        decimal64{UINT64_C(1641671853395091),322},
+        decimal64{UINT64_C(3028884569513944),324},
+        decimal64{UINT64_C(5618580876448365),326},
+        decimal64{UINT64_C(1047865333457620),329},
+        decimal64{UINT64_C(1964747500233038),331},
+        decimal64{UINT64_C(3703549037939276),333},
+        decimal64{UINT64_C(7018225426894928),335},
+        decimal64{UINT64_C(1336971943823484),338},
+        decimal64{UINT64_C(2560301272421972),340},
+        decimal64{UINT64_C(4928579949412295),342},
+        decimal64{UINT64_C(9536802202112791),344},
+        decimal64{UINT64_C(1854908028310938),347},
+        decimal64{UINT64_C(3626345195347884),349},
+        decimal64{UINT64_C(7125768308858591),351},
+        decimal64{UINT64_C(1407339240999572),354},
+        decimal64{UINT64_C(2793568393384150),356},
+        decimal64{UINT64_C(5573168944801379),358},
+        decimal64{UINT64_C(1117420373432677),361},
+        decimal64{UINT64_C(2251602052466843),363},
+        decimal64{UINT64_C(4559494156245357),365},
+        decimal64{UINT64_C(9278570607959302),367}
+    }};
+
+    static constexpr std::array<decimal128, 205> d128_factorials =
+    {{
+        decimal128{detail::uint128{UINT64_C(54210108624275),UINT64_C(4089650035136921600)},-33},
+        decimal128{detail::uint128{UINT64_C(54210108624275),UINT64_C(4089650035136921600)},-33},
+        decimal128{detail::uint128{UINT64_C(108420217248550),UINT64_C(8179300070273843200)},-33},
+        decimal128{detail::uint128{UINT64_C(325260651745651),UINT64_C(6091156137111977984)},-33},
+        decimal128{detail::uint128{UINT64_C(130104260698260),UINT64_C(9815160084328611840)},-32},
+        decimal128{detail::uint128{UINT64_C(65052130349130),UINT64_C(4907580042164305920)},-31},
+        decimal128{detail::uint128{UINT64_C(390312782094781),UINT64_C(10998736179276283904)},-31},
+        decimal128{detail::uint128{UINT64_C(273218947466347),UINT64_C(2165092103380533248)},-30},
+        decimal128{detail::uint128{UINT64_C(218575157973077),UINT64_C(12800120126930157568)},-29},
+        decimal128{detail::uint128{UINT64_C(196717642175769),UINT64_C(17054131336350007296)},-28},
+        decimal128{detail::uint128{UINT64_C(196717642175769),UINT64_C(17054131336350007296)},-27},
+        decimal128{detail::uint128{UINT64_C(216389406393346),UINT64_C(16914870062614052864)},-26},
+        decimal128{detail::uint128{UINT64_C(259667287672016),UINT64_C(5540448816169222144)},-25},
+        decimal128{detail::uint128{UINT64_C(337567473973621),UINT64_C(3513234646278078464)},-24},
+        decimal128{detail::uint128{UINT64_C(472594463563069),UINT64_C(12297226134273130496)},-23},
+        decimal128{detail::uint128{UINT64_C(70889169534460),UINT64_C(8300944345939312640)},-21},
+        decimal128{detail::uint128{UINT64_C(113422671255136),UINT64_C(13281510953502900224)},-20},
+        decimal128{detail::uint128{UINT64_C(192818541133732),UINT64_C(7821173361987289088)},-19},
+        decimal128{detail::uint128{UINT64_C(347073374040718),UINT64_C(6699414422093299712)},-18},
+        decimal128{detail::uint128{UINT64_C(65943941067736),UINT64_C(9020521251155738624)},-16},
+        decimal128{detail::uint128{UINT64_C(131887882135472),UINT64_C(18041042502311477248)},-15},
+        decimal128{detail::uint128{UINT64_C(276964552484493),UINT64_C(4682049922176909312)},-14},
+        decimal128{detail::uint128{UINT64_C(60932201546588),UINT64_C(9515553256785313792)},-12},
+        decimal128{detail::uint128{UINT64_C(140144063557153),UINT64_C(10817726046380490752)},-11},
+        decimal128{detail::uint128{UINT64_C(336345752537168),UINT64_C(11205147252345536512)},-10},
+        decimal128{detail::uint128{UINT64_C(84086438134292),UINT64_C(2801286813086384128)},-8},
+        decimal128{detail::uint128{UINT64_C(218624739149159),UINT64_C(10972694528766509056)},-7},
+        decimal128{detail::uint128{UINT64_C(59028679570273),UINT64_C(1671355437607288832)},-5},
+        decimal128{detail::uint128{UINT64_C(165280302796764),UINT64_C(12058492854784229376)},-4},
+        decimal128{detail::uint128{UINT64_C(479312878110617),UINT64_C(9144187575680892928)},-3},
+        decimal128{detail::uint128{UINT64_C(143793863433185),UINT64_C(4587930680075223040)},-1},
+        decimal128{detail::uint128{UINT64_C(445760976642874),UINT64_C(4999213071378415616)},0},
+        decimal128{detail::uint128{UINT64_C(142643512525719),UINT64_C(14143534152963588096)},2},
+        decimal128{detail::uint128{UINT64_C(470723591334875),UINT64_C(4246151335247872000)},3},
+        decimal128{detail::uint128{UINT64_C(160046021053857),UINT64_C(10667063490839052288)},5},
+        decimal128{detail::uint128{UINT64_C(56016107368850),UINT64_C(2811135018108190720)},7},
+        decimal128{detail::uint128{UINT64_C(201657986527860),UINT64_C(10120086065189486592)},8},
+        decimal128{detail::uint128{UINT64_C(74613455015308),UINT64_C(7433780658862020362)},10},
+        decimal128{detail::uint128{UINT64_C(283531129058171),UINT64_C(17180320059449946407)},11},
+        decimal128{detail::uint128{UINT64_C(110577140332687),UINT64_C(981834160335518098)},13},
+        decimal128{detail::uint128{UINT64_C(442308561330748),UINT64_C(3927336641342072391)},14},
+        decimal128{detail::uint128{UINT64_C(181346510145606),UINT64_C(14153993993072744779)},16},
+        decimal128{detail::uint128{UINT64_C(76165534261154),UINT64_C(15536984395419519648)},18},
+        decimal128{detail::uint128{UINT64_C(327511797322965),UINT64_C(15158149493917189960)},19},
+        decimal128{detail::uint128{UINT64_C(144105190822104),UINT64_C(17737632221549294552)},21},
+        decimal128{detail::uint128{UINT64_C(64847335869947),UINT64_C(4292585684955272225)},23},
+        decimal128{detail::uint128{UINT64_C(298297745001757),UINT64_C(4988498891826610943)},24},
+        decimal128{detail::uint128{UINT64_C(140199940150825),UINT64_C(16917522297389052920)},26},
+        decimal128{detail::uint128{UINT64_C(67295971272396),UINT64_C(8120410702746745402)},28},
+        decimal128{detail::uint128{UINT64_C(329750259234742),UINT64_C(10275221925523769882)},29},
+        decimal128{detail::uint128{UINT64_C(164875129617371),UINT64_C(5137610962761884941)},31},
+        decimal128{detail::uint128{UINT64_C(84086316104859),UINT64_C(6493997846487567159)},33},
+        decimal128{detail::uint128{UINT64_C(437248843745268),UINT64_C(11632695913283887289)},34},
+        decimal128{detail::uint128{UINT64_C(231741887184992),UINT64_C(6903198596988842328)},36},
+        decimal128{detail::uint128{UINT64_C(125140619079895),UINT64_C(16271513212496469956)},38},
+        decimal128{detail::uint128{UINT64_C(68827340493942),UINT64_C(13561018285300446380)},40},
+        decimal128{detail::uint128{UINT64_C(385433106766079),UINT64_C(5844074917586203585)},41},
+        decimal128{detail::uint128{UINT64_C(219696870856665),UINT64_C(3884525025235422592)},43},
+        decimal128{detail::uint128{UINT64_C(127424185096865),UINT64_C(15165745366233231235)},45},
+        decimal128{detail::uint128{UINT64_C(75180269207150),UINT64_C(15404150191875949494)},47},
+        decimal128{detail::uint128{UINT64_C(451081615242905),UINT64_C(191180782707938884)},48},
+        decimal128{detail::uint128{UINT64_C(275159785298172),UINT64_C(1038957481137320300)},50},
+        decimal128{detail::uint128{UINT64_C(170599066884866),UINT64_C(12450069845479251620)},52},
+        decimal128{detail::uint128{UINT64_C(107477412137466),UINT64_C(95911491693916842)},54},
+        decimal128{detail::uint128{UINT64_C(68785543767978),UINT64_C(4488601932374399167)},56},
+        decimal128{detail::uint128{UINT64_C(447106034491858),UINT64_C(10729168486724042968)},57},
+        decimal128{detail::uint128{UINT64_C(295089982764626),UINT64_C(12246339541876542812)},59},
+        decimal128{detail::uint128{UINT64_C(197710288452299),UINT64_C(15952680004015295362)},61},
+        decimal128{detail::uint128{UINT64_C(134442996147563),UINT64_C(16750780506317457364)},63},
+        decimal128{detail::uint128{UINT64_C(92765667341819),UINT64_C(1781264190292983224)},65},
+        decimal128{detail::uint128{UINT64_C(64935967139273),UINT64_C(6780908155317953742)},67},
+        decimal128{detail::uint128{UINT64_C(461045366688840),UINT64_C(16784982977451233820)},68},
+        decimal128{detail::uint128{UINT64_C(331952664015965),UINT64_C(8395838929022978027)},70},
+        decimal128{detail::uint128{UINT64_C(242325444731654),UINT64_C(14429997251356072187)},72},
+        decimal128{detail::uint128{UINT64_C(179320829101424),UINT64_C(9940328203055111354)},74},
+        decimal128{detail::uint128{UINT64_C(134490621826068),UINT64_C(7455246152291333515)},76},
+        decimal128{detail::uint128{UINT64_C(102212872587811),UINT64_C(18209773045863908571)},78},
+        decimal128{detail::uint128{UINT64_C(78703911892615),UINT64_C(4244750886249147243)},80},
+        decimal128{detail::uint128{UINT64_C(61389051276239),UINT64_C(16223626542871020981)},82},
+        decimal128{detail::uint128{UINT64_C(484973505082295),UINT64_C(884115580085159597)},83},
+        decimal128{detail::uint128{UINT64_C(387978804065836),UINT64_C(707292464068127677)},85},
+        decimal128{detail::uint128{UINT64_C(314262831293327),UINT64_C(3524385947688711677)},87},
+        decimal128{detail::uint128{UINT64_C(257695521660528),UINT64_C(5472540647424080801)},89},
+        decimal128{detail::uint128{UINT64_C(213887282978238),UINT64_C(8969427315052279453)},91},
+        decimal128{detail::uint128{UINT64_C(179665317701720),UINT64_C(6058579418747150611)},93},
+        decimal128{detail::uint128{UINT64_C(152715520046462),UINT64_C(5149792505935078020)},95},
+        decimal128{detail::uint128{UINT64_C(131335347239957),UINT64_C(10331779658691223614)},97},
+        decimal128{detail::uint128{UINT64_C(114261752098763),UINT64_C(1425483232840448382)},99},
+        decimal128{detail::uint128{UINT64_C(100550341846911),UINT64_C(9370992637331797287)},101},
+        decimal128{detail::uint128{UINT64_C(89489804243751),UINT64_C(4466367191746293746)},103},
+        decimal128{detail::uint128{UINT64_C(80540823819376),UINT64_C(2175056065200709210)},105},
+        decimal128{detail::uint128{UINT64_C(73292149675632),UINT64_C(4930780071126173639)},107},
+        decimal128{detail::uint128{UINT64_C(67428777701581),UINT64_C(12652885057868282459)},109},
+        decimal128{detail::uint128{UINT64_C(62708763262470),UINT64_C(17854608648141654720)},111},
+        decimal128{detail::uint128{UINT64_C(58946237466722),UINT64_C(13093983314511245114)},113},
+        decimal128{detail::uint128{UINT64_C(55998925593386),UINT64_C(10594609741414727697)},115},
+        decimal128{detail::uint128{UINT64_C(537589685696511),UINT64_C(2095835519549807162)},116},
+        decimal128{detail::uint128{UINT64_C(521461995125615),UINT64_C(14392278983348712530)},118},
+        decimal128{detail::uint128{UINT64_C(511032755223103),UINT64_C(8570410181568872794)},120},
+        decimal128{detail::uint128{UINT64_C(505922427670872),UINT64_C(7931303757541897518)},122},
+        decimal128{detail::uint128{UINT64_C(505922427670872),UINT64_C(7931303757541897518)},124},
+        decimal128{detail::uint128{UINT64_C(510981651947581),UINT64_C(2845528454478642041)},126},
+        decimal128{detail::uint128{UINT64_C(521201284986532),UINT64_C(14339420349268136883)},128},
+        decimal128{detail::uint128{UINT64_C(536837323536128),UINT64_C(14031733196797798925)},130},
+        decimal128{detail::uint128{UINT64_C(55831081647757),UINT64_C(7214684403464351192)},133},
+        decimal128{detail::uint128{UINT64_C(58622635730145),UINT64_C(4808407012581136010)},135},
+        decimal128{detail::uint128{UINT64_C(62139993873953),UINT64_C(18009632284932690301)},137},
+        decimal128{detail::uint128{UINT64_C(66489793445130),UINT64_C(13920750763502208654)},139},
+        decimal128{detail::uint128{UINT64_C(71808976920741),UINT64_C(3966364380356654377)},141},
+        decimal128{detail::uint128{UINT64_C(78271784843607),UINT64_C(17051590585448343886)},143},
+        decimal128{detail::uint128{UINT64_C(86098963327968),UINT64_C(13222726421880312789)},145},
+        decimal128{detail::uint128{UINT64_C(95569849294045),UINT64_C(5084919409958180356)},147},
+        decimal128{detail::uint128{UINT64_C(107038231209330),UINT64_C(13073807368636982645)},149},
+        decimal128{detail::uint128{UINT64_C(120953201266543),UINT64_C(12928727919188835227)},151},
+        decimal128{detail::uint128{UINT64_C(137886649443859),UINT64_C(15107684709349463191)},153},
+        decimal128{detail::uint128{UINT64_C(158569646860438),UINT64_C(14606825804695449928)},155},
+        decimal128{detail::uint128{UINT64_C(183940790358108),UINT64_C(18419657459343486045)},157},
+        decimal128{detail::uint128{UINT64_C(215210724718987),UINT64_C(9745083020257765639)},159},
+        decimal128{detail::uint128{UINT64_C(253948655168405),UINT64_C(5227304978842915904)},161},
+        decimal128{detail::uint128{UINT64_C(302198899650402),UINT64_C(5298155721137592345)},163},
+        decimal128{detail::uint128{UINT64_C(362638679580482),UINT64_C(13736484494848931461)},165},
+        decimal128{detail::uint128{UINT64_C(438792802292384),UINT64_C(2232685861273756807)},167},
+        decimal128{detail::uint128{UINT64_C(535327218796708),UINT64_C(11578313906134568080)},169},
+        decimal128{detail::uint128{UINT64_C(65845247911995),UINT64_C(2973659112646154210)},172},
+        decimal128{detail::uint128{UINT64_C(81648107410873),UINT64_C(18444732558648872513)},174},
+        decimal128{detail::uint128{UINT64_C(102060134263592),UINT64_C(9220857643028926929)},176},
+        decimal128{detail::uint128{UINT64_C(128595769172126),UINT64_C(10142541104319683801)},178},
+        decimal128{detail::uint128{UINT64_C(163316626848600),UINT64_C(13249962083960189460)},180},
+        decimal128{detail::uint128{UINT64_C(209045282366208),UINT64_C(16959951467469042508)},182},
+        decimal128{detail::uint128{UINT64_C(269668414252409),UINT64_C(9334551422912569737)},184},
+        decimal128{detail::uint128{UINT64_C(350568938528132),UINT64_C(6600893627673475173)},186},
+        decimal128{detail::uint128{UINT64_C(459245309471853),UINT64_C(7171431126355488348)},188},
+        decimal128{detail::uint128{UINT64_C(60620380850284),UINT64_C(11940888376609817225)},191},
+        decimal128{detail::uint128{UINT64_C(80625106530878),UINT64_C(10716293200252382457)},193},
+        decimal128{detail::uint128{UINT64_C(108037642751377),UINT64_C(5505395732957607716)},195},
+        decimal128{detail::uint128{UINT64_C(145850817714359),UINT64_C(6509947035807292836)},197},
+        decimal128{detail::uint128{UINT64_C(198357112091528),UINT64_C(13280746546388210645)},199},
+        decimal128{detail::uint128{UINT64_C(271749243565394),UINT64_C(6388706561377735550)},201},
+        decimal128{detail::uint128{UINT64_C(375013956120244),UINT64_C(3651326714062600606)},203},
+        decimal128{detail::uint128{UINT64_C(521269399007139),UINT64_C(8026823184340543101)},205},
+        decimal128{detail::uint128{UINT64_C(72977715860999),UINT64_C(9609257519714069778)},208},
+        decimal128{detail::uint128{UINT64_C(102898579364009),UINT64_C(5985888032575922224)},210},
+        decimal128{detail::uint128{UINT64_C(146115982696893),UINT64_C(4441677310041708202)},212},
+        decimal128{detail::uint128{UINT64_C(208945855256557),UINT64_C(6167131112622547213)},214},
+        decimal128{detail::uint128{UINT64_C(300882031569442),UINT64_C(10356408328073232116)},216},
+        decimal128{detail::uint128{UINT64_C(436278945775691),UINT64_C(13172117668335231407)},218},
+        decimal128{detail::uint128{UINT64_C(63696726083250),UINT64_C(18266944428883606517)},221},
+        decimal128{detail::uint128{UINT64_C(93634187342378),UINT64_C(17629036273604125772)},223},
+        decimal128{detail::uint128{UINT64_C(138578597266720),UINT64_C(15760797003656757238)},225},
+        decimal128{detail::uint128{UINT64_C(206482109927414),UINT64_C(1347494646997106345)},227},
+        decimal128{detail::uint128{UINT64_C(309723164891121),UINT64_C(2021241970495659518)},229},
+        decimal128{detail::uint128{UINT64_C(467681978985592),UINT64_C(16149263667782227520)},231},
+        decimal128{detail::uint128{UINT64_C(71087660805810),UINT64_C(2159540172323545757)},234},
+        decimal128{detail::uint128{UINT64_C(108764121032889),UINT64_C(8838119685767890493)},236},
+        decimal128{detail::uint128{UINT64_C(167496746390649),UINT64_C(14717508960505124456)},238},
+        decimal128{detail::uint128{UINT64_C(259619956905507),UINT64_C(3443057611387913711)},240},
+        decimal128{detail::uint128{UINT64_C(405007132772591),UINT64_C(3895430347868381259)},242},
+        decimal128{detail::uint128{UINT64_C(63586119845296),UINT64_C(15129170150624752980)},245},
+        decimal128{detail::uint128{UINT64_C(100466069355568),UINT64_C(18001130734400053191)},247},
+        decimal128{detail::uint128{UINT64_C(159741050275354),UINT64_C(12388663082831679151)},249},
+        decimal128{detail::uint128{UINT64_C(255585680440567),UINT64_C(8753814488304955672)},251},
+        decimal128{detail::uint128{UINT64_C(411492945509313),UINT64_C(11695564596588736921)},253},
+        decimal128{detail::uint128{UINT64_C(66661857172508),UINT64_C(14918082780686318822)},256},
+        decimal128{detail::uint128{UINT64_C(108658827191189),UINT64_C(6607600621757530129)},258},
+        decimal128{detail::uint128{UINT64_C(178200476593550),UINT64_C(10098595256733967347)},260},
+        decimal128{detail::uint128{UINT64_C(294030786379358),UINT64_C(7439310136756270314)},262},
+        decimal128{detail::uint128{UINT64_C(488091105389734),UINT64_C(17514343167654083173)},264},
+        decimal128{detail::uint128{UINT64_C(81511214600085),UINT64_C(13587113383602352724)},267},
+        decimal128{detail::uint128{UINT64_C(136938840528144),UINT64_C(690257596000490637)},269},
+        decimal128{detail::uint128{UINT64_C(231426640492563),UINT64_C(7807363203776267759)},271},
+        decimal128{detail::uint128{UINT64_C(393425288837357),UINT64_C(15117191853790610351)},273},
+        decimal128{detail::uint128{UINT64_C(67275724391188),UINT64_C(3452036778462543296)},276},
+        decimal128{detail::uint128{UINT64_C(115714245952843),UINT64_C(12578331125491013051)},278},
+        decimal128{detail::uint128{UINT64_C(200185645498419),UINT64_C(10507998962136626092)},280},
+        decimal128{detail::uint128{UINT64_C(348323023167250),UINT64_C(943978764830750881)},282},
+        decimal128{detail::uint128{UINT64_C(60956529054268),UINT64_C(14000254339127545116)},285},
+        decimal128{detail::uint128{UINT64_C(107283491135513),UINT64_C(290745459567871271)},287},
+        decimal128{detail::uint128{UINT64_C(189891779309858),UINT64_C(699086904172227667)},289},
+        decimal128{detail::uint128{UINT64_C(338007367171547),UINT64_C(5671593267116857635)},291},
+        decimal128{detail::uint128{UINT64_C(60503318723706),UINT64_C(17857092534110738142)},294},
+        decimal128{detail::uint128{UINT64_C(108905973702672),UINT64_C(10006673672947866716)},296},
+        decimal128{detail::uint128{UINT64_C(197119812401837),UINT64_C(5568293377913143658)},298},
+        decimal128{detail::uint128{UINT64_C(358758058571343),UINT64_C(16406186932863169007)},300},
+        decimal128{detail::uint128{UINT64_C(65652724718555),UINT64_C(17187878401396605121)},303},
+        decimal128{detail::uint128{UINT64_C(120801013482142),UINT64_C(16868300999602112130)},305},
+        decimal128{detail::uint128{UINT64_C(223481874941964),UINT64_C(7225589553441490339)},307},
+        decimal128{detail::uint128{UINT64_C(415676287392053),UINT64_C(14177466332349554095)},309},
+        decimal128{detail::uint128{UINT64_C(77731465742314),UINT64_C(1009425981589216522)},312},
+        decimal128{detail::uint128{UINT64_C(146135155595550),UINT64_C(7800678948974783579)},314},
+        decimal128{detail::uint128{UINT64_C(276195444075590),UINT64_C(5519911176707565155)},316},
+        decimal128{detail::uint128{UINT64_C(524771343743621),UINT64_C(10487831235744373795)},318},
+        decimal128{detail::uint128{UINT64_C(100231326655031),UINT64_C(13274136395063711432)},321},
+        decimal128{detail::uint128{UINT64_C(192444147177660),UINT64_C(16631904723141741174)},323},
+        decimal128{detail::uint128{UINT64_C(371417204052885),UINT64_C(9963483227212098527)},325},
+        decimal128{detail::uint128{UINT64_C(72054937586259),UINT64_C(14661169156938737729)},328},
+        decimal128{detail::uint128{UINT64_C(140507128293206),UINT64_C(11064872986006464537)},330},
+        decimal128{detail::uint128{UINT64_C(275393971454684),UINT64_C(17259932474882378105)},332},
+        decimal128{detail::uint128{UINT64_C(54252612376572),UINT64_C(17198371264686573095)},335},
+        decimal128{detail::uint128{UINT64_C(107420172505614),UINT64_C(7489463637937660402)},337},
+        decimal128{detail::uint128{UINT64_C(213766143286172),UINT64_C(12321488469176606973)},339},
+        decimal128{detail::uint128{UINT64_C(427532286572345),UINT64_C(6196232864643662331)},341},
+        decimal128{detail::uint128{UINT64_C(85933989601041),UINT64_C(7609569511223171436)},344},
+        decimal128{detail::uint128{UINT64_C(173586658994103),UINT64_C(12050916479403087010)},346},
+        decimal128{detail::uint128{UINT64_C(352380917758030),UINT64_C(7676823346112574659)},348},
+        decimal128{detail::uint128{UINT64_C(71885707222638),UINT64_C(3779681251452111424)},351}
+    }};
+
+    static constexpr std::array<decimal128, 205> d128_log_factorials =
+    {{
+        decimal128{detail::uint128{UINT64_C(0),UINT64_C(0)},0},
+        decimal128{detail::uint128{UINT64_C(0),UINT64_C(0)},0},
+        decimal128{detail::uint128{UINT64_C(375755839507647),UINT64_C(8395602002641374214)},-34},
+        decimal128{detail::uint128{UINT64_C(97131475455426),UINT64_C(10664248517504112286)},-33},
+        decimal128{detail::uint128{UINT64_C(172282643356956),UINT64_C(1275322473806656159)},-33},
+        decimal128{detail::uint128{UINT64_C(259530447414035),UINT64_C(7432619314379192683)},-33},
+        decimal128{detail::uint128{UINT64_C(356661922869461),UINT64_C(18096867831883304969)},-33},
+        decimal128{detail::uint128{UINT64_C(462149923422830),UINT64_C(1899779995758553845)},-33},
+        decimal128{detail::uint128{UINT64_C(57487667527512),UINT64_C(8005011129876012773)},-32},
+        decimal128{detail::uint128{UINT64_C(69398845828444),UINT64_C(14766102252488491167)},-32},
+        decimal128{detail::uint128{UINT64_C(81881184629229),UINT64_C(3844339190135141043)},-32},
+        decimal128{detail::uint128{UINT64_C(94880200950032),UINT64_C(14418857929349869908)},-32},
+        decimal128{detail::uint128{UINT64_C(108350906890651),UINT64_C(16860510886286363492)},-32},
+        decimal128{detail::uint128{UINT64_C(122255525219027),UINT64_C(7343996024621064408)},-32},
+        decimal128{detail::uint128{UINT64_C(136561883669440),UINT64_C(12633538568307537135)},-32},
+        decimal128{detail::uint128{UINT64_C(151242253225614),UINT64_C(14785139406300074823)},-32},
+        decimal128{detail::uint128{UINT64_C(166272486805920),UINT64_C(12907354197560583597)},-32},
+        decimal128{detail::uint128{UINT64_C(181631367119624),UINT64_C(954356219762225246)},-32},
+        decimal128{detail::uint128{UINT64_C(197300103815632),UINT64_C(16469373077044606641)},-32},
+        decimal128{detail::uint128{UINT64_C(213261939505449),UINT64_C(3157861302660701154)},-32},
+        decimal128{detail::uint128{UINT64_C(229501836701310),UINT64_C(990023974977254032)},-32},
+        decimal128{detail::uint128{UINT64_C(246006225907113),UINT64_C(906186345300062955)},-32},
+        decimal128{detail::uint128{UINT64_C(262762800622993),UINT64_C(1787886745475143205)},-32},
+        decimal128{detail::uint128{UINT64_C(279760348826623),UINT64_C(12619586507194758145)},-32},
+        decimal128{detail::uint128{UINT64_C(296988613162319),UINT64_C(5368421125091603114)},-32},
+        decimal128{detail::uint128{UINT64_C(314438173973735),UINT64_C(2910531678464200096)},-32},
+        decimal128{detail::uint128{UINT64_C(332100350697187),UINT64_C(2147942551468804014)},-32},
+        decimal128{detail::uint128{UINT64_C(349967118148585),UINT64_C(12289579235387521603)},-32},
+        decimal128{detail::uint128{UINT64_C(368031034994075),UINT64_C(7886303440034345717)},-32},
+        decimal128{detail::uint128{UINT64_C(386285182265439),UINT64_C(39701096920857684)},-32},
+        decimal128{detail::uint128{UINT64_C(404723110216689),UINT64_C(10945227669583298373)},-32},
+        decimal128{detail::uint128{UINT64_C(423338792153640),UINT64_C(12763677857423589792)},-32},
+        decimal128{detail::uint128{UINT64_C(442126584129023),UINT64_C(1193074309644449953)},-32},
+        decimal128{detail::uint128{UINT64_C(461081189600292),UINT64_C(15148138610165418014)},-32},
+        decimal128{detail::uint128{UINT64_C(480197628309072),UINT64_C(11949066367036962664)},-32},
+        decimal128{detail::uint128{UINT64_C(499471208770117),UINT64_C(7255738452739830881)},-32},
+        decimal128{detail::uint128{UINT64_C(518897503861202),UINT64_C(13077936970982563662)},-32},
+        decimal128{detail::uint128{UINT64_C(538472329088981),UINT64_C(3030296625392125942)},-32},
+        decimal128{detail::uint128{UINT64_C(55819172317387),UINT64_C(7225968688051632992)},-31},
+        decimal128{detail::uint128{UINT64_C(57805193065271),UINT64_C(10301720572757637327)},-31},
+        decimal128{detail::uint128{UINT64_C(59804938624365),UINT64_C(5426306191343417430)},-31},
+        decimal128{detail::uint128{UINT64_C(61818070075566),UINT64_C(8148188765882456988)},-31},
+        decimal128{detail::uint128{UINT64_C(63844264835654),UINT64_C(7170523169010773019)},-31},
+        decimal128{detail::uint128{UINT64_C(65883215503948),UINT64_C(4320494803148243373)},-31},
+        decimal128{detail::uint128{UINT64_C(67934628815043),UINT64_C(16352103860858472668)},-31},
+        decimal128{detail::uint128{UINT64_C(69998224685707),UINT64_C(16905318500788350356)},-31},
+        decimal128{detail::uint128{UINT64_C(72073735345578),UINT64_C(11485183420943481504)},-31},
+        decimal128{detail::uint128{UINT64_C(74160904542660),UINT64_C(10564379989494594714)},-31},
+        decimal128{detail::uint128{UINT64_C(76259486815737),UINT64_C(14404004839493179834)},-31},
+        decimal128{detail::uint128{UINT64_C(78369246826805),UINT64_C(2643081757070762810)},-31},
+        decimal128{detail::uint128{UINT64_C(80489958747454),UINT64_C(6962034200616923131)},-31},
+        decimal128{detail::uint128{UINT64_C(82621405693871),UINT64_C(6104788958967711216)},-31},
+        decimal128{detail::uint128{UINT64_C(84763379205724),UINT64_C(3214573804993251584)},-31},
+        decimal128{detail::uint128{UINT64_C(86915678764761),UINT64_C(10971947317893888083)},-31},
+        decimal128{detail::uint128{UINT64_C(89078111349409),UINT64_C(1793457115527019173)},-31},
+        decimal128{detail::uint128{UINT64_C(91250491022060),UINT64_C(4572688924488077070)},-31},
+        decimal128{detail::uint128{UINT64_C(93432638546116),UINT64_C(16075800362645480751)},-31},
+        decimal128{detail::uint128{UINT64_C(95624381030145),UINT64_C(2169982889741027991)},-31},
+        decimal128{detail::uint128{UINT64_C(97825551596789),UINT64_C(2260715228896669488)},-31},
+        decimal128{detail::uint128{UINT64_C(100035989074325),UINT64_C(16757093008767908509)},-31},
+        decimal128{detail::uint128{UINT64_C(102255537708958),UINT64_C(11344340610017322231)},-31},
+        decimal128{detail::uint128{UINT64_C(104484046896133),UINT64_C(16735669318040631687)},-31},
+        decimal128{detail::uint128{UINT64_C(106721370929336),UINT64_C(12258883688178785645)},-31},
+        decimal128{detail::uint128{UINT64_C(108967368764963),UINT64_C(10743880073970735295)},-31},
+        decimal128{detail::uint128{UINT64_C(111221903802009),UINT64_C(8617537885288856450)},-31},
+        decimal128{detail::uint128{UINT64_C(113484843675417),UINT64_C(14921689556274777037)},-31},
+        decimal128{detail::uint128{UINT64_C(115756060062052),UINT64_C(7969216522939088335)},-31},
+        decimal128{detail::uint128{UINT64_C(118035428498341),UINT64_C(2911390698406058948)},-31},
+        decimal128{detail::uint128{UINT64_C(120322828208726),UINT64_C(14534922491785934683)},-31},
+        decimal128{detail::uint128{UINT64_C(122618141944136),UINT64_C(8577449394604699450)},-31},
+        decimal128{detail::uint128{UINT64_C(124921255829748),UINT64_C(10828183584012931734)},-31},
+        decimal128{detail::uint128{UINT64_C(127232059221397),UINT64_C(14859669698729402080)},-31},
+        decimal128{detail::uint128{UINT64_C(129550444570013),UINT64_C(18161956531391620820)},-31},
+        decimal128{detail::uint128{UINT64_C(131876307293540),UINT64_C(18428687908736125573)},-31},
+        decimal128{detail::uint128{UINT64_C(134209545655826),UINT64_C(9075944410789296293)},-31},
+        decimal128{detail::uint128{UINT64_C(136550060652014),UINT64_C(12857558836999090234)},-31},
+        decimal128{detail::uint128{UINT64_C(138897755900011),UINT64_C(11432518399123725125)},-31},
+        decimal128{detail::uint128{UINT64_C(141252537537625),UINT64_C(12143531953946854984)},-31},
+        decimal128{detail::uint128{UINT64_C(143614314125017),UINT64_C(8715978782636028972)},-31},
+        decimal128{detail::uint128{UINT64_C(145982996552120),UINT64_C(16708666051355595338)},-31},
+        decimal128{detail::uint128{UINT64_C(148358497950722),UINT64_C(5329946613924545095)},-31},
+        decimal128{detail::uint128{UINT64_C(150740733610908),UINT64_C(14060862467930861420)},-31},
+        decimal128{detail::uint128{UINT64_C(153129620901617),UINT64_C(10279439986453070632)},-31},
+        decimal128{detail::uint128{UINT64_C(155525079195037),UINT64_C(12477471924412136825)},-31},
+        decimal128{detail::uint128{UINT64_C(157927029794633),UINT64_C(4996501271523622510)},-31},
+        decimal128{detail::uint128{UINT64_C(160335395866574),UINT64_C(7367655816154326847)},-31},
+        decimal128{detail::uint128{UINT64_C(162750102374375),UINT64_C(16461066467984518471)},-31},
+        decimal128{detail::uint128{UINT64_C(165171076016558),UINT64_C(16014460789803793588)},-31},
+        decimal128{detail::uint128{UINT64_C(167598245167162),UINT64_C(3096020717787640920)},-31},
+        decimal128{detail::uint128{UINT64_C(170031539818942),UINT64_C(12632351581286771139)},-31},
+        decimal128{detail::uint128{UINT64_C(172470891529114),UINT64_C(6682261165199818481)},-31},
+        decimal128{detail::uint128{UINT64_C(174916233367485),UINT64_C(10918194582047811030)},-31},
+        decimal128{detail::uint128{UINT64_C(177367499866863),UINT64_C(17441498519895663447)},-31},
+        decimal128{detail::uint128{UINT64_C(179824626975605),UINT64_C(12427374872697451024)},-31},
+        decimal128{detail::uint128{UINT64_C(182287552012195),UINT64_C(5003266385231733888)},-31},
+        decimal128{detail::uint128{UINT64_C(184756213621747),UINT64_C(12772592772316748996)},-31},
+        decimal128{detail::uint128{UINT64_C(187230551734332),UINT64_C(10108912566298503770)},-31},
+        decimal128{detail::uint128{UINT64_C(189710507525025),UINT64_C(16154182249738810922)},-31},
+        decimal128{detail::uint128{UINT64_C(192196023375600),UINT64_C(16336698185009115167)},-31},
+        decimal128{detail::uint128{UINT64_C(194687042837774),UINT64_C(8846887134337060085)},-31},
+        decimal128{detail::uint128{UINT64_C(197183510597931),UINT64_C(6662534521866390060)},-31},
+        decimal128{detail::uint128{UINT64_C(199685372443252),UINT64_C(4057395574591470454)},-31},
+        decimal128{detail::uint128{UINT64_C(202192575229176),UINT64_C(15143589350634979809)},-31},
+        decimal128{detail::uint128{UINT64_C(204705066848136),UINT64_C(16204384537133890983)},-31},
+        decimal128{detail::uint128{UINT64_C(207222796199497),UINT64_C(6810864327142601005)},-31},
+        decimal128{detail::uint128{UINT64_C(209745713160648),UINT64_C(8524260499214466908)},-31},
+        decimal128{detail::uint128{UINT64_C(212273768559193),UINT64_C(9778328956098273061)},-31},
+        decimal128{detail::uint128{UINT64_C(214806914146181),UINT64_C(14447595065482470685)},-31},
+        decimal128{detail::uint128{UINT64_C(217345102570336),UINT64_C(17212543880808323045)},-31},
+        decimal128{detail::uint128{UINT64_C(219888287353235),UINT64_C(18208667534378230353)},-31},
+        decimal128{detail::uint128{UINT64_C(222436422865394),UINT64_C(14484594287322457904)},-31},
+        decimal128{detail::uint128{UINT64_C(224989464303219),UINT64_C(4594512772039262243)},-31},
+        decimal128{detail::uint128{UINT64_C(227547367666783),UINT64_C(9594319154179835578)},-31},
+        decimal128{detail::uint128{UINT64_C(230110089738398),UINT64_C(4333629807203791899)},-31},
+        decimal128{detail::uint128{UINT64_C(232677588061934),UINT64_C(2371251351992060408)},-31},
+        decimal128{detail::uint128{UINT64_C(235249820922867),UINT64_C(18088922114800293044)},-31},
+        decimal128{detail::uint128{UINT64_C(237826747329019),UINT64_C(11676349397939104195)},-31},
+        decimal128{detail::uint128{UINT64_C(240408326991950),UINT64_C(7711458209291911802)},-31},
+        decimal128{detail::uint128{UINT64_C(242994520308994),UINT64_C(15704530933146320477)},-31},
+        decimal128{detail::uint128{UINT64_C(245585288345898),UINT64_C(16007467223639096776)},-31},
+        decimal128{detail::uint128{UINT64_C(248180592820039),UINT64_C(4091409768871680153)},-31},
+        decimal128{detail::uint128{UINT64_C(250780396084199),UINT64_C(17274359960940356895)},-31},
+        decimal128{detail::uint128{UINT64_C(253384661110882),UINT64_C(16162383612946836005)},-31},
+        decimal128{detail::uint128{UINT64_C(255993351477130),UINT64_C(11843623114132678836)},-31},
+        decimal128{detail::uint128{UINT64_C(258606431349841),UINT64_C(863532428254002447)},-31},
+        decimal128{detail::uint128{UINT64_C(261223865471553),UINT64_C(7873546640743712641)},-31},
+        decimal128{detail::uint128{UINT64_C(263845619146687),UINT64_C(18301982044228383561)},-31},
+        decimal128{detail::uint128{UINT64_C(266471658228220),UINT64_C(5672934628740553396)},-31},
+        decimal128{detail::uint128{UINT64_C(269101949104773),UINT64_C(15490031457751395820)},-31},
+        decimal128{detail::uint128{UINT64_C(271736458688114),UINT64_C(5599360018535669448)},-31},
+        decimal128{detail::uint128{UINT64_C(274375154401030),UINT64_C(5400206633504759689)},-31},
+        decimal128{detail::uint128{UINT64_C(277018004165585),UINT64_C(7285594327525100504)},-31},
+        decimal128{detail::uint128{UINT64_C(279664976391727),UINT64_C(12276560311882133072)},-31},
+        decimal128{detail::uint128{UINT64_C(282316039966242),UINT64_C(17977668444829220143)},-31},
+        decimal128{detail::uint128{UINT64_C(284971164242039),UINT64_C(6416537564279360410)},-31},
+        decimal128{detail::uint128{UINT64_C(287630319027749),UINT64_C(18375853204565592987)},-31},
+        decimal128{detail::uint128{UINT64_C(290293474577643),UINT64_C(5049335868219086760)},-31},
+        decimal128{detail::uint128{UINT64_C(292960601581828),UINT64_C(5939267618414853599)},-31},
+        decimal128{detail::uint128{UINT64_C(295631671156745),UINT64_C(11925233538926339636)},-31},
+        decimal128{detail::uint128{UINT64_C(298306654835932),UINT64_C(6278104435014112199)},-31},
+        decimal128{detail::uint128{UINT64_C(300985524561052),UINT64_C(2025533568405514136)},-31},
+        decimal128{detail::uint128{UINT64_C(303668252673180),UINT64_C(12510831137312982235)},-31},
+        decimal128{detail::uint128{UINT64_C(306354811904337),UINT64_C(10039012196012622235)},-31},
+        decimal128{detail::uint128{UINT64_C(309045175369255),UINT64_C(8300138176396610052)},-31},
+        decimal128{detail::uint128{UINT64_C(311739316557379),UINT64_C(5099119953041998445)},-31},
+        decimal128{detail::uint128{UINT64_C(314437209325086),UINT64_C(7880914061141189814)},-31},
+        decimal128{detail::uint128{UINT64_C(317138827888121),UINT64_C(1644340382468864222)},-31},
+        decimal128{detail::uint128{UINT64_C(319844146814235),UINT64_C(1289518300402802086)},-31},
+        decimal128{detail::uint128{UINT64_C(322553141016028),UINT64_C(3880213820148694076)},-31},
+        decimal128{detail::uint128{UINT64_C(325265785743981),UINT64_C(12010000822499923070)},-31},
+        decimal128{detail::uint128{UINT64_C(327982056579677),UINT64_C(9288310192692886664)},-31},
+        decimal128{detail::uint128{UINT64_C(330701929429198),UINT64_C(13513783429905505573)},-31},
+        decimal128{detail::uint128{UINT64_C(333425380516703),UINT64_C(5585437936013310117)},-31},
+        decimal128{detail::uint128{UINT64_C(336152386378166),UINT64_C(16134293694720453091)},-31},
+        decimal128{detail::uint128{UINT64_C(338882923855288),UINT64_C(10342002193526752604)},-31},
+        decimal128{detail::uint128{UINT64_C(341616970089554),UINT64_C(8556278332608456433)},-31},
+        decimal128{detail::uint128{UINT64_C(344354502516453),UINT64_C(17072164178990351691)},-31},
+        decimal128{detail::uint128{UINT64_C(347095498859843),UINT64_C(11119126050977297486)},-31},
+        decimal128{detail::uint128{UINT64_C(349839937126454),UINT64_C(12608508263680033506)},-31},
+        decimal128{detail::uint128{UINT64_C(352587795600538),UINT64_C(13325238703227473277)},-31},
+        decimal128{detail::uint128{UINT64_C(355339052838647),UINT64_C(13889958283489144304)},-31},
+        decimal128{detail::uint128{UINT64_C(358093687664544),UINT64_C(9092666718449897286)},-31},
+        decimal128{detail::uint128{UINT64_C(360851679164238),UINT64_C(11320277516439383265)},-31},
+        decimal128{detail::uint128{UINT64_C(363613006681145),UINT64_C(3629674028133872760)},-31},
+        decimal128{detail::uint128{UINT64_C(366377649811361),UINT64_C(11791690564348803242)},-31},
+        decimal128{detail::uint128{UINT64_C(369145588399059),UINT64_C(7530279299956664412)},-31},
+        decimal128{detail::uint128{UINT64_C(371916802531987),UINT64_C(3225006181898900260)},-31},
+        decimal128{detail::uint128{UINT64_C(374691272537081),UINT64_C(18122095259430735804)},-31},
+        decimal128{detail::uint128{UINT64_C(377468978976185),UINT64_C(4137819550525391142)},-31},
+        decimal128{detail::uint128{UINT64_C(380249902641860),UINT64_C(5923865392934241648)},-31},
+        decimal128{detail::uint128{UINT64_C(383034024553309),UINT64_C(1791714881548115639)},-31},
+        decimal128{detail::uint128{UINT64_C(385821325952383),UINT64_C(17738742482709569384)},-31},
+        decimal128{detail::uint128{UINT64_C(388611788299693),UINT64_C(1882104004813379046)},-31},
+        decimal128{detail::uint128{UINT64_C(391405393270795),UINT64_C(18309873182759862624)},-31},
+        decimal128{detail::uint128{UINT64_C(394202122752486),UINT64_C(11359962448562307394)},-31},
+        decimal128{detail::uint128{UINT64_C(397001958839161),UINT64_C(16301758406914089550)},-31},
+        decimal128{detail::uint128{UINT64_C(399804883829272),UINT64_C(15326757352590658152)},-31},
+        decimal128{detail::uint128{UINT64_C(402610880221856),UINT64_C(4335747985399148830)},-31},
+        decimal128{detail::uint128{UINT64_C(405419930713144),UINT64_C(7368773792881448703)},-31},
+        decimal128{detail::uint128{UINT64_C(408232018193250),UINT64_C(16736607990345597621)},-31},
+        decimal128{detail::uint128{UINT64_C(411047125742930),UINT64_C(4283212518241814617)},-31},
+        decimal128{detail::uint128{UINT64_C(413865236630409),UINT64_C(2932384664193584883)},-31},
+        decimal128{detail::uint128{UINT64_C(416686334308288),UINT64_C(665013025024747085)},-31},
+        decimal128{detail::uint128{UINT64_C(419510402410509),UINT64_C(17462442733404411431)},-31},
+        decimal128{detail::uint128{UINT64_C(422337424749395),UINT64_C(17482441615235433502)},-31},
+        decimal128{detail::uint128{UINT64_C(425167385312744),UINT64_C(10820759886232154094)},-31},
+        decimal128{detail::uint128{UINT64_C(428000268260993),UINT64_C(17750075256726662941)},-31},
+        decimal128{detail::uint128{UINT64_C(430836057924444),UINT64_C(12078204110755434508)},-31},
+        decimal128{detail::uint128{UINT64_C(433674738800541),UINT64_C(16597534640982438641)},-31},
+        decimal128{detail::uint128{UINT64_C(436516295551215),UINT64_C(8041887953421191564)},-31},
+        decimal128{detail::uint128{UINT64_C(439360713000275),UINT64_C(9307909284489376327)},-31},
+        decimal128{detail::uint128{UINT64_C(442207976130863),UINT64_C(9712477374054468142)},-31},
+        decimal128{detail::uint128{UINT64_C(445058070082956),UINT64_C(545492112019392570)},-31},
+        decimal128{detail::uint128{UINT64_C(447910980150920),UINT64_C(8169884262803896577)},-31},
+        decimal128{detail::uint128{UINT64_C(450766691781121),UINT64_C(7711848890227373382)},-31},
+        decimal128{detail::uint128{UINT64_C(453625190569576),UINT64_C(6975357487860097242)},-31},
+        decimal128{detail::uint128{UINT64_C(456486462259659),UINT64_C(654568367113571142)},-31},
+        decimal128{detail::uint128{UINT64_C(459350492739849),UINT64_C(12135766803016375730)},-31},
+        decimal128{detail::uint128{UINT64_C(462217268041530),UINT64_C(16589394770037041917)},-31},
+        decimal128{detail::uint128{UINT64_C(465086774336828),UINT64_C(881251166380859035)},-31},
+        decimal128{detail::uint128{UINT64_C(467958997936492),UINT64_C(10640337571602910280)},-31},
+        decimal128{detail::uint128{UINT64_C(470833925287827),UINT64_C(16988612747426235782)},-31},
+        decimal128{detail::uint128{UINT64_C(473711542972656),UINT64_C(7880168744134485830)},-31},
+        decimal128{detail::uint128{UINT64_C(476591837705326),UINT64_C(8593744598095749161)},-31},
+        decimal128{detail::uint128{UINT64_C(479474796330758),UINT64_C(13176633318122428169)},-31}
+    }};
+
+    static constexpr std::array<decimal128, 205> d128_half_integer_gammas =
+    {{
+        decimal128{detail::uint128{UINT64_C(96084915789102),UINT64_C(17383534340244052313)},-33},
+        decimal128{detail::uint128{UINT64_C(480424578945514),UINT64_C(13130695406382055102)},-34},
+        decimal128{detail::uint128{UINT64_C(72063686841827),UINT64_C(3814278718328263427)},-33},
+        decimal128{detail::uint128{UINT64_C(180159217104568),UINT64_C(312324758965882759)},-33},
+        decimal128{detail::uint128{UINT64_C(63055725986598),UINT64_C(14866708924605700259)},-32},
+        decimal128{detail::uint128{UINT64_C(283750766939694),UINT64_C(11559957939596996315)},-32},
+        decimal128{detail::uint128{UINT64_C(156062921816832),UINT64_C(823953644665482489)},-31},
+        decimal128{detail::uint128{UINT64_C(101440899180940),UINT64_C(15292965128000204910)},-30},
+        decimal128{detail::uint128{UINT64_C(76080674385705),UINT64_C(11469723846000153683)},-29},
+        decimal128{detail::uint128{UINT64_C(64668573227849),UINT64_C(14360951287527518534)},-28},
+        decimal128{detail::uint128{UINT64_C(61435144566457),UINT64_C(5341868889981844380)},-27},
+        decimal128{detail::uint128{UINT64_C(64506901794780),UINT64_C(2841950723424503857)},-26},
+        decimal128{detail::uint128{UINT64_C(74182937063997),UINT64_C(3268243331938179436)},-25},
+        decimal128{detail::uint128{UINT64_C(92728671329996),UINT64_C(8696990183350112199)},-24},
+        decimal128{detail::uint128{UINT64_C(125183706295495),UINT64_C(4362239118038830822)},-23},
+        decimal128{detail::uint128{UINT64_C(181516374128468),UINT64_C(1713560702728916787)},-22},
+        decimal128{detail::uint128{UINT64_C(281350379899125),UINT64_C(10034716718713641667)},-21},
+        decimal128{detail::uint128{UINT64_C(464228126833557),UINT64_C(2722224530595345038)},-20},
+        decimal128{detail::uint128{UINT64_C(81239922195872),UINT64_C(9238592727866222399)},-18},
+        decimal128{detail::uint128{UINT64_C(150293856062364),UINT64_C(2334001287584870146)},-17},
+        decimal128{detail::uint128{UINT64_C(293073019321610),UINT64_C(861953696048586461)},-16},
+        decimal128{detail::uint128{UINT64_C(60079968960930),UINT64_C(1099037711375437805)},-14},
+        decimal128{detail::uint128{UINT64_C(129171933265999),UINT64_C(11586303116311967090)},-13},
+        decimal128{detail::uint128{UINT64_C(290636849848499),UINT64_C(3010751919564986432)},-12},
+        decimal128{detail::uint128{UINT64_C(68299659714397),UINT64_C(5595913880630802990)},-10},
+        decimal128{detail::uint128{UINT64_C(167334166300273),UINT64_C(7253628581747124259)},-9},
+        decimal128{detail::uint128{UINT64_C(426702124065697),UINT64_C(2817020420802047987)},-8},
+        decimal128{detail::uint128{UINT64_C(113076062877409),UINT64_C(13751464983477776606)},-6},
+        decimal128{detail::uint128{UINT64_C(310959172912876),UINT64_C(14758098612426946146)},-5},
+        decimal128{detail::uint128{UINT64_C(88623364280169),UINT64_C(16380909193189983718)},-3},
+        decimal128{detail::uint128{UINT64_C(261438924626501),UINT64_C(3129159139322050509)},-2},
+        decimal128{detail::uint128{UINT64_C(79738872011082),UINT64_C(15804022516829414456)},0},
+        decimal128{detail::uint128{UINT64_C(251177446834910),UINT64_C(18423206002706417790)},1},
+        decimal128{detail::uint128{UINT64_C(81632670221346),UINT64_C(1375855932452197878)},3},
+        decimal128{detail::uint128{UINT64_C(273469445241509),UINT64_C(6453791781085818052)},4},
+        decimal128{detail::uint128{UINT64_C(94346958608320),UINT64_C(13386838329068885956)},6},
+        decimal128{detail::uint128{UINT64_C(334931703059538),UINT64_C(10629787920775441911)},7},
+        decimal128{detail::uint128{UINT64_C(122250071616731),UINT64_C(10705167898355570395)},9},
+        decimal128{detail::uint128{UINT64_C(458437768562743),UINT64_C(7862577489841673654)},10},
+        decimal128{detail::uint128{UINT64_C(176498540896656),UINT64_C(4041663257643069696)},12},
+        decimal128{detail::uint128{UINT64_C(69716923654179),UINT64_C(3810066275614158724)},14},
+        decimal128{detail::uint128{UINT64_C(282353540799425),UINT64_C(14508431212551865250)},15},
+        decimal128{detail::uint128{UINT64_C(117176719431761),UINT64_C(12938527980850105935)},17},
+        decimal128{detail::uint128{UINT64_C(498001057584987),UINT64_C(4260197715911683279)},18},
+        decimal128{detail::uint128{UINT64_C(216630460049469),UINT64_C(8217312711851377534)},20},
+        decimal128{detail::uint128{UINT64_C(96400554722013),UINT64_C(16661658728739096892)},22},
+        decimal128{detail::uint128{UINT64_C(438622523985163),UINT64_C(4790582531981117137)},23},
+        decimal128{detail::uint128{UINT64_C(203959473653100),UINT64_C(16892782415970313003)},25},
+        decimal128{detail::uint128{UINT64_C(96880749985222),UINT64_C(17247443684440674485)},27},
+        decimal128{detail::uint128{UINT64_C(469871637428331),UINT64_C(4329102352586199301)},28},
+        decimal128{detail::uint128{UINT64_C(232586460527023),UINT64_C(17730404406814739770)},30},
+        decimal128{detail::uint128{UINT64_C(117456162566147),UINT64_C(1851857757063266212)},32},
+        decimal128{detail::uint128{UINT64_C(60489923721565),UINT64_C(13958661316852815988)},34},
+        decimal128{detail::uint128{UINT64_C(317572099538220),UINT64_C(4107681637066465378)},35},
+        decimal128{detail::uint128{UINT64_C(169901073252947),UINT64_C(15110330527427245109)},37},
+        decimal128{detail::uint128{UINT64_C(92596084922856),UINT64_C(10356505705924447020)},39},
+        decimal128{detail::uint128{UINT64_C(513908271321853),UINT64_C(16895769705719667406)},40},
+        decimal128{detail::uint128{UINT64_C(290358173296847),UINT64_C(8531538959677586745)},42},
+        decimal128{detail::uint128{UINT64_C(166955949645687),UINT64_C(5366803503657351169)},44},
+        decimal128{detail::uint128{UINT64_C(97669230542727),UINT64_C(1202671921900047514)},46},
+        decimal128{detail::uint128{UINT64_C(58113192172922),UINT64_C(11138000195176424934)},48},
+        decimal128{detail::uint128{UINT64_C(351584812646181),UINT64_C(13889343367059671164)},49},
+        decimal128{detail::uint128{UINT64_C(216224659777401),UINT64_C(14352670553960206525)},51},
+        decimal128{detail::uint128{UINT64_C(135140412360876),UINT64_C(2052890068584047222)},53},
+        decimal128{detail::uint128{UINT64_C(85814161849156),UINT64_C(6099738652715353406)},55},
+        decimal128{detail::uint128{UINT64_C(55350134392705),UINT64_C(15371312756701324949)},57},
+        decimal128{detail::uint128{UINT64_C(362543380272223),UINT64_C(3836692169418532431)},58},
+        decimal128{detail::uint128{UINT64_C(241091347881028),UINT64_C(7993189794407641794)},60},
+        decimal128{detail::uint128{UINT64_C(162736659819694),UINT64_C(3550728703854203049)},62},
+        decimal128{detail::uint128{UINT64_C(111474611976490),UINT64_C(9626479350886854219)},64},
+        decimal128{detail::uint128{UINT64_C(77474855323660),UINT64_C(16836112389406617071)},66},
+        decimal128{detail::uint128{UINT64_C(54619773003180),UINT64_C(17403482456644530520)},68},
+        decimal128{detail::uint128{UINT64_C(390531376972743),UINT64_C(13754435122751083520)},69},
+        decimal128{detail::uint128{UINT64_C(283135248305239),UINT64_C(3976773640038931277)},71},
+        decimal128{detail::uint128{UINT64_C(208104407504350),UINT64_C(15190013434445466313)},73},
+        decimal128{detail::uint128{UINT64_C(155037783590741),UINT64_C(6704873990234484499)},75},
+        decimal128{detail::uint128{UINT64_C(117053526611009),UINT64_C(13455448416164881782)},77},
+        decimal128{detail::uint128{UINT64_C(89545947857422),UINT64_C(8172042469889536128)},79},
+        decimal128{detail::uint128{UINT64_C(69398109589502),UINT64_C(7255670117849868080)},81},
+        decimal128{detail::uint128{UINT64_C(54477516027759),UINT64_C(6986973127671815056)},83},
+        decimal128{detail::uint128{UINT64_C(433096252420687),UINT64_C(1128541347547752426)},84},
+        decimal128{detail::uint128{UINT64_C(348642483198653),UINT64_C(1554111827355775009)},86},
+        decimal128{detail::uint128{UINT64_C(284143623806902),UINT64_C(4863716233668319198)},88},
+        decimal128{detail::uint128{UINT64_C(234418489640694),UINT64_C(6779577503832796080)},90},
+        decimal128{detail::uint128{UINT64_C(195739438849979),UINT64_C(14699851811818065019)},92},
+        decimal128{detail::uint128{UINT64_C(165399825828232),UINT64_C(17125294519782200603)},94},
+        decimal128{detail::uint128{UINT64_C(141416851083139),UINT64_C(2836210607239668481)},96},
+        decimal128{detail::uint128{UINT64_C(122325576186915),UINT64_C(6788307032584057866)},98},
+        decimal128{detail::uint128{UINT64_C(107034879163550),UINT64_C(17468983699579520393)},100},
+        decimal128{detail::uint128{UINT64_C(94725868059742),UINT64_C(10848364555700487644)},102},
+        decimal128{detail::uint128{UINT64_C(84779651913469),UINT64_C(11369493243985796087)},104},
+        decimal128{detail::uint128{UINT64_C(76725584981690),UINT64_C(51448424898344312)},106},
+        decimal128{detail::uint128{UINT64_C(70203910258246),UINT64_C(6503435734580328111)},108},
+        decimal128{detail::uint128{UINT64_C(64938616988877),UINT64_C(16161387295027056891)},110},
+        decimal128{detail::uint128{UINT64_C(60717606884600),UINT64_C(15018663400481750435)},112},
+        decimal128{detail::uint128{UINT64_C(57378138505947),UINT64_C(14192636913455254161)},114},
+        decimal128{detail::uint128{UINT64_C(54796122273180),UINT64_C(2209220647018393480)},116},
+        decimal128{detail::uint128{UINT64_C(528782579936188),UINT64_C(2872235170017945467)},117},
+        decimal128{detail::uint128{UINT64_C(515563015437783),UINT64_C(8334452512880362315)},119},
+        decimal128{detail::uint128{UINT64_C(507829570206216),UINT64_C(12913355463983092542)},121},
+        decimal128{detail::uint128{UINT64_C(505290422355185),UINT64_C(11373049160766412950)},123},
+        decimal128{detail::uint128{UINT64_C(507816874466961),UINT64_C(10046408601042028644)},125},
+        decimal128{detail::uint128{UINT64_C(515434127583965),UINT64_C(17852503520647122994)},127},
+        decimal128{detail::uint128{UINT64_C(528319980773565),UINT64_C(2157915044167443405)},129},
+        decimal128{detail::uint128{UINT64_C(54681118010063),UINT64_C(18255036539122417097)},132},
+        decimal128{detail::uint128{UINT64_C(57141768320516),UINT64_C(16032800411220849850)},134},
+        decimal128{detail::uint128{UINT64_C(60284565578145),UINT64_C(5477623108138074590)},136},
+        decimal128{detail::uint128{UINT64_C(64203062340724),UINT64_C(13673534841493608875)},138},
+        decimal128{detail::uint128{UINT64_C(69018292016279),UINT64_C(1786329103008943409)},140},
+        decimal128{detail::uint128{UINT64_C(74884846837662),UINT64_C(15127589089467033004)},142},
+        decimal128{detail::uint128{UINT64_C(81998907287240),UINT64_C(14535568204858350462)},144},
+        decimal128{detail::uint128{UINT64_C(90608792552401),UINT64_C(1304407607400835968)},146},
+        decimal128{detail::uint128{UINT64_C(101028803695927),UINT64_C(3575790050728530540)},148},
+        decimal128{detail::uint128{UINT64_C(113657404157918),UINT64_C(1716920797855902905)},150},
+        decimal128{detail::uint128{UINT64_C(129001153719237),UINT64_C(657433020406781184)},152},
+        decimal128{detail::uint128{UINT64_C(147706321008526),UINT64_C(7485822395269750796)},154},
+        decimal128{detail::uint128{UINT64_C(170600800764847),UINT64_C(18422899225602624526)},156},
+        decimal128{detail::uint128{UINT64_C(198749932891047),UINT64_C(16943225299768217427)},158},
+        decimal128{detail::uint128{UINT64_C(233531171146981),UINT64_C(5612063070102752974)},160},
+        decimal128{detail::uint128{UINT64_C(276734437809172),UINT64_C(15596965613820894808)},162},
+        decimal128{detail::uint128{UINT64_C(330697653181961),UINT64_C(10152871634609575552)},164},
+        decimal128{detail::uint128{UINT64_C(398490672084263),UINT64_C(12326444040073086298)},166},
+        decimal128{detail::uint128{UINT64_C(484166166582380),UINT64_C(6583360955150953867)},168},
+        decimal128{detail::uint128{UINT64_C(59310355406341),UINT64_C(10952170957546245238)},171},
+        decimal128{detail::uint128{UINT64_C(73248288926831),UINT64_C(16016241582520402337)},173},
+        decimal128{detail::uint128{UINT64_C(91194119713905),UINT64_C(12469289420385532505)},175},
+        decimal128{detail::uint128{UINT64_C(114448620240951),UINT64_C(11498440805999194180)},177},
+        decimal128{detail::uint128{UINT64_C(144777504604803),UINT64_C(14822228780694623911)},179},
+        decimal128{detail::uint128{UINT64_C(184591318371124),UINT64_C(15670161482486473954)},181},
+        decimal128{detail::uint128{UINT64_C(237199844106895),UINT64_C(7961306416346814965)},183},
+        decimal128{detail::uint128{UINT64_C(307173798118429),UINT64_C(10771060411011864170)},185},
+        decimal128{detail::uint128{UINT64_C(400861806544550),UINT64_C(11196988504945502241)},187},
+        decimal128{detail::uint128{UINT64_C(527133275606084),UINT64_C(888981828721171735)},189},
+        decimal128{detail::uint128{UINT64_C(69845159017806),UINT64_C(2515866821887796965)},192},
+        decimal128{detail::uint128{UINT64_C(93243287288771),UINT64_C(3543149647957304464)},194},
+        decimal128{detail::uint128{UINT64_C(125412221403397),UINT64_C(4673302556134026746)},196},
+        decimal128{detail::uint128{UINT64_C(169933560001603),UINT64_C(5133286598770485386)},198},
+        decimal128{detail::uint128{UINT64_C(231959309402188),UINT64_C(8759376894324119956)},200},
+        decimal128{detail::uint128{UINT64_C(318944050428009),UINT64_C(2820771192840889131)},202},
+        decimal128{detail::uint128{UINT64_C(441737509842792),UINT64_C(12484504096359572948)},204},
+        decimal128{detail::uint128{UINT64_C(61622382623069),UINT64_C(10669812453117583408)},207},
+        decimal128{detail::uint128{UINT64_C(86579447585412),UINT64_C(13976515572576179350)},209},
+        decimal128{detail::uint128{UINT64_C(122509918333359),UINT64_C(961090580011551132)},211},
+        decimal128{detail::uint128{UINT64_C(174576633625036),UINT64_C(11976431918899452542)},213},
+        decimal128{detail::uint128{UINT64_C(250517469251927),UINT64_C(10914286818559466849)},215},
+        decimal128{detail::uint128{UINT64_C(361997743069035),UINT64_C(6824473577069297062)},217},
+        decimal128{detail::uint128{UINT64_C(526706716165446),UINT64_C(8546103249107610855)},219},
+        decimal128{detail::uint128{UINT64_C(77162533918237),UINT64_C(16728822403836578796)},222},
+        decimal128{detail::uint128{UINT64_C(113814737529400),UINT64_C(16835146814332394287)},224},
+        decimal128{detail::uint128{UINT64_C(169014885231160),UINT64_C(6553448945574053901)},226},
+        decimal128{detail::uint128{UINT64_C(252677253420584),UINT64_C(13486754988375120905)},228},
+        decimal128{detail::uint128{UINT64_C(380279266397980),UINT64_C(375082657898241216)},230},
+        decimal128{detail::uint128{UINT64_C(57612308859293),UINT64_C(17950166774169848612)},233},
+        decimal128{detail::uint128{UINT64_C(87858771010423),UINT64_C(5699080044000295984)},235},
+        decimal128{detail::uint128{UINT64_C(134863213500999),UINT64_C(14374344810021867579)},237},
+        decimal128{detail::uint128{UINT64_C(208363664859044),UINT64_C(12154887211312079778)},239},
+        decimal128{detail::uint128{UINT64_C(324005498855814),UINT64_C(8201738050838744118)},241},
+        decimal128{detail::uint128{UINT64_C(507068605709349),UINT64_C(11175513082928774899)},243},
+        decimal128{detail::uint128{UINT64_C(79863305399222),UINT64_C(10383996165020497427)},246},
+        decimal128{detail::uint128{UINT64_C(126583339057767),UINT64_C(14060557191975246712)},248},
+        decimal128{detail::uint128{UINT64_C(201900425797139),UINT64_C(10712906234394953229)},250},
+        decimal128{detail::uint128{UINT64_C(324050183404409),UINT64_C(499911119496755720)},252},
+        decimal128{detail::uint128{UINT64_C(523341046198120),UINT64_C(10676364537421870603)},254},
+        decimal128{detail::uint128{UINT64_C(85042920007194),UINT64_C(10958281274185829781)},257},
+        decimal128{detail::uint128{UINT64_C(139045174211763),UINT64_C(2974927183589094883)},259},
+        decimal128{detail::uint128{UINT64_C(228729311578350),UINT64_C(7384065666954850551)},261},
+        decimal128{detail::uint128{UINT64_C(378547010662169),UINT64_C(16832314697237665565)},263},
+        decimal128{detail::uint128{UINT64_C(63028077275251),UINT64_C(5357454451298844215)},266},
+        decimal128{detail::uint128{UINT64_C(105572029436045),UINT64_C(16813602437252123498)},268},
+        decimal128{detail::uint128{UINT64_C(177888869599737),UINT64_C(6655995820161104945)},270},
+        decimal128{detail::uint128{UINT64_C(301521633971554),UINT64_C(15247962891020626479)},272},
+        decimal128{detail::uint128{UINT64_C(514094385921500),UINT64_C(18065676777495060952)},274},
+        decimal128{detail::uint128{UINT64_C(88167187185537),UINT64_C(7709949585767790857)},277},
+        decimal128{detail::uint128{UINT64_C(152088397895052),UINT64_C(848110785695491888)},279},
+        decimal128{detail::uint128{UINT64_C(263873370347915),UINT64_C(5529755909397779781)},281},
+        decimal128{detail::uint128{UINT64_C(460459031257112),UINT64_C(3654232237943521443)},283},
+        decimal128{detail::uint128{UINT64_C(80810559985623),UINT64_C(3519009833257778065)},286},
+        decimal128{detail::uint128{UINT64_C(142630638374624),UINT64_C(17186865079557161497)},288},
+        decimal128{detail::uint128{UINT64_C(253169383114959),UINT64_C(4681243813020589394)},290},
+        decimal128{detail::uint128{UINT64_C(451907348860202),UINT64_C(4943372552605485020)},292},
+        decimal128{detail::uint128{UINT64_C(81117369120406),UINT64_C(5665042088283458430)},295},
+        decimal128{detail::uint128{UINT64_C(146416851262333),UINT64_C(7089454476821018691)},297},
+        decimal128{detail::uint128{UINT64_C(265746585041135),UINT64_C(1707079710835870196)},299},
+        decimal128{detail::uint128{UINT64_C(484987517700071),UINT64_C(10032949499916544964)},301},
+        decimal128{detail::uint128{UINT64_C(88995209497963),UINT64_C(2366778439335408222)},304},
+        decimal128{detail::uint128{UINT64_C(164196161523741),UINT64_C(17925063114750348607)},306},
+        decimal128{detail::uint128{UINT64_C(304583879626541),UINT64_C(6595446891351594581)},308},
+        decimal128{detail::uint128{UINT64_C(56804893550349),UINT64_C(17767556907317685413)},311},
+        decimal128{detail::uint128{UINT64_C(106509175406906),UINT64_C(3338210081442638774)},313},
+        decimal128{detail::uint128{UINT64_C(200769795642018),UINT64_C(2787644629514559281)},315},
+        decimal128{detail::uint128{UINT64_C(380458762741624),UINT64_C(7311728421038140516)},317},
+        decimal128{detail::uint128{UINT64_C(72477394302279),UINT64_C(8255073059627718969)},320},
+        decimal128{detail::uint128{UINT64_C(138794210088865),UINT64_C(2619042896484752421)},322},
+        decimal128{detail::uint128{UINT64_C(267178854421065),UINT64_C(7347500584946842362)},324},
+        decimal128{detail::uint128{UINT64_C(516991083304761),UINT64_C(10066896215287490857)},326},
+        decimal128{detail::uint128{UINT64_C(100554765702776),UINT64_C(2225489102942205470)},329},
+        decimal128{detail::uint128{UINT64_C(196584566948927),UINT64_C(5826570722148775824)},331},
+        decimal128{detail::uint128{UINT64_C(386288674054642),UINT64_C(3240410356221594024)},333},
+        decimal128{detail::uint128{UINT64_C(76292013125791),UINT64_C(15305142583952858354)},336},
+        decimal128{detail::uint128{UINT64_C(151439646054696),UINT64_C(14424274405387661686)},338},
+        decimal128{detail::uint128{UINT64_C(302122093879120),UINT64_C(1475246209658248671)},340},
+        decimal128{detail::uint128{UINT64_C(60575479822763),UINT64_C(10625963546313827764)},343},
+        decimal128{detail::uint128{UINT64_C(122059591842868),UINT64_C(11173373584913561797)},345},
+        decimal128{detail::uint128{UINT64_C(247170673481808),UINT64_C(17092058287337097154)},347},
+        decimal128{detail::uint128{UINT64_C(502992320535481),UINT64_C(3053938807950563928)},349}
+    }};
+};
+
+#if !(defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L) && (!defined(_MSC_VER) || _MSC_VER != 1900)
+
+template <bool b> constexpr std::array<decimal32, 69> gamma_lookup_imp<b>::d32_factorials;
+template <bool b> constexpr std::array<decimal32, 69> gamma_lookup_imp<b>::d32_log_factorials;
+template <bool b> constexpr std::array<decimal32, 69> gamma_lookup_imp<b>::d32_half_integer_gammas;
+
+template <bool b> constexpr std::array<decimal64, 205> gamma_lookup_imp<b>::d64_factorials;
+template <bool b> constexpr std::array<decimal64, 205> gamma_lookup_imp<b>::d64_log_factorials;
+template <bool b> constexpr std::array<decimal64, 205> gamma_lookup_imp<b>::d64_half_integer_gammas;
+
+template <bool b> constexpr std::array<decimal128, 205> gamma_lookup_imp<b>::d128_factorials;
+template <bool b> constexpr std::array<decimal128, 205> gamma_lookup_imp<b>::d128_log_factorials;
+template <bool b> constexpr std::array<decimal128, 205> gamma_lookup_imp<b>::d128_half_integer_gammas;
+
+#endif
+
+} //namespace gamma_lookup_detail
+
+using gamma_lookup = gamma_lookup_detail::gamma_lookup_imp<true>;
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr const auto& factorial_table() noexcept;
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr const auto& log_factorial_table() noexcept;
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr const auto& half_integer_gamma_table() noexcept;
+
+template <>
+constexpr const auto& factorial_table<decimal32>() noexcept
+{
+    return gamma_lookup::d32_factorials;
+}
+
+template <>
+constexpr const auto& log_factorial_table<decimal32>() noexcept
+{
+    return gamma_lookup::d32_log_factorials;
+}
+
+template <>
+constexpr const auto& half_integer_gamma_table<decimal32>() noexcept
+{
+    return gamma_lookup::d32_half_integer_gammas;
+}
+
+template <>
+constexpr const auto& factorial_table<decimal64>() noexcept
+{
+    return gamma_lookup::d64_factorials;
+}
+
+template <>
+constexpr const auto& log_factorial_table<decimal64>() noexcept
+{
+    return gamma_lookup::d64_log_factorials;
+}
+
+template <>
+constexpr const auto& half_integer_gamma_table<decimal64>() noexcept
+{
+    return gamma_lookup::d64_half_integer_gammas;
+}
+
+template <>
+constexpr const auto& factorial_table<decimal128>() noexcept
+{
+    return gamma_lookup::d128_factorials;
+}
+
+template <>
+constexpr const auto& log_factorial_table<decimal128>() noexcept
+{
+    return gamma_lookup::d128_log_factorials;
+}
+
+template <>
+constexpr const auto& half_integer_gamma_table<decimal128>() noexcept
+{
+    return gamma_lookup::d128_half_integer_gammas;
+}
+
+} //namespace detail
+} //namespace decimal
+} //namespace boost
+
+#endif //BOOST_DECIMAL_DETAIL_CMATH_IMPL_GAMMA_LOOKUP_HPP
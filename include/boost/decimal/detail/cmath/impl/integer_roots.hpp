@@ -0,0 +1,314 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_INTEGER_ROOTS_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_INTEGER_ROOTS_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/countl.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/emulated256.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Integer types wide enough to hold the significand of T scaled so that
+// its square (cube) root has one more digit than the significand of T
+#ifdef BOOST_DECIMAL_HAS_INT128
+using root_uint128_type = uint128_t;
+#else
+using root_uint128_type = uint128;
+#endif
+
+template <typename T>
+using isqrt_integer_t = std::conditional_t<(std::numeric_limits<T>::digits10 < 9), std::uint64_t,
+                        std::conditional_t<(std::numeric_limits<T>::digits10 < 19), root_uint128_type, uint256_t>>;
+
+// A decimal128 cube root would need a 384-bit integer, so its integer root is taken to 25 digits
+// and then extended to the full precision by icbrt_extend
+template <typename T>
+using icbrt_integer_t = std::conditional_t<(std::numeric_limits<T>::digits10 < 9), root_uint128_type, uint256_t>;
+
+// sig * 10^shift in the integer type of the root
+template <typename UInt>
+constexpr auto mul_pow10(std::uint64_t sig, int shift) noexcept
+    -> std::enable_if_t<!std::is_same<UInt, uint256_t>::value, UInt>
+{
+    return static_cast<UInt>(sig) * pow10(static_cast<UInt>(shift));
+}
+
+template <typename UInt>
+constexpr auto mul_pow10(const uint128& sig, int shift) noexcept
+    -> std::enable_if_t<std::is_same<UInt, uint256_t>::value, UInt>
+{
+    // 10^shift itself may exceed 128 bits
+    constexpr int max_shift { std::numeric_limits<uint128>::digits10 };
+
+    if (shift > max_shift)
+    {
+        return umul256(sig, pow10(static_cast<uint128>(max_shift))) * pow10(static_cast<std::uint64_t>(shift - max_shift));
+    }
+
+    return umul256(sig, pow10(static_cast<uint128>(shift)));
+}
+
+// Narrows a root, which has one digit more than the significand of the decimal type,
+// to an integer type accepted by the constructors of the decimal types
+template <typename UInt>
+constexpr auto narrow_root(const UInt& root) noexcept -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(root);
+}
+
+constexpr auto narrow_root(const uint256_t& root) noexcept -> uint128
+{
+    return root.low;
+}
+
+// Newton iterations for floor(sqrt(n)) and floor(cbrt(n)).
+// The initial estimate x must not be below the root, the iterates then decrease monotonically to it
+template <typename UInt>
+constexpr auto isqrt_newton(const UInt& n, UInt x) noexcept -> UInt
+{
+    for (;;)
+    {
+        const UInt y { (x + n / x) >> 1 };
+
+        if (!(y < x))
+        {
+            return x;
+        }
+
+        x = y;
+    }
+}
+
+template <typename UInt>
+constexpr auto icbrt_newton(const UInt& n, UInt x) noexcept -> UInt
+{
+    for (;;)
+    {
+        const UInt y { (x + x + n / (x * x)) / UINT64_C(3) };
+
+        if (!(y < x))
+        {
+            return x;
+        }
+
+        x = y;
+    }
+}
+
+// The roots of the wider types start from the root of their leading 64 (128) bits,
+// which leaves only one or two iterations in the wide arithmetic
+
+constexpr auto isqrt(std::uint64_t n) noexcept -> std::uint64_t
+{
+    if (n == 0U)
+    {
+        return 0U;
+    }
+
+    const int bits { 64 - countl_zero(n) };
+
+    return isqrt_newton(n, static_cast<std::uint64_t>(UINT64_C(1) << ((bits + 1) / 2)));
+}
+
+constexpr auto icbrt(std::uint64_t n) noexcept -> std::uint64_t
+{
+    if (n == 0U)
+    {
+        return 0U;
+    }
+
+    const int bits { 64 - countl_zero(n) };
+
+    return icbrt_newton(n, static_cast<std::uint64_t>(UINT64_C(1) << ((bits + 2) / 3)));
+}
+
+constexpr auto isqrt(uint128 n) noexcept -> uint128
+{
+    if (n.high == 0U)
+    {
+        return uint128 { isqrt(n.low) };
+    }
+
+    const int high_bits { 64 - countl_zero(n.high) };
+    const int shift { high_bits + (high_bits & 1) };
+
+    const auto top_root { isqrt(static_cast<std::uint64_t>(n >> shift)) };
+
+    return isqrt_newton(n, uint128 { top_root + 1U } << (shift / 2));
+}
+
+constexpr auto icbrt(uint128 n) noexcept -> uint128
+{
+    if (n.high == 0U)
+    {
+        return uint128 { icbrt(n.low) };
+    }
+
+    const int high_bits { 64 - countl_zero(n.high) };
+    const int shift { ((high_bits + 2) / 3) * 3 };
+
+    const auto top_root { icbrt(static_cast<std::uint64_t>(n >> shift)) };
+
+    return icbrt_newton(n, uint128 { top_root + 1U } << (shift / 3));
+}
+
+#ifdef BOOST_DECIMAL_HAS_INT128
+
+constexpr auto isqrt(uint128_t n) noexcept -> uint128_t
+{
+    const auto high { static_cast<std::uint64_t>(n >> 64U) };
+
+    if (high == 0U)
+    {
+        return isqrt(static_cast<std::uint64_t>(n));
+    }
+
+    const int high_bits { 64 - countl_zero(high) };
+    const int shift { high_bits + (high_bits & 1) };
+
+    const auto top_root { isqrt(static_cast<std::uint64_t>(n >> shift)) };
+
+    return isqrt_newton(n, static_cast<uint128_t>(top_root + 1U) << (shift / 2));
+}
+
+constexpr auto icbrt(uint128_t n) noexcept -> uint128_t
+{
+    const auto high { static_cast<std::uint64_t>(n >> 64U) };
+
+    if (high == 0U)
+    {
+        return icbrt(static_cast<std::uint64_t>(n));
+    }
+
+    const int high_bits { 64 - countl_zero(high) };
+    const int shift { ((high_bits + 2) / 3) * 3 };
+
+    const auto top_root { icbrt(static_cast<std::uint64_t>(n >> shift)) };
+
+    return icbrt_newton(n, static_cast<uint128_t>(top_root + 1U) << (shift / 3));
+}
+
+#endif // BOOST_DECIMAL_HAS_INT128
+
+constexpr auto bit_width(const uint128& n) noexcept -> int
+{
+    return (n.high != 0U) ? 128 - countl_zero(n.high) : 64 - countl_zero(n.low);
+}
+
+constexpr auto isqrt(const uint256_t& n) noexcept -> uint256_t
+{
+    if (n.high == 0U)
+    {
+        return uint256_t { isqrt(n.low) };
+    }
+
+    const int high_bits { bit_width(n.high) };
+    const int shift { high_bits + (high_bits & 1) };
+
+    const auto top_root { isqrt((n >> shift).low) };
+
+    return isqrt_newton(n, uint256_t { top_root + 1U } << (shift / 2));
+}
+
+constexpr auto icbrt(const uint256_t& n) noexcept -> uint256_t
+{
+    if (n.high == 0U)
+    {
+        return uint256_t { icbrt(n.low) };
+    }
+
+    const int high_bits { bit_width(n.high) };
+    const int shift { ((high_bits + 2) / 3) * 3 };
+
+    const auto top_root { icbrt((n >> shift).low) };
+
+    return icbrt_newton(n, uint256_t { top_root + 1U } << (shift / 3));
+}
+
+// Extends root = floor(cbrt(n)) to floor(cbrt(n * 10^(3 * extra))) without forming the scaled n,
+// and sets exact when that root leaves no remainder.
+// The integer types narrower than uint256_t always hold the fully scaled n
+template <typename UInt>
+constexpr auto icbrt_extend(const UInt& n, const UInt& root, int, bool& exact) noexcept -> UInt
+{
+    exact = (root * root * root == n);
+
+    return root;
+}
+
+constexpr auto icbrt_extend(const uint256_t& n, const uint256_t& root, int extra, bool& exact) noexcept -> uint256_t
+{
+    if (extra == 0)
+    {
+        exact = (root * root * root == n);
+
+        return root;
+    }
+
+    // The extended root is root * 10^extra + d with 0 <= d < 10^extra. With the remainder e = n - root^3,
+    // (n * 10^(3 * extra) - (root * 10^extra + d)^3) / 10^extra = 10^(2 * extra) * e - 3 * root^2 * d * 10^extra - 3 * root * d^2 - d^3 / 10^extra,
+    // whose sign is found without any term exceeding 256 bits for a root of up to 25 digits and extra of up to 10.
+    // Dropping all but the first two terms gives an estimate of d that is never too small and at most one or two too large
+    const uint256_t p1 { pow10(static_cast<std::uint64_t>(extra)) };
+    const uint256_t p2 { p1 * p1 };
+
+    const uint256_t e { n - root * root * root };
+    const uint256_t three_root2 { root * root * UINT64_C(3) };
+    const uint256_t scaled_e { e * p2 };
+
+    uint256_t d { (e * p1) / three_root2 };
+
+    if (!(d < p1))
+    {
+        d = p1 - uint256_t { 1U };
+    }
+
+    for (;;)
+    {
+        const uint256_t subtrahend { three_root2 * d * p1 + root * d * d * UINT64_C(3) };
+
+        if (!(scaled_e < subtrahend))
+        {
+            const uint256_t rest { scaled_e - subtrahend };
+
+            // The remaining term d^3 / 10^extra is below 10^(2 * extra)
+            if (p2 < rest)
+            {
+                exact = false;
+                break;
+            }
+
+            const uint256_t scaled_rest { rest * p1 };
+            const uint256_t d3 { d * d * d };
+
+            if (!(scaled_rest < d3))
+            {
+                exact = (scaled_rest == d3);
+                break;
+            }
+        }
+
+        d -= uint256_t { 1U };
+    }
+
+    return root * p1 + d;
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CMATH_IMPL_INTEGER_ROOTS_HPP
@@ -7,12 +7,15 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_IMPL_LOG_IMPL_HPP
 
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
 #include <boost/decimal/detail/cmath/impl/taylor_series_result.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #endif
 
 namespace boost {
@@ -25,28 +28,28 @@ template <bool b>
 struct log_table_imp
 {
 private:
-    using d32_coeffs_t  = std::array<decimal32,   8>;
-    using d64_coeffs_t  = std::array<decimal64,  11>;
-    using d128_coeffs_t = std::array<decimal128, 21>;
+    using d32_coeffs_t  = std::array<decimal32,   2>;
+    using d64_coeffs_t  = std::array<decimal64,   6>;
+    using d128_coeffs_t = std::array<decimal128, 13>;
+
+    using d32_values_t  = std::array<decimal32,  90>;
+    using d64_values_t  = std::array<decimal64,  90>;
+    using d128_values_t = std::array<decimal128, 90>;
 
 public:
+    // The series is only evaluated for |z| <= 2/19 (see log_table_reduction),
+    // so it is truncated once the remaining terms are below the precision of each type
     static constexpr d32_coeffs_t d32_coeffs =
     {{
-         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 17}]
+         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 5}]
          //            (1),                                                       // * z
          ::boost::decimal::decimal32 { UINT64_C(8333333333333333333), - 19 - 1 }, // * z^3
          ::boost::decimal::decimal32 { UINT64_C(1250000000000000000), - 19 - 1 }, // * z^5
-         ::boost::decimal::decimal32 { UINT64_C(2232142857142857143), - 19 - 2 }, // * z^7
-         ::boost::decimal::decimal32 { UINT64_C(4340277777777777778), - 19 - 3 }, // * z^9
-         ::boost::decimal::decimal32 { UINT64_C(8877840909090909091), - 19 - 4 }, // * z^11
-         ::boost::decimal::decimal32 { UINT64_C(1878004807692307692), - 19 - 4 }, // * z^13
-         ::boost::decimal::decimal32 { UINT64_C(4069010416666666667), - 19 - 5 }, // * z^15
-         ::boost::decimal::decimal32 { UINT64_C(8975758272058823529), - 19 - 6 }, // * z^17
     }};
 
     static constexpr d64_coeffs_t d64_coeffs =
     {{
-         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 23}]
+         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 13}]
          //            (1),                                                       // * z
          ::boost::decimal::decimal64 { UINT64_C(8333333333333333333), - 19 - 1 }, // * z^3
          ::boost::decimal::decimal64 { UINT64_C(1250000000000000000), - 19 - 1 }, // * z^5
@@ -54,16 +57,11 @@ public:
          ::boost::decimal::decimal64 { UINT64_C(4340277777777777778), - 19 - 3 }, // * z^9
          ::boost::decimal::decimal64 { UINT64_C(8877840909090909091), - 19 - 4 }, // * z^11
          ::boost::decimal::decimal64 { UINT64_C(1878004807692307692), - 19 - 4 }, // * z^13
-         ::boost::decimal::decimal64 { UINT64_C(4069010416666666667), - 19 - 5 }, // * z^15
-         ::boost::decimal::decimal64 { UINT64_C(8975758272058823529), - 19 - 6 }, // * z^17
-         ::boost::decimal::decimal64 { UINT64_C(2007735402960526316), - 19 - 6 }, // * z^19
-         ::boost::decimal::decimal64 { UINT64_C(4541306268601190476), - 19 - 7 }, // * z^21
-         ::boost::decimal::decimal64 { UINT64_C(1036602517832880435), - 19 - 7 }, // * z^23
-     }};
+    }};
 
     static constexpr d128_coeffs_t d128_coeffs =
     {{
-         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 43}]
+         // Series[Log[(1 + (z/2))/(1 - (z/2))], {z, 0, 27}]
          //            (1),                                                                                                                   // * z
          ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(451750905202293), UINT64_C(9484758194528277842)  }, -35 }, // * z^3
          ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(67762635780344),  UINT64_C(500376525493764096)   }, -35 }, // * z^5
@@ -78,14 +76,576 @@ public:
          ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(56194335091917),  UINT64_C(11823550152479764302) }, -41 }, // * z^23
          ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(129246970711410), UINT64_C(10592095684364861440) }, -42 }, // * z^25
          ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(299182802572709), UINT64_C(12220910627630811506) }, -43 }, // * z^27
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(69637376460889),  UINT64_C(5865971761607874066)  }, -43 }, // * z^29
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(162861606239176), UINT64_C(11636108014793143194) }, -44 }, // * z^31
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(382478014652611), UINT64_C(14470401740943906374) }, -45 }, // * z^33
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(90155532025258),  UINT64_C(9076666090147568782)  }, -45 }, // * z^35
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(213205650059732), UINT64_C(16978042870933143358) }, -46 }, // * z^37
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(505680067449366), UINT64_C(9996854995997550184)  }, -47 }, // * z^39
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(120253186771495), UINT64_C(12950434681540257980) }, -47 }, // * z^41
-         ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(286650038234379), UINT64_C(5345076336561816786)  }, -48 }, // * z^43
+    }};
+
+    // Log[k/10] for k = 10, ..., 99
+    static constexpr d32_values_t d32_values =
+    {{
+        ::boost::decimal::decimal32 { UINT64_C(0), 0 }, // ln(1.0)
+        ::boost::decimal::decimal32 { UINT64_C(9531017980432486004), -20 }, // ln(1.1)
+        ::boost::decimal::decimal32 { UINT64_C(1823215567939546262), -19 }, // ln(1.2)
+        ::boost::decimal::decimal32 { UINT64_C(2623642644674910520), -19 }, // ln(1.3)
+        ::boost::decimal::decimal32 { UINT64_C(3364722366212129305), -19 }, // ln(1.4)
+        ::boost::decimal::decimal32 { UINT64_C(4054651081081643820), -19 }, // ln(1.5)
+        ::boost::decimal::decimal32 { UINT64_C(4700036292457355537), -19 }, // ln(1.6)
+        ::boost::decimal::decimal32 { UINT64_C(5306282510621703962), -19 }, // ln(1.7)
+        ::boost::decimal::decimal32 { UINT64_C(5877866649021190082), -19 }, // ln(1.8)
+        ::boost::decimal::decimal32 { UINT64_C(6418538861723947760), -19 }, // ln(1.9)
+        ::boost::decimal::decimal32 { UINT64_C(6931471805599453094), -19 }, // ln(2.0)
+        ::boost::decimal::decimal32 { UINT64_C(7419373447293773125), -19 }, // ln(2.1)
+        ::boost::decimal::decimal32 { UINT64_C(7884573603642701695), -19 }, // ln(2.2)
+        ::boost::decimal::decimal32 { UINT64_C(8329091229351040068), -19 }, // ln(2.3)
+        ::boost::decimal::decimal32 { UINT64_C(8754687373538999356), -19 }, // ln(2.4)
+        ::boost::decimal::decimal32 { UINT64_C(9162907318741550652), -19 }, // ln(2.5)
+        ::boost::decimal::decimal32 { UINT64_C(9555114450274363615), -19 }, // ln(2.6)
+        ::boost::decimal::decimal32 { UINT64_C(9932517730102833902), -19 }, // ln(2.7)
+        ::boost::decimal::decimal32 { UINT64_C(1029619417181158240), -18 }, // ln(2.8)
+        ::boost::decimal::decimal32 { UINT64_C(1064710736992428343), -18 }, // ln(2.9)
+        ::boost::decimal::decimal32 { UINT64_C(1098612288668109691), -18 }, // ln(3.0)
+        ::boost::decimal::decimal32 { UINT64_C(1131402111491100562), -18 }, // ln(3.1)
+        ::boost::decimal::decimal32 { UINT64_C(1163150809805680863), -18 }, // ln(3.2)
+        ::boost::decimal::decimal32 { UINT64_C(1193922468472434551), -18 }, // ln(3.3)
+        ::boost::decimal::decimal32 { UINT64_C(1223775431622115706), -18 }, // ln(3.4)
+        ::boost::decimal::decimal32 { UINT64_C(1252762968495367996), -18 }, // ln(3.5)
+        ::boost::decimal::decimal32 { UINT64_C(1280933845462064318), -18 }, // ln(3.6)
+        ::boost::decimal::decimal32 { UINT64_C(1308332819650178760), -18 }, // ln(3.7)
+        ::boost::decimal::decimal32 { UINT64_C(1335001066732340085), -18 }, // ln(3.8)
+        ::boost::decimal::decimal32 { UINT64_C(1360976553135600743), -18 }, // ln(3.9)
+        ::boost::decimal::decimal32 { UINT64_C(1386294361119890619), -18 }, // ln(4.0)
+        ::boost::decimal::decimal32 { UINT64_C(1410986973710262120), -18 }, // ln(4.1)
+        ::boost::decimal::decimal32 { UINT64_C(1435084525289322622), -18 }, // ln(4.2)
+        ::boost::decimal::decimal32 { UINT64_C(1458615022699516739), -18 }, // ln(4.3)
+        ::boost::decimal::decimal32 { UINT64_C(1481604540924215479), -18 }, // ln(4.4)
+        ::boost::decimal::decimal32 { UINT64_C(1504077396776274073), -18 }, // ln(4.5)
+        ::boost::decimal::decimal32 { UINT64_C(1526056303495049316), -18 }, // ln(4.6)
+        ::boost::decimal::decimal32 { UINT64_C(1547562508716012903), -18 }, // ln(4.7)
+        ::boost::decimal::decimal32 { UINT64_C(1568615917913845245), -18 }, // ln(4.8)
+        ::boost::decimal::decimal32 { UINT64_C(1589235205116580926), -18 }, // ln(4.9)
+        ::boost::decimal::decimal32 { UINT64_C(1609437912434100375), -18 }, // ln(5.0)
+        ::boost::decimal::decimal32 { UINT64_C(1629240539730280088), -18 }, // ln(5.1)
+        ::boost::decimal::decimal32 { UINT64_C(1648658625587381671), -18 }, // ln(5.2)
+        ::boost::decimal::decimal32 { UINT64_C(1667706820558076150), -18 }, // ln(5.3)
+        ::boost::decimal::decimal32 { UINT64_C(1686398953570228700), -18 }, // ln(5.4)
+        ::boost::decimal::decimal32 { UINT64_C(1704748092238425235), -18 }, // ln(5.5)
+        ::boost::decimal::decimal32 { UINT64_C(1722766597741103549), -18 }, // ln(5.6)
+        ::boost::decimal::decimal32 { UINT64_C(1740466174840504467), -18 }, // ln(5.7)
+        ::boost::decimal::decimal32 { UINT64_C(1757857917552373653), -18 }, // ln(5.8)
+        ::boost::decimal::decimal32 { UINT64_C(1774952350911673767), -18 }, // ln(5.9)
+        ::boost::decimal::decimal32 { UINT64_C(1791759469228055001), -18 }, // ln(6.0)
+        ::boost::decimal::decimal32 { UINT64_C(1808288771179265565), -18 }, // ln(6.1)
+        ::boost::decimal::decimal32 { UINT64_C(1824549292051045871), -18 }, // ln(6.2)
+        ::boost::decimal::decimal32 { UINT64_C(1840549633397487004), -18 }, // ln(6.3)
+        ::boost::decimal::decimal32 { UINT64_C(1856297990365626172), -18 }, // ln(6.4)
+        ::boost::decimal::decimal32 { UINT64_C(1871802176901591427), -18 }, // ln(6.5)
+        ::boost::decimal::decimal32 { UINT64_C(1887069649032379861), -18 }, // ln(6.6)
+        ::boost::decimal::decimal32 { UINT64_C(1902107526396920376), -18 }, // ln(6.7)
+        ::boost::decimal::decimal32 { UINT64_C(1916922612182061015), -18 }, // ln(6.8)
+        ::boost::decimal::decimal32 { UINT64_C(1931521411603213698), -18 }, // ln(6.9)
+        ::boost::decimal::decimal32 { UINT64_C(1945910149055313305), -18 }, // ln(7.0)
+        ::boost::decimal::decimal32 { UINT64_C(1960094784047269737), -18 }, // ln(7.1)
+        ::boost::decimal::decimal32 { UINT64_C(1974081026022009627), -18 }, // ln(7.2)
+        ::boost::decimal::decimal32 { UINT64_C(1987874348154345445), -18 }, // ln(7.3)
+        ::boost::decimal::decimal32 { UINT64_C(2001480000210124070), -18 }, // ln(7.4)
+        ::boost::decimal::decimal32 { UINT64_C(2014903020542264757), -18 }, // ln(7.5)
+        ::boost::decimal::decimal32 { UINT64_C(2028148247292285395), -18 }, // ln(7.6)
+        ::boost::decimal::decimal32 { UINT64_C(2041220328859638165), -18 }, // ln(7.7)
+        ::boost::decimal::decimal32 { UINT64_C(2054123733695546053), -18 }, // ln(7.8)
+        ::boost::decimal::decimal32 { UINT64_C(2066862759472975810), -18 }, // ln(7.9)
+        ::boost::decimal::decimal32 { UINT64_C(2079441541679835928), -18 }, // ln(8.0)
+        ::boost::decimal::decimal32 { UINT64_C(2091864061678393082), -18 }, // ln(8.1)
+        ::boost::decimal::decimal32 { UINT64_C(2104134154270207429), -18 }, // ln(8.2)
+        ::boost::decimal::decimal32 { UINT64_C(2116255514802552239), -18 }, // ln(8.3)
+        ::boost::decimal::decimal32 { UINT64_C(2128231705849267931), -18 }, // ln(8.4)
+        ::boost::decimal::decimal32 { UINT64_C(2140066163496270771), -18 }, // ln(8.5)
+        ::boost::decimal::decimal32 { UINT64_C(2151762203259462049), -18 }, // ln(8.6)
+        ::boost::decimal::decimal32 { UINT64_C(2163323025660538035), -18 }, // ln(8.7)
+        ::boost::decimal::decimal32 { UINT64_C(2174751721484160788), -18 }, // ln(8.8)
+        ::boost::decimal::decimal32 { UINT64_C(2186051276738094154), -18 }, // ln(8.9)
+        ::boost::decimal::decimal32 { UINT64_C(2197224577336219383), -18 }, // ln(9.0)
+        ::boost::decimal::decimal32 { UINT64_C(2208274413522804357), -18 }, // ln(9.1)
+        ::boost::decimal::decimal32 { UINT64_C(2219203484054994626), -18 }, // ln(9.2)
+        ::boost::decimal::decimal32 { UINT64_C(2230014400159210253), -18 }, // ln(9.3)
+        ::boost::decimal::decimal32 { UINT64_C(2240709689275958212), -18 }, // ln(9.4)
+        ::boost::decimal::decimal32 { UINT64_C(2251291798606495151), -18 }, // ln(9.5)
+        ::boost::decimal::decimal32 { UINT64_C(2261763098473790554), -18 }, // ln(9.6)
+        ::boost::decimal::decimal32 { UINT64_C(2272125885509337138), -18 }, // ln(9.7)
+        ::boost::decimal::decimal32 { UINT64_C(2282382385676526236), -18 }, // ln(9.8)
+        ::boost::decimal::decimal32 { UINT64_C(2292534757140544243), -18 }, // ln(9.9)
+    }};
+
+    // Log[k/10] for k = 10, ..., 99
+    static constexpr d64_values_t d64_values =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(0), 0 }, // ln(1.0)
+        ::boost::decimal::decimal64 { UINT64_C(9531017980432486004), -20 }, // ln(1.1)
+        ::boost::decimal::decimal64 { UINT64_C(1823215567939546262), -19 }, // ln(1.2)
+        ::boost::decimal::decimal64 { UINT64_C(2623642644674910520), -19 }, // ln(1.3)
+        ::boost::decimal::decimal64 { UINT64_C(3364722366212129305), -19 }, // ln(1.4)
+        ::boost::decimal::decimal64 { UINT64_C(4054651081081643820), -19 }, // ln(1.5)
+        ::boost::decimal::decimal64 { UINT64_C(4700036292457355537), -19 }, // ln(1.6)
+        ::boost::decimal::decimal64 { UINT64_C(5306282510621703962), -19 }, // ln(1.7)
+        ::boost::decimal::decimal64 { UINT64_C(5877866649021190082), -19 }, // ln(1.8)
+        ::boost::decimal::decimal64 { UINT64_C(6418538861723947760), -19 }, // ln(1.9)
+        ::boost::decimal::decimal64 { UINT64_C(6931471805599453094), -19 }, // ln(2.0)
+        ::boost::decimal::decimal64 { UINT64_C(7419373447293773125), -19 }, // ln(2.1)
+        ::boost::decimal::decimal64 { UINT64_C(7884573603642701695), -19 }, // ln(2.2)
+        ::boost::decimal::decimal64 { UINT64_C(8329091229351040068), -19 }, // ln(2.3)
+        ::boost::decimal::decimal64 { UINT64_C(8754687373538999356), -19 }, // ln(2.4)
+        ::boost::decimal::decimal64 { UINT64_C(9162907318741550652), -19 }, // ln(2.5)
+        ::boost::decimal::decimal64 { UINT64_C(9555114450274363615), -19 }, // ln(2.6)
+        ::boost::decimal::decimal64 { UINT64_C(9932517730102833902), -19 }, // ln(2.7)
+        ::boost::decimal::decimal64 { UINT64_C(1029619417181158240), -18 }, // ln(2.8)
+        ::boost::decimal::decimal64 { UINT64_C(1064710736992428343), -18 }, // ln(2.9)
+        ::boost::decimal::decimal64 { UINT64_C(1098612288668109691), -18 }, // ln(3.0)
+        ::boost::decimal::decimal64 { UINT64_C(1131402111491100562), -18 }, // ln(3.1)
+        ::boost::decimal::decimal64 { UINT64_C(1163150809805680863), -18 }, // ln(3.2)
+        ::boost::decimal::decimal64 { UINT64_C(1193922468472434551), -18 }, // ln(3.3)
+        ::boost::decimal::decimal64 { UINT64_C(1223775431622115706), -18 }, // ln(3.4)
+        ::boost::decimal::decimal64 { UINT64_C(1252762968495367996), -18 }, // ln(3.5)
+        ::boost::decimal::decimal64 { UINT64_C(1280933845462064318), -18 }, // ln(3.6)
+        ::boost::decimal::decimal64 { UINT64_C(1308332819650178760), -18 }, // ln(3.7)
+        ::boost::decimal::decimal64 { UINT64_C(1335001066732340085), -18 }, // ln(3.8)
+        ::boost::decimal::decimal64 { UINT64_C(1360976553135600743), -18 }, // ln(3.9)
+        ::boost::decimal::decimal64 { UINT64_C(1386294361119890619), -18 }, // ln(4.0)
+        ::boost::decimal::decimal64 { UINT64_C(1410986973710262120), -18 }, // ln(4.1)
+        ::boost::decimal::decimal64 { UINT64_C(1435084525289322622), -18 }, // ln(4.2)
+        ::boost::decimal::decimal64 { UINT64_C(1458615022699516739), -18 }, // ln(4.3)
+        ::boost::decimal::decimal64 { UINT64_C(1481604540924215479), -18 }, // ln(4.4)
+        ::boost::decimal::decimal64 { UINT64_C(1504077396776274073), -18 }, // ln(4.5)
+        ::boost::decimal::decimal64 { UINT64_C(1526056303495049316), -18 }, // ln(4.6)
+        ::boost::decimal::decimal64 { UINT64_C(1547562508716012903), -18 }, // ln(4.7)
+        ::boost::decimal::decimal64 { UINT64_C(1568615917913845245), -18 }, // ln(4.8)
+        ::boost::decimal::decimal64 { UINT64_C(1589235205116580926), -18 }, // ln(4.9)
+        ::boost::decimal::decimal64 { UINT64_C(1609437912434100375), -18 }, // ln(5.0)
+        ::boost::decimal::decimal64 { UINT64_C(1629240539730280088), -18 }, // ln(5.1)
+        ::boost::decimal::decimal64 { UINT64_C(1648658625587381671), -18 }, // ln(5.2)
+        ::boost::decimal::decimal64 { UINT64_C(1667706820558076150), -18 }, // ln(5.3)
+        ::boost::decimal::decimal64 { UINT64_C(1686398953570228700), -18 }, // ln(5.4)
+        ::boost::decimal::decimal64 { UINT64_C(1704748092238425235), -18 }, // ln(5.5)
+        ::boost::decimal::decimal64 { UINT64_C(1722766597741103549), -18 }, // ln(5.6)
+        ::boost::decimal::decimal64 { UINT64_C(1740466174840504467), -18 }, // ln(5.7)
+        ::boost::decimal::decimal64 { UINT64_C(1757857917552373653), -18 }, // ln(5.8)
+        ::boost::decimal::decimal64 { UINT64_C(1774952350911673767), -18 }, // ln(5.9)
+        ::boost::decimal::decimal64 { UINT64_C(1791759469228055001), -18 }, // ln(6.0)
+        ::boost::decimal::decimal64 { UINT64_C(1808288771179265565), -18 }, // ln(6.1)
+        ::boost::decimal::decimal64 { UINT64_C(1824549292051045871), -18 }, // ln(6.2)
+        ::boost::decimal::decimal64 { UINT64_C(1840549633397487004), -18 }, // ln(6.3)
+        ::boost::decimal::decimal64 { UINT64_C(1856297990365626172), -18 }, // ln(6.4)
+        ::boost::decimal::decimal64 { UINT64_C(1871802176901591427), -18 }, // ln(6.5)
+        ::boost::decimal::decimal64 { UINT64_C(1887069649032379861), -18 }, // ln(6.6)
+        ::boost::decimal::decimal64 { UINT64_C(1902107526396920376), -18 }, // ln(6.7)
+        ::boost::decimal::decimal64 { UINT64_C(1916922612182061015), -18 }, // ln(6.8)
+        ::boost::decimal::decimal64 { UINT64_C(1931521411603213698), -18 }, // ln(6.9)
+        ::boost::decimal::decimal64 { UINT64_C(1945910149055313305), -18 }, // ln(7.0)
+        ::boost::decimal::decimal64 { UINT64_C(1960094784047269737), -18 }, // ln(7.1)
+        ::boost::decimal::decimal64 { UINT64_C(1974081026022009627), -18 }, // ln(7.2)
+        ::boost::decimal::decimal64 { UINT64_C(1987874348154345445), -18 }, // ln(7.3)
+        ::boost::decimal::decimal64 { UINT64_C(2001480000210124070), -18 }, // ln(7.4)
+        ::boost::decimal::decimal64 { UINT64_C(2014903020542264757), -18 }, // ln(7.5)
+        ::boost::decimal::decimal64 { UINT64_C(2028148247292285395), -18 }, // ln(7.6)
+        ::boost::decimal::decimal64 { UINT64_C(2041220328859638165), -18 }, // ln(7.7)
+        ::boost::decimal::decimal64 { UINT64_C(2054123733695546053), -18 }, // ln(7.8)
+        ::boost::decimal::decimal64 { UINT64_C(2066862759472975810), -18 }, // ln(7.9)
+        ::boost::decimal::decimal64 { UINT64_C(2079441541679835928), -18 }, // ln(8.0)
+        ::boost::decimal::decimal64 { UINT64_C(2091864061678393082), -18 }, // ln(8.1)
+        ::boost::decimal::decimal64 { UINT64_C(2104134154270207429), -18 }, // ln(8.2)
+        ::boost::decimal::decimal64 { UINT64_C(2116255514802552239), -18 }, // ln(8.3)
+        ::boost::decimal::decimal64 { UINT64_C(2128231705849267931), -18 }, // ln(8.4)
+        ::boost::decimal::decimal64 { UINT64_C(2140066163496270771), -18 }, // ln(8.5)
+        ::boost::decimal::decimal64 { UINT64_C(2151762203259462049), -18 }, // ln(8.6)
+        ::boost::decimal::decimal64 { UINT64_C(2163323025660538035), -18 }, // ln(8.7)
+        ::boost::decimal::decimal64 { UINT64_C(2174751721484160788), -18 }, // ln(8.8)
+        ::boost::decimal::decimal64 { UINT64_C(2186051276738094154), -18 }, // ln(8.9)
+        ::boost::decimal::decimal64 { UINT64_C(2197224577336219383), -18 }, // ln(9.0)
+        ::boost::decimal::decimal64 { UINT64_C(2208274413522804357), -18 }, // ln(9.1)
+        ::boost::decimal::decimal64 { UINT64_C(2219203484054994626), -18 }, // ln(9.2)
+        ::boost::decimal::decimal64 { UINT64_C(2230014400159210253), -18 }, // ln(9.3)
+        ::boost::decimal::decimal64 { UINT64_C(2240709689275958212), -18 }, // ln(9.4)
+        ::boost::decimal::decimal64 { UINT64_C(2251291798606495151), -18 }, // ln(9.5)
+        ::boost::decimal::decimal64 { UINT64_C(2261763098473790554), -18 }, // ln(9.6)
+        ::boost::decimal::decimal64 { UINT64_C(2272125885509337138), -18 }, // ln(9.7)
+        ::boost::decimal::decimal64 { UINT64_C(2282382385676526236), -18 }, // ln(9.8)
+        ::boost::decimal::decimal64 { UINT64_C(2292534757140544243), -18 }, // ln(9.9)
+    }};
+
+    // Log[k/10] for k = 10, ..., 99
+    static constexpr d128_values_t d128_values =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(0), UINT64_C(0) }, 0 }, // ln(1.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(516677520019165), UINT64_C(5824955696451355869) }, -35 }, // ln(1.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(98836713983472), UINT64_C(8176028621896654394) }, -34 }, // ln(1.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(142227952759107), UINT64_C(11397611552838242632) }, -34 }, // ln(1.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(182401964962887), UINT64_C(16263826191251294529) }, -34 }, // ln(1.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(219803075538970), UINT64_C(16064304874920167971) }, -34 }, // ln(1.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(254789477952149), UINT64_C(507325749617860637) }, -34 }, // ln(1.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(287654151291894), UINT64_C(7556972897756486919) }, -34 }, // ln(1.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(318639789522443), UINT64_C(5793589423107270750) }, -34 }, // ln(1.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(347949688903187), UINT64_C(832801755168634701) }, -34 }, // ln(1.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(375755839507647), UINT64_C(8395602002641374214) }, -34 }, // ln(2.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(402205040501858), UINT64_C(13881386992461910884) }, -34 }, // ln(2.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(427423591509563), UINT64_C(18201469609141285609) }, -34 }, // ln(2.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(451520940284617), UINT64_C(17077225783278967247) }, -34 }, // ln(2.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(474592553491119), UINT64_C(16571630624538028608) }, -34 }, // ln(2.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(496722201063145), UINT64_C(16283878255664887791) }, -34 }, // ln(2.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(517983792266755), UINT64_C(1346469481770065230) }, -34 }, // ln(2.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(538442865061414), UINT64_C(3411150224317887105) }, -34 }, // ln(2.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(55815780447053), UINT64_C(9844640448873087521) }, -33 }, // ln(2.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(57718084705791), UINT64_C(12304863118689069291) }, -33 }, // ln(2.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(59555891504661), UINT64_C(15358711539352840350) }, -33 }, // ln(3.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(61333431361666), UINT64_C(16721668059679105737) }, -33 }, // ln(3.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(63054531745979), UINT64_C(11958339219451654455) }, -33 }, // ln(3.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(64722666704853), UINT64_C(8960600670519010843) }, -33 }, // ln(3.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(66340999079954), UINT64_C(3439931897410741275) }, -33 }, // ln(3.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(67912416602603), UINT64_C(6944119259433528555) }, -33 }, // ln(3.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(69439562903009), UINT64_C(1418919142574864496) }, -33 }, // ln(3.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(70924864269940), UINT64_C(8741227167629124043) }, -33 }, // ln(3.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(72370552841083), UINT64_C(8301538005264821538) }, -33 }, // ln(3.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(73778686780572), UINT64_C(10964449472523799128) }, -33 }, // ln(3.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(75151167901529), UINT64_C(9057818030012095489) }, -33 }, // ln(4.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(76489757112270), UINT64_C(12471006603246424723) }, -33 }, // ln(4.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(77796088000950), UINT64_C(11451070936365104318) }, -33 }, // ln(4.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(79071678821540), UINT64_C(8682234774376052843) }, -33 }, // ln(4.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(80317943101721), UINT64_C(2659707161178265982) }, -33 }, // ln(4.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(81536199058558), UINT64_C(16965142026844857147) }, -33 }, // ln(4.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(82727677979226), UINT64_C(9925980408075854792) }, -33 }, // ln(4.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(83893531700350), UINT64_C(17137287478644822210) }, -33 }, // ln(4.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(85034839299876), UINT64_C(13564769706943671252) }, -33 }, // ln(4.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(86152613098892), UINT64_C(3036478656445792523) }, -33 }, // ln(4.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(87247804057079), UINT64_C(6157296840572536524) }, -33 }, // ln(5.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(88321306633851), UINT64_C(5046362384902758072) }, -33 }, // ln(5.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(89373963177440), UINT64_C(4663555963183054268) }, -33 }, // ln(5.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(90406567895897), UINT64_C(17958010449248225142) }, -33 }, // ln(5.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(91419870456906), UINT64_C(3025349630066881293) }, -33 }, // ln(5.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(92414579257270), UINT64_C(18205930045448258633) }, -33 }, // ln(5.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(93391364397818), UINT64_C(5150177427024359457) }, -33 }, // ln(5.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(94350860394980), UINT64_C(9907968492756838335) }, -33 }, // ln(5.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(95293668656556), UINT64_C(7610400096840341228) }, -33 }, // ln(5.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(96220359745834), UINT64_C(9328906419055067589) }, -33 }, // ln(5.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(97131475455426), UINT64_C(10664248517504112286) }, -33 }, // ln(6.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(98027530709685), UINT64_C(2714458846030140291) }, -33 }, // ln(6.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(98909015312431), UINT64_C(12027205037830377674) }, -33 }, // ln(6.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(99776395554847), UINT64_C(13057501423857121115) }, -33 }, // ln(6.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(100630115696744), UINT64_C(7263876197602926391) }, -33 }, // ln(6.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(101470599332990), UINT64_C(1763034773743495302) }, -33 }, // ln(6.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(102298250655618), UINT64_C(4266137648670282779) }, -33 }, // ln(6.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(103113455621028), UINT64_C(9263417791840698111) }, -33 }, // ln(6.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(103916583030718), UINT64_C(17192212949271564827) }, -33 }, // ln(6.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(104707985533123), UINT64_C(11532410895567871590) }, -33 }, // ln(6.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(105488000553368), UINT64_C(2249656237584800492) }, -33 }, // ln(7.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(106256951157077), UINT64_C(14304152105022642238) }, -33 }, // ln(7.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(107015146853773), UINT64_C(15171200194435688049) }, -33 }, // ln(7.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(107762884344857), UINT64_C(6763559842017115266) }, -33 }, // ln(7.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(108500448220705), UINT64_C(4046764145780395980) }, -33 }, // ln(7.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(109228111610976), UINT64_C(7763727328064553321) }, -33 }, // ln(7.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(109946136791848), UINT64_C(3607074983416093474) }, -33 }, // ln(7.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(110654775753559), UINT64_C(14298289442460522601) }, -33 }, // ln(7.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(111354270731337), UINT64_C(6269986450675071065) }, -33 }, // ln(7.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(112044854702499), UINT64_C(4595897883722108663) }, -33 }, // ln(7.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(112726751852294), UINT64_C(4363355008163367426) }, -33 }, // ln(8.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(113400178010803), UINT64_C(4631780117558898091) }, -33 }, // ln(8.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(114065341063035), UINT64_C(7776543581397696660) }, -33 }, // ln(8.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(114722441334167), UINT64_C(15426175166377743134) }, -33 }, // ln(8.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(115371671951715), UINT64_C(6756607914516376254) }, -33 }, // ln(8.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(116013219186268), UINT64_C(14291691759832005862) }, -33 }, // ln(8.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(116647262772305), UINT64_C(3987771752527324779) }, -33 }, // ln(8.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(117273976210453), UINT64_C(9216830584332358025) }, -33 }, // ln(8.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(117893527052485), UINT64_C(16411988213039089535) }, -33 }, // ln(8.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(118506077170207), UINT64_C(11386304772002080973) }, -33 }, // ln(8.9)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(119111783009323), UINT64_C(12270679004996129083) }, -33 }, // ln(9.0)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(119710795829278), UINT64_C(16302138244465310886) }, -33 }, // ln(9.1)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(120303261929991), UINT64_C(5231517386227126729) }, -33 }, // ln(9.2)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(120889322866328), UINT64_C(13633635525322394471) }, -33 }, // ln(9.3)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(121469115651115), UINT64_C(12442824456796094146) }, -33 }, // ln(9.4)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(122042772947398), UINT64_C(706553793976534509) }, -33 }, // ln(9.5)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(122610423250641), UINT64_C(8870306685094943188) }, -33 }, // ln(9.6)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(123172191061488), UINT64_C(12768324166601254990) }, -33 }, // ln(9.7)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(123728197049656), UINT64_C(16788759708306616076) }, -33 }, // ln(9.8)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(124278558209515), UINT64_C(5872568136162299577) }, -33 }, // ln(9.9)
+    }};
+
+    // Log[k/100] for k = 11, ..., 100, which replaces Log[k/10] - Log[10] for arguments in [0.1, 1)
+    static constexpr d32_values_t d32_fraction_values =
+    {{
+        ::boost::decimal::decimal32 { UINT64_C(2207274913189720824), -18, true }, // ln(0.11)
+        ::boost::decimal::decimal32 { UINT64_C(2120263536200091058), -18, true }, // ln(0.12)
+        ::boost::decimal::decimal32 { UINT64_C(2040220828526554632), -18, true }, // ln(0.13)
+        ::boost::decimal::decimal32 { UINT64_C(1966112856372832754), -18, true }, // ln(0.14)
+        ::boost::decimal::decimal32 { UINT64_C(1897119984885881302), -18, true }, // ln(0.15)
+        ::boost::decimal::decimal32 { UINT64_C(1832581463748310130), -18, true }, // ln(0.16)
+        ::boost::decimal::decimal32 { UINT64_C(1771956841931875288), -18, true }, // ln(0.17)
+        ::boost::decimal::decimal32 { UINT64_C(1714798428091926676), -18, true }, // ln(0.18)
+        ::boost::decimal::decimal32 { UINT64_C(1660731206821650908), -18, true }, // ln(0.19)
+        ::boost::decimal::decimal32 { UINT64_C(1609437912434100375), -18, true }, // ln(0.20)
+        ::boost::decimal::decimal32 { UINT64_C(1560647748264668372), -18, true }, // ln(0.21)
+        ::boost::decimal::decimal32 { UINT64_C(1514127732629775515), -18, true }, // ln(0.22)
+        ::boost::decimal::decimal32 { UINT64_C(1469675970058941677), -18, true }, // ln(0.23)
+        ::boost::decimal::decimal32 { UINT64_C(1427116355640145748), -18, true }, // ln(0.24)
+        ::boost::decimal::decimal32 { UINT64_C(1386294361119890619), -18, true }, // ln(0.25)
+        ::boost::decimal::decimal32 { UINT64_C(1347073647966609323), -18, true }, // ln(0.26)
+        ::boost::decimal::decimal32 { UINT64_C(1309333319983762294), -18, true }, // ln(0.27)
+        ::boost::decimal::decimal32 { UINT64_C(1272965675812887444), -18, true }, // ln(0.28)
+        ::boost::decimal::decimal32 { UINT64_C(1237874356001617341), -18, true }, // ln(0.29)
+        ::boost::decimal::decimal32 { UINT64_C(1203972804325935993), -18, true }, // ln(0.30)
+        ::boost::decimal::decimal32 { UINT64_C(1171182981502945122), -18, true }, // ln(0.31)
+        ::boost::decimal::decimal32 { UINT64_C(1139434283188364821), -18, true }, // ln(0.32)
+        ::boost::decimal::decimal32 { UINT64_C(1108662624521611133), -18, true }, // ln(0.33)
+        ::boost::decimal::decimal32 { UINT64_C(1078809661371929978), -18, true }, // ln(0.34)
+        ::boost::decimal::decimal32 { UINT64_C(1049822124498677688), -18, true }, // ln(0.35)
+        ::boost::decimal::decimal32 { UINT64_C(1021651247531981366), -18, true }, // ln(0.36)
+        ::boost::decimal::decimal32 { UINT64_C(9942522733438669237), -19, true }, // ln(0.37)
+        ::boost::decimal::decimal32 { UINT64_C(9675840262617055986), -19, true }, // ln(0.38)
+        ::boost::decimal::decimal32 { UINT64_C(9416085398584449406), -19, true }, // ln(0.39)
+        ::boost::decimal::decimal32 { UINT64_C(9162907318741550652), -19, true }, // ln(0.40)
+        ::boost::decimal::decimal32 { UINT64_C(8915981192837835642), -19, true }, // ln(0.41)
+        ::boost::decimal::decimal32 { UINT64_C(8675005677047230621), -19, true }, // ln(0.42)
+        ::boost::decimal::decimal32 { UINT64_C(8439700702945289446), -19, true }, // ln(0.43)
+        ::boost::decimal::decimal32 { UINT64_C(8209805520698302051), -19, true }, // ln(0.44)
+        ::boost::decimal::decimal32 { UINT64_C(7985076962177716106), -19, true }, // ln(0.45)
+        ::boost::decimal::decimal32 { UINT64_C(7765287894989963678), -19, true }, // ln(0.46)
+        ::boost::decimal::decimal32 { UINT64_C(7550225842780327812), -19, true }, // ln(0.47)
+        ::boost::decimal::decimal32 { UINT64_C(7339691750802004390), -19, true }, // ln(0.48)
+        ::boost::decimal::decimal32 { UINT64_C(7133498878774647578), -19, true }, // ln(0.49)
+        ::boost::decimal::decimal32 { UINT64_C(6931471805599453094), -19, true }, // ln(0.50)
+        ::boost::decimal::decimal32 { UINT64_C(6733445532637655964), -19, true }, // ln(0.51)
+        ::boost::decimal::decimal32 { UINT64_C(6539264674066640131), -19, true }, // ln(0.52)
+        ::boost::decimal::decimal32 { UINT64_C(6348782724359695339), -19, true }, // ln(0.53)
+        ::boost::decimal::decimal32 { UINT64_C(6161861394238169844), -19, true }, // ln(0.54)
+        ::boost::decimal::decimal32 { UINT64_C(5978370007556204494), -19, true }, // ln(0.55)
+        ::boost::decimal::decimal32 { UINT64_C(5798184952529421347), -19, true }, // ln(0.56)
+        ::boost::decimal::decimal32 { UINT64_C(5621189181535412166), -19, true }, // ln(0.57)
+        ::boost::decimal::decimal32 { UINT64_C(5447271754416720314), -19, true }, // ln(0.58)
+        ::boost::decimal::decimal32 { UINT64_C(5276327420823719174), -19, true }, // ln(0.59)
+        ::boost::decimal::decimal32 { UINT64_C(5108256237659906832), -19, true }, // ln(0.60)
+        ::boost::decimal::decimal32 { UINT64_C(4942963218147801193), -19, true }, // ln(0.61)
+        ::boost::decimal::decimal32 { UINT64_C(4780358009429998127), -19, true }, // ln(0.62)
+        ::boost::decimal::decimal32 { UINT64_C(4620354595965586801), -19, true }, // ln(0.63)
+        ::boost::decimal::decimal32 { UINT64_C(4462871026284195115), -19, true }, // ln(0.64)
+        ::boost::decimal::decimal32 { UINT64_C(4307829160924542574), -19, true }, // ln(0.65)
+        ::boost::decimal::decimal32 { UINT64_C(4155154439616658232), -19, true }, // ln(0.66)
+        ::boost::decimal::decimal32 { UINT64_C(4004775665971253084), -19, true }, // ln(0.67)
+        ::boost::decimal::decimal32 { UINT64_C(3856624808119846690), -19, true }, // ln(0.68)
+        ::boost::decimal::decimal32 { UINT64_C(3710636813908319858), -19, true }, // ln(0.69)
+        ::boost::decimal::decimal32 { UINT64_C(3566749439387323789), -19, true }, // ln(0.70)
+        ::boost::decimal::decimal32 { UINT64_C(3424903089467759467), -19, true }, // ln(0.71)
+        ::boost::decimal::decimal32 { UINT64_C(3285040669720360570), -19, true }, // ln(0.72)
+        ::boost::decimal::decimal32 { UINT64_C(3147107448397002389), -19, true }, // ln(0.73)
+        ::boost::decimal::decimal32 { UINT64_C(3011050927839216143), -19, true }, // ln(0.74)
+        ::boost::decimal::decimal32 { UINT64_C(2876820724517809274), -19, true }, // ln(0.75)
+        ::boost::decimal::decimal32 { UINT64_C(2744368457017602892), -19, true }, // ln(0.76)
+        ::boost::decimal::decimal32 { UINT64_C(2613647641344075189), -19, true }, // ln(0.77)
+        ::boost::decimal::decimal32 { UINT64_C(2484613592984996312), -19, true }, // ln(0.78)
+        ::boost::decimal::decimal32 { UINT64_C(2357223335210698739), -19, true }, // ln(0.79)
+        ::boost::decimal::decimal32 { UINT64_C(2231435513142097558), -19, true }, // ln(0.80)
+        ::boost::decimal::decimal32 { UINT64_C(2107210313156526025), -19, true }, // ln(0.81)
+        ::boost::decimal::decimal32 { UINT64_C(1984509387238382548), -19, true }, // ln(0.82)
+        ::boost::decimal::decimal32 { UINT64_C(1863295781914934446), -19, true }, // ln(0.83)
+        ::boost::decimal::decimal32 { UINT64_C(1743533871447777527), -19, true }, // ln(0.84)
+        ::boost::decimal::decimal32 { UINT64_C(1625189294977749132), -19, true }, // ln(0.85)
+        ::boost::decimal::decimal32 { UINT64_C(1508228897345836351), -19, true }, // ln(0.86)
+        ::boost::decimal::decimal32 { UINT64_C(1392620673335076495), -19, true }, // ln(0.87)
+        ::boost::decimal::decimal32 { UINT64_C(1278333715098848957), -19, true }, // ln(0.88)
+        ::boost::decimal::decimal32 { UINT64_C(1165338162559515297), -19, true }, // ln(0.89)
+        ::boost::decimal::decimal32 { UINT64_C(1053605156578263012), -19, true }, // ln(0.90)
+        ::boost::decimal::decimal32 { UINT64_C(9431067947124132688), -20, true }, // ln(0.91)
+        ::boost::decimal::decimal32 { UINT64_C(8338160893905105839), -20, true }, // ln(0.92)
+        ::boost::decimal::decimal32 { UINT64_C(7257069283483543071), -20, true }, // ln(0.93)
+        ::boost::decimal::decimal32 { UINT64_C(6187540371808747180), -20, true }, // ln(0.94)
+        ::boost::decimal::decimal32 { UINT64_C(5129329438755053343), -20, true }, // ln(0.95)
+        ::boost::decimal::decimal32 { UINT64_C(4082199452025512955), -20, true }, // ln(0.96)
+        ::boost::decimal::decimal32 { UINT64_C(3045920748470854592), -20, true }, // ln(0.97)
+        ::boost::decimal::decimal32 { UINT64_C(2020270731751944841), -20, true }, // ln(0.98)
+        ::boost::decimal::decimal32 { UINT64_C(1005033585350144118), -20, true }, // ln(0.99)
+        ::boost::decimal::decimal32 { 0, 0 }, // ln(1.00)
+    }};
+
+    // Log[k/100] for k = 11, ..., 100
+    static constexpr d64_values_t d64_fraction_values =
+    {{
+        ::boost::decimal::decimal64 { UINT64_C(2207274913189720824), -18, true }, // ln(0.11)
+        ::boost::decimal::decimal64 { UINT64_C(2120263536200091058), -18, true }, // ln(0.12)
+        ::boost::decimal::decimal64 { UINT64_C(2040220828526554632), -18, true }, // ln(0.13)
+        ::boost::decimal::decimal64 { UINT64_C(1966112856372832754), -18, true }, // ln(0.14)
+        ::boost::decimal::decimal64 { UINT64_C(1897119984885881302), -18, true }, // ln(0.15)
+        ::boost::decimal::decimal64 { UINT64_C(1832581463748310130), -18, true }, // ln(0.16)
+        ::boost::decimal::decimal64 { UINT64_C(1771956841931875288), -18, true }, // ln(0.17)
+        ::boost::decimal::decimal64 { UINT64_C(1714798428091926676), -18, true }, // ln(0.18)
+        ::boost::decimal::decimal64 { UINT64_C(1660731206821650908), -18, true }, // ln(0.19)
+        ::boost::decimal::decimal64 { UINT64_C(1609437912434100375), -18, true }, // ln(0.20)
+        ::boost::decimal::decimal64 { UINT64_C(1560647748264668372), -18, true }, // ln(0.21)
+        ::boost::decimal::decimal64 { UINT64_C(1514127732629775515), -18, true }, // ln(0.22)
+        ::boost::decimal::decimal64 { UINT64_C(1469675970058941677), -18, true }, // ln(0.23)
+        ::boost::decimal::decimal64 { UINT64_C(1427116355640145748), -18, true }, // ln(0.24)
+        ::boost::decimal::decimal64 { UINT64_C(1386294361119890619), -18, true }, // ln(0.25)
+        ::boost::decimal::decimal64 { UINT64_C(1347073647966609323), -18, true }, // ln(0.26)
+        ::boost::decimal::decimal64 { UINT64_C(1309333319983762294), -18, true }, // ln(0.27)
+        ::boost::decimal::decimal64 { UINT64_C(1272965675812887444), -18, true }, // ln(0.28)
+        ::boost::decimal::decimal64 { UINT64_C(1237874356001617341), -18, true }, // ln(0.29)
+        ::boost::decimal::decimal64 { UINT64_C(1203972804325935993), -18, true }, // ln(0.30)
+        ::boost::decimal::decimal64 { UINT64_C(1171182981502945122), -18, true }, // ln(0.31)
+        ::boost::decimal::decimal64 { UINT64_C(1139434283188364821), -18, true }, // ln(0.32)
+        ::boost::decimal::decimal64 { UINT64_C(1108662624521611133), -18, true }, // ln(0.33)
+        ::boost::decimal::decimal64 { UINT64_C(1078809661371929978), -18, true }, // ln(0.34)
+        ::boost::decimal::decimal64 { UINT64_C(1049822124498677688), -18, true }, // ln(0.35)
+        ::boost::decimal::decimal64 { UINT64_C(1021651247531981366), -18, true }, // ln(0.36)
+        ::boost::decimal::decimal64 { UINT64_C(9942522733438669237), -19, true }, // ln(0.37)
+        ::boost::decimal::decimal64 { UINT64_C(9675840262617055986), -19, true }, // ln(0.38)
+        ::boost::decimal::decimal64 { UINT64_C(9416085398584449406), -19, true }, // ln(0.39)
+        ::boost::decimal::decimal64 { UINT64_C(9162907318741550652), -19, true }, // ln(0.40)
+        ::boost::decimal::decimal64 { UINT64_C(8915981192837835642), -19, true }, // ln(0.41)
+        ::boost::decimal::decimal64 { UINT64_C(8675005677047230621), -19, true }, // ln(0.42)
+        ::boost::decimal::decimal64 { UINT64_C(8439700702945289446), -19, true }, // ln(0.43)
+        ::boost::decimal::decimal64 { UINT64_C(8209805520698302051), -19, true }, // ln(0.44)
+        ::boost::decimal::decimal64 { UINT64_C(7985076962177716106), -19, true }, // ln(0.45)
+        ::boost::decimal::decimal64 { UINT64_C(7765287894989963678), -19, true }, // ln(0.46)
+        ::boost::decimal::decimal64 { UINT64_C(7550225842780327812), -19, true }, // ln(0.47)
+        ::boost::decimal::decimal64 { UINT64_C(7339691750802004390), -19, true }, // ln(0.48)
+        ::boost::decimal::decimal64 { UINT64_C(7133498878774647578), -19, true }, // ln(0.49)
+        ::boost::decimal::decimal64 { UINT64_C(6931471805599453094), -19, true }, // ln(0.50)
+        ::boost::decimal::decimal64 { UINT64_C(6733445532637655964), -19, true }, // ln(0.51)
+        ::boost::decimal::decimal64 { UINT64_C(6539264674066640131), -19, true }, // ln(0.52)
+        ::boost::decimal::decimal64 { UINT64_C(6348782724359695339), -19, true }, // ln(0.53)
+        ::boost::decimal::decimal64 { UINT64_C(6161861394238169844), -19, true }, // ln(0.54)
+        ::boost::decimal::decimal64 { UINT64_C(5978370007556204494), -19, true }, // ln(0.55)
+        ::boost::decimal::decimal64 { UINT64_C(5798184952529421347), -19, true }, // ln(0.56)
+        ::boost::decimal::decimal64 { UINT64_C(5621189181535412166), -19, true }, // ln(0.57)
+        ::boost::decimal::decimal64 { UINT64_C(5447271754416720314), -19, true }, // ln(0.58)
+        ::boost::decimal::decimal64 { UINT64_C(5276327420823719174), -19, true }, // ln(0.59)
+        ::boost::decimal::decimal64 { UINT64_C(5108256237659906832), -19, true }, // ln(0.60)
+        ::boost::decimal::decimal64 { UINT64_C(4942963218147801193), -19, true }, // ln(0.61)
+        ::boost::decimal::decimal64 { UINT64_C(4780358009429998127), -19, true }, // ln(0.62)
+        ::boost::decimal::decimal64 { UINT64_C(4620354595965586801), -19, true }, // ln(0.63)
+        ::boost::decimal::decimal64 { UINT64_C(4462871026284195115), -19, true }, // ln(0.64)
+        ::boost::decimal::decimal64 { UINT64_C(4307829160924542574), -19, true }, // ln(0.65)
+        ::boost::decimal::decimal64 { UINT64_C(4155154439616658232), -19, true }, // ln(0.66)
+        ::boost::decimal::decimal64 { UINT64_C(4004775665971253084), -19, true }, // ln(0.67)
+        ::boost::decimal::decimal64 { UINT64_C(3856624808119846690), -19, true }, // ln(0.68)
+        ::boost::decimal::decimal64 { UINT64_C(3710636813908319858), -19, true }, // ln(0.69)
+        ::boost::decimal::decimal64 { UINT64_C(3566749439387323789), -19, true }, // ln(0.70)
+        ::boost::decimal::decimal64 { UINT64_C(3424903089467759467), -19, true }, // ln(0.71)
+        ::boost::decimal::decimal64 { UINT64_C(3285040669720360570), -19, true }, // ln(0.72)
+        ::boost::decimal::decimal64 { UINT64_C(3147107448397002389), -19, true }, // ln(0.73)
+        ::boost::decimal::decimal64 { UINT64_C(3011050927839216143), -19, true }, // ln(0.74)
+        ::boost::decimal::decimal64 { UINT64_C(2876820724517809274), -19, true }, // ln(0.75)
+        ::boost::decimal::decimal64 { UINT64_C(2744368457017602892), -19, true }, // ln(0.76)
+        ::boost::decimal::decimal64 { UINT64_C(2613647641344075189), -19, true }, // ln(0.77)
+        ::boost::decimal::decimal64 { UINT64_C(2484613592984996312), -19, true }, // ln(0.78)
+        ::boost::decimal::decimal64 { UINT64_C(2357223335210698739), -19, true }, // ln(0.79)
+        ::boost::decimal::decimal64 { UINT64_C(2231435513142097558), -19, true }, // ln(0.80)
+        ::boost::decimal::decimal64 { UINT64_C(2107210313156526025), -19, true }, // ln(0.81)
+        ::boost::decimal::decimal64 { UINT64_C(1984509387238382548), -19, true }, // ln(0.82)
+        ::boost::decimal::decimal64 { UINT64_C(1863295781914934446), -19, true }, // ln(0.83)
+        ::boost::decimal::decimal64 { UINT64_C(1743533871447777527), -19, true }, // ln(0.84)
+        ::boost::decimal::decimal64 { UINT64_C(1625189294977749132), -19, true }, // ln(0.85)
+        ::boost::decimal::decimal64 { UINT64_C(1508228897345836351), -19, true }, // ln(0.86)
+        ::boost::decimal::decimal64 { UINT64_C(1392620673335076495), -19, true }, // ln(0.87)
+        ::boost::decimal::decimal64 { UINT64_C(1278333715098848957), -19, true }, // ln(0.88)
+        ::boost::decimal::decimal64 { UINT64_C(1165338162559515297), -19, true }, // ln(0.89)
+        ::boost::decimal::decimal64 { UINT64_C(1053605156578263012), -19, true }, // ln(0.90)
+        ::boost::decimal::decimal64 { UINT64_C(9431067947124132688), -20, true }, // ln(0.91)
+        ::boost::decimal::decimal64 { UINT64_C(8338160893905105839), -20, true }, // ln(0.92)
+        ::boost::decimal::decimal64 { UINT64_C(7257069283483543071), -20, true }, // ln(0.93)
+        ::boost::decimal::decimal64 { UINT64_C(6187540371808747180), -20, true }, // ln(0.94)
+        ::boost::decimal::decimal64 { UINT64_C(5129329438755053343), -20, true }, // ln(0.95)
+        ::boost::decimal::decimal64 { UINT64_C(4082199452025512955), -20, true }, // ln(0.96)
+        ::boost::decimal::decimal64 { UINT64_C(3045920748470854592), -20, true }, // ln(0.97)
+        ::boost::decimal::decimal64 { UINT64_C(2020270731751944841), -20, true }, // ln(0.98)
+        ::boost::decimal::decimal64 { UINT64_C(1005033585350144118), -20, true }, // ln(0.99)
+        ::boost::decimal::decimal64 { 0, 0 }, // ln(1.00)
+    }};
+
+    // Log[k/100] for k = 11, ..., 100
+    static constexpr d128_values_t d128_fraction_values =
+    {{
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(119656612807652), UINT64_C(7860944687557637967) }, -33, true }, // ln(0.11)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(114939716609496), UINT64_C(15402626215501784314) }, -33, true }, // ln(0.12)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(110600592731933), UINT64_C(5857095885552849682) }, -33, true }, // ln(0.13)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(106583191511555), UINT64_C(5370474421711544492) }, -33, true }, // ln(0.14)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(102843080453946), UINT64_C(18303147404941343279) }, -33, true }, // ln(0.15)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(99344440212629), UINT64_C(3256775651132977558) }, -33, true }, // ln(0.16)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(96057972878654), UINT64_C(11775182973173890738) }, -33, true }, // ln(0.17)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(92959409055599), UINT64_C(13796195728009767516) }, -33, true }, // ln(0.18)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(90028419117525), UINT64_C(6913576865319810475) }, -33, true }, // ln(0.19)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(87247804057079), UINT64_C(6157296840572536524) }, -33, true }, // ln(0.20)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(84602883957658), UINT64_C(3764043934219527695) }, -33, true }, // ln(0.21)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(82081028856887), UINT64_C(12555407709406366031) }, -33, true }, // ln(0.22)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(79671293979382), UINT64_C(5289134462508777220) }, -33, true }, // ln(0.23)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(77364132658732), UINT64_C(1650345163640960761) }, -33, true }, // ln(0.24)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(75151167901529), UINT64_C(9057818030012095489) }, -33, true }, // ln(0.25)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(73025008781168), UINT64_C(10551558907401577745) }, -33, true }, // ln(0.26)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(70979101501702), UINT64_C(12189765240517750719) }, -33, true }, // ln(0.27)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(69007607560790), UINT64_C(10064937443560272556) }, -33, true }, // ln(0.28)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(67105303302052), UINT64_C(7604714773744290785) }, -33, true }, // ln(0.29)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(65267496503182), UINT64_C(4550866353080519727) }, -33, true }, // ln(0.30)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(63489956646177), UINT64_C(3187909832754254339) }, -33, true }, // ln(0.31)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(61768856261864), UINT64_C(7951238672981705622) }, -33, true }, // ln(0.32)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(60100721302990), UINT64_C(10948977221914349233) }, -33, true }, // ln(0.33)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(58482388927889), UINT64_C(16469645995022618801) }, -33, true }, // ln(0.34)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(56910971405240), UINT64_C(12965458632999831521) }, -33, true }, // ln(0.35)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(55383825104835), UINT64_C(43914676148943964) }, -33, true }, // ln(0.36)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(538985237379036), UINT64_C(1003042805785050637) }, -34, true }, // ln(0.37)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(524528351667606), UINT64_C(5399934429428075687) }, -34, true }, // ln(0.38)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(510447012272714), UINT64_C(15664307904257403017) }, -34, true }, // ln(0.39)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(496722201063145), UINT64_C(16283878255664887791) }, -34, true }, // ln(0.40)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(483336308955734), UINT64_C(598736597031147064) }, -34, true }, // ln(0.41)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(470273000068934), UINT64_C(10798093265844351120) }, -34, true }, // ln(0.42)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(457517091863036), UINT64_C(1592966738315762638) }, -34, true }, // ln(0.43)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(445054449061229), UINT64_C(6478010649164976396) }, -34, true }, // ln(0.44)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(432871889492851), UINT64_C(10997614582175477678) }, -34, true }, // ln(0.45)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(420957100286175), UINT64_C(7602254475027294757) }, -34, true }, // ln(0.46)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(409298563074931), UINT64_C(9276160064175827051) }, -34, true }, // ln(0.47)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(397885487079673), UINT64_C(8107849633768233396) }, -34, true }, // ln(0.48)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(386707749089519), UINT64_C(2710295696489710986) }, -34, true }, // ln(0.49)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(375755839507647), UINT64_C(8395602002641374214) }, -34, true }, // ln(0.50)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(365020813739928), UINT64_C(1058202485629607114) }, -34, true }, // ln(0.51)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(354494248304038), UINT64_C(4886266702826645159) }, -34, true }, // ln(0.52)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(344168201119461), UINT64_C(1068930358141797730) }, -34, true }, // ln(0.53)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(334035175509379), UINT64_C(2821585960278823283) }, -34, true }, // ln(0.54)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(324088087505730), UINT64_C(17036478469851014435) }, -34, true }, // ln(0.55)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(314320236100258), UINT64_C(20052064413593262) }, -34, true }, // ln(0.56)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(304725276128635), UINT64_C(7782373628217459332) }, -34, true }, // ln(0.57)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(295297193512876), UINT64_C(12311313513672878786) }, -34, true }, // ln(0.58)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(286030282620095), UINT64_C(13572994365235166788) }, -34, true }, // ln(0.59)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(276919125524175), UINT64_C(219573380744719819) }, -34, true }, // ln(0.60)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(267958572981589), UINT64_C(5930493800646233313) }, -34, true }, // ln(0.61)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(259143726954124), UINT64_C(5036752251191617562) }, -34, true }, // ln(0.62)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(250469924529963), UINT64_C(13180532464633734765) }, -34, true }, // ln(0.63)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(241932723110996), UINT64_C(15776552506047027154) }, -34, true }, // ln(0.64)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(233527886748539), UINT64_C(15444734523512683198) }, -34, true }, // ln(0.65)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(225251373522258), UINT64_C(8860449847954360040) }, -34, true }, // ln(0.66)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(217099323868155), UINT64_C(14227880637378861577) }, -34, true }, // ln(0.67)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(209068049771251), UINT64_C(8726905357908400871) }, -34, true }, // ln(0.68)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(201154024747204), UINT64_C(9984693673816678402) }, -34, true }, // ln(0.69)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(193353874544759), UINT64_C(10578519885099631301) }, -34, true }, // ln(0.70)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(185664368507663), UINT64_C(714025652978523535) }, -34, true }, // ln(0.71)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(178082411540702), UINT64_C(10490288832557617041) }, -34, true }, // ln(0.72)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(170605036629867), UINT64_C(2332971988195586786) }, -34, true }, // ln(0.73)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(163229397871388), UINT64_C(11054184876853228039) }, -34, true }, // ln(0.74)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(155952763968676), UINT64_C(10778041201430757858) }, -34, true }, // ln(0.75)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(148772512159958), UINT64_C(15451076500496253089) }, -34, true }, // ln(0.76)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(141686122542843), UINT64_C(772652278599719906) }, -34, true }, // ln(0.77)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(134691172765067), UINT64_C(7268705901616028803) }, -34, true }, // ln(0.78)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(127785333053448), UINT64_C(5562847497436101207) }, -34, true }, // ln(0.79)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(120966361555498), UINT64_C(7888276253023513577) }, -34, true }, // ln(0.80)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(114232099970408), UINT64_C(5204025159068206928) }, -34, true }, // ln(0.81)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(107580469448086), UINT64_C(10649878668099324467) }, -34, true }, // ln(0.82)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(101009466736762), UINT64_C(7940539113137066188) }, -34, true }, // ln(0.83)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(94517160561287), UINT64_C(2402491263202976906) }, -34, true }, // ln(0.84)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(88101688215753), UINT64_C(838629104884887294) }, -34, true }, // ln(0.85)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(81761252355388), UINT64_C(11644108809383940040) }, -34, true }, // ln(0.86)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(75494117973905), UINT64_C(14693752712462262431) }, -34, true }, // ln(0.87)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(69298609553581), UINT64_C(16529152720233153798) }, -34, true }, // ln(0.88)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(63173108376364), UINT64_C(11445754909474584568) }, -34, true }, // ln(0.89)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(57116049985204), UINT64_C(2602012579534103464) }, -34, true }, // ln(0.90)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(511259217856519), UINT64_C(10255827396323438304) }, -35, true }, // ln(0.91)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(452012607785279), UINT64_C(10513268797568757052) }, -35, true }, // ln(0.92)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(393406514151534), UINT64_C(404938204971805606) }, -35, true }, // ln(0.93)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(335427235672840), UINT64_C(8805580615344528374) }, -35, true }, // ln(0.94)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(278061506044604), UINT64_C(1841026179889188660) }, -35, true }, // ln(0.95)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(221296475720259), UINT64_C(15569220384978143443) }, -35, true }, // ln(0.96)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(165119694635538), UINT64_C(13149097782247547262) }, -35, true }, // ln(0.97)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(109519095818716), UINT64_C(16933913233321574183) }, -35, true }, // ln(0.98)
+        ::boost::decimal::decimal128 { boost::decimal::detail::uint128 { UINT64_C(54482979832876), UINT64_C(1748426025180127155) }, -35, true }, // ln(0.99)
+        ::boost::decimal::decimal128 { 0, 0 }, // ln(1.00)
     }};
 };
 
@@ -100,6 +660,24 @@ constexpr typename log_table_imp<b>::d64_coeffs_t log_table_imp<b>::d64_coeffs;
 template <bool b>
 constexpr typename log_table_imp<b>::d128_coeffs_t log_table_imp<b>::d128_coeffs;
 
+template <bool b>
+constexpr typename log_table_imp<b>::d32_values_t log_table_imp<b>::d32_values;
+
+template <bool b>
+constexpr typename log_table_imp<b>::d64_values_t log_table_imp<b>::d64_values;
+
+template <bool b>
+constexpr typename log_table_imp<b>::d128_values_t log_table_imp<b>::d128_values;
+
+template <bool b>
+constexpr typename log_table_imp<b>::d32_values_t log_table_imp<b>::d32_fraction_values;
+
+template <bool b>
+constexpr typename log_table_imp<b>::d64_values_t log_table_imp<b>::d64_fraction_values;
+
+template <bool b>
+constexpr typename log_table_imp<b>::d128_values_t log_table_imp<b>::d128_fraction_values;
+
 #endif
 
 } //namespace log_detail
@@ -127,6 +705,118 @@ constexpr auto log_series_expansion<decimal128>(decimal128 z2) noexcept
     return taylor_series_result(z2, log_table::d128_coeffs);
 }
 
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto log_table_value(std::size_t k) noexcept;
+
+template <>
+constexpr auto log_table_value<decimal32>(std::size_t k) noexcept
+{
+    return log_table::d32_values[k];
+}
+
+template <>
+constexpr auto log_table_value<decimal64>(std::size_t k) noexcept
+{
+    return log_table::d64_values[k];
+}
+
+template <>
+constexpr auto log_table_value<decimal128>(std::size_t k) noexcept
+{
+    return log_table::d128_values[k];
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto log_fraction_table_value(std::size_t k) noexcept;
+
+template <>
+constexpr auto log_fraction_table_value<decimal32>(std::size_t k) noexcept
+{
+    return log_table::d32_fraction_values[k];
+}
+
+template <>
+constexpr auto log_fraction_table_value<decimal64>(std::size_t k) noexcept
+{
+    return log_table::d64_fraction_values[k];
+}
+
+template <>
+constexpr auto log_fraction_table_value<decimal128>(std::size_t k) noexcept
+{
+    return log_table::d128_fraction_values[k];
+}
+
+// Log[(1 + s)/(1 - s)] with z = 2s
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto log_series_from_ratio(T num, T den) noexcept -> T
+{
+    constexpr T one { 1, 0 };
+
+    const T s   { num / den };
+    const T z   { s + s };
+    const T zsq { z * z };
+
+    return z * fma(log_series_expansion(zsq), zsq, one);
+}
+
+// Natural logarithm of x in (9/10, 11/10).
+// Here the reduction by the table would cancel log(10) against log(c),
+// so the series is applied to x directly with s = (x - 1)/(x + 1)
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto log_near_one(T x) noexcept -> T
+{
+    constexpr T one { 1, 0 };
+
+    return log_series_from_ratio(x - one, x + one);
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+struct log_reduction
+{
+    int exp10;      // x = 10^exp10 * m with m in [1, 10)
+    T   log_c;      // log(c) from the table, where c = k/10 are the two leading digits of m
+    T   log_ratio;  // log(m/c), which lies in [0, log(1.1))
+};
+
+// Reduces finite x > 0 to log(x) = exp10 * log(10) + log(c) + log(m/c).
+// With s = (m - c)/(m + c) we have m/c = (1 + s)/(1 - s) and |s| <= 1/21,
+// which keeps the series short. m - c only holds the trailing digits of
+// the significand of x and is therefore exact.
+// For x in [0.1, 1) the sum -log(10) + log(c) would cancel, so x itself is
+// reduced against c = (k + 1)/100 from a table of its own, giving exp10 = 0 and log(x/c) in (log(10/11), 0].
+// Both terms are then negative and |log(c)| <= |log(x)|, so neither the sum nor the rounding of log(c) loses digits.
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto log_table_reduction(T x) noexcept -> log_reduction<T>
+{
+    using sig_type = typename T::significand_type;
+
+    constexpr int digits { std::numeric_limits<T>::digits10 };
+
+    int exp10val { };
+
+    const sig_type gn { frexp10(x, &exp10val) };
+
+    const sig_type scale { pow10(static_cast<sig_type>(digits - 2)) };
+    const auto k { static_cast<std::uint32_t>(gn / scale) };
+    const sig_type c { static_cast<sig_type>(k) * scale };
+
+    const int exp10 { exp10val + digits - 1 };
+
+    if (exp10 == -1)
+    {
+        const sig_type c_up { static_cast<sig_type>(c + scale) };
+
+        return { 0,
+                 log_fraction_table_value<T>(static_cast<std::size_t>(k - 10U)),
+                 -log_series_from_ratio(T { c_up - gn, 1 - digits }, T { gn + c_up, 1 - digits }) };
+    }
+
+    return { exp10,
+             log_table_value<T>(static_cast<std::size_t>(k - 10U)),
+             log_series_from_ratio(T { gn - c, 1 - digits }, T { gn + c, 1 - digits }) };
+}
+
 } //namespace detail
 } //namespace decimal
 } //namespace boost
@@ -9,9 +9,18 @@
 #include <boost/decimal/fwd.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/emulated256.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 #endif
 
@@ -77,6 +86,331 @@ constexpr auto pow_n_impl(T b, UnsignedIntegralType p) noexcept -> std::enable_i
     return result;
 }
 
+// Builds sig * 10^exp, where the exponent may lie outside of the range of the type,
+// and rounds once from the digits beyond the precision of T or below etiny.
+// The lowest digit of sig has to be marked as described for div_pow10_to_guard_digit when sig is inexact
+template <typename T, typename Unsigned>
+constexpr auto make_decimal_with_underflow(Unsigned sig, std::int64_t exp, bool isneg) noexcept -> T
+{
+    using result_sig_type = std::conditional_t<(std::numeric_limits<T>::digits10 > 16), uint128, std::uint64_t>;
+
+    constexpr std::int64_t max_exp { std::numeric_limits<T>::max_exponent10 + 2 * std::numeric_limits<Unsigned>::digits10 };
+
+    if (exp > max_exp)
+    {
+        return isneg ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    }
+
+    const auto excess_digits { static_cast<std::int64_t>(num_digits(sig) - std::numeric_limits<T>::digits10) };
+    const auto shift { (std::max)(excess_digits, static_cast<std::int64_t>(etiny_v<T>) - exp) };
+
+    if (shift <= 0)
+    {
+        return T { static_cast<result_sig_type>(sig), static_cast<int>(exp), isneg };
+    }
+
+    // Far below etiny only the sticky digit is left
+    constexpr std::int64_t max_shift { std::numeric_limits<Unsigned>::digits10 + 2 };
+
+    auto guarded { static_cast<result_sig_type>(div_pow10_to_guard_digit(sig, static_cast<int>((std::min)(shift, max_shift)))) };
+    exp += shift - 1;
+    exp += fenv_round<T>(guarded, isneg);
+
+    return T { guarded, static_cast<int>(exp), isneg };
+}
+
+// The significands of the intermediate powers are kept with more digits than the significand of the type.
+// Truncating a partial power costs a relative error of up to 10^(1 - digits), which the squarings
+// of the ladder double at every step, so that the power is off by less than 2 * p * 10^(1 - digits) before it is rounded.
+// For any p up to 2^64 whose power neither overflows nor underflows, that is a few hundredths of an ulp
+// of decimal32 with 19 digits, and far less for decimal64 and decimal128 with two limbs of 19 and 38 digits.
+template <typename T, bool = (std::numeric_limits<T>::digits10 > 7)>
+struct pow_wide_traits
+{
+    using significand_type = std::uint64_t;
+
+    #ifdef BOOST_DECIMAL_HAS_INT128
+    using product_type = uint128_t;
+    #else
+    using product_type = uint128;
+    #endif
+
+    static constexpr int digits {19};
+
+    static constexpr auto widen(typename T::significand_type sig, std::int64_t&) noexcept -> significand_type
+    {
+        return static_cast<significand_type>(sig);
+    }
+
+    // lhs *= rhs, truncating the product to the digits of the wide significand
+    static constexpr auto mul(significand_type& lhs_sig, std::int64_t& lhs_exp, significand_type rhs_sig, std::int64_t rhs_exp) noexcept -> void
+    {
+        #ifdef BOOST_DECIMAL_HAS_INT128
+        const auto prod { static_cast<product_type>(lhs_sig) * rhs_sig };
+        #else
+        const auto prod { umul128(lhs_sig, rhs_sig) };
+        #endif
+
+        const auto prod_digits { num_digits(prod) };
+
+        lhs_exp += rhs_exp;
+
+        if (prod_digits > digits)
+        {
+            const auto divisor { pow10(static_cast<product_type>(prod_digits - digits)) };
+
+            lhs_sig = static_cast<significand_type>(prod / divisor);
+            lhs_exp += prod_digits - digits;
+
+            // Mark a truncation that left a trailing zero, so that the final rounding
+            // does not mistake the result for an exact or a halfway value
+            if (((lhs_sig % 10U) == 0U) && (static_cast<product_type>(lhs_sig) * divisor != prod))
+            {
+                ++lhs_sig;
+            }
+        }
+        else
+        {
+            lhs_sig = static_cast<significand_type>(prod);
+        }
+    }
+
+    // Returns 10^k / sig truncated to the digits of the wide significand
+    static constexpr auto reciprocal(typename T::significand_type sig, int& k) noexcept -> significand_type
+    {
+        const auto wide_sig { static_cast<product_type>(sig) };
+
+        k = digits + num_digits(sig) - 1;
+
+        const auto num { pow10(static_cast<product_type>(k)) };
+
+        auto res { static_cast<significand_type>(num / wide_sig) };
+
+        if (((res % 10U) == 0U) && (static_cast<product_type>(res) * wide_sig != num))
+        {
+            ++res;
+        }
+
+        return res;
+    }
+
+    static constexpr auto to_decimal(significand_type sig, std::int64_t exp, bool isneg) noexcept -> T
+    {
+        return make_decimal_with_underflow<T>(sig, exp, isneg);
+    }
+};
+
+// The products of limbs of 19 and 38 digits
+constexpr auto umul_limbs(std::uint64_t lhs, std::uint64_t rhs) noexcept -> uint128
+{
+    return umul128(lhs, rhs);
+}
+
+constexpr auto umul_limbs(const uint128& lhs, const uint128& rhs) noexcept -> uint256_t
+{
+    return umul256(lhs, rhs);
+}
+
+// A significand of 2 * limb_digits - 1 or 2 * limb_digits digits, hi * 10^limb_digits + lo
+// with 10^(limb_digits - 1) <= hi < 10^limb_digits and lo < 10^limb_digits
+template <typename Limb>
+struct pow_wide_limbs
+{
+    Limb hi;
+    Limb lo;
+};
+
+template <typename T>
+struct pow_wide_traits<T, true>
+{
+    using limb_type = std::conditional_t<(std::numeric_limits<T>::digits10 > 16), uint128, std::uint64_t>;
+    using product_type = std::conditional_t<(std::numeric_limits<T>::digits10 > 16), uint256_t, uint128>;
+    using significand_type = pow_wide_limbs<limb_type>;
+
+    static constexpr int limb_digits {std::numeric_limits<limb_type>::digits10};
+
+    static constexpr int digits {2 * limb_digits - 1};
+
+    // Splits x into x / 10^limb_digits and the remainder
+    static constexpr auto split(const product_type& x, limb_type& rem) noexcept -> product_type
+    {
+        const auto quo { div_pow10(x, limb_digits) };
+
+        // The remainder fits into a limb, so it can be taken modulo the width of the limb
+        rem = x.low - quo.low * pow10(static_cast<limb_type>(limb_digits));
+
+        return quo;
+    }
+
+    static constexpr auto widen(typename T::significand_type sig, std::int64_t& exp) noexcept -> significand_type
+    {
+        const auto wide_sig { static_cast<limb_type>(sig) };
+        const auto shift { limb_digits - num_digits(wide_sig) };
+
+        exp -= limb_digits + shift;
+
+        return { wide_sig * pow10(static_cast<limb_type>(shift)), limb_type { 0U } };
+    }
+
+    // lhs *= rhs, truncating the product to its top two limbs
+    static constexpr auto mul(significand_type& lhs_sig, std::int64_t& lhs_exp, const significand_type& rhs_sig, std::int64_t rhs_exp) noexcept -> void
+    {
+        // The middle carry may exceed a limb
+        limb_type limbs[4] {};
+
+        const auto carry0 { split(umul_limbs(lhs_sig.lo, rhs_sig.lo), limbs[0]) };
+        const auto carry1 { split(umul_limbs(lhs_sig.hi, rhs_sig.lo) + umul_limbs(lhs_sig.lo, rhs_sig.hi) + carry0, limbs[1]) };
+        limbs[3] = split(umul_limbs(lhs_sig.hi, rhs_sig.hi) + carry1, limbs[2]).low;
+
+        const auto top_digit { pow10(static_cast<limb_type>(limb_digits - 1)) };
+
+        bool sticky { limbs[0] != 0U };
+
+        lhs_exp += rhs_exp;
+
+        if (limbs[3] < top_digit)
+        {
+            // The top limb of the product of two normalized significands has at least limb_digits - 2 digits,
+            // and the top limbs are shifted up by one digit to normalize it again
+            const auto limb2_top { div_pow10(limbs[2], limb_digits - 1) };
+            const auto limb1_top { div_pow10(limbs[1], limb_digits - 1) };
+
+            sticky = sticky || (limbs[1] != limb1_top * top_digit);
+
+            lhs_sig.hi = limbs[3] * 10U + limb2_top;
+            lhs_sig.lo = (limbs[2] - limb2_top * top_digit) * 10U + limb1_top;
+            lhs_exp += 2 * limb_digits - 1;
+        }
+        else
+        {
+            sticky = sticky || (limbs[1] != 0U);
+
+            lhs_sig.hi = limbs[3];
+            lhs_sig.lo = limbs[2];
+            lhs_exp += 2 * limb_digits;
+        }
+
+        // Mark a truncation that left a trailing zero, so that the final rounding
+        // does not mistake the result for an exact or a halfway value
+        if (sticky && ((lhs_sig.lo % 10U) == 0U))
+        {
+            ++lhs_sig.lo;
+        }
+    }
+
+    // Returns 10^k / sig truncated to two limbs
+    static constexpr auto reciprocal(typename T::significand_type sig, int& k) noexcept -> significand_type
+    {
+        const auto wide_sig { static_cast<limb_type>(sig) };
+        const auto sig_digits { num_digits(wide_sig) };
+
+        // 10^(limb_digits - 1) <= 10^a / sig < 10^limb_digits, where the lower bound is only reached by a power of ten
+        const auto a { (wide_sig == pow10(static_cast<limb_type>(sig_digits - 1))) ? limb_digits + sig_digits - 2 : limb_digits + sig_digits - 1 };
+
+        const auto divisor { product_type { wide_sig } };
+        const auto num { (a > limb_digits) ? umul_limbs(pow10(static_cast<limb_type>(limb_digits)), pow10(static_cast<limb_type>(a - limb_digits)))
+                                           : product_type { pow10(static_cast<limb_type>(a)) } };
+
+        const auto hi { num / divisor };
+        const auto rem { umul_limbs((num - hi * divisor).low, pow10(static_cast<limb_type>(limb_digits))) };
+        const auto lo { rem / divisor };
+
+        significand_type res { hi.low, lo.low };
+
+        if (((res.lo % 10U) == 0U) && (lo * divisor != rem))
+        {
+            ++res.lo;
+        }
+
+        k = a + limb_digits;
+
+        return res;
+    }
+
+    static constexpr auto to_decimal(const significand_type& sig, std::int64_t exp, bool isneg) noexcept -> T
+    {
+        auto result_sig { sig.hi };
+
+        if ((sig.lo != 0U) && ((result_sig % 10U) == 0U))
+        {
+            ++result_sig;
+        }
+
+        return make_decimal_with_underflow<T>(result_sig, exp + limb_digits, isneg);
+    }
+};
+
+// Calculates (b^p) for b = sig * 10^exp with the ladder method for powers.
+// Unlike pow_n_impl, the intermediate powers are not rounded to the precision of T,
+// but truncated to the wider significand of pow_wide_traits, so that the result is
+// rounded only once when it is converted to T. The intermediate powers are exact as long
+// as they fit into the wide significand, e.g. for the small powers of values with few digits.
+// With invert the power of the reciprocal of b is taken
+template <typename T, typename UnsignedIntegralType>
+constexpr auto pow_n_wide_impl(typename T::significand_type sig, int exp, bool isneg, UnsignedIntegralType p, bool invert = false) noexcept
+    -> std::enable_if_t<(detail::is_decimal_floating_point_v<T> && std::is_integral<UnsignedIntegralType>::value && std::is_unsigned<UnsignedIntegralType>::value), T>
+{
+    using traits = pow_wide_traits<T>;
+    using significand_type = typename traits::significand_type;
+
+    // Once the magnitude of a partial power is beyond this bound the result is certain to overflow or underflow
+    constexpr std::int64_t exp_bound { 2 * (bias_v<T> + traits::digits) };
+
+    const bool result_isneg { isneg && ((p & 1U) != 0U) };
+
+    std::int64_t y_exp { exp };
+    significand_type y_sig { traits::widen(sig, y_exp) };
+
+    if (invert)
+    {
+        int k {};
+        y_sig = traits::reciprocal(sig, k);
+        y_exp = -static_cast<std::int64_t>(exp) - k;
+    }
+
+    // The first factor of the result is copied rather than multiplied by one
+    bool has_result { false };
+
+    significand_type result_sig { };
+    std::int64_t     result_exp { 0 };
+
+    for (;;)
+    {
+        if ((p & 1U) != 0U)
+        {
+            if (has_result)
+            {
+                traits::mul(result_sig, result_exp, y_sig, y_exp);
+            }
+            else
+            {
+                result_sig = y_sig;
+                result_exp = y_exp;
+                has_result = true;
+            }
+        }
+
+        p >>= 1U;
+
+        if (p == 0U)
+        {
+            break;
+        }
+
+        if ((y_exp > exp_bound) || (y_exp < -exp_bound))
+        {
+            // The remaining factors all move the result further in the same direction
+            result_sig = y_sig;
+            result_exp = y_exp;
+            break;
+        }
+
+        traits::mul(y_sig, y_exp, y_sig, y_exp);
+    }
+
+    return traits::to_decimal(result_sig, result_exp, result_isneg);
+}
+
 template<typename T>
 constexpr auto pow_2_impl(int e2) noexcept -> std::enable_if_t<detail::is_decimal_floating_point_v<T>, T>
 {
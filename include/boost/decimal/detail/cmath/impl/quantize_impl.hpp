@@ -0,0 +1,69 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_QUANTIZE_IMPL_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_QUANTIZE_IMPL_HPP
+
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+// Rescales the finite value x to the exponent exp, keeping its value apart from the rounding.
+// Removing digits rounds according to the current rounding mode,
+// and adding digits beyond the precision of T gives sNaN
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto rescale_finite_impl(T x, int exp) noexcept -> T
+{
+    using significand_type = typename T::significand_type;
+
+    const auto x_exp {x.biased_exponent()};
+
+    // Already at the target quantum, as most values of a money column are
+    if (x_exp == exp)
+    {
+        return x;
+    }
+
+    const auto sig {x.full_significand()};
+    const auto sign {x.isneg()};
+
+    if (sig == 0U)
+    {
+        return T{0, exp, sign};
+    }
+
+    if (x_exp > exp)
+    {
+        const auto shift {x_exp - exp};
+        constexpr auto max_sig {static_cast<significand_type>(detail::max_significand_v<T>)};
+
+        if (shift >= detail::precision_v<T> || sig > max_sig / detail::pow10(static_cast<significand_type>(shift)))
+        {
+            return std::numeric_limits<T>::signaling_NaN();
+        }
+
+        return T{sig * detail::pow10(static_cast<significand_type>(shift)), exp, sign};
+    }
+
+    auto res_sig {detail::div_pow10_to_guard_digit(sig, exp - x_exp)};
+    detail::fenv_round<T>(res_sig, sign);
+
+    return T{res_sig, exp, sign};
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CMATH_IMPL_QUANTIZE_IMPL_HPP
@@ -7,6 +7,7 @@
 
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/cmath/fma.hpp>
+#include <boost/decimal/detail/cmath/impl/fixed_point_series.hpp>
 
 namespace boost {
 namespace decimal {
@@ -15,15 +16,7 @@ namespace detail {
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T, typename Array>
 constexpr auto remez_series_result(T x, const Array &coeffs) noexcept
 {
-    T result {};
-
-    result = coeffs[0];
-    for (std::size_t i {1}; i < coeffs.size(); ++i)
-    {
-        result = fma(result, x, coeffs[i]);
-    }
-
-    return result;
+    return fixed_point_horner(x, coeffs, true);
 }
 
 } //namespace detail
@@ -7,6 +7,7 @@
 
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/cmath/fma.hpp>
+#include <boost/decimal/detail/cmath/impl/fixed_point_series.hpp>
 
 namespace boost {
 namespace decimal {
@@ -15,16 +16,7 @@ namespace detail {
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T, typename Array>
 constexpr auto taylor_series_result(T x, const Array &coeffs) noexcept
 {
-    const std::size_t N = coeffs.size();
-
-    auto result = coeffs[N - 1];
-
-    for (std::size_t i = N - 1; i-- > 0;)
-    {
-        result = fma(result, x, coeffs[i]);
-    }
-
-    return result;
+    return fixed_point_horner(x, coeffs, false);
 }
 
 } //namespace detail
@@ -0,0 +1,320 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_IMPL_TRIG_REDUCTION_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_IMPL_TRIG_REDUCTION_HPP
+
+#include <boost/decimal/numbers.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+#include <boost/decimal/detail/cmath/impl/fixed_point_series.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <cstdint>
+#include <limits>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+namespace trig_reduction_detail {
+
+template <bool b>
+struct trig_reduction_table_imp
+{
+    // The first 6300 digits of 2/pi in limbs of nine digits, so that 2/pi = sum of limbs[j] * 10^(-9 * (j + 1))
+    static constexpr std::array<std::uint32_t, 700> two_div_pi_limbs =
+    {{
+        UINT32_C(636619772), UINT32_C(367581343), UINT32_C(75535053), UINT32_C(490057448), UINT32_C(137838582), UINT32_C(961825794), UINT32_C(990669376), UINT32_C(235587190),
+        UINT32_C(536906140), UINT32_C(360455211), UINT32_C(65012343), UINT32_C(824291370), UINT32_C(907031832), UINT32_C(147571647), UINT32_C(384458314), UINT32_C(611511869),
+        UINT32_C(642926799), UINT32_C(356916959), UINT32_C(867749636), UINT32_C(310292310), UINT32_C(985587701), UINT32_C(230754869), UINT32_C(571584869), UINT32_C(590646773),
+        UINT32_C(449560966), UINT32_C(894516047), UINT32_C(329520456), UINT32_C(890799022), UINT32_C(863761847), UINT32_C(560347610), UINT32_C(695824481), UINT32_C(957643747),
+        UINT32_C(751376342), UINT32_C(114892399), UINT32_C(785773600), UINT32_C(994689390), UINT32_C(957838443), UINT32_C(593292387), UINT32_C(132299624), UINT32_C(667945851),
+        UINT32_C(218797794), UINT32_C(608751526), UINT32_C(299146267), UINT32_C(856964155), UINT32_C(983496557), UINT32_C(394439935), UINT32_C(472396799), UINT32_C(849771502),
+        UINT32_C(340684715), UINT32_C(433724470), UINT32_C(75068642), UINT32_C(186190147), UINT32_C(952038957), UINT32_C(841459037), UINT32_C(335072237), UINT32_C(209977986),
+        UINT32_C(541221308), UINT32_C(627102012), UINT32_C(881299111), UINT32_C(265588664), UINT32_C(91786992), UINT32_C(478392663), UINT32_C(362424067), UINT32_C(212143992),
+        UINT32_C(535647949), UINT32_C(995331146), UINT32_C(617741119), UINT32_C(20280064), UINT32_C(962710257), UINT32_C(555398285), UINT32_C(243520488), UINT32_C(797504590),
+        UINT32_C(725511058), UINT32_C(951562532), UINT32_C(272185831), UINT32_C(913927045), UINT32_C(249709256), UINT32_C(279843100), UINT32_C(98001191), UINT32_C(39428356),
+        UINT32_C(227611187), UINT32_C(140526100), UINT32_C(840065270), UINT32_C(984083699), UINT32_C(246424962), UINT32_C(245824812), UINT32_C(585936356), UINT32_C(993836765),
+        UINT32_C(740846301), UINT32_C(630224803), UINT32_C(486106427), UINT32_C(208868636), UINT32_C(563029898), UINT32_C(330890390), UINT32_C(985141599), UINT32_C(500621317),
+        UINT32_C(563255927), UINT32_C(89637433), UINT32_C(19188293), UINT32_C(314876162), UINT32_C(799903630), UINT32_C(630831397), UINT32_C(388157435), UINT32_C(931234869),
+        UINT32_C(370256146), UINT32_C(758046650), UINT32_C(182823773), UINT32_C(310525074), UINT32_C(600104490), UINT32_C(871884612), UINT32_C(845039801), UINT32_C(754671780),
+        UINT32_C(150502243), UINT32_C(345268467), UINT32_C(810390325), UINT32_C(128997664), UINT32_C(933372580), UINT32_C(424494147), UINT32_C(514252454), UINT32_C(546768668),
+        UINT32_C(568278987), UINT32_C(840517002), UINT32_C(313344212), UINT32_C(478434378), UINT32_C(39358226), UINT32_C(874839818), UINT32_C(986041726), UINT32_C(495262070),
+        UINT32_C(323357771), UINT32_C(919883998), UINT32_C(21017550), UINT32_C(264517783), UINT32_C(533227384), UINT32_C(203141166), UINT32_C(60564161), UINT32_C(957195402),
+        UINT32_C(555264310), UINT32_C(478797229), UINT32_C(364155998), UINT32_C(314767562), UINT32_C(392374951), UINT32_C(88247501), UINT32_C(728908757), UINT32_C(205465021),
+        UINT32_C(44955121), UINT32_C(550155524), UINT32_C(427256270), UINT32_C(617363313), UINT32_C(114107733), UINT32_C(707198224), UINT32_C(283161544), UINT32_C(241410955),
+        UINT32_C(984980503), UINT32_C(982997105), UINT32_C(188094376), UINT32_C(382337204), UINT32_C(659318564), UINT32_C(742310849), UINT32_C(623017797), UINT32_C(828087159),
+        UINT32_C(79169637), UINT32_C(961309179), UINT32_C(80866598), UINT32_C(414261272), UINT32_C(614176015), UINT32_C(362759498), UINT32_C(870766355), UINT32_C(52763866),
+        UINT32_C(27857619), UINT32_C(107882750), UINT32_C(734627112), UINT32_C(419119181), UINT32_C(801413583), UINT32_C(33207527), UINT32_C(354751751), UINT32_C(64499259),
+        UINT32_C(812239862), UINT32_C(320876334), UINT32_C(395004140), UINT32_C(508516172), UINT32_C(926321994), UINT32_C(878747511), UINT32_C(37862653), UINT32_C(848841368),
+        UINT32_C(177634219), UINT32_C(914015170), UINT32_C(954777174), UINT32_C(146477511), UINT32_C(317149437), UINT32_C(513738812), UINT32_C(920948583), UINT32_C(351694228),
+        UINT32_C(474545367), UINT32_C(717840732), UINT32_C(729167856), UINT32_C(660035132), UINT32_C(317325413), UINT32_C(991163989), UINT32_C(834597161), UINT32_C(69802439),
+        UINT32_C(574756378), UINT32_C(353220134), UINT32_C(812215221), UINT32_C(892492863), UINT32_C(237727907), UINT32_C(41291325), UINT32_C(256759238), UINT32_C(999289753),
+        UINT32_C(340697427), UINT32_C(959390004), UINT32_C(158002735), UINT32_C(520159146), UINT32_C(894398432), UINT32_C(96010956), UINT32_C(43499819), UINT32_C(419151694),
+        UINT32_C(273044559), UINT32_C(795613075), UINT32_C(989708333), UINT32_C(984459683), UINT32_C(315615107), UINT32_C(138972142), UINT32_C(18273824), UINT32_C(334685917),
+        UINT32_C(233826893), UINT32_C(308141941), UINT32_C(570224808), UINT32_C(347357296), UINT32_C(398248847), UINT32_C(13273576), UINT32_C(83883174), UINT32_C(283099861),
+        UINT32_C(995234744), UINT32_C(265443874), UINT32_C(647868149), UINT32_C(898168411), UINT32_C(324877007), UINT32_C(384899339), UINT32_C(964644598), UINT32_C(266224151),
+        UINT32_C(878704559), UINT32_C(725131984), UINT32_C(310433111), UINT32_C(960403132), UINT32_C(144009353), UINT32_C(91951634), UINT32_C(160955046), UINT32_C(229781723),
+        UINT32_C(704047640), UINT32_C(217351993), UINT32_C(556186196), UINT32_C(849931806), UINT32_C(428291412), UINT32_C(20908840), UINT32_C(944070093), UINT32_C(252692719),
+        UINT32_C(37244201), UINT32_C(312620437), UINT32_C(495654558), UINT32_C(581223170), UINT32_C(428720334), UINT32_C(471819506), UINT32_C(898583921), UINT32_C(895909169),
+        UINT32_C(792436803), UINT32_C(748503147), UINT32_C(673331583), UINT32_C(545135961), UINT32_C(743474666), UINT32_C(559026937), UINT32_C(805638014), UINT32_C(549308766),
+        UINT32_C(972455522), UINT32_C(655322903), UINT32_C(692110389), UINT32_C(380242192), UINT32_C(851112148), UINT32_C(261351132), UINT32_C(128683950), UINT32_C(939866273),
+        UINT32_C(963201307), UINT32_C(954026967), UINT32_C(165858734), UINT32_C(33126467), UINT32_C(413257344), UINT32_C(642923980), UINT32_C(599412479), UINT32_C(278935033),
+        UINT32_C(776839366), UINT32_C(623816609), UINT32_C(2573577), UINT32_C(251457761), UINT32_C(535534246), UINT32_C(35190865), UINT32_C(800682588), UINT32_C(270075098),
+        UINT32_C(242366434), UINT32_C(867431431), UINT32_C(756904939), UINT32_C(25326844), UINT32_C(531994623), UINT32_C(766387562), UINT32_C(879402754), UINT32_C(976920230),
+        UINT32_C(76790822), UINT32_C(760152873), UINT32_C(570248813), UINT32_C(549694145), UINT32_C(27233416), UINT32_C(626069188), UINT32_C(435246887), UINT32_C(183747330),
+        UINT32_C(259540749), UINT32_C(998994834), UINT32_C(212466393), UINT32_C(224405568), UINT32_C(578178406), UINT32_C(459538110), UINT32_C(810045644), UINT32_C(280994086),
+        UINT32_C(958980415), UINT32_C(466945615), UINT32_C(491440398), UINT32_C(699572694), UINT32_C(247248284), UINT32_C(696191559), UINT32_C(747554622), UINT32_C(769231394),
+        UINT32_C(9222822), UINT32_C(857625455), UINT32_C(452809474), UINT32_C(80429640), UINT32_C(229943691), UINT32_C(244628878), UINT32_C(720159129), UINT32_C(903812006),
+        UINT32_C(678340884), UINT32_C(921385675), UINT32_C(94601741), UINT32_C(870585826), UINT32_C(263887604), UINT32_C(492339068), UINT32_C(397238834), UINT32_C(365134586),
+        UINT32_C(676767107), UINT32_C(755165733), UINT32_C(262266026), UINT32_C(792528656), UINT32_C(608403582), UINT32_C(846914495), UINT32_C(370428271), UINT32_C(380704044),
+        UINT32_C(538032027), UINT32_C(979073689), UINT32_C(427958499), UINT32_C(522063103), UINT32_C(923813588), UINT32_C(323419002), UINT32_C(390145062), UINT32_C(596137577),
+        UINT32_C(816823271), UINT32_C(545742732), UINT32_C(168001260), UINT32_C(382378973), UINT32_C(757010179), UINT32_C(402699657), UINT32_C(163459005), UINT32_C(769213285),
+        UINT32_C(329827804), UINT32_C(653978271), UINT32_C(15757696), UINT32_C(144362175), UINT32_C(334211316), UINT32_C(973688139), UINT32_C(793746460), UINT32_C(586529144),
+        UINT32_C(99106666), UINT32_C(419812562), UINT32_C(629374302), UINT32_C(120563633), UINT32_C(119523659), UINT32_C(146773739), UINT32_C(690950410), UINT32_C(539991319),
+        UINT32_C(828072647), UINT32_C(857284932), UINT32_C(561903051), UINT32_C(589936331), UINT32_C(564696389), UINT32_C(913055159), UINT32_C(672679975), UINT32_C(794999086),
+        UINT32_C(79592749), UINT32_C(66517840), UINT32_C(732215833), UINT32_C(310083694), UINT32_C(540274155), UINT32_C(569138729), UINT32_C(890398901), UINT32_C(132030674),
+        UINT32_C(277503346), UINT32_C(388916792), UINT32_C(977189896), UINT32_C(246552732), UINT32_C(455833226), UINT32_C(977394067), UINT32_C(714389532), UINT32_C(949570649),
+        UINT32_C(609738007), UINT32_C(991239761), UINT32_C(608758453), UINT32_C(933709445), UINT32_C(470579965), UINT32_C(530861666), UINT32_C(425369931), UINT32_C(745496740),
+        UINT32_C(244904434), UINT32_C(452847994), UINT32_C(533851388), UINT32_C(397673597), UINT32_C(709718236), UINT32_C(625133359), UINT32_C(619215284), UINT32_C(700046448),
+        UINT32_C(466688207), UINT32_C(650317214), UINT32_C(211716964), UINT32_C(537612464), UINT32_C(536449981), UINT32_C(273543707), UINT32_C(833961775), UINT32_C(387231396),
+        UINT32_C(389593123), UINT32_C(542118818), UINT32_C(61221596), UINT32_C(560395479), UINT32_C(536353461), UINT32_C(934660889), UINT32_C(867449634), UINT32_C(901605616),
+        UINT32_C(36471496), UINT32_C(848818092), UINT32_C(301338958), UINT32_C(901525976), UINT32_C(155367623), UINT32_C(473692463), UINT32_C(785290977), UINT32_C(356264500),
+        UINT32_C(649572425), UINT32_C(132781295), UINT32_C(533568526), UINT32_C(138225526), UINT32_C(47008140), UINT32_C(434983823), UINT32_C(280449501), UINT32_C(743907262),
+        UINT32_C(136074962), UINT32_C(957736145), UINT32_C(359121552), UINT32_C(688401812), UINT32_C(676731807), UINT32_C(795183670), UINT32_C(695816711), UINT32_C(516974110),
+        UINT32_C(469628984), UINT32_C(237566410), UINT32_C(929131517), UINT32_C(872774596), UINT32_C(515798859), UINT32_C(813730210), UINT32_C(894366637), UINT32_C(192289919),
+        UINT32_C(943224507), UINT32_C(602932875), UINT32_C(378107177), UINT32_C(340182320), UINT32_C(780997026), UINT32_C(522481950), UINT32_C(646453746), UINT32_C(135968115),
+        UINT32_C(18083422), UINT32_C(137657639), UINT32_C(620519309), UINT32_C(98186364), UINT32_C(725288931), UINT32_C(362046664), UINT32_C(626028393), UINT32_C(502297349),
+        UINT32_C(181945248), UINT32_C(164486865), UINT32_C(523662424), UINT32_C(644662928), UINT32_C(333224), UINT32_C(458424725), UINT32_C(121305034), UINT32_C(783806409),
+        UINT32_C(852866455), UINT32_C(430645921), UINT32_C(887973083), UINT32_C(108526576), UINT32_C(480637984), UINT32_C(44253132), UINT32_C(208303833), UINT32_C(394012203),
+        UINT32_C(163823399), UINT32_C(319287469), UINT32_C(611593542), UINT32_C(55329582), UINT32_C(808323055), UINT32_C(902017169), UINT32_C(39390588), UINT32_C(284065707),
+        UINT32_C(897538017), UINT32_C(236663458), UINT32_C(113441299), UINT32_C(734417418), UINT32_C(628950231), UINT32_C(664546529), UINT32_C(648183123), UINT32_C(987886265),
+        UINT32_C(360886352), UINT32_C(218317725), UINT32_C(313112022), UINT32_C(98452835), UINT32_C(560749684), UINT32_C(843697956), UINT32_C(416402086), UINT32_C(198723884),
+        UINT32_C(548830160), UINT32_C(228438536), UINT32_C(265725429), UINT32_C(817596639), UINT32_C(77743155), UINT32_C(683173702), UINT32_C(471132088), UINT32_C(948045945),
+        UINT32_C(699700956), UINT32_C(994914852), UINT32_C(528087066), UINT32_C(944302658), UINT32_C(239309043), UINT32_C(829662640), UINT32_C(937514974), UINT32_C(516528438),
+        UINT32_C(994358860), UINT32_C(285229564), UINT32_C(162905741), UINT32_C(656718822), UINT32_C(889061919), UINT32_C(215260510), UINT32_C(383164960), UINT32_C(101378721),
+        UINT32_C(928810469), UINT32_C(369196004), UINT32_C(81932249), UINT32_C(852135185), UINT32_C(898712762), UINT32_C(7247321), UINT32_C(500615211), UINT32_C(518093733),
+        UINT32_C(678200854), UINT32_C(275908365), UINT32_C(162245727), UINT32_C(151516834), UINT32_C(482297999), UINT32_C(703159027), UINT32_C(607396841), UINT32_C(296825885),
+        UINT32_C(540764555), UINT32_C(259025608), UINT32_C(390422195), UINT32_C(831751405), UINT32_C(656165812), UINT32_C(206063358), UINT32_C(571293061), UINT32_C(624082413),
+        UINT32_C(247566346), UINT32_C(281088345), UINT32_C(1079665), UINT32_C(575006111), UINT32_C(549442432), UINT32_C(458227793), UINT32_C(684128963), UINT32_C(109090968),
+        UINT32_C(660545693), UINT32_C(746797086), UINT32_C(536123762), UINT32_C(122992261), UINT32_C(74037206), UINT32_C(635685476), UINT32_C(856572517), UINT32_C(485364246),
+        UINT32_C(286148562), UINT32_C(481591390), UINT32_C(473706011), UINT32_C(912314425), UINT32_C(67879843), UINT32_C(236736893), UINT32_C(905340190), UINT32_C(986876069),
+        UINT32_C(801805784), UINT32_C(665531384), UINT32_C(832963469), UINT32_C(438040948), UINT32_C(521161777), UINT32_C(511763414), UINT32_C(13781770), UINT32_C(533652250),
+        UINT32_C(522983805), UINT32_C(532124091), UINT32_C(725877378), UINT32_C(673314070), UINT32_C(653129660), UINT32_C(608407176), UINT32_C(905775828), UINT32_C(724868680),
+        UINT32_C(870259687), UINT32_C(857797586), UINT32_C(128888750), UINT32_C(633952978), UINT32_C(47637605), UINT32_C(362017728), UINT32_C(559434514), UINT32_C(484332717),
+        UINT32_C(575843377), UINT32_C(559207659), UINT32_C(149559089), UINT32_C(324114524), UINT32_C(52594782), UINT32_C(85048207), UINT32_C(311225397), UINT32_C(828474651),
+        UINT32_C(113026395), UINT32_C(324021406), UINT32_C(209266639), UINT32_C(375763608), UINT32_C(872252578), UINT32_C(180848519), UINT32_C(158937885), UINT32_C(954965033),
+        UINT32_C(72895440), UINT32_C(944108439), UINT32_C(924766082), UINT32_C(275293889), UINT32_C(593432053), UINT32_C(464273514), UINT32_C(531547171), UINT32_C(447892946),
+        UINT32_C(901442674), UINT32_C(86742528), UINT32_C(47795912), UINT32_C(293583367), UINT32_C(676266383), UINT32_C(354714117), UINT32_C(649674872), UINT32_C(869119500),
+        UINT32_C(244157842), UINT32_C(592783429), UINT32_C(824802435), UINT32_C(684913665), UINT32_C(577495386), UINT32_C(198359728), UINT32_C(113924945), UINT32_C(733864478),
+        UINT32_C(829297238), UINT32_C(183436293), UINT32_C(447514516), UINT32_C(252740066), UINT32_C(42507030), UINT32_C(740486543), UINT32_C(35478522), UINT32_C(980799688),
+        UINT32_C(4310670), UINT32_C(732378792), UINT32_C(599024907), UINT32_C(297391746), UINT32_C(852433648), UINT32_C(408780835), UINT32_C(979276497), UINT32_C(761950046),
+        UINT32_C(842367376), UINT32_C(559631557), UINT32_C(823100738), UINT32_C(486476166), UINT32_C(123738175), UINT32_C(211235754), UINT32_C(512292950), UINT32_C(314461071),
+        UINT32_C(188457329), UINT32_C(296787943), UINT32_C(122255052), UINT32_C(72353754), UINT32_C(656242870), UINT32_C(147328545), UINT32_C(51868489), UINT32_C(704377141),
+        UINT32_C(604438528), UINT32_C(730510604), UINT32_C(804680902), UINT32_C(117171586)
+    }};
+
+    // pi/2 = 1.570796326794896619231321691639751442098584699... in the same limbs, least significant first
+    static constexpr std::array<std::uint32_t, 6> pi_half_limbs =
+    {{
+        UINT32_C(98584699), UINT32_C(639751442), UINT32_C(231321691), UINT32_C(794896619), UINT32_C(570796326), UINT32_C(1)
+    }};
+};
+
+#if !(defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L) && (!defined(_MSC_VER) || _MSC_VER != 1900)
+
+template <bool b>
+constexpr std::array<std::uint32_t, 700> trig_reduction_table_imp<b>::two_div_pi_limbs;
+
+template <bool b>
+constexpr std::array<std::uint32_t, 6> trig_reduction_table_imp<b>::pi_half_limbs;
+
+#endif
+
+using trig_reduction_table = trig_reduction_table_imp<true>;
+
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::uint32_t limb_base {UINT32_C(1000000000)};
+
+} // namespace trig_reduction_detail
+
+template <typename T>
+struct trig_reduction_traits
+{
+    static constexpr int digits {std::numeric_limits<T>::digits10};
+
+    // Limbs of the significand, which grows by up to eight digits when its exponent is aligned to the limbs
+    static constexpr int sig_limbs {(digits + 16) / 9};
+
+    // Limbs of the fraction of x * 2/pi. The error of cutting off 2/pi reaches sig_limbs - 1 limbs up through the
+    // upper limbs of the significand, so that many extra limbs keep the fraction accurate to 10^-(2 * digits + 30),
+    // even when x is very close to a multiple of pi/2
+    static constexpr int frac_limbs {(2 * digits + 33) / 9 + sig_limbs - 1};
+
+    static constexpr int max_product_limbs {sig_limbs + frac_limbs + 1};
+
+    static_assert(std::numeric_limits<T>::max_exponent10 / 9 + frac_limbs <= static_cast<int>(trig_reduction_detail::trig_reduction_table::two_div_pi_limbs.size()),
+                  "The table of 2/pi does not cover the exponent range of T");
+};
+
+// Reads exactly the working digits of fixed_point_series.hpp from the limbs at and below the non-zero limbs[top],
+// whose weight is 10^(9 * (top - frac_limbs))
+template <typename T>
+constexpr auto limbs_to_fixed_point(const std::uint32_t* limbs, int top, int frac_limbs, bool sign) noexcept -> fixed_point_value<T>
+{
+    using traits = fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    const int leading_digits {num_digits(limbs[top])};
+
+    sig_type sig {limbs[top]};
+    int digits {leading_digits};
+    int index {top - 1};
+
+    while (digits + 9 <= traits::working_digits && index >= 0)
+    {
+        sig = sig * trig_reduction_detail::limb_base + limbs[index];
+        digits += 9;
+        --index;
+    }
+
+    if (digits < traits::working_digits)
+    {
+        const int remaining {traits::working_digits - digits};
+        const std::uint32_t next {index >= 0 ? limbs[index] : UINT32_C(0)};
+
+        sig = sig * pow10(static_cast<sig_type>(remaining)) + next / pow10(static_cast<std::uint32_t>(9 - remaining));
+    }
+
+    return {sig, 9 * (top - frac_limbs) + leading_digits - traits::working_digits, sign};
+}
+
+// Payne-Hanek reduction of finite x >= 0: returns r with x = k * pi/2 + r and |r| <= pi/4 in the working digits
+// of fixed_point_series.hpp, and stores k % 4 in quadrant. Arguments below pi/4 are returned unchanged with k = 0.
+//
+// With x = sig * 10^(9m), the digits of 2/pi with a weight of 10^(-9(m - 1)) or more make sig * digits * 10^(9m) a multiple of 10^9,
+// so they cannot change k % 4 or the fraction. Only a fixed window of the table is multiplied with sig in exact integer arithmetic,
+// which gives the same accuracy at the same cost for every exponent
+template <typename T>
+constexpr auto trig_reduce_fixed_point(T x, int* quadrant) noexcept -> fixed_point_value<T>
+{
+    using traits = trig_reduction_traits<T>;
+    using trig_reduction_detail::trig_reduction_table;
+    using trig_reduction_detail::limb_base;
+
+    constexpr int frac_limbs {traits::frac_limbs};
+
+    #if (defined(_MSC_VER) && (_MSC_VER < 1920))
+    const auto pi_quarter = numbers::pi_v<T> / 4;
+    #else
+    constexpr auto pi_quarter = numbers::pi_v<T> / 4;
+    #endif
+
+    if (x < pi_quarter)
+    {
+        *quadrant = 0;
+        return to_fixed_point(x);
+    }
+
+    int exp10 {};
+    auto sig {frexp10(x, &exp10)};
+
+    // Shift the significand by up to eight digits so that the exponent is a multiple of nine
+    const int shift {((exp10 % 9) + 9) % 9};
+    const int m {(exp10 - shift) / 9};
+
+    std::uint32_t sig_limbs[traits::sig_limbs] {};
+    std::uint64_t carry {};
+
+    for (int i {}; i < traits::sig_limbs; ++i)
+    {
+        const auto limb {static_cast<std::uint64_t>(sig % limb_base)};
+        sig /= limb_base;
+
+        const auto current {limb * pow10(static_cast<std::uint64_t>(shift)) + carry};
+        sig_limbs[i] = static_cast<std::uint32_t>(current % limb_base);
+        carry = current / limb_base;
+    }
+
+    // The window of 2/pi from the limb of weight 10^(-9m) down to frac_limbs limbs below the decimal point of the product,
+    // least significant first
+    const int last {m - 1 + frac_limbs};
+    const int first {m - 1 > 0 ? m - 1 : 0};
+    const int window {last - first + 1};
+
+    std::uint32_t product[traits::max_product_limbs] {};
+
+    for (int i {}; i < traits::sig_limbs; ++i)
+    {
+        carry = 0U;
+
+        for (int k {}; k < window; ++k)
+        {
+            const auto current {static_cast<std::uint64_t>(sig_limbs[i]) * trig_reduction_table::two_div_pi_limbs[static_cast<std::size_t>(last - k)] +
+                                product[i + k] + carry};
+            product[i + k] = static_cast<std::uint32_t>(current % limb_base);
+            carry = current / limb_base;
+        }
+
+        product[i + window] = static_cast<std::uint32_t>(carry);
+    }
+
+    // product[frac_limbs] holds the units of k, and every limb above it a multiple of 10^9, which is a multiple of 4.
+    // Round to the nearest k, which leaves a negative fraction 1 - f for f >= 1/2
+    int k {static_cast<int>(product[frac_limbs] % 4U)};
+    const bool round_up {product[frac_limbs - 1] >= limb_base / 2U};
+
+    if (round_up)
+    {
+        ++k;
+
+        std::uint32_t borrow {};
+        for (int i {}; i < frac_limbs; ++i)
+        {
+            const auto subtrahend {product[i] + borrow};
+            product[i] = subtrahend == 0U ? 0U : limb_base - subtrahend;
+            borrow = subtrahend == 0U ? 0U : 1U;
+        }
+    }
+
+    *quadrant = k % 4;
+
+    int top {frac_limbs - 1};
+    while (top >= 0 && product[top] == 0U)
+    {
+        --top;
+    }
+
+    if (top < 0)
+    {
+        return {0U, 0, false};
+    }
+
+    // r = f * pi/2 with both factors and their product in the working digits
+    auto r {limbs_to_fixed_point<T>(product, top, frac_limbs, round_up)};
+    const auto pi_half {limbs_to_fixed_point<T>(trig_reduction_table::pi_half_limbs.data(), 5, 5, false)};
+
+    fixed_point_mul(r, pi_half);
+
+    return r;
+}
+
+// The reduced argument of trig_reduce_fixed_point rounded to T once
+template <typename T>
+constexpr auto trig_reduce(T x, int* quadrant) noexcept -> T
+{
+    const auto r {trig_reduce_fixed_point(x, quadrant)};
+
+    return T{r.sig, r.exp, r.sig != 0U && r.sign};
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CMATH_IMPL_TRIG_REDUCTION_HPP
@@ -7,6 +7,7 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_LGAMMA_HPP
 
 #include <boost/decimal/fwd.hpp> // NOLINT(llvm-include-order)
+#include <boost/decimal/detail/cmath/impl/gamma_lookup.hpp>
 #include <boost/decimal/detail/cmath/impl/lgamma_impl.hpp>
 #include <boost/decimal/detail/cmath/impl/tgamma_impl.hpp>
 #include <boost/decimal/detail/cmath/log.hpp>
@@ -17,6 +18,8 @@
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <array>
+#include <cstddef>
+#include <limits>
 #include <type_traits>
 #endif
 
@@ -25,6 +28,59 @@ namespace decimal {
 
 namespace detail {
 
+// lgamma of a normal, positive argument
+template <typename T>
+constexpr auto lgamma_positive_impl(T x) noexcept -> T
+{
+    T result { };
+
+    const auto nx = static_cast<int>(x);
+
+    const auto& log_factorials = detail::log_factorial_table<T>();
+
+    if ((nx == x) && (nx <= static_cast<int>(log_factorials.size())))
+    {
+        // lgamma(n) = log((n - 1)!) is looked up
+        result = log_factorials[static_cast<std::size_t>(nx - 1)];
+    }
+    else
+    {
+        constexpr T one { 1, 0 };
+
+        constexpr int asymp_cutoff
+        {
+              std::numeric_limits<T>::digits10 < 10 ? T {  2, 1 } //  20
+            : std::numeric_limits<T>::digits10 < 20 ? T {  5, 1 } //  50
+            :                                         T { 15, 1 } // 150
+        };
+
+        if (x < T { 2, -1 })
+        {
+            // Perform the Taylor series expansion.
+
+            result =   (x * fma(detail::lgamma_taylor_series_expansion(x), x, -numbers::egamma_v<T>))
+                     - log(x);
+        }
+        else if (x < T { asymp_cutoff })
+        {
+            result = log(tgamma(x));
+        }
+        else
+        {
+            // Perform the Laurent series expansion. Do note, however, that
+            // the coefficients of the Laurent asymptotic expansion are exactly
+            // the same as those used for the tgamma() function.
+
+            constexpr T half { 5, -1 };
+
+            result =   (((x - half) * (log(x)) - x))
+                     + log(detail::tgamma_series_expansion_asymp(one / x));
+        }
+    }
+
+    return result;
+}
+
 template <typename T>
 constexpr auto lgamma_impl(T x) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
@@ -53,57 +109,20 @@ constexpr auto lgamma_impl(T x) noexcept
         // Pure negative integer argument.
         result = std::numeric_limits<T>::infinity();
     }
-    else if ((is_pure_int) && ((nx == 1) || (nx == 2)))
-    {
-        constexpr T zero { 0, 0 };
-
-        result = zero;
-    }
-    else
+    else if (signbit(x))
     {
+        // Reflection for negative argument.
         constexpr T one { 1, 0 };
 
-        if (signbit(x))
-        {
-            // Reflection for negative argument.
-            const auto za = -x + one;
+        const auto za = -x + one;
 
-            const auto phase = sin(numbers::pi_v<T> * za);
+        const auto phase = sin(numbers::pi_v<T> * za);
 
-            result = log(numbers::pi_v<T>) - log(abs(phase)) - lgamma(za);
-        }
-        else
-        {
-            constexpr int asymp_cutoff
-            {
-                  std::numeric_limits<T>::digits10 < 10 ? T {  2, 1 } //  20
-                : std::numeric_limits<T>::digits10 < 20 ? T {  5, 1 } //  50
-                :                                         T { 15, 1 } // 150
-            };
-
-            if (x < T { 2, -1 })
-            {
-                // Perform the Taylor series expansion.
-
-                result =   (x * fma(detail::lgamma_taylor_series_expansion(x), x, -numbers::egamma_v<T>))
-                         - log(x);
-            }
-            else if (x < T { asymp_cutoff })
-            {
-                result = log(tgamma(x));
-            }
-            else
-            {
-                // Perform the Laurent series expansion. Do note, however, that
-                // the coefficients of the Laurent asymptotic expansion are exactly
-                // the same as those used for the tgamma() function.
-
-                constexpr T half { 5, -1 };
-
-                result =   (((x - half) * (log(x)) - x))
-                         + log(detail::tgamma_series_expansion_asymp(one / x));
-            }
-        }
+        result = log(numbers::pi_v<T>) - log(abs(phase)) - lgamma(za);
+    }
+    else
+    {
+        result = lgamma_positive_impl(x);
     }
 
     return result;
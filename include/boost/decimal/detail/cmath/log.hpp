@@ -7,6 +7,7 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_LOG_HPP
 
 #include <boost/decimal/fwd.hpp> // NOLINT(llvm-include-order)
+#include <boost/decimal/detail/cmath/impl/log_impl.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
@@ -22,13 +23,35 @@ namespace decimal {
 
 namespace detail {
 
+// log of a positive normal argument, shared by log_impl and the batched log
+template <typename T>
+constexpr auto log_normal_impl(T x) noexcept -> T
+{
+    constexpr T near_one_lower { 9, -1 };
+    constexpr T near_one_upper { 11, -1 };
+
+    T result { };
+
+    if ((x > near_one_lower) && (x < near_one_upper))
+    {
+        result = detail::log_near_one(x);
+    }
+    else
+    {
+        // The natural logarithm is computed directly from the table of log(k/10),
+        // without going through log10.
+        const auto reduced { detail::log_table_reduction(x) };
+
+        result = fma(static_cast<T>(reduced.exp10), numbers::ln10_v<T>, reduced.log_c + reduced.log_ratio);
+    }
+
+    return result;
+}
+
 template <typename T>
 constexpr auto log_impl(T x) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
 {
-    constexpr T one  { 1, 0 };
-    constexpr T zero { 0, 0 };
-
     T result { };
 
     const auto fpc = fpclassify(x);
@@ -45,23 +68,9 @@ constexpr auto log_impl(T x) noexcept
     {
         result = std::numeric_limits<T>::infinity();
     }
-    else if (x < one)
-    {
-        // Handle reflection.
-        result = -log(one / x);
-    }
-    else if(x > one)
-    {
-        // Use the implementation of log10 in order to compute the natural
-        // logarithm. The base of the boost::decimal library is, in fact,
-        // base-10. And so, somewhat uncommonly, the fastest and most accurate
-        // logarithm in this system is log10 in base-10.
-
-        result = log10(x) * numbers::ln10_v<T>;
-    }
     else
     {
-        result = zero;
+        result = log_normal_impl(x);
     }
 
     return result;
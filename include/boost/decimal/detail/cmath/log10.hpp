@@ -27,8 +27,8 @@ template <typename T>
 constexpr auto log10_impl(T x) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
 {
-    constexpr T zero { 0, 0 };
-    constexpr T one  { 1, 0 };
+    constexpr T near_one_lower { 9, -1 };
+    constexpr T near_one_upper { 11, -1 };
 
     T result { };
 
@@ -69,52 +69,17 @@ constexpr auto log10_impl(T x) noexcept
         }
         else
         {
-            if (x < one)
+            if ((x > near_one_lower) && (x < near_one_upper))
             {
-                // Handle reflection.
-                result = -log10(one / x);
-            }
-            else if(x > one)
-            {
-                // The algorithm for base-10 logarithm is based on Chapter 5,
-                // pages 35-36 of Cody and Waite, "Software Manual for the
-                // Elementary Functions", Prentice Hall, 1980.
-
-                // In this implementation, however, we use 2s (as for natural
-                // logarithm in Cody and Waite) even though we are computing
-                // the base-10 logarithm.
-
-                T g { gn, -std::numeric_limits<T>::digits10 };
-
-                exp10val += std::numeric_limits<T>::digits10;
-
-                int reduce_sqrt2 { };
-
-                while (g < numbers::inv_sqrt2_v<T>)
-                {
-                    g += g;
-
-                    ++reduce_sqrt2;
-                }
-
-                const T s   { (g - one) / (g + one) };
-                const T z   { s + s };
-                const T zsq { z * z };
-
-                result = z * fma(detail::log_series_expansion(zsq), zsq, one);
-
-                result /= numbers::ln10_v<T>;
-
-                for(int i = 0; i < reduce_sqrt2; ++i)
-                {
-                    result -= numbers::log10_2_v<T>;
-                }
-
-                result += static_cast<T>(exp10val);
+                result = detail::log_near_one(x) * numbers::log10e_v<T>;
             }
             else
             {
-                result = zero;
+                // The reduction is shared with the natural logarithm: log(x) = exp10 * log(10) + log(c) + log(m/c),
+                // where only the fractional part log(c) + log(m/c) needs to be converted to base-10.
+                const auto reduced { detail::log_table_reduction(x) };
+
+                result = fma(reduced.log_c + reduced.log_ratio, numbers::log10e_v<T>, static_cast<T>(reduced.exp10));
             }
         }
     }
@@ -0,0 +1,336 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_NORMAL_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_NORMAL_HPP
+
+#include <boost/decimal/decimal128.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/promotion.hpp>
+#include <boost/decimal/detail/cmath/erf.hpp>
+#include <boost/decimal/detail/cmath/exp.hpp>
+#include <boost/decimal/detail/cmath/fabs.hpp>
+#include <boost/decimal/detail/cmath/log.hpp>
+#include <boost/decimal/detail/cmath/sqrt.hpp>
+#include <boost/decimal/detail/cmath/impl/evaluate_polynomial.hpp>
+#include <boost/decimal/numbers.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <array>
+#include <limits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+BOOST_DECIMAL_CONSTEXPR_VARIABLE T inv_sqrt_2pi_v = T{UINT64_C(3989422804014326779), -19};
+
+template <>
+BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 inv_sqrt_2pi_v<decimal128> = decimal128{uint128{UINT64_C(216267043553777),
+                                                                                                           UINT64_C(5417644614746090187)}, -34};
+
+// exp(-x * x / 2) from the exact square of the leading digits of x, see split_for_square
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto exp_neg_half_square(T x) noexcept -> T
+{
+    T hi {};
+    T lo {};
+    split_for_square(x, hi, lo);
+
+    const T e {exp(-(hi * hi / 2))};
+
+    // Arguments with few digits, such as 1.25, have nothing left to correct
+    return lo == T{0, 0} ? e : e * exp(-((hi + lo / 2) * lo));
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto normal_pdf_impl(T x) noexcept -> T
+{
+    const auto fpc {fpclassify(x)};
+
+    if (fpc == FP_NAN)
+    {
+        return x;
+    }
+    else if (fpc == FP_INFINITE)
+    {
+        return T{0, 0};
+    }
+
+    return inv_sqrt_2pi_v<T> * exp_neg_half_square(x);
+}
+
+// The lower tail 0.5 * erfc(|x| / sqrt(2)) for z = |x| / sqrt(2) >= 0.5, where e = exp(-x * x / 2).
+// The rational approximations of erf.hpp only see the rounding of z,
+// while the exponential factor is taken from x itself, so the tail keeps its relative precision.
+// For large z the tail is close to exp(-z * z) / (2 * sqrt(pi) * z), so it is a normal number of T
+// while z * z <= (-emin - 3) * ln(10). Beyond that it is flushed to zero,
+// since the arithmetic does not round results into the subnormal range
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto normal_tail_impl(T z, T e) noexcept -> T
+{
+    constexpr T half {5, -1};
+    constexpr T max_square {T{-3 - emin_v<T>} * numbers::ln10_v<T>};
+
+    if (z * z > max_square)
+    {
+        return T{0, 0};
+    }
+
+    return half * erfc_rational_impl(z) / z * e;
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto normal_cdf_impl(T x) noexcept -> T
+{
+    constexpr T half {5, -1};
+    constexpr T one {1, 0};
+
+    const auto fpc {fpclassify(x)};
+
+    if (fpc == FP_NAN)
+    {
+        return x;
+    }
+    else if (fpc == FP_INFINITE)
+    {
+        return signbit(x) ? T{0, 0} : one;
+    }
+
+    const T z {fabs(x) * numbers::inv_sqrt2_v<T>};
+
+    if (z < half)
+    {
+        return half + half * erf_calc_impl(x * numbers::inv_sqrt2_v<T>, false);
+    }
+
+    const T tail {normal_tail_impl(z, exp_neg_half_square(x))};
+
+    return signbit(x) ? tail : one - tail;
+}
+
+// Wichura, M.J. (1988), Algorithm AS 241: The Percentage Points of the Normal Distribution,
+// Applied Statistics 37(3), 477-484. Relative error about 1e-16, for 0 < p <= 0.5
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto normal_quantile_estimate(T p) noexcept -> T
+{
+    constexpr T half {5, -1};
+
+    const T q {p - half};
+
+    if (q >= T{425, -3, true})
+    {
+        constexpr std::array<T, 8> P = {
+            T{UINT64_C(3387132872796366608), -18},
+            T{UINT64_C(1331416678917843774), -16},
+            T{UINT64_C(1971590950306551443), -15},
+            T{UINT64_C(1373169376550946112), -14},
+            T{UINT64_C(4592195393154987146), -14},
+            T{UINT64_C(6726577092700870085), -14},
+            T{UINT64_C(3343057558358812810), -14},
+            T{UINT64_C(2509080928730122673), -15}
+        };
+        constexpr std::array<T, 8> Q = {
+            T{1, 0},
+            T{UINT64_C(4231333070160091125), -17},
+            T{UINT64_C(6871870074920579083), -16},
+            T{UINT64_C(5394196021424751108), -15},
+            T{UINT64_C(2121379430158659587), -14},
+            T{UINT64_C(3930789580009271061), -14},
+            T{UINT64_C(2872908573572194267), -14},
+            T{UINT64_C(5226495278852854561), -15}
+        };
+
+        const T r {T{180625, -6} - q * q};
+
+        return q * tools::evaluate_polynomial(P, r) / tools::evaluate_polynomial(Q, r);
+    }
+
+    T r {sqrt(-log(p))};
+    T result {};
+
+    if (r <= T{5})
+    {
+        constexpr std::array<T, 8> P = {
+            T{UINT64_C(1423437110749683577), -18},
+            T{UINT64_C(4630337846156545296), -18},
+            T{UINT64_C(5769497221460691406), -18},
+            T{UINT64_C(3647848324763204605), -18},
+            T{UINT64_C(1270458252452368383), -18},
+            T{UINT64_C(2417807251774506118), -19},
+            T{UINT64_C(2272384498926918458), -20},
+            T{UINT64_C(7745450142783414076), -22}
+        };
+        constexpr std::array<T, 8> Q = {
+            T{1, 0},
+            T{UINT64_C(2053191626637758822), -18},
+            T{UINT64_C(1676384830183803849), -18},
+            T{UINT64_C(6897673349851000046), -19},
+            T{UINT64_C(1481039764274800746), -19},
+            T{UINT64_C(1519866656361645720), -20},
+            T{UINT64_C(5475938084995344946), -22},
+            T{UINT64_C(1050750071644416843), -27}
+        };
+
+        r -= T{16, -1};
+        result = tools::evaluate_polynomial(P, r) / tools::evaluate_polynomial(Q, r);
+    }
+    else
+    {
+        constexpr std::array<T, 8> P = {
+            T{UINT64_C(6657904643501103777), -18},
+            T{UINT64_C(5463784911164114370), -18},
+            T{UINT64_C(1784826539917291336), -18},
+            T{UINT64_C(2965605718285048912), -19},
+            T{UINT64_C(2653218952657612309), -20},
+            T{UINT64_C(1242660947388078439), -21},
+            T{UINT64_C(2711555568743487578), -23},
+            T{UINT64_C(2010334399292288133), -25}
+        };
+        constexpr std::array<T, 8> Q = {
+            T{1, 0},
+            T{UINT64_C(5998322065558879377), -19},
+            T{UINT64_C(1369298809227358053), -19},
+            T{UINT64_C(1487536129085061485), -20},
+            T{UINT64_C(7868691311456132591), -22},
+            T{UINT64_C(1846318317510054682), -23},
+            T{UINT64_C(1421511758316445889), -25},
+            T{UINT64_C(2044263103389939786), -33}
+        };
+
+        r -= T{5};
+        result = tools::evaluate_polynomial(P, r) / tools::evaluate_polynomial(Q, r);
+    }
+
+    return -result;
+}
+
+template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE T>
+constexpr auto normal_quantile_impl(T p) noexcept -> T
+{
+    constexpr T zero {0, 0};
+    constexpr T half {5, -1};
+    constexpr T one {1, 0};
+
+    if (isnan(p) || p < zero || p > one)
+    {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+    else if (p == zero)
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+    else if (p == one)
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+
+    // The quantile is solved in the lower half, where 1 - p is exact for p > 0.5
+    const bool upper {p > half};
+    const T q {upper ? one - p : p};
+
+    T x {normal_quantile_estimate(q)};
+
+    // Halley's iteration triples the correct digits of the estimate, so decimal32 needs none
+    // and decimal64 and decimal128 one step. The residual is formed without cancellation:
+    // from erf in the center, where x is small, and from the relative precision of the tail otherwise
+    constexpr int steps {std::numeric_limits<T>::digits10 < 9 ? 0 : 1};
+
+    for (int i {}; i < steps; ++i)
+    {
+        const T z {fabs(x) * numbers::inv_sqrt2_v<T>};
+        const T e {exp_neg_half_square(x)};
+
+        if (e == zero)
+        {
+            break;
+        }
+
+        const T residual {z < half ? half * erf_calc_impl(x * numbers::inv_sqrt2_v<T>, false) - (q - half)
+                                   : normal_tail_impl(z, e) - q};
+
+        const T u {residual / (inv_sqrt_2pi_v<T> * e)};
+
+        x -= u / (one + x * u / 2);
+    }
+
+    return upper ? -x : x;
+}
+
+} //namespace detail
+
+// Density, cumulative distribution and quantile function of the standard normal distribution
+
+BOOST_DECIMAL_EXPORT template <typename T>
+constexpr auto normal_pdf(T x) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    #if BOOST_DECIMAL_DEC_EVAL_METHOD == 0
+
+    using evaluation_type = T;
+
+    #elif BOOST_DECIMAL_DEC_EVAL_METHOD == 1
+
+    using evaluation_type = detail::promote_args_t<T, decimal64>;
+
+    #else // BOOST_DECIMAL_DEC_EVAL_METHOD == 2
+
+    using evaluation_type = detail::promote_args_t<T, decimal128>;
+
+    #endif
+
+    return static_cast<T>(detail::normal_pdf_impl(static_cast<evaluation_type>(x)));
+}
+
+BOOST_DECIMAL_EXPORT template <typename T>
+constexpr auto normal_cdf(T x) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    #if BOOST_DECIMAL_DEC_EVAL_METHOD == 0
+
+    using evaluation_type = T;
+
+    #elif BOOST_DECIMAL_DEC_EVAL_METHOD == 1
+
+    using evaluation_type = detail::promote_args_t<T, decimal64>;
+
+    #else // BOOST_DECIMAL_DEC_EVAL_METHOD == 2
+
+    using evaluation_type = detail::promote_args_t<T, decimal128>;
+
+    #endif
+
+    return static_cast<T>(detail::normal_cdf_impl(static_cast<evaluation_type>(x)));
+}
+
+BOOST_DECIMAL_EXPORT template <typename T>
+constexpr auto normal_quantile(T p) noexcept
+    BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
+{
+    #if BOOST_DECIMAL_DEC_EVAL_METHOD == 0
+
+    using evaluation_type = T;
+
+    #elif BOOST_DECIMAL_DEC_EVAL_METHOD == 1
+
+    using evaluation_type = detail::promote_args_t<T, decimal64>;
+
+    #else // BOOST_DECIMAL_DEC_EVAL_METHOD == 2
+
+    using evaluation_type = detail::promote_args_t<T, decimal128>;
+
+    #endif
+
+    return static_cast<T>(detail::normal_quantile_impl(static_cast<evaluation_type>(p)));
+}
+
+} //namespace decimal
+} //namespace boost
+
+#endif //BOOST_DECIMAL_DETAIL_CMATH_NORMAL_HPP
@@ -8,6 +8,7 @@
 
 #include <boost/decimal/fwd.hpp> // NOLINT(llvm-include-order)
 #include <boost/decimal/detail/cmath/impl/pow_impl.hpp>
+#include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
@@ -139,13 +140,32 @@ constexpr auto pow(T b, IntegralType p) noexcept
 
             if(is_pure)
             {
-                // Here, a pure power-of-10 argument (b) gets a pure integral result.
+                // Here, a pure power-of-10 argument (b) gets a pure integral result,
+                // which only requires editing the exponent.
                 const int log10_val { exp10val + static_cast<int>(zeros_removal.number_of_removed_zeros) };
 
-                result = T { 1, static_cast<int>(log10_val * static_cast<int>(p)) };
+                // Powers beyond this bound overflow or underflow for any log10_val != 0
+                constexpr std::int64_t p_bound { 4 * (detail::bias_v<T> + std::numeric_limits<T>::digits10) };
+
+                const auto up { detail::make_positive_unsigned(p) };
+
+                auto p_clamped = static_cast<std::int64_t>((up > static_cast<std::uint64_t>(p_bound)) ? static_cast<std::uint64_t>(p_bound) : static_cast<std::uint64_t>(up));
+
+                if (p < static_cast<local_integral_type>(UINT8_C(0)))
+                {
+                    p_clamped = -p_clamped;
+                }
+
+                const bool isneg { signbit(b) && ((up & 1U) != 0U) };
+
+                result = detail::make_decimal_with_underflow<T>(UINT64_C(1), static_cast<std::int64_t>(log10_val) * p_clamped, isneg);
             }
             else
             {
+                // The power is accumulated in a wider significand and rounded once at the end
+                const auto sig = static_cast<typename T::significand_type>(zeros_removal.trimmed_number);
+                const int  sig_exp { exp10val + static_cast<int>(zeros_removal.number_of_removed_zeros) };
+
                 BOOST_DECIMAL_IF_CONSTEXPR (std::is_signed<local_integral_type>::value)
                 {
                     if(p < static_cast<local_integral_type>(UINT8_C(0)))
@@ -157,16 +177,16 @@ constexpr auto pow(T b, IntegralType p) noexcept
                                 + static_cast<local_unsigned_integral_type>(UINT8_C(1))
                             );
 
-                        result = one / detail::pow_n_impl(b, up);
+                        result = detail::pow_n_wide_impl<T>(sig, sig_exp, signbit(b), up, true);
                     }
                     else
                     {
-                        result = detail::pow_n_impl(b, static_cast<local_unsigned_integral_type>(p));
+                        result = detail::pow_n_wide_impl<T>(sig, sig_exp, signbit(b), static_cast<local_unsigned_integral_type>(p));
                     }
                 }
                 else
                 {
-                    result = detail::pow_n_impl(b, static_cast<local_unsigned_integral_type>(p));
+                    result = detail::pow_n_wide_impl<T>(sig, sig_exp, signbit(b), static_cast<local_unsigned_integral_type>(p));
                 }
             }
         }
@@ -192,6 +212,7 @@ constexpr auto pow(T x, T a) noexcept
     else
     {
         constexpr T one  { 1, 0 };
+        constexpr T half { 5, -1 };
 
         const auto fpc_x = fpclassify(x);
         const auto fpc_a = fpclassify(a);
@@ -252,6 +273,10 @@ constexpr auto pow(T x, T a) noexcept
                         : one
                     );
             }
+            else if (a == half)
+            {
+                result = sqrt(x);
+            }
             else
             {
                 const auto a_log_x = a * log(x);
@@ -0,0 +1,111 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CMATH_SINCOS_HPP
+#define BOOST_DECIMAL_DETAIL_CMATH_SINCOS_HPP
+
+#include <boost/decimal/fwd.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/promotion.hpp>
+#include <boost/decimal/detail/cmath/sin.hpp>
+#include <boost/decimal/detail/cmath/cos.hpp>
+#include <boost/decimal/detail/cmath/impl/trig_reduction.hpp>
+#include <boost/decimal/detail/cmath/impl/sin_impl.hpp>
+#include <boost/decimal/detail/cmath/impl/cos_impl.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <limits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+// sin(x) and cos(x) from one argument reduction, with the same results as sin_impl and cos_impl
+template <typename T>
+constexpr auto sincos_impl(T x, T* sin_result, T* cos_result) noexcept -> void
+{
+    const auto fpc = fpclassify(x);
+
+    if (fabs(x) < std::numeric_limits<T>::epsilon() || (fpc == FP_INFINITE) || (fpc == FP_NAN))
+    {
+        *sin_result = sin_impl(x);
+        *cos_result = cos_impl(x);
+        return;
+    }
+
+    const bool negative {signbit(x)};
+
+    int k {};
+    const auto r {detail::trig_reduce_fixed_point(abs(x), &k)};
+
+    const auto sin_r {detail::sin_series_expansion(r)};
+    const auto cos_r {detail::cos_series_expansion(r)};
+
+    // See the table of sin_impl
+    switch (static_cast<unsigned>(k % 4))
+    {
+        case 3U:
+            *sin_result = -cos_r;
+            *cos_result = sin_r;
+            break;
+        case 2U:
+            *sin_result = -sin_r;
+            *cos_result = -cos_r;
+            break;
+        case 1U:
+            *sin_result = cos_r;
+            *cos_result = -sin_r;
+            break;
+        case 0U:
+        default:
+            *sin_result = sin_r;
+            *cos_result = cos_r;
+            break;
+    }
+
+    if (negative)
+    {
+        *sin_result = -*sin_result;
+    }
+}
+
+} // namespace detail
+
+// Stores sin(x) in *sin_result and cos(x) in *cos_result,
+// which costs about as much as one of them for large arguments
+BOOST_DECIMAL_EXPORT template <typename T>
+constexpr auto sincos(T x, T* sin_result, T* cos_result) noexcept
+    BOOST_DECIMAL_REQUIRES_RETURN(detail::is_decimal_floating_point_v, T, void)
+{
+    #if BOOST_DECIMAL_DEC_EVAL_METHOD == 0
+
+    using evaluation_type = T;
+
+    #elif BOOST_DECIMAL_DEC_EVAL_METHOD == 1
+
+    using evaluation_type = detail::promote_args_t<T, decimal64>;
+
+    #else // BOOST_DECIMAL_DEC_EVAL_METHOD == 2
+
+    using evaluation_type = detail::promote_args_t<T, decimal128>;
+
+    #endif
+
+    evaluation_type s {};
+    evaluation_type c {};
+
+    detail::sincos_impl(static_cast<evaluation_type>(x), &s, &c);
+
+    *sin_result = static_cast<T>(s);
+    *cos_result = static_cast<T>(c);
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CMATH_SINCOS_HPP
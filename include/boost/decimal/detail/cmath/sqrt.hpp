@@ -10,6 +10,7 @@
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/cmath/impl/integer_roots.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <type_traits>
@@ -22,6 +23,48 @@ namespace decimal {
 
 namespace detail {
 
+// sqrt of a positive normal argument, shared by sqrt_impl and the batched sqrt
+template <typename T>
+constexpr auto sqrt_normal_impl(T x) noexcept -> T
+{
+    // With x = gn * 10^exp10val, the significand is shifted by a power of ten
+    // that leaves an even exponent and gives the root one digit more than T.
+    // The integer square root is then exact up to that guard digit,
+    // and the result is rounded only once when it is converted to T.
+
+    using integer_type = isqrt_integer_t<T>;
+
+    constexpr int digits { std::numeric_limits<T>::digits10 };
+
+    int exp10val { };
+
+    const auto gn { frexp10(x, &exp10val) };
+
+    int shift { digits + 1 };
+
+    if (((exp10val - shift) & 1) != 0)
+    {
+        ++shift;
+    }
+
+    const auto n { mul_pow10<integer_type>(gn, shift) };
+
+    auto root { isqrt(n) };
+
+    // Mark an inexact root that ends with 0 or 5, so that the final rounding
+    // does not mistake it for an exact or a halfway value
+    const auto last_digit { static_cast<unsigned>(narrow_root(root % UINT64_C(10))) };
+
+    auto sig { narrow_root(root) };
+
+    if (((last_digit == 0U) || (last_digit == 5U)) && (root * root != n))
+    {
+        ++sig;
+    }
+
+    return T { sig, (exp10val - shift) / 2 };
+}
+
 template <typename T>
 constexpr auto sqrt_impl(T x) noexcept
     BOOST_DECIMAL_REQUIRES(detail::is_decimal_floating_point_v, T)
@@ -44,111 +87,7 @@ constexpr auto sqrt_impl(T x) noexcept
     }
     else
     {
-        int exp10val { };
-
-        const auto gn { frexp10(x, &exp10val) };
-
-        const auto
-            zeros_removal
-            {
-                remove_trailing_zeros(gn)
-            };
-
-        const bool is_pure { static_cast<unsigned>(zeros_removal.trimmed_number) == 1U };
-
-        constexpr T one { 1 };
-
-        if(is_pure)
-        {
-            // Here, a pure power-of-10 argument gets a straightforward result.
-            // For argument 10^n where n is even, the result is exact.
-
-            const int p10 { exp10val + static_cast<int>(zeros_removal.number_of_removed_zeros) };
-
-            if (p10 == 0)
-            {
-                result = one;
-            }
-            else
-            {
-                const int p10_mod2 = (p10 % 2);
-
-                result = T { 1, p10 / 2 };
-
-                if (p10_mod2 == 1)
-                {
-                    result *= numbers::sqrt10_v<T>;
-                }
-                else if (p10_mod2 == -1)
-                {
-                    result /= numbers::sqrt10_v<T>;
-                }
-            }
-        }
-        else
-        {
-            // Scale the argument to the interval 1/10 <= x < 1.
-            T gx { gn, -std::numeric_limits<T>::digits10 };
-
-            exp10val += std::numeric_limits<T>::digits10;
-
-            // For this work we perform an order-2 Pade approximation of the square root
-            // at argument x = 1/2. This results in slightly more than 2 decimal digits
-            // of accuracy over the interval 1/10 <= x < 1.
-
-            // See also WolframAlpha at:
-            //   https://www.wolframalpha.com/input?i=FullSimplify%5BPadeApproximant%5BSqrt%5Bx%5D%2C+%7Bx%2C+1%2F2%2C+%7B2%2C+2%7D%7D%5D%5D
-
-            // PadeApproximant[Sqrt[x], {x, 1/2, {2, 2}}]
-            // FullSimplify[%]
-
-            // HornerForm[Numerator[Out[2]]]
-            // Results in:
-            //   1 + x (20 + 20 x)
-
-            // HornerForm[Denominator[Out[2]]]
-            // Results in:
-            //   5 Sqrt[2] + x (20 Sqrt[2] + 4 Sqrt[2] x)
-
-            constexpr T five { 5 };
-
-            result =
-                  (one + gx * ((one + gx) * 20))
-                / (numbers::sqrt2_v<T> * ((gx * 4) * (five + gx) + five));
-
-            // Perform 2, 3 or 4 Newton-Raphson iterations depending on precision.
-            // Note from above, we start with slightly more than 2 decimal digits
-            // of accuracy.
-
-            constexpr int iter_loops
-            {
-                  std::numeric_limits<T>::digits10 < 10 ? 2
-                : std::numeric_limits<T>::digits10 < 20 ? 3 : 4
-            };
-
-            for (int idx = 0; idx < iter_loops; ++idx)
-            {
-                result = (result + gx / result) / 2;
-            }
-
-            if (exp10val != 0)
-            {
-                // Rescale the result if necessary.
-
-                const int exp10val_mod2 = (exp10val % 2);
-
-                result *= T { 1, exp10val / 2 };
-
-                if (exp10val_mod2 == 1)
-                {
-                    result *= numbers::sqrt10_v<T>;
-                }
-                else if (exp10val_mod2 == -1)
-                {
-                    result /= numbers::sqrt10_v<T>;
-                }
-            }
-        }
+        result = sqrt_normal_impl(x);
     }
 
     return result;
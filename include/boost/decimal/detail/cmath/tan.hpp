@@ -12,7 +12,7 @@
 #include <boost/decimal/detail/concepts.hpp>
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/cmath/cos.hpp>
-#include <boost/decimal/detail/cmath/remquo.hpp>
+#include <boost/decimal/detail/cmath/impl/trig_reduction.hpp>
 #include <boost/decimal/detail/cmath/impl/sin_impl.hpp>
 #include <boost/decimal/detail/cmath/impl/cos_impl.hpp>
 
@@ -58,14 +58,8 @@ constexpr auto tan(T x) noexcept
         // | 2 | -sin(r) | -cos(r) |  sin(r)/cos(r) |
         // | 3 | -cos(r) |  sin(r) | -cos(r)/sin(r) |
 
-        #if (defined(_MSC_VER) && (_MSC_VER < 1920))
-        const auto my_pi_half = numbers::pi_v<T> / 2;
-        #else
-        constexpr auto my_pi_half = numbers::pi_v<T> / 2;
-        #endif
-
         int k { };
-        auto r { remquo(x, my_pi_half, &k) };
+        const auto r {detail::trig_reduce_fixed_point(x, &k)};
 
         const auto n = static_cast<unsigned>(k % 4);
 
@@ -7,6 +7,7 @@
 #define BOOST_DECIMAL_DETAIL_CMATH_TGAMMA_HPP
 
 #include <boost/decimal/fwd.hpp> // NOLINT(llvm-include-order)
+#include <boost/decimal/detail/cmath/impl/gamma_lookup.hpp>
 #include <boost/decimal/detail/cmath/impl/tgamma_impl.hpp>
 #include <boost/decimal/detail/cmath/sin.hpp>
 #include <boost/decimal/detail/config.hpp>
@@ -14,6 +15,7 @@
 #include <boost/decimal/numbers.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstddef>
 #include <iterator>
 #include <limits>
 #endif
@@ -68,14 +70,32 @@ constexpr auto tgamma_impl(T x) noexcept
         {
             constexpr T one { 1, 0 };
 
+            const auto& factorials = detail::factorial_table<T>();
+            const auto& half_integer_gammas = detail::half_integer_gamma_table<T>();
+
             if (is_pure_int)
             {
-                result = one;
+                // tgamma(n) = (n - 1)! is looked up, and only continued as a product beyond the table.
+                // The tables of decimal32 and decimal64 reach the largest finite factorial, so the product overflows at once
+                const auto table_size = static_cast<int>(factorials.size());
 
-                for(auto index = 2; index < nx; ++index)
+                if (nx <= table_size)
                 {
-                    result *= index;
+                    result = factorials[static_cast<std::size_t>(nx - 1)];
                 }
+                else
+                {
+                    result = factorials.back();
+
+                    for (auto index = table_size; (index < nx) && !isinf(result); ++index)
+                    {
+                        result *= index;
+                    }
+                }
+            }
+            else if ((nx < static_cast<int>(half_integer_gammas.size())) && ((x - nx) == T { 5, -1 }))
+            {
+                result = half_integer_gammas[static_cast<std::size_t>(nx)];
             }
             else
             {
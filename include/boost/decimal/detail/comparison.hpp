@@ -14,6 +14,8 @@
 #include <boost/decimal/detail/shrink_significand.hpp>
 #include <boost/decimal/detail/cmath/isfinite.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/attributes.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cstdint>
@@ -22,12 +24,73 @@
 namespace boost {
 namespace decimal {
 
+namespace detail {
+
+// Whether sig is in [1, max_sig], compared in the wider of the two types
+template <typename SigType, typename T>
+constexpr auto in_significand_range(T sig, SigType max_sig) noexcept -> bool
+{
+    return sizeof(T) > sizeof(SigType) ? (sig != 0U && sig <= static_cast<T>(max_sig))
+                                       : (static_cast<SigType>(sig) != 0U && static_cast<SigType>(sig) <= max_sig);
+}
+
+// The fast paths below apply when both significands are non-zero and have at most the precision of DecimalType,
+// which holds for every finite value of DecimalType itself. Zeros and the wider significands of the mixed
+// comparisons with integers take the normalizing path
+template <typename DecimalType, typename T1, typename T2>
+constexpr auto comparison_fast_path_applies(T1 lhs_sig, T2 rhs_sig) noexcept -> bool
+{
+    using sig_type = typename DecimalType::significand_type;
+
+    constexpr sig_type max_sig {static_cast<sig_type>(pow10(static_cast<sig_type>(precision_v<DecimalType>)) - 1U)};
+
+    return in_significand_range(lhs_sig, max_sig) && in_significand_range(rhs_sig, max_sig);
+}
+
+// Returns -1, 0 or 1 as lhs_sig * 10^lhs_exp is less than, equal to or greater than rhs_sig * 10^rhs_exp,
+// for significands in [1, 10^precision). Once the significand with the larger exponent reaches 10^(precision - gap)
+// its value is at least 10^precision units of the smaller exponent, which the other significand is below,
+// so at most one multiplication within the significand type is needed
+template <typename DecimalType, typename T>
+constexpr auto compare_magnitudes(T lhs_sig, std::int32_t lhs_exp, T rhs_sig, std::int32_t rhs_exp) noexcept -> int
+{
+    if (lhs_exp == rhs_exp)
+    {
+        return lhs_sig < rhs_sig ? -1 : static_cast<int>(lhs_sig != rhs_sig);
+    }
+
+    const bool lhs_is_wider {lhs_exp > rhs_exp};
+    const auto gap {lhs_is_wider ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
+    const int wider_sign {lhs_is_wider ? 1 : -1};
+
+    auto wider_sig {lhs_is_wider ? lhs_sig : rhs_sig};
+    const auto narrower_sig {lhs_is_wider ? rhs_sig : lhs_sig};
+
+    if (gap >= precision_v<DecimalType> || wider_sig >= pow10(static_cast<T>(precision_v<DecimalType> - gap)))
+    {
+        return wider_sign;
+    }
+
+    wider_sig *= pow10(static_cast<T>(gap));
+
+    return wider_sig == narrower_sig ? 0 : (wider_sig > narrower_sig ? wider_sign : -wider_sign);
+}
+
+} // namespace detail
+
 template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE DecimalType = decimal32, typename T1, typename T2>
 constexpr auto equal_parts_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
                                 T2 rhs_sig, std::int32_t rhs_exp, bool rhs_sign) noexcept -> bool
 {
     using sig_type = typename DecimalType::significand_type;
 
+    if (detail::comparison_fast_path_applies<DecimalType>(lhs_sig, rhs_sig))
+    {
+        return lhs_sign == rhs_sign &&
+               detail::compare_magnitudes<DecimalType>(static_cast<sig_type>(lhs_sig), lhs_exp,
+                                                       static_cast<sig_type>(rhs_sig), rhs_exp) == 0;
+    }
+
     auto new_lhs_sig {detail::shrink_significand<sig_type>(lhs_sig, lhs_exp)};
     auto new_rhs_sig {detail::shrink_significand<sig_type>(rhs_sig, rhs_exp)};
 
@@ -112,9 +175,18 @@ constexpr auto less_parts_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
 {
     const bool both_neg {lhs_sign && rhs_sign};
 
-    // Normalize the significands and exponents
     using sig_type = typename DecimalType::significand_type;
 
+    if (detail::comparison_fast_path_applies<DecimalType>(lhs_sig, rhs_sig))
+    {
+        const auto cmp {detail::compare_magnitudes<DecimalType>(static_cast<sig_type>(lhs_sig), lhs_exp,
+                                                                static_cast<sig_type>(rhs_sig), rhs_exp)};
+
+        return both_neg ? cmp > 0 : cmp < 0;
+    }
+
+    // Normalize the significands and exponents
+
     auto new_lhs_sig {detail::shrink_significand<sig_type>(lhs_sig, lhs_exp)};
     auto new_rhs_sig {detail::shrink_significand<sig_type>(rhs_sig, rhs_exp)};
 
@@ -193,6 +193,17 @@ typedef unsigned __int128 uint128_t;
 #  define BOOST_DECIMAL_HAS_SPACESHIP_OPERATOR
 #endif
 
+#if __has_include(<span>)
+#  if __cplusplus >= 202002L || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#    ifndef BOOST_DECIMAL_BUILD_MODULE
+#      include <span>
+#    endif
+#    if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+#      define BOOST_DECIMAL_HAS_STD_SPAN
+#    endif
+#  endif
+#endif
+
 // Is constant evaluated detection
 #ifdef __cpp_lib_is_constant_evaluated
 #  define BOOST_DECIMAL_HAS_IS_CONSTANT_EVALUATED
@@ -0,0 +1,51 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_CONVERSION_RESULT_HPP
+#define BOOST_DECIMAL_DETAIL_CONVERSION_RESULT_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <system_error>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+// The result of a conversion that reports its status in ec instead of errno
+BOOST_DECIMAL_EXPORT template <typename T>
+struct conversion_result
+{
+    T value;
+
+    // Values:
+    // 0 = no error
+    // EINVAL = invalid_argument
+    // ERANGE = result_out_of_range
+    std::errc ec;
+
+    // Only integer results are comparable, since comparing floating point values exactly is unreliable
+    // and a NaN result would never compare equal to itself
+    template <typename U = T, std::enable_if_t<detail::is_integral_v<U>, bool> = true>
+    friend constexpr auto operator==(const conversion_result& lhs, const conversion_result& rhs) noexcept -> bool
+    {
+        return lhs.value == rhs.value && lhs.ec == rhs.ec;
+    }
+
+    template <typename U = T, std::enable_if_t<detail::is_integral_v<U>, bool> = true>
+    friend constexpr auto operator!=(const conversion_result& lhs, const conversion_result& rhs) noexcept -> bool
+    {
+        return !(lhs == rhs); // NOLINT : Expression can not be simplified since this is the definition
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_CONVERSION_RESULT_HPP
@@ -0,0 +1,232 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
+#define BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
+
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/countl.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/emulated256.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+// Divides val by 10^digits for 0 <= digits <= 19.
+// Every case divides by a constant, which the compiler replaces with a multiplication by its reciprocal
+constexpr auto div_pow10(std::uint64_t val, int digits) noexcept -> std::uint64_t
+{
+    switch (digits)
+    {
+        case 0: return val;
+        case 1: return val / UINT64_C(10);
+        case 2: return val / UINT64_C(100);
+        case 3: return val / UINT64_C(1000);
+        case 4: return val / UINT64_C(10000);
+        case 5: return val / UINT64_C(100000);
+        case 6: return val / UINT64_C(1000000);
+        case 7: return val / UINT64_C(10000000);
+        case 8: return val / UINT64_C(100000000);
+        case 9: return val / UINT64_C(1000000000);
+        case 10: return val / UINT64_C(10000000000);
+        case 11: return val / UINT64_C(100000000000);
+        case 12: return val / UINT64_C(1000000000000);
+        case 13: return val / UINT64_C(10000000000000);
+        case 14: return val / UINT64_C(100000000000000);
+        case 15: return val / UINT64_C(1000000000000000);
+        case 16: return val / UINT64_C(10000000000000000);
+        case 17: return val / UINT64_C(100000000000000000);
+        case 18: return val / UINT64_C(1000000000000000000);
+        default: return val / UINT64_C(10000000000000000000);
+    }
+}
+
+// Reciprocals of the normalized powers of 10, v = floor((2^128 - 1) / (10^k << s)) - 2^64
+// where s is the number of leading zeros of 10^k.
+// See: N. Moller and T. Granlund, "Improved division by invariant integers", IEEE Transactions on Computers, 2011
+BOOST_DECIMAL_CONSTEXPR_VARIABLE std::uint64_t pow10_reciprocals[20] =
+{
+    UINT64_C(18446744073709551615), UINT64_C(11068046444225730969), UINT64_C(5165088340638674452),
+    UINT64_C(442721857769029238), UINT64_C(11776401416656177751), UINT64_C(5731772318583031878),
+    UINT64_C(896069040124515179), UINT64_C(12501756908424955256), UINT64_C(6312056711998053881),
+    UINT64_C(1360296554856532782), UINT64_C(13244520931996183421), UINT64_C(6906267930855036413),
+    UINT64_C(1835665529942118807), UINT64_C(14005111292133121062), UINT64_C(7514740218964586526),
+    UINT64_C(2322443360429758898), UINT64_C(14783955820913345206), UINT64_C(8137815841988765842),
+    UINT64_C(2820903858849102350), UINT64_C(15581492618384294730)
+};
+
+// Divides the two word value (u1, u0) by the normalized divisor d with its reciprocal v,
+// which needs u1 < d, using two multiplications instead of a 128-bit division
+constexpr auto div_2by1_preinv(std::uint64_t u1, std::uint64_t u0, std::uint64_t d, std::uint64_t v, std::uint64_t& r) noexcept -> std::uint64_t
+{
+    const auto p {umul128(v, u1)};
+    const auto q0 {p.low + u0};
+    auto q1 {p.high + u1 + static_cast<std::uint64_t>(q0 < u0) + 1U};
+
+    r = u0 - q1 * d;
+
+    if (r > q0)
+    {
+        --q1;
+        r += d;
+    }
+
+    if (BOOST_DECIMAL_UNLIKELY(r >= d))
+    {
+        ++q1;
+        r -= d;
+    }
+
+    return q1;
+}
+
+// Divides the words of val, from the most significant in words[0] to the least in words[N - 1],
+// in place by 10^digits for 0 <= digits <= 19
+template <std::size_t N>
+constexpr auto div_pow10_words(std::uint64_t (&words)[N], int digits) noexcept -> void
+{
+    const auto shift {countl_zero(powers_of_10[static_cast<std::size_t>(digits)])};
+    const auto d {powers_of_10[static_cast<std::size_t>(digits)] << shift};
+    const auto v {pow10_reciprocals[static_cast<std::size_t>(digits)]};
+
+    // The bits shifted out of the top word are below 2^shift <= d
+    std::uint64_t r {shift == 0 ? UINT64_C(0) : words[0] >> (64 - shift)};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        const auto next {i + 1U < N ? words[i + 1U] : UINT64_C(0)};
+        const auto u0 {shift == 0 ? words[i] : (words[i] << shift) | (next >> (64 - shift))};
+        words[i] = div_2by1_preinv(r, u0, d, v, r);
+    }
+}
+
+// Divides val by 10^digits for 0 <= digits <= 38.
+// The emulated division falls back to a long division for any divisor above 2^32,
+// which this replaces with one or two passes of the division by a precomputed reciprocal
+constexpr auto div_pow10(uint128 val, int digits) noexcept -> uint128
+{
+    std::uint64_t words[2] {val.high, val.low};
+
+    for (; digits > 19; digits -= 19)
+    {
+        div_pow10_words(words, 19);
+    }
+    div_pow10_words(words, digits);
+
+    return uint128 {words[0], words[1]};
+}
+
+// Divides val by 10^digits for 0 <= digits <= 77
+constexpr auto div_pow10(const uint256_t& val, int digits) noexcept -> uint256_t
+{
+    std::uint64_t words[4] {val.high.high, val.high.low, val.low.high, val.low.low};
+
+    for (; digits > 19; digits -= 19)
+    {
+        div_pow10_words(words, 19);
+    }
+    div_pow10_words(words, digits);
+
+    return uint256_t {uint128 {words[0], words[1]}, uint128 {words[2], words[3]}};
+}
+
+// Removes the lowest digits of sig but one, which is kept as the guard digit for fenv_round.
+// An inexact guard digit of 0 or 5 is marked by adding one,
+// so that the rounding does not mistake the result for an exact or a halfway value
+template <typename Unsigned, std::enable_if_t<std::is_unsigned<Unsigned>::value && sizeof(Unsigned) <= sizeof(std::uint64_t), bool> = true>
+constexpr auto div_pow10_to_guard_digit(Unsigned sig, int digits) noexcept -> Unsigned
+{
+    if (digits - 1 > 19)
+    {
+        return sig == 0U ? Unsigned {0U} : Unsigned {1U};
+    }
+
+    const auto wide_sig {static_cast<std::uint64_t>(sig)};
+    auto res {div_pow10(wide_sig, digits - 1)};
+
+    if (res * powers_of_10[static_cast<std::size_t>(digits - 1)] != wide_sig)
+    {
+        const auto guard_digit {res % 10U};
+        if (guard_digit == 0U || guard_digit == 5U)
+        {
+            ++res;
+        }
+    }
+
+    return static_cast<Unsigned>(res);
+}
+
+// 128-bit values that fit in 64 bits take the path above, and the rest are divided in full width
+template <typename Unsigned, std::enable_if_t<!(std::is_unsigned<Unsigned>::value && sizeof(Unsigned) <= sizeof(std::uint64_t)), bool> = true>
+constexpr auto div_pow10_to_guard_digit(Unsigned sig, int digits) noexcept -> Unsigned
+{
+    if (sig <= Unsigned {UINT64_MAX})
+    {
+        return Unsigned {div_pow10_to_guard_digit(static_cast<std::uint64_t>(sig), digits)};
+    }
+    else if (digits - 1 > 38)
+    {
+        return Unsigned {1U};
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_INT128
+    // The builtin division is much faster than that of the emulated type
+    using wide_type = uint128_t;
+    #else
+    using wide_type = Unsigned;
+    #endif
+
+    const auto wide_sig {static_cast<wide_type>(sig)};
+    const auto divisor {pow10(static_cast<wide_type>(digits - 1))};
+    auto res {static_cast<wide_type>(wide_sig / divisor)};
+
+    if (res * divisor != wide_sig)
+    {
+        const auto guard_digit {static_cast<unsigned>(res % wide_type {10U})};
+        if (guard_digit == 0U || guard_digit == 5U)
+        {
+            ++res;
+        }
+    }
+
+    return static_cast<Unsigned>(res);
+}
+
+// The largest magnitude of a value of the signed type Int with the given sign,
+// which for negative values is one more than for positive
+template <typename Int>
+constexpr auto max_magnitude(bool is_neg) noexcept -> std::make_unsigned_t<Int>
+{
+    using unsigned_type = std::make_unsigned_t<Int>;
+    return static_cast<unsigned_type>(static_cast<unsigned_type>((std::numeric_limits<Int>::max)()) + (is_neg ? 1U : 0U));
+}
+
+// The value of Int with the given sign and magnitude, which has to be at most max_magnitude<Int>(is_neg)
+template <typename Int>
+constexpr auto from_magnitude(std::make_unsigned_t<Int> mag, bool is_neg) noexcept -> Int
+{
+    // The magnitude of the smallest value is not representable in Int
+    return is_neg && mag != 0U ? static_cast<Int>(-static_cast<Int>(mag - 1U) - 1) : static_cast<Int>(mag);
+}
+
+// The value of Int that a result out of range with the given sign saturates to
+template <typename Int>
+constexpr auto saturated_value(bool is_neg) noexcept -> Int
+{
+    return is_neg ? (std::numeric_limits<Int>::min)() : (std::numeric_limits<Int>::max)();
+}
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_DIV_POW10_HPP
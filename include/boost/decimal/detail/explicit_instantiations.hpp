@@ -0,0 +1,133 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_EXPLICIT_INSTANTIATIONS_HPP
+#define BOOST_DECIMAL_DETAIL_EXPLICIT_INSTANTIATIONS_HPP
+
+// The function templates that are explicitly instantiated by the compiled library (see src/).
+// Each list is expanded once with EXTERN = extern to declare the instantiations in the headers,
+// and once with EXTERN empty to define them in the library.
+//
+// Only the templates that are instantiated by nearly every user are listed,
+// the rest are still implicitly instantiated on use.
+
+// Functions that are available for every decimal type
+#define BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(EXTERN, T) \
+    EXTERN template T ceil(T) noexcept; \
+    EXTERN template T fabs(T) noexcept; \
+    EXTERN template T floor(T) noexcept; \
+    EXTERN template T nearbyint(T) noexcept; \
+    EXTERN template T rint(T) noexcept; \
+    EXTERN template T round(T) noexcept; \
+    EXTERN template T sqrt(T) noexcept; \
+    EXTERN template T cbrt(T) noexcept; \
+    EXTERN template T trunc(T) noexcept; \
+    EXTERN template T fdim(T, T) noexcept; \
+    EXTERN template T fmod(T, T) noexcept; \
+    EXTERN template T hypot(T, T) noexcept; \
+    EXTERN template T remainder(T, T) noexcept; \
+    EXTERN template T pow(T, int) noexcept; \
+    namespace detail { \
+    EXTERN template from_chars_result from_chars_general_impl(const char*, const char*, T&, chars_format) noexcept; \
+    EXTERN template to_chars_result to_chars_impl(char*, char*, T, chars_format, int) noexcept; \
+    EXTERN template T strtod_impl(const char*, char**) noexcept; \
+    }
+
+// Functions that are not yet available for decimal32_fast
+#define BOOST_DECIMAL_DETAIL_INSTANTIATE_TRANSCENDENTAL(EXTERN, T) \
+    EXTERN template T acos(T) noexcept; \
+    EXTERN template T acosh(T) noexcept; \
+    EXTERN template T asin(T) noexcept; \
+    EXTERN template T asinh(T) noexcept; \
+    EXTERN template T atan(T) noexcept; \
+    EXTERN template T atanh(T) noexcept; \
+    EXTERN template T cos(T) noexcept; \
+    EXTERN template T cosh(T) noexcept; \
+    EXTERN template T erf(T) noexcept; \
+    EXTERN template T erfc(T) noexcept; \
+    EXTERN template T exp(T) noexcept; \
+    EXTERN template T exp2(T) noexcept; \
+    EXTERN template T expm1(T) noexcept; \
+    EXTERN template T lgamma(T) noexcept; \
+    EXTERN template T log(T) noexcept; \
+    EXTERN template T log10(T) noexcept; \
+    EXTERN template T log1p(T) noexcept; \
+    EXTERN template T log2(T) noexcept; \
+    EXTERN template T sin(T) noexcept; \
+    EXTERN template T sinh(T) noexcept; \
+    EXTERN template T tan(T) noexcept; \
+    EXTERN template T tanh(T) noexcept; \
+    EXTERN template T tgamma(T) noexcept; \
+    EXTERN template T atan2(T, T) noexcept; \
+    EXTERN template T pow(T, T) noexcept;
+
+#define BOOST_DECIMAL_DETAIL_INSTANTIATE_ALL(EXTERN) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(EXTERN, decimal32) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(EXTERN, decimal64) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(EXTERN, decimal128) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(EXTERN, decimal32_fast) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_TRANSCENDENTAL(EXTERN, decimal32) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_TRANSCENDENTAL(EXTERN, decimal64) \
+    BOOST_DECIMAL_DETAIL_INSTANTIATE_TRANSCENDENTAL(EXTERN, decimal128)
+
+// The settings that change the definitions of the instantiated functions are recorded in the name of a function
+// that the compiled library defines, and which every translation unit using its instantiations calls.
+// A program whose settings differ from those of the library then fails to link instead of mixing definitions
+#ifdef BOOST_DECIMAL_FINITE_ONLY
+#  define BOOST_DECIMAL_DETAIL_FINITE_ONLY_TAG finite_only
+#else
+#  define BOOST_DECIMAL_DETAIL_FINITE_ONLY_TAG all_values
+#endif
+
+#ifdef BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+#  define BOOST_DECIMAL_DETAIL_INSTRUMENTATION_TAG instrumented
+#else
+#  define BOOST_DECIMAL_DETAIL_INSTRUMENTATION_TAG uninstrumented
+#endif
+
+#define BOOST_DECIMAL_DETAIL_SETTINGS_NAME_IMPL(finite, instrumentation, eval_method) \
+    compiled_with_##finite##_##instrumentation##_eval_method_##eval_method
+#define BOOST_DECIMAL_DETAIL_SETTINGS_NAME(finite, instrumentation, eval_method) \
+    BOOST_DECIMAL_DETAIL_SETTINGS_NAME_IMPL(finite, instrumentation, eval_method)
+
+#define BOOST_DECIMAL_DETAIL_COMPILED_SETTINGS \
+    BOOST_DECIMAL_DETAIL_SETTINGS_NAME(BOOST_DECIMAL_DETAIL_FINITE_ONLY_TAG, \
+                                       BOOST_DECIMAL_DETAIL_INSTRUMENTATION_TAG, \
+                                       BOOST_DECIMAL_DEC_EVAL_METHOD)
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+
+namespace boost {
+namespace decimal {
+namespace detail {
+
+auto BOOST_DECIMAL_DETAIL_COMPILED_SETTINGS() noexcept -> int;
+
+} // namespace detail
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_BUILD_MODULE
+
+#if defined(BOOST_DECIMAL_EXTERN_TEMPLATES) && !defined(BOOST_DECIMAL_BUILD_MODULE)
+
+namespace boost {
+namespace decimal {
+
+BOOST_DECIMAL_DETAIL_INSTANTIATE_ALL(extern)
+
+namespace detail {
+namespace {
+
+BOOST_DECIMAL_ATTRIBUTE_UNUSED const int compiled_settings_check {BOOST_DECIMAL_DETAIL_COMPILED_SETTINGS()};
+
+} // namespace
+} // namespace detail
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_EXTERN_TEMPLATES
+
+#endif // BOOST_DECIMAL_DETAIL_EXPLICIT_INSTANTIATIONS_HPP
@@ -9,6 +9,7 @@
 #include <boost/decimal/detail/attributes.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
 #include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/instrumentation.hpp>
 
 namespace boost {
 namespace decimal {
@@ -20,6 +21,8 @@ namespace detail {
 template <typename TargetType = decimal32, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
 constexpr auto fenv_round(T& val, bool = false) noexcept -> int
 {
+    BOOST_DECIMAL_INSTRUMENT(fenv_round_calls);
+
     using significand_type = std::conditional_t<std::is_same<TargetType, decimal128>::value, detail::uint128, int>;
 
     const auto trailing_num {val % 10};
@@ -46,6 +49,8 @@ constexpr auto fenv_round(T& val, bool = false) noexcept -> int
 template <typename TargetType = decimal32, typename T, std::enable_if_t<is_integral_v<T>, bool> = true>
 constexpr auto fenv_round(T& val, bool is_neg = false) noexcept -> int // NOLINT(readability-function-cognitive-complexity)
 {
+    BOOST_DECIMAL_INSTRUMENT(fenv_round_calls);
+
     using significand_type = std::conditional_t<std::is_same<TargetType, decimal128>::value, detail::uint128, int>;
 
     if (BOOST_DECIMAL_IS_CONSTANT_EVALUATED(coeff))
@@ -0,0 +1,40 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_FROM_COMPONENTS_HPP
+#define BOOST_DECIMAL_DETAIL_FROM_COMPONENTS_HPP
+
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#endif
+
+namespace boost {
+namespace decimal {
+
+// The value (-1)^sign * sig * 10^exp from components that are known to be in range,
+// e.g. those of a value of the same type that were stored separately.
+// Unlike the constructor this only packs the bits: sig must have at most precision_v<Decimal> digits,
+// exp + bias_v<Decimal> must be within [0, max_biased_exp_v<Decimal>], and zero must have the exponent 0
+// as the constructor gives it. These preconditions are only asserted in debug builds
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+constexpr auto from_components_unchecked(typename Decimal::significand_type sig, int exp, bool sign = false) noexcept -> Decimal
+{
+    BOOST_DECIMAL_ASSERT(sig <= static_cast<typename Decimal::significand_type>(detail::max_significand_v<Decimal>));
+    BOOST_DECIMAL_ASSERT(exp >= detail::etiny_v<Decimal> && exp <= detail::max_biased_exp_v<Decimal> - detail::bias_v<Decimal>);
+    BOOST_DECIMAL_ASSERT(sig != 0U || exp == 0);
+
+    Decimal res;
+    res.pack_components(sig, static_cast<std::uint32_t>(exp + detail::bias_v<Decimal>), sign);
+
+    return res;
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_FROM_COMPONENTS_HPP
@@ -7,6 +7,8 @@
 
 #include <boost/decimal/detail/config.hpp>
 #include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/emulated256.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cstdint>
@@ -30,21 +32,138 @@ constexpr auto pow10(T n) noexcept -> T
     return static_cast<T>(powers_of_10[static_cast<std::size_t>(n)]);
 }
 
+// Every power of 10 that fits in 128 bits, so that the 128-bit significands of decimal128
+// can be scaled by a single table lookup instead of a runtime multiplication
+BOOST_DECIMAL_CONSTEXPR_VARIABLE uint128 powers_of_10_u128[39] =
+{
+    uint128 {UINT64_C(0), UINT64_C(1)}, // 10^0
+    uint128 {UINT64_C(0), UINT64_C(10)}, // 10^1
+    uint128 {UINT64_C(0), UINT64_C(100)}, // 10^2
+    uint128 {UINT64_C(0), UINT64_C(1000)}, // 10^3
+    uint128 {UINT64_C(0), UINT64_C(10000)}, // 10^4
+    uint128 {UINT64_C(0), UINT64_C(100000)}, // 10^5
+    uint128 {UINT64_C(0), UINT64_C(1000000)}, // 10^6
+    uint128 {UINT64_C(0), UINT64_C(10000000)}, // 10^7
+    uint128 {UINT64_C(0), UINT64_C(100000000)}, // 10^8
+    uint128 {UINT64_C(0), UINT64_C(1000000000)}, // 10^9
+    uint128 {UINT64_C(0), UINT64_C(10000000000)}, // 10^10
+    uint128 {UINT64_C(0), UINT64_C(100000000000)}, // 10^11
+    uint128 {UINT64_C(0), UINT64_C(1000000000000)}, // 10^12
+    uint128 {UINT64_C(0), UINT64_C(10000000000000)}, // 10^13
+    uint128 {UINT64_C(0), UINT64_C(100000000000000)}, // 10^14
+    uint128 {UINT64_C(0), UINT64_C(1000000000000000)}, // 10^15
+    uint128 {UINT64_C(0), UINT64_C(10000000000000000)}, // 10^16
+    uint128 {UINT64_C(0), UINT64_C(100000000000000000)}, // 10^17
+    uint128 {UINT64_C(0), UINT64_C(1000000000000000000)}, // 10^18
+    uint128 {UINT64_C(0), UINT64_C(10000000000000000000)}, // 10^19
+    uint128 {UINT64_C(5), UINT64_C(7766279631452241920)}, // 10^20
+    uint128 {UINT64_C(54), UINT64_C(3875820019684212736)}, // 10^21
+    uint128 {UINT64_C(542), UINT64_C(1864712049423024128)}, // 10^22
+    uint128 {UINT64_C(5421), UINT64_C(200376420520689664)}, // 10^23
+    uint128 {UINT64_C(54210), UINT64_C(2003764205206896640)}, // 10^24
+    uint128 {UINT64_C(542101), UINT64_C(1590897978359414784)}, // 10^25
+    uint128 {UINT64_C(5421010), UINT64_C(15908979783594147840)}, // 10^26
+    uint128 {UINT64_C(54210108), UINT64_C(11515845246265065472)}, // 10^27
+    uint128 {UINT64_C(542101086), UINT64_C(4477988020393345024)}, // 10^28
+    uint128 {UINT64_C(5421010862), UINT64_C(7886392056514347008)}, // 10^29
+    uint128 {UINT64_C(54210108624), UINT64_C(5076944270305263616)}, // 10^30
+    uint128 {UINT64_C(542101086242), UINT64_C(13875954555633532928)}, // 10^31
+    uint128 {UINT64_C(5421010862427), UINT64_C(9632337040368467968)}, // 10^32
+    uint128 {UINT64_C(54210108624275), UINT64_C(4089650035136921600)}, // 10^33
+    uint128 {UINT64_C(542101086242752), UINT64_C(4003012203950112768)}, // 10^34
+    uint128 {UINT64_C(5421010862427522), UINT64_C(3136633892082024448)}, // 10^35
+    uint128 {UINT64_C(54210108624275221), UINT64_C(12919594847110692864)}, // 10^36
+    uint128 {UINT64_C(542101086242752217), UINT64_C(68739955140067328)}, // 10^37
+    uint128 {UINT64_C(5421010862427522170), UINT64_C(687399551400673280)} // 10^38
+};
+
+// Every power of 10 that fits in 256 bits, i.e. those that the product of two 128-bit values can reach
+BOOST_DECIMAL_CONSTEXPR_VARIABLE uint256_t powers_of_10_u256[78] =
+{
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1)}}, // 10^0
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10)}}, // 10^1
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100)}}, // 10^2
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000)}}, // 10^3
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000)}}, // 10^4
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100000)}}, // 10^5
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000000)}}, // 10^6
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000000)}}, // 10^7
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100000000)}}, // 10^8
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000000000)}}, // 10^9
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000000000)}}, // 10^10
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100000000000)}}, // 10^11
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000000000000)}}, // 10^12
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000000000000)}}, // 10^13
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100000000000000)}}, // 10^14
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000000000000000)}}, // 10^15
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000000000000000)}}, // 10^16
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(100000000000000000)}}, // 10^17
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(1000000000000000000)}}, // 10^18
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(0), UINT64_C(10000000000000000000)}}, // 10^19
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5), UINT64_C(7766279631452241920)}}, // 10^20
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54), UINT64_C(3875820019684212736)}}, // 10^21
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542), UINT64_C(1864712049423024128)}}, // 10^22
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421), UINT64_C(200376420520689664)}}, // 10^23
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54210), UINT64_C(2003764205206896640)}}, // 10^24
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542101), UINT64_C(1590897978359414784)}}, // 10^25
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421010), UINT64_C(15908979783594147840)}}, // 10^26
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54210108), UINT64_C(11515845246265065472)}}, // 10^27
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542101086), UINT64_C(4477988020393345024)}}, // 10^28
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421010862), UINT64_C(7886392056514347008)}}, // 10^29
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54210108624), UINT64_C(5076944270305263616)}}, // 10^30
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542101086242), UINT64_C(13875954555633532928)}}, // 10^31
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421010862427), UINT64_C(9632337040368467968)}}, // 10^32
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54210108624275), UINT64_C(4089650035136921600)}}, // 10^33
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542101086242752), UINT64_C(4003012203950112768)}}, // 10^34
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421010862427522), UINT64_C(3136633892082024448)}}, // 10^35
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(54210108624275221), UINT64_C(12919594847110692864)}}, // 10^36
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(542101086242752217), UINT64_C(68739955140067328)}}, // 10^37
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(0)}, uint128 {UINT64_C(5421010862427522170), UINT64_C(687399551400673280)}}, // 10^38
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2)}, uint128 {UINT64_C(17316620476856118468), UINT64_C(6873995514006732800)}}, // 10^39
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29)}, uint128 {UINT64_C(7145508105175220139), UINT64_C(13399722918938673152)}}, // 10^40
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293)}, uint128 {UINT64_C(16114848830623546549), UINT64_C(4870020673419870208)}}, // 10^41
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938)}, uint128 {UINT64_C(13574535716559052564), UINT64_C(11806718586779598848)}}, // 10^42
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29387)}, uint128 {UINT64_C(6618148649623664334), UINT64_C(7386721425538678784)}}, // 10^43
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293873)}, uint128 {UINT64_C(10841254275107988496), UINT64_C(80237960548581376)}}, // 10^44
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938735)}, uint128 {UINT64_C(16178822382532126880), UINT64_C(802379605485813760)}}, // 10^45
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29387358)}, uint128 {UINT64_C(14214271235644855872), UINT64_C(8023796054858137600)}}, // 10^46
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293873587)}, uint128 {UINT64_C(13015503840481697412), UINT64_C(6450984253743169536)}}, // 10^47
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938735877)}, uint128 {UINT64_C(1027829888850112811), UINT64_C(9169610316303040512)}}, // 10^48
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29387358770)}, uint128 {UINT64_C(10278298888501128114), UINT64_C(17909126868192198656)}}, // 10^49
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293873587705)}, uint128 {UINT64_C(10549268516463523069), UINT64_C(13070572018536022016)}}, // 10^50
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938735877055)}, uint128 {UINT64_C(13258964796087472617), UINT64_C(1578511669393358848)}}, // 10^51
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29387358770557)}, uint128 {UINT64_C(3462439444907864858), UINT64_C(15785116693933588480)}}, // 10^52
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293873587705571)}, uint128 {UINT64_C(16177650375369096972), UINT64_C(10277214349659471872)}}, // 10^53
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938735877055718)}, uint128 {UINT64_C(14202551164014556797), UINT64_C(10538423128046960640)}}, // 10^54
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(29387358770557187)}, uint128 {UINT64_C(12898303124178706663), UINT64_C(13150510911921848320)}}, // 10^55
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(293873587705571876)}, uint128 {UINT64_C(18302566799529756941), UINT64_C(2377900603251621888)}}, // 10^56
+    uint256_t {uint128 {UINT64_C(0), UINT64_C(2938735877055718769)}, uint128 {UINT64_C(17004971331911604867), UINT64_C(5332261958806667264)}}, // 10^57
+    uint256_t {uint128 {UINT64_C(1), UINT64_C(10940614696847636083)}, uint128 {UINT64_C(4029016655730084128), UINT64_C(16429131440647569408)}}, // 10^58
+    uint256_t {uint128 {UINT64_C(15), UINT64_C(17172426599928602752)}, uint128 {UINT64_C(3396678409881738056), UINT64_C(16717361816799281152)}}, // 10^59
+    uint256_t {uint128 {UINT64_C(159), UINT64_C(5703569335900062977)}, uint128 {UINT64_C(15520040025107828953), UINT64_C(1152921504606846976)}}, // 10^60
+    uint256_t {uint128 {UINT64_C(1593), UINT64_C(1695461137871974930)}, uint128 {UINT64_C(7626447661401876602), UINT64_C(11529215046068469760)}}, // 10^61
+    uint256_t {uint128 {UINT64_C(15930), UINT64_C(16954611378719749304)}, uint128 {UINT64_C(2477500319180559562), UINT64_C(4611686018427387904)}}, // 10^62
+    uint256_t {uint128 {UINT64_C(159309), UINT64_C(3525417123811528497)}, uint128 {UINT64_C(6328259118096044006), UINT64_C(9223372036854775808)}}, // 10^63
+    uint256_t {uint128 {UINT64_C(1593091), UINT64_C(16807427164405733357)}, uint128 {UINT64_C(7942358959831785217), UINT64_C(0)}}, // 10^64
+    uint256_t {uint128 {UINT64_C(15930919), UINT64_C(2053574980671369030)}, uint128 {UINT64_C(5636613303479645706), UINT64_C(0)}}, // 10^65
+    uint256_t {uint128 {UINT64_C(159309191), UINT64_C(2089005733004138687)}, uint128 {UINT64_C(1025900813667802212), UINT64_C(0)}}, // 10^66
+    uint256_t {uint128 {UINT64_C(1593091911), UINT64_C(2443313256331835254)}, uint128 {UINT64_C(10259008136678022120), UINT64_C(0)}}, // 10^67
+    uint256_t {uint128 {UINT64_C(15930919111), UINT64_C(5986388489608800929)}, uint128 {UINT64_C(10356360998232463120), UINT64_C(0)}}, // 10^68
+    uint256_t {uint128 {UINT64_C(159309191113), UINT64_C(4523652674959354447)}, uint128 {UINT64_C(11329889613776873120), UINT64_C(0)}}, // 10^69
+    uint256_t {uint128 {UINT64_C(1593091911132), UINT64_C(8343038602174441244)}, uint128 {UINT64_C(2618431695511421504), UINT64_C(0)}}, // 10^70
+    uint256_t {uint128 {UINT64_C(15930919111324), UINT64_C(9643409726906205977)}, uint128 {UINT64_C(7737572881404663424), UINT64_C(0)}}, // 10^71
+    uint256_t {uint128 {UINT64_C(159309191113245), UINT64_C(4200376900514301694)}, uint128 {UINT64_C(3588752519208427776), UINT64_C(0)}}, // 10^72
+    uint256_t {uint128 {UINT64_C(1593091911132452), UINT64_C(5110280857723913709)}, uint128 {UINT64_C(17440781118374726144), UINT64_C(0)}}, // 10^73
+    uint256_t {uint128 {UINT64_C(15930919111324522), UINT64_C(14209320429820033867)}, uint128 {UINT64_C(8387114520361296896), UINT64_C(0)}}, // 10^74
+    uint256_t {uint128 {UINT64_C(159309191113245227), UINT64_C(12965995782233477362)}, uint128 {UINT64_C(10084168908774762496), UINT64_C(0)}}, // 10^75
+    uint256_t {uint128 {UINT64_C(1593091911132452277), UINT64_C(532749306367912313)}, uint128 {UINT64_C(8607968719199866880), UINT64_C(0)}}, // 10^76
+    uint256_t {uint128 {UINT64_C(15930919111324522770), UINT64_C(5327493063679123134)}, uint128 {UINT64_C(12292710897160462336), UINT64_C(0)}} // 10^77
+};
+
 template <>
 constexpr auto pow10(detail::uint128 n) noexcept -> detail::uint128
 {
-    detail::uint128 res {1};
-    if (n <= 19)
-    {
-        res = powers_of_10[static_cast<std::size_t>(n)];
-    }
-    else
-    {
-        res = powers_of_10[static_cast<std::size_t>(19)];
-        res *= powers_of_10[static_cast<std::size_t>(n - 19)];
-    }
-
-    return res;
+    return powers_of_10_u128[static_cast<std::size_t>(n)];
 }
 
 #ifdef BOOST_DECIMAL_HAS_INT128
@@ -52,18 +171,7 @@ constexpr auto pow10(detail::uint128 n) noexcept -> detail::uint128
 template <>
 constexpr auto pow10(detail::uint128_t n) noexcept -> detail::uint128_t
 {
-    detail::uint128_t res {1};
-    if (n <= 19)
-    {
-        res = powers_of_10[static_cast<std::size_t>(n)];
-    }
-    else
-    {
-        res = powers_of_10[static_cast<std::size_t>(19)];
-        res *= powers_of_10[static_cast<std::size_t>(n - 19)];
-    }
-
-    return res;
+    return static_cast<detail::uint128_t>(powers_of_10_u128[static_cast<std::size_t>(n)]);
 }
 
 #endif
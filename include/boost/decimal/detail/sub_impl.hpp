@@ -23,6 +23,11 @@ constexpr auto sub_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
                         bool abs_lhs_bigger) noexcept -> ReturnType
 {
     auto delta_exp {lhs_exp > rhs_exp ? lhs_exp - rhs_exp : rhs_exp - lhs_exp};
+
+    if (delta_exp != 0)
+    {
+        BOOST_DECIMAL_INSTRUMENT(mismatched_exponent_additions);
+    }
     auto signed_sig_lhs {detail::make_signed_value(lhs_sig, lhs_sign)};
     auto signed_sig_rhs {detail::make_signed_value(rhs_sig, rhs_sign)};
 
@@ -32,8 +37,11 @@ constexpr auto sub_impl(T1 lhs_sig, std::int32_t lhs_exp, bool lhs_sign,
         // we return the larger of the two
         //
         // e.g. 1e20 - 1e-20 = 1e20
-        return abs_lhs_bigger ? ReturnType{detail::shrink_significand(lhs_sig, lhs_exp), lhs_exp, false} :
-                                ReturnType{detail::shrink_significand(rhs_sig, rhs_exp), rhs_exp, true};
+        //
+        // The larger keeps its own sign, unless it is rhs of a subtraction,
+        // which is every case but a positive lhs and a negative rhs (the addition of the two)
+        return abs_lhs_bigger ? ReturnType{detail::shrink_significand(lhs_sig, lhs_exp), lhs_exp, lhs_sign} :
+                                ReturnType{detail::shrink_significand(rhs_sig, rhs_exp), rhs_exp, !(lhs_sign && rhs_sign)};
     }
 
     // The two numbers can be subtracted together without special handling
@@ -8,6 +8,7 @@
 #define BOOST_TO_CHARS_INTEGER_IMPL_HPP
 
 #include <boost/decimal/detail/apply_sign.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
 #include <boost/decimal/detail/emulated128.hpp>
 #include <boost/decimal/detail/to_chars_result.hpp>
 #include <boost/decimal/detail/memcpy.hpp>
@@ -38,6 +39,41 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE char digit_table[] = {
         'u', 'v', 'w', 'x', 'y', 'z'
 };
 
+// Writes the decimal digits of value from end towards the front of the buffer,
+// and returns the position in front of the most significant digit
+template <typename Unsigned_Integer>
+constexpr auto to_chars_decimal_digits(char* end, Unsigned_Integer value) noexcept -> char*
+{
+    while (value != 0)
+    {
+        *end-- = digit_table[static_cast<std::size_t>(value % 10U)];
+        value /= 10U;
+    }
+
+    return end;
+}
+
+// Each digit of the emulated type would take two long divisions, so the value is split instead
+// into blocks of 19 digits by the division by 10^19, and the digits of every block are found with 64-bit arithmetic
+constexpr auto to_chars_decimal_digits(char* end, uint128 value) noexcept -> char*
+{
+    while (value.high != 0U)
+    {
+        const auto quotient {div_pow10(value, 19)};
+        auto block {value.low - quotient.low * powers_of_10[19]};
+
+        for (int i {}; i < 19; ++i)
+        {
+            *end-- = digit_table[static_cast<std::size_t>(block % 10U)];
+            block /= 10U;
+        }
+
+        value = quotient;
+    }
+
+    return to_chars_decimal_digits(end, value.low);
+}
+
 // Use a simple lookup table to put together the Integer in character form
 template <typename Integer, typename Unsigned_Integer>
 BOOST_DECIMAL_CONSTEXPR auto to_chars_integer_impl(char* first, char* last, Integer value, int base) noexcept
@@ -95,6 +131,10 @@ BOOST_DECIMAL_CONSTEXPR auto to_chars_integer_impl(char* first, char* last, Inte
             break;
         // LCOV_EXCL_STOP
 
+        case 10:
+            end = to_chars_decimal_digits(end, unsigned_value);
+            break;
+
         default:
             while (unsigned_value != 0)
             {
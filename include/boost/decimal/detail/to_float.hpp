@@ -12,10 +12,12 @@
 #include <boost/decimal/detail/fast_float/compute_float64.hpp>
 #include <boost/decimal/detail/fast_float/compute_float80_128.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/conversion_result.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cerrno>
 #include <limits>
+#include <system_error>
 #include <type_traits>
 #endif
 
@@ -28,9 +30,12 @@ namespace decimal {
 #  pragma GCC diagnostic ignored "-Wduplicated-branches"
 #endif
 
-template <typename Decimal, typename TargetType>
-BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
-    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_floating_point_v, TargetType, TargetType)
+// Attempts conversion to binary floating point type without ever touching errno.
+// Non-finite values convert to the matching non-finite value,
+// and values that can not be converted return 0 and std::errc::invalid_argument
+BOOST_DECIMAL_EXPORT template <typename TargetType, typename Decimal>
+BOOST_DECIMAL_CXX20_CONSTEXPR auto try_to_float(Decimal val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_floating_point_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>)
 {
     bool success {};
 
@@ -41,13 +46,13 @@ BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
         case FP_NAN:
             if (issignaling(val))
             {
-                return std::numeric_limits<TargetType>::signaling_NaN();
+                return {std::numeric_limits<TargetType>::signaling_NaN(), std::errc{}};
             }
-            return std::numeric_limits<TargetType>::quiet_NaN();
+            return {std::numeric_limits<TargetType>::quiet_NaN(), std::errc{}};
         case FP_INFINITE:
-            return std::numeric_limits<TargetType>::infinity();
+            return {std::numeric_limits<TargetType>::infinity(), std::errc{}};
         case FP_ZERO:
-            return 0;
+            return {static_cast<TargetType>(0), std::errc{}};
         default:
             static_cast<void>(success);
     }
@@ -79,11 +84,26 @@ BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
 
     if (BOOST_DECIMAL_UNLIKELY(!success))
     {
-        errno = EINVAL;
-        return 0;
+        return {static_cast<TargetType>(0), std::errc::invalid_argument};
+    }
+
+    return {result, std::errc{}};
+}
+
+// Attempts conversion to binary floating point type:
+// If the value can not be converted sets errno to EINVAL and returns 0
+template <typename Decimal, typename TargetType>
+BOOST_DECIMAL_CXX20_CONSTEXPR auto to_float(Decimal val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_floating_point_v, TargetType, TargetType)
+{
+    const auto r {try_to_float<TargetType>(val)};
+
+    if (BOOST_DECIMAL_UNLIKELY(!r))
+    {
+        errno = static_cast<int>(r.ec);
     }
 
-    return result;
+    return r.value;
 }
 
 #if defined(__GNUC__) && __GNUC__ >= 6
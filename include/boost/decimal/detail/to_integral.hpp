@@ -9,10 +9,15 @@
 #include <boost/decimal/detail/power_tables.hpp>
 #include <boost/decimal/detail/apply_sign.hpp>
 #include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/conversion_result.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
 
 #ifndef BOOST_DECIMAL_BUILD_MODULE
 #include <cerrno>
+#include <cstdint>
 #include <limits>
+#include <system_error>
 #include <type_traits>
 #endif
 
@@ -26,31 +31,15 @@ namespace decimal {
 #  pragma warning(disable: 4146)
 #endif
 
-// Attempts conversion to integral type:
-// If this is nan sets errno to EINVAL and returns 0
-// If this is not representable sets errno to ERANGE and returns 0
-template <typename Decimal, typename TargetType>
-constexpr auto to_integral(Decimal val) noexcept
-    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType)
+namespace detail {
+
+// The integral part of (-1)^isneg * sig * 10^expval for values already known to be in range of TargetType
+template <typename TargetType>
+constexpr auto integral_from_components(std::uint64_t sig, std::int32_t expval, bool isneg) noexcept -> TargetType
 {
     using Conversion_Type = std::conditional_t<std::numeric_limits<TargetType>::is_signed, std::int64_t, std::uint64_t>;
 
-    constexpr Decimal max_target_type { (std::numeric_limits<TargetType>::max)() };
-    constexpr Decimal min_target_type { (std::numeric_limits<TargetType>::min)() };
-
-    if (isnan(val))
-    {
-        errno = EINVAL;
-        return static_cast<TargetType>(0);
-    }
-    if (isinf(val) || val > max_target_type || val < min_target_type)
-    {
-        errno = ERANGE;
-        return static_cast<TargetType>(0);
-    }
-
-    auto result {static_cast<Conversion_Type>(val.full_significand())};
-    auto expval {val.biased_exponent()};
+    auto result {static_cast<Conversion_Type>(sig)};
     const auto abs_exp_val {detail::make_positive_unsigned(expval)};
 
     if (abs_exp_val >= 19)
@@ -68,32 +57,15 @@ constexpr auto to_integral(Decimal val) noexcept
 
     BOOST_DECIMAL_IF_CONSTEXPR (std::is_signed<TargetType>::value)
     {
-        result = static_cast<bool>(val.isneg()) ? static_cast<Conversion_Type>(detail::apply_sign(result)) : static_cast<Conversion_Type>(result);
+        result = isneg ? static_cast<Conversion_Type>(detail::apply_sign(result)) : static_cast<Conversion_Type>(result);
     }
 
     return static_cast<TargetType>(result);
 }
 
-template <typename Decimal, typename TargetType>
-constexpr auto to_integral_128(Decimal val) noexcept
-    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType)
+template <typename TargetType>
+constexpr auto integral_from_components(detail::uint128 sig, std::int32_t expval, bool isneg) noexcept -> TargetType
 {
-    constexpr Decimal max_target_type { (std::numeric_limits<TargetType>::max)() };
-    constexpr Decimal min_target_type { (std::numeric_limits<TargetType>::min)() };
-
-    if (isnan(val))
-    {
-        errno = EINVAL;
-        return static_cast<TargetType>(UINT64_C(0));
-    }
-    if (isinf(val) || val > max_target_type || val < min_target_type)
-    {
-        errno = ERANGE;
-        return static_cast<TargetType>(UINT64_C(0));
-    }
-
-    auto sig {val.full_significand()};
-    auto expval {val.biased_exponent()};
     const auto abs_exp_val {detail::make_positive_unsigned(expval)};
 
     if (abs_exp_val >= 38)
@@ -113,13 +85,128 @@ constexpr auto to_integral_128(Decimal val) noexcept
 
     BOOST_DECIMAL_IF_CONSTEXPR (std::is_signed<TargetType>::value)
     {
-        result = static_cast<bool>(val.isneg()) ? static_cast<TargetType>(detail::apply_sign(result)) :
-                                                  static_cast<TargetType>(result);
+        result = isneg ? static_cast<TargetType>(detail::apply_sign(result)) : static_cast<TargetType>(result);
     }
 
     return result;
 }
 
+// The conversion of (-1)^isneg * sig * 10^expval to an integral type of at most 64 bits, with the range checked
+// on the components. This only takes integer operations, unlike the comparison with the limits as decimal values
+template <typename TargetType, typename Unsigned>
+constexpr auto checked_integral_from_components(Unsigned sig, std::int32_t expval, bool isneg) noexcept -> conversion_result<TargetType>
+{
+    constexpr auto max_digits {sizeof(Unsigned) > sizeof(std::uint64_t) ? 38 : 19};
+    constexpr auto max_value {static_cast<std::uint64_t>((std::numeric_limits<TargetType>::max)())};
+
+    // The magnitude of the smallest value of a signed type is one more than that of the largest
+    const auto max_mag {isneg ? (std::is_signed<TargetType>::value ? max_value + 1U : UINT64_C(0)) : max_value};
+
+    // Every negative value other than zero is out of range of unsigned types, including those that would truncate to zero,
+    // e.g. -0.5 gives std::errc::result_out_of_range
+    if (!std::is_signed<TargetType>::value && isneg && sig != 0U)
+    {
+        return {static_cast<TargetType>(0), std::errc::result_out_of_range};
+    }
+
+    if (expval < 0)
+    {
+        sig = expval <= -max_digits ? static_cast<Unsigned>(0U) : static_cast<Unsigned>(sig / detail::pow10<Unsigned>(static_cast<Unsigned>(-expval)));
+    }
+
+    if (sig > max_mag)
+    {
+        return {static_cast<TargetType>(0), std::errc::result_out_of_range};
+    }
+
+    auto mag {static_cast<std::uint64_t>(sig)};
+
+    if (expval > 0 && mag != 0U)
+    {
+        if (expval > std::numeric_limits<std::uint64_t>::digits10 || mag > max_mag / detail::powers_of_10[expval])
+        {
+            return {static_cast<TargetType>(0), std::errc::result_out_of_range};
+        }
+
+        mag *= detail::powers_of_10[expval];
+    }
+
+    if (isneg && mag != 0U)
+    {
+        return {static_cast<TargetType>(-static_cast<std::int64_t>(mag - 1U) - 1), std::errc{}};
+    }
+
+    return {static_cast<TargetType>(mag), std::errc{}};
+}
+
+template <typename TargetType, typename Decimal, typename Unsigned>
+constexpr auto integral_from_decimal(Decimal, Unsigned sig, std::int32_t expval, bool isneg, std::false_type) noexcept -> conversion_result<TargetType>
+{
+    return checked_integral_from_components<TargetType>(sig, expval, isneg);
+}
+
+// The 128-bit integer types
+template <typename TargetType, typename Decimal, typename Unsigned>
+constexpr auto integral_from_decimal(Decimal val, Unsigned sig, std::int32_t expval, bool isneg, std::true_type) noexcept -> conversion_result<TargetType>
+{
+    constexpr Decimal max_target_type { (std::numeric_limits<TargetType>::max)() };
+    constexpr Decimal min_target_type { (std::numeric_limits<TargetType>::min)() };
+
+    if (val > max_target_type || val < min_target_type)
+    {
+        return {static_cast<TargetType>(0), std::errc::result_out_of_range};
+    }
+
+    return {integral_from_components<TargetType>(sig, expval, isneg), std::errc{}};
+}
+
+} // namespace detail
+
+// Attempts conversion to integral type without ever touching errno:
+// If this is nan returns 0 and std::errc::invalid_argument
+// If this is not representable returns 0 and std::errc::result_out_of_range
+BOOST_DECIMAL_EXPORT template <typename TargetType, typename Decimal>
+constexpr auto try_to_integral(Decimal val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_integral_v, TargetType, detail::is_decimal_floating_point_v, Decimal, conversion_result<TargetType>)
+{
+    if (isnan(val))
+    {
+        return {static_cast<TargetType>(0), std::errc::invalid_argument};
+    }
+    if (isinf(val))
+    {
+        return {static_cast<TargetType>(0), std::errc::result_out_of_range};
+    }
+
+    using unsigned_type = std::conditional_t<(sizeof(typename Decimal::significand_type) > sizeof(std::uint64_t)), detail::uint128, std::uint64_t>;
+    using is_wide = std::integral_constant<bool, (sizeof(TargetType) > sizeof(std::uint64_t))>;
+
+    return detail::integral_from_decimal<TargetType>(val, static_cast<unsigned_type>(val.full_significand()), val.biased_exponent(), val.isneg(), is_wide{});
+}
+
+// Attempts conversion to integral type:
+// If this is nan sets errno to EINVAL and returns 0
+// If this is not representable sets errno to ERANGE and returns 0
+template <typename Decimal, typename TargetType>
+constexpr auto to_integral(Decimal val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType)
+{
+    const auto r {try_to_integral<TargetType>(val)};
+
+    if (BOOST_DECIMAL_UNLIKELY(!r))
+    {
+        errno = static_cast<int>(r.ec);
+    }
+
+    return r.value;
+}
+
+template <typename Decimal, typename TargetType>
+constexpr auto to_integral_128(Decimal val) noexcept
+    BOOST_DECIMAL_REQUIRES_TWO_RETURN(detail::is_decimal_floating_point_v, Decimal, detail::is_integral_v, TargetType, TargetType)
+{
+    return to_integral<Decimal, TargetType>(val);
+}
 
 #ifdef _MSC_VER
 #  pragma warning(pop)
@@ -0,0 +1,112 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_DETAIL_TO_SCALED_INTEGER_HPP
+#define BOOST_DECIMAL_DETAIL_TO_SCALED_INTEGER_HPP
+
+#include <boost/decimal/detail/attributes.hpp>
+#include <boost/decimal/detail/concepts.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/conversion_result.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/from_components.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+namespace detail {
+
+constexpr auto saturated_scaled_integer(bool is_neg) noexcept -> conversion_result<std::int64_t>
+{
+    return {saturated_value<std::int64_t>(is_neg), std::errc::result_out_of_range};
+}
+
+} // namespace detail
+
+// Converts val to the integer number of units of 10^exp, e.g. 12345 for 123.45 at the exponent -2.
+// Removing decimal places rounds according to the current rounding mode.
+// NaN gives 0 and std::errc::invalid_argument, and infinities and values out of the range of std::int64_t
+// give the largest or smallest value and std::errc::result_out_of_range. errno is never set
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+constexpr auto to_scaled_integer(Decimal val, int exp) noexcept -> conversion_result<std::int64_t>
+{
+    using significand_type = typename Decimal::significand_type;
+    using promoted_type = std::conditional_t<(sizeof(significand_type) > sizeof(std::uint64_t)), significand_type, std::uint64_t>;
+
+    if (!isfinite(val))
+    {
+        return isnan(val) ? conversion_result<std::int64_t>{0, std::errc::invalid_argument} : detail::saturated_scaled_integer(val.isneg());
+    }
+
+    const auto sig {static_cast<promoted_type>(val.full_significand())};
+    const auto val_exp {static_cast<int>(val.biased_exponent())};
+    const auto is_neg {val.isneg()};
+    const auto max_mag {detail::max_magnitude<std::int64_t>(is_neg)};
+
+    if (val_exp >= exp)
+    {
+        // Values already at the target quantum, as are all values that were read at the same exponent,
+        // are only checked for range
+        const auto shift {val_exp - exp};
+
+        if (sig == 0U)
+        {
+            return {0, std::errc{}};
+        }
+        else if (shift > std::numeric_limits<std::int64_t>::digits10 || sig > promoted_type {max_mag / detail::powers_of_10[shift]})
+        {
+            return detail::saturated_scaled_integer(is_neg);
+        }
+
+        return {detail::from_magnitude<std::int64_t>(static_cast<std::uint64_t>(sig) * detail::powers_of_10[shift], is_neg), std::errc{}};
+    }
+
+    auto guarded {detail::div_pow10_to_guard_digit(sig, exp - val_exp)};
+    detail::fenv_round<decimal128>(guarded, is_neg);
+
+    if (guarded > promoted_type {max_mag})
+    {
+        return detail::saturated_scaled_integer(is_neg);
+    }
+
+    return {detail::from_magnitude<std::int64_t>(static_cast<std::uint64_t>(guarded), is_neg), std::errc{}};
+}
+
+// The value ticks * 10^exp, which is exact as long as ticks has at most as many digits as the precision of Decimal
+BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Decimal>
+constexpr auto from_scaled_integer(std::int64_t ticks, int exp) noexcept -> Decimal
+{
+    using significand_type = typename Decimal::significand_type;
+
+    const auto is_neg {ticks < 0};
+    const auto mag {is_neg ? static_cast<std::uint64_t>(-static_cast<std::uint64_t>(ticks)) : static_cast<std::uint64_t>(ticks)};
+
+    // Every std::uint64_t fits in the significand of decimal128
+    constexpr auto max_mag {std::numeric_limits<Decimal>::digits10 > std::numeric_limits<std::uint64_t>::digits10 ?
+                            UINT64_MAX : static_cast<std::uint64_t>(detail::max_significand_v<Decimal>)};
+
+    // Ticks that fit in the significand are packed as they are. The rest, and zero, which the constructor
+    // stores with the exponent 0, take the constructor
+    if (BOOST_DECIMAL_LIKELY(mag != 0U && mag <= max_mag &&
+                             exp >= detail::etiny_v<Decimal> && exp <= detail::max_biased_exp_v<Decimal> - detail::bias_v<Decimal>))
+    {
+        return from_components_unchecked<Decimal>(static_cast<significand_type>(mag), exp, is_neg);
+    }
+
+    return Decimal{ticks, exp};
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_DETAIL_TO_SCALED_INTEGER_HPP
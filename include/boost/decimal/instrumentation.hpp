@@ -0,0 +1,79 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_INSTRUMENTATION_HPP
+#define BOOST_DECIMAL_INSTRUMENTATION_HPP
+
+#include <boost/decimal/detail/config.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#endif
+
+namespace boost {
+namespace decimal {
+
+// Counts of how often the slow paths of the library are taken by the calling thread.
+// The counters are only updated when BOOST_DECIMAL_ENABLE_INSTRUMENTATION is defined,
+// otherwise they are always zero and the hooks compile to nothing
+BOOST_DECIMAL_EXPORT struct instrumentation_counters
+{
+    // Additions and subtractions of finite values whose exponents differ once their significands are normalized
+    std::uint64_t mismatched_exponent_additions;
+
+    // Calls to the rounding of a significand according to the current rounding mode
+    std::uint64_t fenv_round_calls;
+
+    // Construction from a significand with more digits than the precision of the type
+    std::uint64_t constructor_renormalizations;
+
+    // Calls to fpclassify that return FP_NAN or FP_INFINITE
+    std::uint64_t non_finite_classifications;
+};
+
+namespace detail {
+
+#ifdef BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+
+inline auto thread_instrumentation_counters() noexcept -> instrumentation_counters&
+{
+    static thread_local instrumentation_counters counters {};
+    return counters;
+}
+
+// The counters can not be modified during constant evaluation.
+// On compilers without detection of constant evaluation the instrumented functions can not be used in constant expressions
+#  define BOOST_DECIMAL_INSTRUMENT(counter) \
+    do { if (!BOOST_DECIMAL_IS_CONSTANT_EVALUATED(counter)) { ++::boost::decimal::detail::thread_instrumentation_counters().counter; } } while (false)
+
+#else
+
+#  define BOOST_DECIMAL_INSTRUMENT(counter) static_cast<void>(0)
+
+#endif // BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+
+} // namespace detail
+
+// Returns a snapshot of the counters of the calling thread
+BOOST_DECIMAL_EXPORT inline auto get_instrumentation_counters() noexcept -> instrumentation_counters
+{
+    #ifdef BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+    return detail::thread_instrumentation_counters();
+    #else
+    return instrumentation_counters{};
+    #endif
+}
+
+// Sets all the counters of the calling thread to zero
+BOOST_DECIMAL_EXPORT inline auto reset_instrumentation_counters() noexcept -> void
+{
+    #ifdef BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+    detail::thread_instrumentation_counters() = instrumentation_counters{};
+    #endif
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_INSTRUMENTATION_HPP
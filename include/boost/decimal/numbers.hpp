@@ -29,14 +29,14 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec log2e_v = Dec{UINT64_C(1442695040888963407)
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 log2e_v<decimal128> = decimal128{detail::uint128{UINT64_C(78208654878293),
-                                                                                                            UINT64_C(16395798456599530402)}, -33};
+                                                                                                            UINT64_C(16395798456599530404)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec log10e_v = Dec{UINT64_C(4342944819032518277), -19};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 log10e_v<decimal128> = decimal128{detail::uint128{UINT64_C(235431510388986),
-                                                                                                             UINT64_C(2047877485384264674)}, -34};
+                                                                                                             UINT64_C(2047877485384264675)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec log10_2_v = Dec{UINT64_C(3010299956639811952), -19};
@@ -50,7 +50,7 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec pi_v = Dec{UINT64_C(3141592653589793238), -
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 pi_v<decimal128> = decimal128{detail::uint128{UINT64_C(170306079004327),
-                                                                                                         UINT64_C(13456286628489437068)}, -33};
+                                                                                                         UINT64_C(13456286628489437071)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec pi_over_four_v = Dec{UINT64_C(7853981633974483096), -19};
@@ -68,49 +68,49 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec inv_pi_v = Dec{UINT64_C(3183098861837906715
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 inv_pi_v<decimal128> = decimal128{detail::uint128{UINT64_C(172556135062039),
-                                                                                                             UINT64_C(13820348844234745256)}, -34};
+                                                                                                             UINT64_C(13820348844234745263)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec inv_sqrtpi_v = Dec{UINT64_C(5641895835477562869), -19};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 inv_sqrtpi_v<decimal128> = decimal128{detail::uint128{UINT64_C(305847786088084),
-                                                                                                                 UINT64_C(12695685840195063976)}, -34};
+                                                                                                                 UINT64_C(12695685840195063982)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec ln2_v = Dec{UINT64_C(6931471805599453094), -19};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 ln2_v<decimal128> = decimal128{detail::uint128{UINT64_C(375755839507647),
-                                                                                                          UINT64_C(8395602002641374208)}, -34};
+                                                                                                          UINT64_C(8395602002641374214)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec ln10_v = Dec{UINT64_C(2302585092994045684), -18};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 ln10_v<decimal128> = decimal128{detail::uint128{UINT64_C(124823388007844),
-                                                                                                           UINT64_C(1462833818723808456)}, -33};
+                                                                                                           UINT64_C(1462833818723808460)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec sqrt2_v = Dec{UINT64_C(1414213562373095049), -18};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 sqrt2_v<decimal128> = decimal128{detail::uint128{UINT64_C(76664670834168),
-                                                                                                            UINT64_C(12987834932751794202)}, -33};
+                                                                                                            UINT64_C(12987834932751794210)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec sqrt3_v = Dec{UINT64_C(1732050807568877294), -18};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 sqrt3_v<decimal128> = decimal128{detail::uint128{UINT64_C(93894662421072),
-                                                                                                            UINT64_C(8437766544231453518)}, -33};
+                                                                                                            UINT64_C(8437766544231453520)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec sqrt10_v = Dec{UINT64_C(3162277660168379332), -18};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 sqrt10_v<decimal128> = decimal128{detail::uint128{UINT64_C(171427415457846),
-                                                                                                             UINT64_C(13450487317535253574)}, -33};
+                                                                                                             UINT64_C(13450487317535253583)}, -33};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec cbrt2_v = Dec{UINT64_C(1259921049894873165), -18};
@@ -138,21 +138,21 @@ BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec inv_sqrt3_v = Dec{UINT64_C(5773502691896257
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 inv_sqrt3_v<decimal128> = decimal128{detail::uint128{UINT64_C(312982208070241),
-                                                                                                                UINT64_C(9679144407061960114)}, -34};
+                                                                                                                UINT64_C(9679144407061960119)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec egamma_v = Dec{UINT64_C(5772156649015328606), -19};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 egamma_v<decimal128> = decimal128{detail::uint128{UINT64_C(312909238939453),
-                                                                                                             UINT64_C(7916302232898517972)}, -34};
+                                                                                                             UINT64_C(7916302232898517976)}, -34};
 
 BOOST_DECIMAL_EXPORT template <BOOST_DECIMAL_DECIMAL_FLOATING_TYPE Dec, std::enable_if_t<detail::is_decimal_floating_point_v<Dec>, bool> = true>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE Dec phi_v = Dec{UINT64_C(1618033988749894848), -18};
 
 BOOST_DECIMAL_EXPORT template <>
 BOOST_DECIMAL_CONSTEXPR_VARIABLE_SPECIALIZATION decimal128 phi_v<decimal128> = decimal128{detail::uint128{UINT64_C(87713798287901),
-                                                                                                          UINT64_C(2061523135646567614)}, -33};
+                                                                                                          UINT64_C(2061523135646567622)}, -33};
 
 BOOST_DECIMAL_EXPORT BOOST_DECIMAL_CONSTEXPR_VARIABLE auto e {e_v<decimal64>};
 BOOST_DECIMAL_EXPORT BOOST_DECIMAL_CONSTEXPR_VARIABLE auto log10_2 {log10_2_v<decimal64>};
@@ -0,0 +1,565 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_DECIMAL_SCALED_DECIMAL_HPP
+#define BOOST_DECIMAL_SCALED_DECIMAL_HPP
+
+#include <boost/decimal/fwd.hpp>
+#include <boost/decimal/decimal32.hpp>
+#include <boost/decimal/decimal32_fast.hpp>
+#include <boost/decimal/decimal64.hpp>
+#include <boost/decimal/decimal128.hpp>
+#include <boost/decimal/charconv.hpp>
+#include <boost/decimal/detail/config.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/emulated128.hpp>
+#include <boost/decimal/detail/fenv_rounding.hpp>
+#include <boost/decimal/detail/from_chars_result.hpp>
+#include <boost/decimal/detail/parser.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/decimal/detail/to_chars_result.hpp>
+#include <boost/decimal/detail/type_traits.hpp>
+#include <boost/decimal/detail/cmath/frexp10.hpp>
+
+#ifndef BOOST_DECIMAL_BUILD_MODULE
+#include <cstdint>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#endif
+
+namespace boost {
+namespace decimal {
+
+BOOST_DECIMAL_EXPORT template <typename Int, int Scale>
+class scaled_decimal;
+
+BOOST_DECIMAL_EXPORT template <typename Int, int Scale>
+constexpr auto from_chars(const char* first, const char* last, scaled_decimal<Int, Scale>& value, chars_format fmt = chars_format::general) noexcept -> from_chars_result;
+
+// A decimal number with a fixed number of decimal places, stored as the integer number of
+// units of 10^Scale, e.g. scaled_decimal<std::int64_t, -2> stores 123.45 as 12345 cents.
+// Addition, subtraction and comparison are the integer operations,
+// and only multiplication and division have to round, once, to the fixed exponent
+template <typename Int, int Scale>
+class scaled_decimal
+{
+    static_assert(std::is_integral<Int>::value && std::is_signed<Int>::value && sizeof(Int) <= sizeof(std::int64_t),
+                  "scaled_decimal is only defined for the signed integer types of up to 64 bits");
+    static_assert(Scale <= 0 && -Scale < std::numeric_limits<Int>::digits10,
+                  "The scale must be at most zero and leave at least one integer digit");
+
+public:
+    using integer_type = Int;
+
+private:
+    using unsigned_type = std::make_unsigned_t<Int>;
+
+    // Holds the product of two magnitudes, and a magnitude scaled by 10^(1 - Scale)
+    #ifdef BOOST_DECIMAL_HAS_INT128
+    using wide_type = std::conditional_t<(sizeof(Int) <= sizeof(std::int32_t)), std::uint64_t, detail::uint128_t>;
+    #else
+    using wide_type = std::conditional_t<(sizeof(Int) <= sizeof(std::int32_t)), std::uint64_t, detail::uint128>;
+    #endif
+
+    Int ticks_ {};
+
+    static constexpr auto magnitude(Int val) noexcept -> unsigned_type
+    {
+        return val < 0 ? static_cast<unsigned_type>(-static_cast<unsigned_type>(val)) : static_cast<unsigned_type>(val);
+    }
+
+    static constexpr auto saturated(bool is_neg) noexcept -> scaled_decimal
+    {
+        return from_ticks(detail::saturated_value<Int>(is_neg));
+    }
+
+    static constexpr auto from_magnitude(unsigned_type mag, bool is_neg) noexcept -> scaled_decimal
+    {
+        return from_ticks(detail::from_magnitude<Int>(mag, is_neg));
+    }
+
+    // Rounds away the guard digit according to the current rounding mode.
+    // Unsigned has to be at least as wide as unsigned_type
+    template <typename Unsigned>
+    static constexpr auto round_guard_digit(Unsigned guarded, bool is_neg, bool& overflow) noexcept -> scaled_decimal
+    {
+        const auto max_mag {static_cast<Unsigned>(detail::max_magnitude<Int>(is_neg))};
+
+        // Checked before rounding so that fenv_round never sees more digits than a decimal128 significand
+        if (guarded / static_cast<Unsigned>(10U) > max_mag)
+        {
+            overflow = true;
+            return saturated(is_neg);
+        }
+
+        detail::fenv_round<decimal128>(guarded, is_neg);
+
+        if (guarded > max_mag)
+        {
+            overflow = true;
+            return saturated(is_neg);
+        }
+
+        return from_magnitude(static_cast<unsigned_type>(guarded), is_neg);
+    }
+
+    // Converts the magnitude sig * 10^exp to the fixed exponent
+    template <typename Unsigned>
+    static constexpr auto from_parts(Unsigned significand, int exp, bool is_neg, bool& overflow) noexcept -> scaled_decimal
+    {
+        using promoted_type = std::conditional_t<(sizeof(Unsigned) > sizeof(unsigned_type)), Unsigned, unsigned_type>;
+        const auto sig {static_cast<promoted_type>(significand)};
+
+        if (sig == 0U)
+        {
+            return scaled_decimal{};
+        }
+
+        if (exp < Scale)
+        {
+            return round_guard_digit(detail::div_pow10_to_guard_digit(sig, Scale - exp), is_neg, overflow);
+        }
+
+        const auto shift {exp - Scale};
+        if (shift > std::numeric_limits<unsigned_type>::digits10 ||
+            sig > static_cast<promoted_type>(detail::max_magnitude<Int>(is_neg) / detail::pow10(static_cast<unsigned_type>(shift))))
+        {
+            overflow = true;
+            return saturated(is_neg);
+        }
+
+        return from_magnitude(static_cast<unsigned_type>(static_cast<unsigned_type>(sig) * detail::pow10(static_cast<unsigned_type>(shift))), is_neg);
+    }
+
+    // Rounds num / rhs, where num includes the guard digit
+    template <typename Unsigned>
+    static constexpr auto div_guard_digit(Unsigned num, unsigned_type rhs, bool is_neg) noexcept -> scaled_decimal
+    {
+        auto res {static_cast<Unsigned>(num / rhs)};
+
+        if (res * rhs != num)
+        {
+            const auto guard_digit {static_cast<unsigned>(res % static_cast<Unsigned>(10U))};
+            if (guard_digit == 0U || guard_digit == 5U)
+            {
+                ++res;
+            }
+        }
+
+        bool overflow {};
+        return round_guard_digit(res, is_neg, overflow);
+    }
+
+    // Rounds lhs * 10^digits / rhs to an integer
+    static constexpr auto div_round(unsigned_type lhs, int digits, unsigned_type rhs, bool is_neg) noexcept -> scaled_decimal
+    {
+        const auto factor {detail::pow10(static_cast<std::uint64_t>(digits + 1))};
+
+        // Most numerators fit in 64 bits, where the division is much cheaper than in 128
+        if (lhs <= UINT64_MAX / factor)
+        {
+            return div_guard_digit(static_cast<std::uint64_t>(lhs * factor), rhs, is_neg);
+        }
+
+        return div_guard_digit(static_cast<wide_type>(static_cast<wide_type>(lhs) * factor), rhs, is_neg);
+    }
+
+    template <typename Decimal>
+    static constexpr auto from_decimal(Decimal val, bool& overflow) noexcept -> scaled_decimal
+    {
+        if (isnan(val))
+        {
+            return scaled_decimal{};
+        }
+        else if (isinf(val))
+        {
+            overflow = true;
+            return saturated(signbit(val));
+        }
+
+        int exp {};
+        const auto sig {frexp10(val, &exp)};
+
+        return from_parts(sig, exp, signbit(val), overflow);
+    }
+
+    // Rounds the digits in [first, last), which may include the decimal point, times 10^exp to Scale,
+    // where int_digits of them are in front of the decimal point. Only the digits down to the guard digit
+    // are accumulated and the rest only decide whether the value lies exactly on the guard digit,
+    // so the result is rounded once however many digits there are
+    static constexpr auto from_digits(const char* first, const char* last, int int_digits, int exp, bool is_neg, bool& overflow) noexcept -> scaled_decimal
+    {
+        const auto max_guarded {static_cast<wide_type>(static_cast<wide_type>(detail::max_magnitude<Int>(is_neg)) * 10U + 9U)};
+
+        wide_type guarded {};
+        bool sticky {};
+
+        // The power of ten of the next digit
+        auto pos {exp + int_digits - 1};
+
+        for (; first != last; ++first)
+        {
+            if (*first == '.')
+            {
+                continue;
+            }
+
+            const auto digit {static_cast<unsigned>(*first - '0')};
+
+            if (pos >= Scale - 1)
+            {
+                guarded = static_cast<wide_type>(guarded * 10U + digit);
+
+                if (guarded > max_guarded)
+                {
+                    overflow = true;
+                    return saturated(is_neg);
+                }
+            }
+            else if (digit != 0U)
+            {
+                sticky = true;
+            }
+
+            --pos;
+        }
+
+        // Trailing zeros implied by the exponent down to the guard digit
+        for (; guarded != 0U && pos >= Scale - 1; --pos)
+        {
+            guarded = static_cast<wide_type>(guarded * 10U);
+
+            if (guarded > max_guarded)
+            {
+                overflow = true;
+                return saturated(is_neg);
+            }
+        }
+
+        // As in div_guard_digit a guard digit of 0 or 5 followed by non-zero digits
+        // must not be rounded as an exact zero or tie
+        if (sticky)
+        {
+            const auto guard_digit {static_cast<unsigned>(guarded % static_cast<wide_type>(10U))};
+            if (guard_digit == 0U || guard_digit == 5U)
+            {
+                ++guarded;
+            }
+        }
+
+        return round_guard_digit(guarded, is_neg, overflow);
+    }
+
+    // Reads everything the digits are not parsed for, i.e. non-finite values, invalid strings and chars_format::hex,
+    // through decimal128
+    static constexpr auto from_chars_decimal128(const char* first, const char* last, scaled_decimal& value, chars_format fmt) noexcept -> from_chars_result
+    {
+        decimal128 parsed {};
+        auto r {from_chars(first, last, parsed, fmt)};
+
+        if (isinf(parsed))
+        {
+            r.ec = std::errc::result_out_of_range;
+            return r;
+        }
+        else if (r.ec != std::errc())
+        {
+            return r;
+        }
+        else if (isnan(parsed))
+        {
+            return {first, std::errc::invalid_argument};
+        }
+
+        bool overflow {};
+        const auto res {from_decimal(parsed, overflow)};
+
+        if (overflow)
+        {
+            r.ec = std::errc::result_out_of_range;
+        }
+        else
+        {
+            value = res;
+        }
+
+        return r;
+    }
+
+    template <typename I, int S>
+    friend constexpr auto from_chars(const char* first, const char* last, scaled_decimal<I, S>& value, chars_format fmt) noexcept -> from_chars_result;
+
+public:
+    constexpr scaled_decimal() noexcept = default;
+
+    // The value ticks * 10^Scale
+    static constexpr auto from_ticks(Int ticks) noexcept -> scaled_decimal
+    {
+        scaled_decimal res;
+        res.ticks_ = ticks;
+        return res;
+    }
+
+    static constexpr auto scale() noexcept -> int { return Scale; }
+
+    constexpr auto ticks() const noexcept -> Int { return ticks_; }
+
+    // A whole number, which must be within the range of the type
+    template <typename Integer, std::enable_if_t<detail::is_integral_v<Integer>, bool> = true>
+    explicit constexpr scaled_decimal(Integer val) noexcept
+        : ticks_ {static_cast<Int>(static_cast<Int>(val) * static_cast<Int>(detail::pow10(static_cast<unsigned_type>(-Scale))))} {}
+
+    // Rounds according to the current rounding mode if val has more decimal places than the type,
+    // and saturates to the largest or smallest value if val is out of range. NaN converts to zero
+    template <typename Decimal, std::enable_if_t<detail::is_decimal_floating_point_v<Decimal>, bool> = true>
+    explicit constexpr scaled_decimal(Decimal val) noexcept
+    {
+        bool overflow {};
+        *this = from_decimal(val, overflow);
+    }
+
+    // Exact unless the number of digits of ticks() exceeds the precision of Decimal
+    template <typename Decimal, std::enable_if_t<detail::is_decimal_floating_point_v<Decimal>, bool> = true>
+    explicit constexpr operator Decimal() const noexcept
+    {
+        return Decimal{ticks_, Scale};
+    }
+
+    // Addition and subtraction are exact. As for Int the result must be within range
+    friend constexpr auto operator+(scaled_decimal val) noexcept -> scaled_decimal { return val; }
+    friend constexpr auto operator-(scaled_decimal val) noexcept -> scaled_decimal { return from_ticks(static_cast<Int>(-val.ticks_)); }
+
+    friend constexpr auto operator+(scaled_decimal lhs, scaled_decimal rhs) noexcept -> scaled_decimal
+    {
+        return from_ticks(static_cast<Int>(lhs.ticks_ + rhs.ticks_));
+    }
+
+    friend constexpr auto operator-(scaled_decimal lhs, scaled_decimal rhs) noexcept -> scaled_decimal
+    {
+        return from_ticks(static_cast<Int>(lhs.ticks_ - rhs.ticks_));
+    }
+
+    // The exact product has twice the decimal places, so it is rounded once to Scale.
+    // Results out of range saturate
+    friend constexpr auto operator*(scaled_decimal lhs, scaled_decimal rhs) noexcept -> scaled_decimal
+    {
+        const auto prod {static_cast<wide_type>(static_cast<wide_type>(magnitude(lhs.ticks_)) * magnitude(rhs.ticks_))};
+        const bool is_neg {(lhs.ticks_ < 0) != (rhs.ticks_ < 0)};
+        bool overflow {};
+
+        // As in div_round the rescaling is much cheaper for products that fit in 64 bits
+        if (prod <= static_cast<wide_type>(UINT64_MAX))
+        {
+            return from_parts(static_cast<std::uint64_t>(prod), 2 * Scale, is_neg, overflow);
+        }
+
+        return from_parts(prod, 2 * Scale, is_neg, overflow);
+    }
+
+    // Rounded once to Scale. Results out of range, and division of a non-zero value by zero, saturate
+    friend constexpr auto operator/(scaled_decimal lhs, scaled_decimal rhs) noexcept -> scaled_decimal
+    {
+        const bool is_neg {(lhs.ticks_ < 0) != (rhs.ticks_ < 0)};
+
+        if (rhs.ticks_ == 0)
+        {
+            return lhs.ticks_ == 0 ? scaled_decimal{} : saturated(lhs.ticks_ < 0);
+        }
+
+        return div_round(magnitude(lhs.ticks_), -Scale, magnitude(rhs.ticks_), is_neg);
+    }
+
+    // Multiplication by a whole number is exact. As for Int the result must be within range
+    friend constexpr auto operator*(scaled_decimal lhs, Int rhs) noexcept -> scaled_decimal
+    {
+        return from_ticks(static_cast<Int>(lhs.ticks_ * rhs));
+    }
+
+    friend constexpr auto operator*(Int lhs, scaled_decimal rhs) noexcept -> scaled_decimal
+    {
+        return from_ticks(static_cast<Int>(lhs * rhs.ticks_));
+    }
+
+    // Rounded to Scale, e.g. for splitting an amount in equal parts
+    friend constexpr auto operator/(scaled_decimal lhs, Int rhs) noexcept -> scaled_decimal
+    {
+        if (rhs == 0)
+        {
+            return lhs.ticks_ == 0 ? scaled_decimal{} : saturated(lhs.ticks_ < 0);
+        }
+
+        return div_round(magnitude(lhs.ticks_), 0, magnitude(rhs), (lhs.ticks_ < 0) != (rhs < 0));
+    }
+
+    constexpr auto operator+=(scaled_decimal rhs) noexcept -> scaled_decimal& { return *this = *this + rhs; }
+    constexpr auto operator-=(scaled_decimal rhs) noexcept -> scaled_decimal& { return *this = *this - rhs; }
+    constexpr auto operator*=(scaled_decimal rhs) noexcept -> scaled_decimal& { return *this = *this * rhs; }
+    constexpr auto operator/=(scaled_decimal rhs) noexcept -> scaled_decimal& { return *this = *this / rhs; }
+    constexpr auto operator*=(Int rhs) noexcept -> scaled_decimal& { return *this = *this * rhs; }
+    constexpr auto operator/=(Int rhs) noexcept -> scaled_decimal& { return *this = *this / rhs; }
+
+    friend constexpr auto operator==(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ == rhs.ticks_; }
+    friend constexpr auto operator!=(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ != rhs.ticks_; }
+    friend constexpr auto operator<(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ < rhs.ticks_; }
+    friend constexpr auto operator<=(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ <= rhs.ticks_; }
+    friend constexpr auto operator>(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ > rhs.ticks_; }
+    friend constexpr auto operator>=(scaled_decimal lhs, scaled_decimal rhs) noexcept -> bool { return lhs.ticks_ >= rhs.ticks_; }
+};
+
+// Writes the value in fixed format with exactly -Scale decimal places, e.g. -123.40
+BOOST_DECIMAL_EXPORT template <typename Int, int Scale>
+constexpr auto to_chars(char* first, char* last, scaled_decimal<Int, Scale> value) noexcept -> to_chars_result
+{
+    using unsigned_type = std::make_unsigned_t<Int>;
+
+    if (first >= last)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    const auto ticks {value.ticks()};
+    auto mag {ticks < 0 ? static_cast<unsigned_type>(-static_cast<unsigned_type>(ticks)) : static_cast<unsigned_type>(ticks)};
+
+    // Digits are produced from the lowest, with at least one integer digit
+    char buffer[std::numeric_limits<unsigned_type>::digits10 + 3] {};
+    int num_chars {};
+    const auto min_digits {1 - Scale};
+    for (int digit {}; mag != 0U || digit < min_digits; ++digit)
+    {
+        if (Scale != 0 && digit == -Scale)
+        {
+            buffer[num_chars++] = '.';
+        }
+
+        buffer[num_chars++] = static_cast<char>('0' + static_cast<int>(mag % 10U));
+        mag /= 10U;
+    }
+
+    if (last - first < num_chars + (ticks < 0 ? 1 : 0))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    if (ticks < 0)
+    {
+        *first++ = '-';
+    }
+
+    while (num_chars > 0)
+    {
+        *first++ = buffer[--num_chars];
+    }
+
+    return {first, std::errc()};
+}
+
+// Parses any of the formats of from_chars for the decimal types.
+// The digits are read directly into the ticks and rounded once to Scale according to the current rounding mode,
+// however many there are. Only chars_format::hex is read as a decimal128 first, which rounds it to 34 digits before.
+// Values out of range, including infinity, give std::errc::result_out_of_range and NaN gives std::errc::invalid_argument.
+// In both cases value is not modified
+template <typename Int, int Scale>
+constexpr auto from_chars(const char* first, const char* last, scaled_decimal<Int, Scale>& value, chars_format fmt) noexcept -> from_chars_result
+{
+    // Exponents are only accumulated up to this bound, beyond which every non-zero value overflows or rounds to zero
+    constexpr int max_exp {100000000};
+
+    if (fmt == chars_format::hex)
+    {
+        return scaled_decimal<Int, Scale>::from_chars_decimal128(first, last, value, fmt);
+    }
+
+    auto next {first};
+    const bool is_neg {next != last && *next == '-'};
+    if (is_neg)
+    {
+        ++next;
+    }
+
+    const auto digits_first {next};
+    int int_digits {};
+    int num_digits {};
+
+    while (next != last && detail::is_integer_char(*next))
+    {
+        ++next;
+        ++int_digits;
+    }
+
+    num_digits = int_digits;
+
+    if (next != last && *next == '.')
+    {
+        ++next;
+
+        while (next != last && detail::is_integer_char(*next))
+        {
+            ++next;
+            ++num_digits;
+        }
+    }
+
+    if (num_digits == 0)
+    {
+        return scaled_decimal<Int, Scale>::from_chars_decimal128(first, last, value, fmt);
+    }
+
+    const auto digits_last {next};
+    int exp {};
+    bool has_exp {};
+
+    if (fmt != chars_format::fixed && next != last && (*next == 'e' || *next == 'E'))
+    {
+        auto exp_next {next + 1};
+        const bool exp_is_neg {exp_next != last && *exp_next == '-'};
+
+        if (exp_next != last && (*exp_next == '-' || *exp_next == '+'))
+        {
+            ++exp_next;
+        }
+
+        const auto exp_digits_first {exp_next};
+
+        while (exp_next != last && detail::is_integer_char(*exp_next))
+        {
+            if (exp < max_exp)
+            {
+                exp = exp * 10 + (*exp_next - '0');
+            }
+
+            ++exp_next;
+        }
+
+        // Without any digits the e is not part of the number
+        if (exp_next != exp_digits_first)
+        {
+            has_exp = true;
+            next = exp_next;
+            exp = exp_is_neg ? -exp : exp;
+        }
+    }
+
+    if (fmt == chars_format::scientific && !has_exp)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    bool overflow {};
+    const auto res {scaled_decimal<Int, Scale>::from_digits(digits_first, digits_last, int_digits, exp, is_neg, overflow)};
+
+    if (overflow)
+    {
+        return {next, std::errc::result_out_of_range};
+    }
+
+    value = res;
+
+    return {next, std::errc()};
+}
+
+} // namespace decimal
+} // namespace boost
+
+#endif // BOOST_DECIMAL_SCALED_DECIMAL_HPP
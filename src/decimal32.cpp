@@ -0,0 +1,23 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+
+namespace boost {
+namespace decimal {
+
+BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(, decimal32)
+BOOST_DECIMAL_DETAIL_INSTANTIATE_TRANSCENDENTAL(, decimal32)
+
+namespace detail {
+
+auto BOOST_DECIMAL_DETAIL_COMPILED_SETTINGS() noexcept -> int
+{
+    return 0;
+}
+
+} // namespace detail
+
+} // namespace decimal
+} // namespace boost
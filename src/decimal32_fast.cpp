@@ -0,0 +1,13 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+
+namespace boost {
+namespace decimal {
+
+BOOST_DECIMAL_DETAIL_INSTANTIATE_COMMON(, decimal32_fast)
+
+} // namespace decimal
+} // namespace boost
@@ -414,6 +414,38 @@ void random_mixed_division(T lower, T upper)
     BOOST_TEST(isinf(val1 / zero));
 }
 
+// An operand too small to change the result leaves the sign of the other one as it would be
+void spot_check_distant_subtraction()
+{
+    const decimal128 big {264, -1};
+    const decimal128 small {4, -80};
+
+    BOOST_TEST_EQ(big - small, big);
+    BOOST_TEST_EQ(big - (-small), big);
+    BOOST_TEST_EQ(-big - small, -big);
+    BOOST_TEST_EQ(-big - (-small), -big);
+    BOOST_TEST_EQ(small - big, -big);
+    BOOST_TEST_EQ(small - (-big), big);
+    BOOST_TEST_EQ(-small - big, -big);
+    BOOST_TEST_EQ(-small - (-big), big);
+    BOOST_TEST_EQ(-big + small, -big);
+    BOOST_TEST_EQ(small + (-big), -big);
+}
+
+// The integer operand of a mixed division is normalized like a decimal one,
+// so that 1 / x keeps all the digits of the quotient
+void spot_check_mixed_division()
+{
+    const decimal128 divisors[] = {decimal128{69, -1}, decimal128{7}, decimal128{-3}, decimal128{123456, -4}, decimal128{1, 10}};
+
+    for (const auto divisor : divisors)
+    {
+        BOOST_TEST_EQ(1 / divisor, decimal128{1} / divisor);
+        BOOST_TEST_EQ(-25 / divisor, decimal128{-25} / divisor);
+        BOOST_TEST_EQ(1234567LL / divisor, decimal128{1234567LL} / divisor);
+    }
+}
+
 void random_and()
 {
     std::uniform_int_distribution<std::uint64_t> dist(0, 9'999'999'999'999'999);
@@ -945,6 +977,8 @@ int main()
     random_mixed_division(-5'000, 5'000);
     random_mixed_division(-5'000LL, 5'000LL);
     random_mixed_division(-sqrt_int_max, sqrt_int_max);
+    spot_check_mixed_division();
+    spot_check_distant_subtraction();
 
     // Bitwise operators
     #if BOOST_DECIMAL_ENDIAN_LITTLE_BYTE
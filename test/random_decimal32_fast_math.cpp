@@ -412,6 +412,38 @@ void random_mixed_division(T lower, T upper)
     BOOST_TEST(isinf(val1 / zero));
 }
 
+// An operand too small to change the result leaves the sign of the other one as it would be
+void spot_check_distant_subtraction()
+{
+    const decimal32_fast big {264, -1};
+    const decimal32_fast small {4, -80};
+
+    BOOST_TEST_EQ(big - small, big);
+    BOOST_TEST_EQ(big - (-small), big);
+    BOOST_TEST_EQ(-big - small, -big);
+    BOOST_TEST_EQ(-big - (-small), -big);
+    BOOST_TEST_EQ(small - big, -big);
+    BOOST_TEST_EQ(small - (-big), big);
+    BOOST_TEST_EQ(-small - big, -big);
+    BOOST_TEST_EQ(-small - (-big), big);
+    BOOST_TEST_EQ(-big + small, -big);
+    BOOST_TEST_EQ(small + (-big), -big);
+}
+
+// The integer operand of a mixed division is normalized like a decimal one,
+// so that 1 / x keeps all the digits of the quotient
+void spot_check_mixed_division()
+{
+    const decimal32_fast divisors[] = {decimal32_fast{69, -1}, decimal32_fast{7}, decimal32_fast{-3}, decimal32_fast{123456, -4}, decimal32_fast{1, 10}};
+
+    for (const auto divisor : divisors)
+    {
+        BOOST_TEST_EQ(1 / divisor, decimal32_fast{1} / divisor);
+        BOOST_TEST_EQ(-25 / divisor, decimal32_fast{-25} / divisor);
+        BOOST_TEST_EQ(1234567LL / divisor, decimal32_fast{1234567LL} / divisor);
+    }
+}
+
 /*
 void random_and()
 {
@@ -970,6 +1002,8 @@ int main()
     random_mixed_division(-5'000L, 5'000L);
     random_mixed_division(-5'000LL, 5'000LL);
     random_mixed_division(-sqrt_int_max, sqrt_int_max);
+    spot_check_mixed_division();
+    spot_check_distant_subtraction();
 
     /*
     // Bitwise operators
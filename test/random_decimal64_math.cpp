@@ -402,6 +402,38 @@ void random_mixed_division(T lower, T upper)
     BOOST_TEST(isinf(val1 / zero));
 }
 
+// An operand too small to change the result leaves the sign of the other one as it would be
+void spot_check_distant_subtraction()
+{
+    const decimal64 big {264, -1};
+    const decimal64 small {4, -80};
+
+    BOOST_TEST_EQ(big - small, big);
+    BOOST_TEST_EQ(big - (-small), big);
+    BOOST_TEST_EQ(-big - small, -big);
+    BOOST_TEST_EQ(-big - (-small), -big);
+    BOOST_TEST_EQ(small - big, -big);
+    BOOST_TEST_EQ(small - (-big), big);
+    BOOST_TEST_EQ(-small - big, -big);
+    BOOST_TEST_EQ(-small - (-big), big);
+    BOOST_TEST_EQ(-big + small, -big);
+    BOOST_TEST_EQ(small + (-big), -big);
+}
+
+// The integer operand of a mixed division is normalized like a decimal one,
+// so that 1 / x keeps all the digits of the quotient
+void spot_check_mixed_division()
+{
+    const decimal64 divisors[] = {decimal64{69, -1}, decimal64{7}, decimal64{-3}, decimal64{123456, -4}, decimal64{1, 10}};
+
+    for (const auto divisor : divisors)
+    {
+        BOOST_TEST_EQ(1 / divisor, decimal64{1} / divisor);
+        BOOST_TEST_EQ(-25 / divisor, decimal64{-25} / divisor);
+        BOOST_TEST_EQ(1234567LL / divisor, decimal64{1234567LL} / divisor);
+    }
+}
+
 void random_and()
 {
     std::uniform_int_distribution<std::uint64_t> dist(0, 9'999'999'999'999'999);
@@ -933,6 +965,8 @@ int main()
     random_mixed_division(-5'000, 5'000);
     random_mixed_division(-5'000LL, 5'000LL);
     random_mixed_division(-sqrt_int_max, sqrt_int_max);
+    spot_check_mixed_division();
+    spot_check_distant_subtraction();
 
     // Spot checked values
     spot_check_sub(945501, 80);
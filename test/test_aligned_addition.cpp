@@ -0,0 +1,129 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <random>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+// Signed coefficients with up to max_digits digits
+auto random_coefficient(int max_digits) -> std::int64_t
+{
+    std::int64_t max_coeff {1};
+    for (int i {}; i < max_digits; ++i)
+    {
+        max_coeff *= 10;
+    }
+
+    std::uniform_int_distribution<std::int64_t> dist(-(max_coeff - 1), max_coeff - 1);
+    return dist(rng);
+}
+
+// Operands with the same exponent give the exact sum and difference when it fits in the precision,
+// and the rounded one otherwise, matching operands whose exponents differ
+template <typename T>
+void test_same_exponent(int max_digits)
+{
+    std::uniform_int_distribution<std::int32_t> exp_dist(-20, 20);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto a {random_coefficient(max_digits)};
+        const auto b {random_coefficient(max_digits)};
+        const auto exp {exp_dist(rng)};
+
+        const T lhs {a, exp};
+        const T rhs {b, exp};
+
+        BOOST_TEST_EQ(lhs + rhs, (T{a + b, exp}));
+        BOOST_TEST_EQ(lhs - rhs, (T{a - b, exp}));
+
+        // The same rhs with another exponent goes through the general path
+        if (b % 10 == 0)
+        {
+            const T other_rhs {b / 10, exp + 1};
+
+            BOOST_TEST_EQ(lhs + rhs, lhs + other_rhs);
+            BOOST_TEST_EQ(lhs - rhs, lhs - other_rhs);
+        }
+    }
+}
+
+// A running total of amounts in cents stays exact
+template <typename T>
+void test_ledger(int max_digits)
+{
+    T total {};
+    std::int64_t expected {};
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto cents {random_coefficient(max_digits)};
+
+        total += T{cents, -2};
+        expected += cents;
+
+        BOOST_TEST_EQ(total, (T{expected, -2}));
+    }
+}
+
+template <typename T>
+void test_zero_signs()
+{
+    const T pos_zero {0, 0};
+    const T neg_zero {0, 0, true};
+    const T val {12345, -2};
+
+    BOOST_TEST(signbit(neg_zero + neg_zero));
+    BOOST_TEST(!signbit(neg_zero + pos_zero));
+    BOOST_TEST(!signbit(pos_zero + neg_zero));
+    BOOST_TEST(!signbit(neg_zero - pos_zero));
+    BOOST_TEST(!signbit(neg_zero - neg_zero));
+    BOOST_TEST(!signbit(pos_zero - pos_zero));
+
+    BOOST_TEST(!signbit(val - val));
+    BOOST_TEST(!signbit(-val + val));
+    BOOST_TEST(!signbit(val + -val));
+    BOOST_TEST(!signbit(-val - -val));
+
+    // Zeros with any exponent add exactly
+    BOOST_TEST_EQ(T(0, 5) + val, val);
+    BOOST_TEST_EQ(val + T(0, -7, true), val);
+    BOOST_TEST_EQ(T(0, 3) - val, -val);
+    BOOST_TEST_EQ(-val - T(0, -3), -val);
+    BOOST_TEST(signbit(T(0, 5) - val));
+    BOOST_TEST(signbit(T(0, 5, true) + -val));
+}
+
+int main()
+{
+    test_same_exponent<decimal32>(7);
+    test_same_exponent<decimal64>(16);
+    test_same_exponent<decimal128>(18);
+    test_same_exponent<decimal32_fast>(7);
+
+    // The totals have to stay within the precision of the type
+    test_ledger<decimal32>(3);
+    test_ledger<decimal64>(7);
+    test_ledger<decimal128>(7);
+    test_ledger<decimal32_fast>(3);
+
+    test_zero_signs<decimal32>();
+    test_zero_signs<decimal64>();
+    test_zero_signs<decimal128>();
+    test_zero_signs<decimal32_fast>();
+
+    return boost::report_errors();
+}
@@ -26,7 +26,11 @@
 
 #include <boost/math/special_functions/next.hpp>
 #include <boost/core/lightweight_test.hpp>
+#include <array>
+#include <cstring>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <cmath>
 
@@ -290,6 +294,43 @@ void test_atan()
     BOOST_TEST_EQ(atan(std::numeric_limits<Dec>::epsilon() * Dec(one(rng))), std::numeric_limits<Dec>::epsilon() * Dec(one(rng)));
 }
 
+struct atan_point
+{
+    const char* x;
+    const char* result;
+};
+
+// atan(x) to 40 digits, e.g. N[ArcTan[7/16], 40], which have to be within three ulp.
+// The polynomials of decimal64 and decimal128 used to be accurate to far fewer digits than the types hold
+template <typename Dec, std::size_t N>
+void test_atan_accuracy(const std::array<atan_point, N>& points)
+{
+    for (const auto& pt : points)
+    {
+        Dec x {};
+        static_cast<void>(from_chars(pt.x, pt.x + std::strlen(pt.x), x));
+
+        Dec ref {};
+        static_cast<void>(from_chars(pt.result, pt.result + std::strlen(pt.result), ref));
+
+        int ref_exp {};
+        static_cast<void>(frexp10(ref, &ref_exp));
+
+        const Dec tol {3, ref_exp};
+        const Dec val {atan(x)};
+
+        if (!BOOST_TEST(fabs(val - ref) <= tol))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::setprecision(std::numeric_limits<Dec>::digits10)
+                      << "atan(" << x << ")"
+                      << "\nval: " << val
+                      << "\nref: " << ref << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    }
+}
+
 namespace local {
 
 auto test_atan_128(const int tol_factor) -> bool
@@ -385,5 +426,84 @@ int main()
         BOOST_TEST(result_pos128_is_ok);
     }
 
+    {
+        const std::array<atan_point, 18U> points
+        {{
+    { "0.25", "0.2449786631268641541720824812112758109141" },
+    { "0.3", "0.2914567944778670919956046214328911935032" },
+    { "0.4375", "0.4124104415973873068997912896671269370468" },
+    { "0.03125", "0.03123983343026827625371174489249097703250" },
+    { "0.0625", "0.06241880999595734847397911298550511360627" },
+    { "0.5", "0.4636476090008061162142562314612144020285" },
+    { "1", "0.7853981633974483096156608458198757210493" },
+    { "1.5", "0.9827937232473290679857106110146660144969" },
+    { "0.001", "0.0009999996666668666665238096349205440116209" },
+    { "100", "1.560796660108231381024981575430471893537" },
+    { "0.3619761", "0.3473038580862061397339955726080283781337" },
+    { "0.2217556", "0.2182242384304694779319976194422184441844" },
+    { "0.5919541", "0.5344823921165004717435298290149985817541" },
+    { "0.6479800", "0.5749538744631124921990342947446527552003" },
+    { "1.104775", "0.8351367738253223650287045019314443123128" },
+    { "0.9450089", "0.7571327634354623362111814799679447803467" },
+    { "30.72796", "1.538264157577394032653842142482492341984" },
+    { "18.47207", "1.516713334482353643904290995369225693047" },
+        }};
+
+        test_atan_accuracy<decimal32>(points);
+    }
+
+    {
+        const std::array<atan_point, 18U> points
+        {{
+    { "0.25", "0.2449786631268641541720824812112758109141" },
+    { "0.3", "0.2914567944778670919956046214328911935032" },
+    { "0.4375", "0.4124104415973873068997912896671269370468" },
+    { "0.03125", "0.03123983343026827625371174489249097703250" },
+    { "0.0625", "0.06241880999595734847397911298550511360627" },
+    { "0.5", "0.4636476090008061162142562314612144020285" },
+    { "1", "0.7853981633974483096156608458198757210493" },
+    { "1.5", "0.9827937232473290679857106110146660144969" },
+    { "0.001", "0.0009999996666668666665238096349205440116209" },
+    { "100", "1.560796660108231381024981575430471893537" },
+    { "0.3254044227295658", "0.3145976421158584439984518859494293331945" },
+    { "0.2256159622843988", "0.2219006467222270064528702825703736825503" },
+    { "0.6082374834583242", "0.5464544676869006173843498761624830501936" },
+    { "0.5876670904374450", "0.5313018265390016014396714874127419662169" },
+    { "0.8284622614282025", "0.6918566499431644889357587621700445664863" },
+    { "0.8767864218840995", "0.7198408831015643686692413192631217272395" },
+    { "35.64765758207000", "1.542751347672991208122129377535807983125" },
+    { "21.96651288222239", "1.525303896729709982346509756648200234136" },
+        }};
+
+        test_atan_accuracy<decimal64>(points);
+    }
+
+    {
+        const std::array<atan_point, 19U> points
+        {{
+    { "0.25", "0.2449786631268641541720824812112758109141" },
+    { "0.3", "0.2914567944778670919956046214328911935032" },
+    { "0.4375", "0.4124104415973873068997912896671269370468" },
+    { "0.03125", "0.03123983343026827625371174489249097703250" },
+    { "0.0625", "0.06241880999595734847397911298550511360627" },
+    { "0.5", "0.4636476090008061162142562314612144020285" },
+    { "1", "0.7853981633974483096156608458198757210493" },
+    { "1.5", "0.9827937232473290679857106110146660144969" },
+    { "0.001", "0.0009999996666668666665238096349205440116209" },
+    { "100", "1.560796660108231381024981575430471893537" },
+    { "0.4279088150899308384822461448493414", "0.4043318578620003236292306627459450229484" },
+    { "0.4306732916417770340444803878199309", "0.4066661460036743376333772295054544885123" },
+    { "0.6470906511871357125187387282494456", "0.5743272644663039318077086274367125501953" },
+    { "0.4602568753307814675146403260441730", "0.4313507333544056039658337270595459031670" },
+    { "0.7250763160872047974336851439147722", "0.6273582132963409741863560095209670880537" },
+    { "0.8317929913465034186259572379640304", "0.6938285329885449992389443328332622498675" },
+    { "18.09182441724691869922025944106281", "1.515578928595320405541583005513846596359" },
+    { "34.18810722922496836417849408462644", "1.541554726687512678032913339196220537501" },
+    { "0.4374153206334722731879697521805106", "0.4123393642469003755588840488877174452084" },
+        }};
+
+        test_atan_accuracy<decimal128>(points);
+    }
+
     return boost::report_errors();
 }
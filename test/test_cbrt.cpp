@@ -188,8 +188,9 @@ namespace local
 
         bool result_val_p10_is_ok { };
 
-        const int np_mod3 = np % 3;
-        const int np_div3 = np / 3;
+        // With np = 3 * q + r and r in {0, 1, 2} the result is 10^q times the correctly rounded cbrt(10^r)
+        const int np_mod3 = ((np % 3) + 3) % 3;
+        const int np_div3 = (np - np_mod3) / 3;
 
         if(np_mod3 == 0)
         {
@@ -197,26 +198,10 @@ namespace local
         }
         else
         {
-          decimal_type val_p10_ctrl { 1, np_div3 };
+          const decimal_type cbrt100 { UINT64_C(4641588833612778892), -18 };
 
-          switch (np_mod3)
-          {
-            case 2:
-                val_p10_ctrl *= boost::decimal::numbers::cbrt10_v<decimal_type>;
-                // fallthrough
-
-            case 1:
-                val_p10_ctrl *= boost::decimal::numbers::cbrt10_v<decimal_type>;
-                break;
-
-            case -2:
-                val_p10_ctrl /= boost::decimal::numbers::cbrt10_v<decimal_type>;
-                // fallthrough
-
-            case -1:
-                val_p10_ctrl /= boost::decimal::numbers::cbrt10_v<decimal_type>;
-                break;
-          }
+          const decimal_type val_p10_ctrl =
+            decimal_type { 1, np_div3 } * ((np_mod3 == 1) ? boost::decimal::numbers::cbrt10_v<decimal_type> : cbrt100);
 
           result_val_p10_is_ok = (val_p10 == val_p10_ctrl);
         }
@@ -335,6 +320,32 @@ namespace local
     return result_is_ok;
   }
 
+  template<typename DecimalType>
+  auto test_cbrt_rounding(const std::array<const char*, 9U>& arg_strings, const std::array<const char*, 9U>& ctrl_strings) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < arg_strings.size(); ++i)
+    {
+      decimal_type x_arg { };
+      decimal_type ctrl { };
+
+      static_cast<void>(from_chars(arg_strings[i], arg_strings[i] + std::strlen(arg_strings[i]), x_arg));
+      static_cast<void>(from_chars(ctrl_strings[i], ctrl_strings[i] + std::strlen(ctrl_strings[i]), ctrl));
+
+      // The root is correctly rounded, so it has to match the control to the last digit
+      const auto result_cbrt_is_ok = (cbrt(x_arg) == ctrl);
+
+      BOOST_TEST(result_cbrt_is_ok);
+
+      result_is_ok = (result_cbrt_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
 } // namespace local
 
 int main()
@@ -387,6 +398,64 @@ int main()
     result_is_ok = (result_edge_is_ok && result_is_ok);
   }
 
+  {
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact cube and four integers whose roots lie close to halfway between two representable values
+    // Table[N[x^(1/3), 7], {x, {2, 3/10, 123456*^-20, 123456*^20, 1/64, 6418, 9177, 10165, 15420}}]
+    const auto result_rounding32_is_ok = local::test_cbrt_rounding<boost::decimal::decimal32>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "0.015625", "6418", "9177", "10165", "15420" }},
+      {{
+         "1.259921E+0",
+         "6.694330E-1",
+         "1.072764E-5",
+         "2.311199E+8",
+         "2.500000E-1",
+         "1.858374E+1",
+         "2.093631E+1",
+         "2.166220E+1",
+         "2.489018E+1"
+      }}
+    );
+
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact cube and four integers whose roots lie close to halfway between two representable values
+    // Table[N[x^(1/3), 16], {x, {2, 3/10, 123456*^-20, 123456*^20, 1/64, 568, 4364, 6991, 11720}}]
+    const auto result_rounding64_is_ok = local::test_cbrt_rounding<boost::decimal::decimal64>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "0.015625", "568", "4364", "6991", "11720" }},
+      {{
+         "1.259921049894873E+0",
+         "6.694329500821695E-1",
+         "1.072763694322832E-5",
+         "2.311199317255868E+8",
+         "2.500000000000000E-1",
+         "8.281635498845707E+0",
+         "1.634161272133467E+1",
+         "1.912111003516740E+1",
+         "2.271481499084082E+1"
+      }}
+    );
+
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact cube and four integers whose roots lie close to halfway between two representable values
+    // Table[N[x^(1/3), 34], {x, {2, 3/10, 123456*^-20, 123456*^20, 1/64, 782, 1886, 3503, 8422}}]
+    const auto result_rounding128_is_ok = local::test_cbrt_rounding<boost::decimal::decimal128>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "0.015625", "782", "1886", "3503", "8422" }},
+      {{
+         "1.259921049894873164767210607278228E+0",
+         "6.694329500821695218826593246399308E-1",
+         "1.072763694322831704548693173735276E-5",
+         "2.311199317255868382454796389154119E+8",
+         "2.500000000000000000000000000000000E-1",
+         "9.213025029190486583284670931364244E+0",
+         "1.235512744195382427374212625184418E+1",
+         "1.518728160478964399628197931082872E+1",
+         "2.034565826878994254883930915342125E+1"
+      }}
+    );
+
+    result_is_ok = (result_rounding32_is_ok && result_rounding64_is_ok && result_rounding128_is_ok && result_is_ok);
+  }
+
   {
     const auto result_cbrt128_is_ok = local::test_cbrt_128(96);
 
@@ -389,6 +389,21 @@ void test_fma()
     BOOST_TEST_EQ(Dec(1, 0) + Dec(1, 0, true), Dec(0, 0));
     BOOST_TEST_EQ(fma(Dec(1, -1), Dec(1, 1), Dec(1, 0, true)), Dec(0, 0));
 
+    // The product is not rounded before the addition: (1 + ulp) * (1 - ulp) - 1 = -ulp^2
+    constexpr int digits {std::numeric_limits<Dec>::digits10};
+    const Dec ulp {1, 1 - digits};
+    BOOST_TEST_EQ(fma(Dec(1) + ulp, Dec(1) - ulp, Dec(-1)), Dec(1, 2 - 2 * digits, true));
+
+    // (1 + 2 ulp) * 1.25 = 1.25 + 2.5 ulp lies halfway between two values,
+    // so an addend far below the last digit still decides the rounding
+    const Dec halfway_x {Dec(1) + ulp + ulp};
+    const Dec halfway_y {125, -2};
+    const Dec tiny {1, -3 * digits};
+    BOOST_TEST_EQ(fma(halfway_x, halfway_y, Dec(0)), halfway_y + ulp + ulp + ulp);
+    BOOST_TEST_EQ(fma(halfway_x, halfway_y, tiny), halfway_y + ulp + ulp + ulp);
+    BOOST_TEST_EQ(fma(halfway_x, halfway_y, -tiny), halfway_y + ulp + ulp);
+    BOOST_TEST_EQ(fma(-halfway_x, halfway_y, tiny), -(halfway_y + ulp + ulp));
+
     std::uniform_real_distribution<double> dist(-1e3, 1e3);
 
     constexpr auto max_iter {std::is_same<Dec, decimal128>::value ? N / 4 : N};
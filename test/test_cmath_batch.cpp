@@ -0,0 +1,306 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The batched functions must give the same results as the scalar functions applied to each element
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+auto same_value(T lhs, T rhs) -> bool
+{
+    if (isnan(lhs) || isnan(rhs))
+    {
+        return isnan(lhs) && isnan(rhs);
+    }
+
+    return (lhs == rhs) && (signbit(lhs) == signbit(rhs));
+}
+
+template <typename T>
+auto make_data() -> std::vector<T>
+{
+    std::uniform_real_distribution<double> dist(-40.0, 40.0);
+
+    std::vector<T> data;
+
+    for (int i {}; i < 300; ++i)
+    {
+        data.emplace_back(dist(rng));
+    }
+
+    // Special values interleaved with the regular ones, also across a block boundary
+    const T specials[] = {
+        T{0}, -T{0}, T{1}, -T{1},
+        std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(),
+        std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::denorm_min(),
+        std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(),
+        T{1, std::numeric_limits<T>::max_exponent10 - 1}, T{1, std::numeric_limits<T>::min_exponent10}
+    };
+
+    std::size_t pos {5U};
+    for (const auto val : specials)
+    {
+        data.insert(data.begin() + static_cast<std::ptrdiff_t>(pos), val);
+        pos += 11U;
+    }
+
+    return data;
+}
+
+template <typename T, typename Batch, typename Scalar>
+void check_unary(const std::vector<T>& data, Batch batch, Scalar scalar)
+{
+    std::vector<T> out(data.size());
+    batch(data.data(), out.data(), data.size());
+
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        if (!BOOST_TEST(same_value(out[i], scalar(data[i]))))
+        {
+            std::cerr << "x: " << data[i] << "\nbatch: " << out[i] << "\nscalar: " << scalar(data[i]) << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    // In place
+    auto in_place {data};
+    batch(in_place.data(), in_place.data(), in_place.size());
+
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(in_place[i], out[i]));
+    }
+}
+
+template <typename T>
+void test_batch()
+{
+    const auto data {make_data<T>()};
+
+    check_unary(data, [](const T* x, T* out, std::size_t n) { detail::exp_batch(x, out, n); }, [](T x) { return exp(x); });
+    check_unary(data, [](const T* x, T* out, std::size_t n) { detail::log_batch(x, out, n); }, [](T x) { return log(x); });
+    check_unary(data, [](const T* x, T* out, std::size_t n) { detail::sqrt_batch(x, out, n); }, [](T x) { return sqrt(x); });
+    check_unary(data, [](const T* x, T* out, std::size_t n) { detail::lgamma_batch(x, out, n); }, [](T x) { return lgamma(x); });
+
+    // Integral arguments take the lookup path of lgamma
+    std::vector<T> integral_data;
+    for (int i {1}; i < 300; ++i)
+    {
+        integral_data.emplace_back(i);
+        integral_data.emplace_back(i, -1);
+    }
+
+    check_unary(integral_data, [](const T* x, T* out, std::size_t n) { detail::lgamma_batch(x, out, n); }, [](T x) { return lgamma(x); });
+
+    const T exponents[] = {
+        T{0}, T{3}, T{-2}, T{5, -1}, T{25, -1}, T{-13, -1}, T{1, -20},
+        std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN()
+    };
+
+    for (const auto a : exponents)
+    {
+        check_unary(data, [a](const T* x, T* out, std::size_t n) { detail::pow_batch(x, a, out, n); }, [a](T x) { return pow(x, a); });
+    }
+
+    std::vector<T> a_values(data.size());
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        a_values[i] = exponents[i % (sizeof(exponents) / sizeof(exponents[0]))];
+    }
+
+    std::vector<T> out(data.size());
+    detail::pow_batch(data.data(), a_values.data(), out.data(), data.size());
+
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(out[i], pow(data[i], a_values[i])));
+    }
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    const std::span<const T> x {data};
+    std::vector<T> span_out(data.size());
+
+    exp(x, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], exp(data[i])));
+    }
+
+    log(x, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], log(data[i])));
+    }
+
+    sqrt(x, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], sqrt(data[i])));
+    }
+
+    lgamma(x, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], lgamma(data[i])));
+    }
+
+    pow(x, T{25, -1}, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], pow(data[i], T{25, -1})));
+    }
+
+    pow(x, std::span<const T>{a_values}, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], pow(data[i], a_values[i])));
+    }
+
+    #endif
+}
+
+// Rounds coeff / 10^digits half away from zero, as the default rounding mode
+auto round_coefficient(std::int64_t coeff, int digits) -> std::int64_t
+{
+    std::int64_t divisor {1};
+    for (int i {}; i < digits; ++i)
+    {
+        divisor *= 10;
+    }
+
+    const auto quotient {coeff / divisor};
+    const auto remainder {coeff % divisor};
+
+    if (2 * (remainder < 0 ? -remainder : remainder) >= divisor)
+    {
+        return coeff < 0 ? quotient - 1 : quotient + 1;
+    }
+
+    return quotient;
+}
+
+template <typename T>
+void test_quantize_batch(int max_digits)
+{
+    std::int64_t max_coeff {1};
+    for (int i {}; i < max_digits; ++i)
+    {
+        max_coeff *= 10;
+    }
+
+    std::uniform_int_distribution<std::int64_t> coeff_dist(-(max_coeff - 1), max_coeff - 1);
+    std::uniform_int_distribution<int> exp_dist(-6, 0);
+
+    std::vector<T> data;
+    std::vector<T> expected;
+    for (int i {}; i < 500; ++i)
+    {
+        const auto coeff {coeff_dist(rng)};
+        const auto exp {exp_dist(rng)};
+
+        data.emplace_back(coeff, exp);
+        const auto expected_coeff {exp < -2 ? round_coefficient(coeff, -2 - exp) : coeff * (exp == -1 ? 10 : (exp == 0 ? 100 : 1))};
+
+        // Values that round to zero keep their sign
+        expected.emplace_back(expected_coeff < 0 ? -expected_coeff : expected_coeff, -2, coeff < 0);
+    }
+
+    std::vector<T> out(data.size());
+    detail::quantize_batch(data.data(), -2, out.data(), data.size());
+
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        // Zeros are always encoded with an exponent of 0
+        if (!BOOST_TEST(same_value(out[i], expected[i])) ||
+            (abs(out[i]) != T{0} && !BOOST_TEST_EQ(quantexp(out[i]), quantexp(T{1, -2}))))
+        {
+            std::cerr << "x: " << data[i] << "\nbatch: " << out[i] << "\nexpected: " << expected[i] << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    // In place
+    auto in_place {data};
+    detail::quantize_batch(in_place.data(), -2, in_place.data(), in_place.size());
+
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(in_place[i], out[i]));
+    }
+
+    // Halfway cases follow the rounding mode
+    const T halfway[] = {T{125, -3}, T{-125, -3}, T{135, -3}, T{-1251, -4}};
+    T rounded[4] {};
+
+    const auto current_mode {boost::decimal::fegetround()};
+    boost::decimal::fesetround(rounding_mode::fe_dec_to_nearest);
+    detail::quantize_batch(halfway, -2, rounded, 4U);
+    BOOST_TEST_EQ(rounded[0], T(12, -2));
+    BOOST_TEST_EQ(rounded[1], T(-12, -2));
+    BOOST_TEST_EQ(rounded[2], T(14, -2));
+    BOOST_TEST_EQ(rounded[3], T(-13, -2));
+
+    boost::decimal::fesetround(rounding_mode::fe_dec_toward_zero);
+    detail::quantize_batch(halfway, -2, rounded, 4U);
+    BOOST_TEST_EQ(rounded[0], T(12, -2));
+    BOOST_TEST_EQ(rounded[1], T(-12, -2));
+    BOOST_TEST_EQ(rounded[2], T(13, -2));
+    BOOST_TEST_EQ(rounded[3], T(-12, -2));
+    boost::decimal::fesetround(current_mode);
+
+    // Zeros and values far below the quantum give zero,
+    // adding more digits than the precision gives sNaN, and non-finite values give NaN
+    const T specials[] = {T{0, 5}, -T{0}, T{4, -20}, T{1, std::numeric_limits<T>::digits10},
+                          std::numeric_limits<T>::quiet_NaN(), std::numeric_limits<T>::infinity()};
+    T special_out[6] {};
+    detail::quantize_batch(specials, -2, special_out, 6U);
+
+    BOOST_TEST_EQ(special_out[0], T{0});
+    BOOST_TEST(signbit(special_out[1]));
+    BOOST_TEST_EQ(special_out[2], T{0});
+    BOOST_TEST(issignaling(special_out[3]));
+    BOOST_TEST(isnan(special_out[4]) && !issignaling(special_out[4]));
+    BOOST_TEST(issignaling(special_out[5]));
+
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    std::vector<T> span_out(data.size());
+    quantize(std::span<const T>{data}, -2, std::span<T>{span_out});
+    for (std::size_t i {}; i < data.size(); ++i)
+    {
+        BOOST_TEST(same_value(span_out[i], out[i]));
+    }
+
+    #endif
+}
+
+int main()
+{
+    test_batch<decimal32>();
+    test_batch<decimal64>();
+    test_batch<decimal128>();
+
+    test_quantize_batch<decimal32>(5);
+    test_quantize_batch<decimal64>(14);
+    test_quantize_batch<decimal128>(16);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,136 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+// Significands with up to max_digits digits and a random number of trailing zeros
+auto random_significand(int max_digits) -> std::uint64_t
+{
+    std::uniform_int_distribution<int> digits_dist(1, max_digits);
+    const auto digits {digits_dist(rng)};
+
+    std::uint64_t sig {};
+    for (int i {}; i < digits; ++i)
+    {
+        sig = sig * 10U + static_cast<std::uint64_t>(rng() % 10U);
+    }
+
+    std::uniform_int_distribution<int> zeros_dist(0, max_digits - digits);
+    for (int i {zeros_dist(rng)}; i > 0; --i)
+    {
+        sig *= 10U;
+    }
+
+    return sig;
+}
+
+// The same value in every cohort compares equal, and neither less nor greater
+template <typename T>
+void test_cohorts(int max_digits)
+{
+    for (std::size_t n {}; n < N; ++n)
+    {
+        auto sig {random_significand(max_digits)};
+        std::int32_t exp {static_cast<std::int32_t>(rng() % 20U) - 10};
+        const bool sign {(rng() & 1U) == 1U};
+
+        const T val {sig, exp, sign};
+
+        while (sig % 10U == 0U && sig != 0U)
+        {
+            sig /= 10U;
+            ++exp;
+
+            const T cohort {sig, exp, sign};
+
+            BOOST_TEST(val == cohort);
+            BOOST_TEST(!(val != cohort));
+            BOOST_TEST(!(val < cohort));
+            BOOST_TEST(!(cohort < val));
+            BOOST_TEST(val <= cohort);
+            BOOST_TEST(val >= cohort);
+        }
+    }
+}
+
+#ifdef BOOST_DECIMAL_HAS_INT128
+
+// Values whose exponents differ by up to gap_max, against the exact comparison of the scaled significands
+template <typename T>
+void test_exponent_gaps(int max_digits, int gap_max)
+{
+    using wide_type = unsigned __int128;
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto lhs_sig {random_significand(max_digits)};
+        const auto rhs_sig {random_significand(max_digits)};
+        const std::int32_t lhs_exp {static_cast<std::int32_t>(rng() % 10U) - 5};
+        const std::int32_t rhs_exp {lhs_exp + static_cast<std::int32_t>(rng() % static_cast<unsigned>(2 * gap_max + 1)) - gap_max};
+        const bool lhs_sign {(rng() & 1U) == 1U};
+        const bool rhs_sign {(rng() & 1U) == 1U};
+
+        const T lhs {lhs_sig, lhs_exp, lhs_sign};
+        const T rhs {rhs_sig, rhs_exp, rhs_sign};
+
+        wide_type lhs_scaled {lhs_sig};
+        wide_type rhs_scaled {rhs_sig};
+        for (auto i {lhs_exp}; i > rhs_exp; --i)
+        {
+            lhs_scaled *= 10U;
+        }
+        for (auto i {rhs_exp}; i > lhs_exp; --i)
+        {
+            rhs_scaled *= 10U;
+        }
+
+        // The comparisons of zeros of either sign are covered elsewhere
+        if (lhs_scaled == 0U && rhs_scaled == 0U)
+        {
+            continue;
+        }
+
+        const bool equal {lhs_sign == rhs_sign && lhs_scaled == rhs_scaled};
+        const bool less {lhs_sign != rhs_sign ? lhs_sign : (lhs_sign ? rhs_scaled < lhs_scaled : lhs_scaled < rhs_scaled)};
+
+        BOOST_TEST_EQ(lhs == rhs, equal);
+        BOOST_TEST_EQ(lhs != rhs, !equal);
+        BOOST_TEST_EQ(lhs < rhs, less);
+        BOOST_TEST_EQ(rhs > lhs, less);
+    }
+}
+
+#endif // BOOST_DECIMAL_HAS_INT128
+
+int main()
+{
+    test_cohorts<decimal32>(7);
+    test_cohorts<decimal64>(16);
+    test_cohorts<decimal128>(19);
+    test_cohorts<decimal32_fast>(7);
+
+    #ifdef BOOST_DECIMAL_HAS_INT128
+    test_exponent_gaps<decimal32>(7, 9);
+    test_exponent_gaps<decimal64>(16, 19);
+    test_exponent_gaps<decimal128>(19, 19);
+    test_exponent_gaps<decimal32_fast>(7, 9);
+    #endif
+
+    return boost::report_errors();
+}
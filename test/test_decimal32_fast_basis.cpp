@@ -400,6 +400,19 @@ void test_hash()
     BOOST_TEST_NE(std::hash<decimal32_fast>{}(one), std::hash<decimal32_fast>{}(zero));
 }
 
+// The unpacked fields fit in 8 bytes, with the sentinels of the non-finite values among them
+void test_layout()
+{
+    static_assert(sizeof(decimal32_fast) == 8U, "decimal32_fast should be 8 bytes wide");
+
+    BOOST_TEST(isinf(std::numeric_limits<decimal32_fast>::infinity()));
+    BOOST_TEST(isnan(std::numeric_limits<decimal32_fast>::quiet_NaN()));
+    BOOST_TEST(issignaling(std::numeric_limits<decimal32_fast>::signaling_NaN()));
+    BOOST_TEST(!isinf(std::numeric_limits<decimal32_fast>::max()));
+    BOOST_TEST(isinf(decimal32_fast(1, 200)));
+    BOOST_TEST_EQ(decimal32_fast(9'999'999, 0), decimal32_fast(9'999'999));
+}
+
 void test_shrink_significand()
 {
     std::mt19937_64 rng(42);
@@ -442,6 +455,7 @@ int main()
     spot_check_addition(989629100, 58451350, 1048080000);
 
     test_shrink_significand();
+    test_layout();
 
     return boost::report_errors();
 }
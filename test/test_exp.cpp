@@ -3,7 +3,9 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -315,6 +317,102 @@ namespace local
     return result_is_ok;
   }
 
+  struct exp_point
+  {
+    bool base_two;
+    const char* x;
+    const char* result;
+  };
+
+  template<typename DecimalType>
+  auto exp_point_result(const exp_point& pt, DecimalType& x) -> DecimalType
+  {
+    static_cast<void>(from_chars(pt.x, pt.x + std::strlen(pt.x), x));
+
+    return pt.base_two ? exp2(x) : exp(x);
+  }
+
+  // exp(x) or 2^x to 40 digits, e.g. N[{Exp[45.67891], 2^200.5}, 40], which have to be within two ulp.
+  // exp2 of large arguments used to lose the digits of the integral part of x * log(2)
+  template<typename DecimalType, std::size_t N>
+  auto test_exp_accuracy(const std::array<exp_point, N>& points) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(const auto& pt : points)
+    {
+      decimal_type x { };
+      const decimal_type val { exp_point_result(pt, x) };
+
+      decimal_type ref { };
+      static_cast<void>(from_chars(pt.result, pt.result + std::strlen(pt.result), ref));
+
+      int ref_exp { };
+      static_cast<void>(frexp10(ref, &ref_exp));
+
+      const decimal_type two_ulp { 2, ref_exp };
+
+      const auto result_point_is_ok = (fabs(val - ref) <= two_ulp);
+
+      // LCOV_EXCL_START
+      if (!result_point_is_ok)
+      {
+        std::cerr << std::setprecision(std::numeric_limits<decimal_type>::digits10)
+                  << (pt.base_two ? "exp2(" : "exp(") << x << ")"
+                  << "\nval: " << val
+                  << "\nref: " << ref << std::endl;
+      }
+      // LCOV_EXCL_STOP
+
+      BOOST_TEST(result_point_is_ok);
+
+      result_is_ok = (result_point_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  // Results below the normal range have to be rounded once to the quantum 10^etiny instead of truncated,
+  // e.g. Exp[-231.9] = 1.52...*^-101 rounds to 2*^-101 in decimal32
+  template<typename DecimalType, std::size_t N>
+  auto test_exp_subnormal(const std::array<exp_point, N>& points) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(const auto& pt : points)
+    {
+      decimal_type x { };
+      const decimal_type val { exp_point_result(pt, x) };
+
+      decimal_type ref { };
+      static_cast<void>(from_chars(pt.result, pt.result + std::strlen(pt.result), ref));
+
+      const auto result_point_is_ok = (val == ref);
+
+      // LCOV_EXCL_START
+      if (!result_point_is_ok)
+      {
+        int val_exp { };
+        const auto val_sig = frexp10(val, &val_exp);
+
+        std::cerr << (pt.base_two ? "exp2(" : "exp(") << pt.x << ")"
+                  << "\nval: " << val_sig << "e" << val_exp
+                  << "\nref: " << pt.result << std::endl;
+      }
+      // LCOV_EXCL_STOP
+
+      BOOST_TEST(result_point_is_ok);
+
+      result_is_ok = (result_point_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
 } // namespace local
 
 auto main() -> int
@@ -333,6 +431,30 @@ auto main() -> int
 
     const auto result_edge_is_ok = local::test_exp_edge<decimal_type, float_type>();
 
+    const auto result_accuracy_is_ok = local::test_exp_accuracy<decimal_type>(std::array<local::exp_point, 10U>
+    {{
+      { false, "0.5", "1.648721270700128146848650787814163571654" },
+      { false, "-3.25", "3.877420783172200988689983526759614326014e-2" },
+      { false, "45.67891", "6.888085866258496378273348228716264779817e+19" },
+      { false, "88.8", "3.675784084471172874119855351214768793759e+38" },
+      { false, "-200.125", "1.221284398342750587955579494083518008792e-87" },
+      { true, "0.5", "1.414213562373095048801688724209698078570" },
+      { true, "-3.25", "1.051120519067143178788906845291518618800e-1" },
+      { true, "200.5", "2.272553576084360916141657902949647315980e+60" },
+      { true, "-250.75", "3.286461789465946443617582900233706360049e-76" },
+      { true, "315.3", "8.217839082034985843702226805166406434305e+94" },
+    }});
+
+    const auto result_subnormal_is_ok = local::test_exp_subnormal<decimal_type>(std::array<local::exp_point, 6U>
+    {{
+      { false, "-229.5", "2.1e-100" },
+      { false, "-231.9", "2e-101" },
+      { false, "-226.37", "4.88e-99" },
+      { true, "-330.3", "3.7e-100" },
+      { true, "-334.1", "3e-101" },
+      { true, "-326.6", "4.83e-99" },
+    }});
+
     BOOST_TEST(result_pos_is_ok);
     BOOST_TEST(result_neg_is_ok);
 
@@ -348,6 +470,9 @@ auto main() -> int
     result_is_ok = (result_neg_narrow_is_ok && result_is_ok);
 
     result_is_ok = (result_edge_is_ok && result_is_ok);
+
+    result_is_ok = (result_accuracy_is_ok && result_is_ok);
+    result_is_ok = (result_subnormal_is_ok && result_is_ok);
   }
 
   {
@@ -362,6 +487,30 @@ auto main() -> int
 
     const auto result_edge_is_ok = local::test_exp_edge<decimal_type, float_type>();
 
+    const auto result_accuracy_is_ok = local::test_exp_accuracy<decimal_type>(std::array<local::exp_point, 10U>
+    {{
+      { false, "0.5", "1.648721270700128146848650787814163571654" },
+      { false, "-3.25", "3.877420783172200988689983526759614326014e-2" },
+      { false, "45.67891", "6.888085866258496378273348228716264779817e+19" },
+      { false, "700.25", "1.302299736699178393533542238619216601350e+304" },
+      { false, "-850.5", "4.290848108958580267723573175950797748208e-370" },
+      { true, "0.5", "1.414213562373095048801688724209698078570" },
+      { true, "-3.25", "1.051120519067143178788906845291518618800e-1" },
+      { true, "200.5", "2.272553576084360916141657902949647315980e+60" },
+      { true, "1200.5", "2.435060717066324546069188412911861703814e+361" },
+      { true, "-1250.125", "4.730169141910457439457396493708637100988e-377" },
+    }});
+
+    const auto result_subnormal_is_ok = local::test_exp_subnormal<decimal_type>(std::array<local::exp_point, 6U>
+    {{
+      { false, "-912.3", "6.2e-397" },
+      { false, "-915.8", "2e-398" },
+      { false, "-908.15", "3.940e-395" },
+      { true, "-1316.7", "4.3e-397" },
+      { true, "-1321.2", "2e-398" },
+      { true, "-1310.9", "2.398e-395" },
+    }});
+
     BOOST_TEST(result_pos_lo_is_ok);
     BOOST_TEST(result_neg_lo_is_ok);
 
@@ -377,14 +526,46 @@ auto main() -> int
     result_is_ok = (result_neg_hi_is_ok && result_is_ok);
 
     result_is_ok = (result_edge_is_ok && result_is_ok);
+
+    result_is_ok = (result_accuracy_is_ok && result_is_ok);
+    result_is_ok = (result_subnormal_is_ok && result_is_ok);
   }
 
   {
+    using decimal_type = boost::decimal::decimal128;
+
     const auto result_pos128_is_ok = local::test_exp_128(8192);
 
+    const auto result_accuracy_is_ok = local::test_exp_accuracy<decimal_type>(std::array<local::exp_point, 10U>
+    {{
+      { false, "0.5", "1.648721270700128146848650787814163571654" },
+      { false, "-3.25", "3.877420783172200988689983526759614326014e-2" },
+      { false, "45.67891", "6.888085866258496378273348228716264779817e+19" },
+      { false, "14000.5", "2.187227141602779406767359742580219599398e+6080" },
+      { false, "-14100.5", "1.700818312493506914440669801778459921523e-6124" },
+      { true, "0.5", "1.414213562373095048801688724209698078570" },
+      { true, "-3.25", "1.051120519067143178788906845291518618800e-1" },
+      { true, "200.5", "2.272553576084360916141657902949647315980e+60" },
+      { true, "20000.25", "4.733373538210459475096726315666976298727e+6020" },
+      { true, "-20400.125", "8.921948362006429433972137549112273119416e-6142" },
+    }});
+
+    const auto result_subnormal_is_ok = local::test_exp_subnormal<decimal_type>(std::array<local::exp_point, 6U>
+    {{
+      { false, "-14215.1", "2.89e-6174" },
+      { false, "-14219.8", "3e-6176" },
+      { false, "-14212.35", "4.517e-6173" },
+      { true, "-20510.3", "6.1e-6175" },
+      { true, "-20516.4", "1e-6176" },
+      { true, "-20505.9", "1.285e-6173" },
+    }});
+
     BOOST_TEST(result_pos128_is_ok);
 
     result_is_ok = (result_pos128_is_ok && result_is_ok);
+
+    result_is_ok = (result_accuracy_is_ok && result_is_ok);
+    result_is_ok = (result_subnormal_is_ok && result_is_ok);
   }
 
   result_is_ok = ((boost::report_errors() == 0) && result_is_ok);
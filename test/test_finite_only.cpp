@@ -0,0 +1,147 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_FINITE_ONLY
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+static_assert(!isnan(decimal64(1)) && !isinf(decimal64(1)) && isfinite(decimal64(1)), "Wrong classification");
+static_assert(decimal64(2) + decimal64(3) == decimal64(5), "Wrong constexpr arithmetic");
+
+// The arithmetic, comparisons and conversions of finite values give the same results as without the macro,
+// which with integer values can be checked against the integer operations.
+// Assertions are enabled, so none of these may produce or classify a non-finite value
+template <typename T>
+void test_integer_values()
+{
+    std::uniform_int_distribution<std::int32_t> dist(-999, 999);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        // Zero is left out since -0 and +0 compare unequal
+        auto a {dist(rng)};
+        auto b {dist(rng)};
+        a = a == 0 ? 1 : a;
+        b = b == 0 ? 1 : b;
+
+        const T da {a};
+        const T db {b};
+
+        BOOST_TEST_EQ(da + db, T{a + b});
+        BOOST_TEST_EQ(da - db, T{a - b});
+        BOOST_TEST_EQ(da * db, T{a * b});
+        BOOST_TEST_EQ((da * db) / db, da);
+        BOOST_TEST_EQ(da + b, T{a + b});
+        BOOST_TEST_EQ(a * db, T{a * b});
+
+        BOOST_TEST_EQ(da < db, a < b);
+        BOOST_TEST_EQ(da <= db, a <= b);
+        BOOST_TEST_EQ(da > db, a > b);
+        BOOST_TEST_EQ(da >= db, a >= b);
+        BOOST_TEST_EQ(da == db, a == b);
+        BOOST_TEST_EQ(da != db, a != b);
+        BOOST_TEST_EQ(da < b, a < b);
+
+        BOOST_TEST_EQ(static_cast<int>(da), a);
+        BOOST_TEST_EQ(static_cast<long long>(db), static_cast<long long>(b));
+        BOOST_TEST_EQ(try_to_integral<int>(da).value, a);
+    }
+}
+
+template <typename T>
+void test_float_conversions()
+{
+    std::uniform_int_distribution<std::int32_t> dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const T val {dist(rng), exp_dist(rng)};
+        const auto res {try_to_float<double>(val)};
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.value, static_cast<double>(val));
+    }
+}
+
+template <typename T>
+void test_charconv()
+{
+    std::uniform_int_distribution<std::int32_t> dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-20, 20);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const T val {dist(rng), exp_dist(rng)};
+
+        char buffer[64] {};
+        const auto r_to {to_chars(buffer, buffer + sizeof(buffer), val)};
+        BOOST_TEST(r_to);
+
+        T parsed {};
+        const auto r_from {from_chars(buffer, r_to.ptr, parsed)};
+        BOOST_TEST(r_from);
+        BOOST_TEST_EQ(parsed, val);
+    }
+}
+
+template <typename T>
+void test_cmath()
+{
+    BOOST_TEST_EQ(sqrt(T{16}), T{4});
+    BOOST_TEST_EQ(abs(T{-3}), T{3});
+    BOOST_TEST_EQ(fmax(T{-3}, T{2}), T{2});
+    BOOST_TEST_EQ(floor(T{25, -1}), T{2});
+    BOOST_TEST_EQ(fpclassify(T{0}), FP_ZERO);
+    BOOST_TEST_EQ(fpclassify(T{1}), FP_NORMAL);
+}
+
+template <typename T>
+void test_exp_log()
+{
+    BOOST_TEST_EQ(exp(T{0}), T{1});
+    BOOST_TEST_EQ(log(T{1}), T{0});
+    BOOST_TEST(abs(log(exp(T{2})) - T{2}) < T(1, -5));
+}
+
+int main()
+{
+    test_integer_values<decimal32>();
+    test_integer_values<decimal64>();
+    test_integer_values<decimal128>();
+    test_integer_values<decimal32_fast>();
+
+    test_float_conversions<decimal32>();
+    test_float_conversions<decimal64>();
+    test_float_conversions<decimal128>();
+
+    test_charconv<decimal32>();
+    test_charconv<decimal64>();
+    test_charconv<decimal128>();
+
+    test_cmath<decimal32>();
+    test_cmath<decimal64>();
+    test_cmath<decimal128>();
+    test_cmath<decimal32_fast>();
+
+    test_exp_log<decimal32>();
+    test_exp_log<decimal64>();
+    test_exp_log<decimal128>();
+
+    return boost::report_errors();
+}
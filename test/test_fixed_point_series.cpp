@@ -0,0 +1,171 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <array>
+#include <cstring>
+#include <limits>
+
+using namespace boost::decimal;
+
+template <typename T>
+T parse(const char* str)
+{
+    T val {};
+    static_cast<void>(from_chars(str, str + std::strlen(str), val));
+    return val;
+}
+
+// The engine keeps at least two digits more than the precision of each type
+static_assert(detail::fixed_point_series_traits<decimal32>::working_digits == 9, "Wrong working digits");
+static_assert(detail::fixed_point_series_traits<decimal64>::working_digits == 18, "Wrong working digits");
+static_assert(detail::fixed_point_series_traits<decimal128>::working_digits == 37, "Wrong working digits");
+
+template <typename T>
+void test_working_digits()
+{
+    using traits = detail::fixed_point_series_traits<T>;
+    using sig_type = typename traits::sig_type;
+
+    constexpr int working_digits {traits::working_digits};
+    const auto lower {detail::pow10(static_cast<sig_type>(working_digits - 1))};
+
+    // Values of T are scaled to exactly the working digits
+    const auto one {detail::to_fixed_point(T{1})};
+    BOOST_TEST(one.sig == lower);
+    BOOST_TEST_EQ(one.exp, 1 - working_digits);
+    BOOST_TEST(!one.sign);
+
+    const auto minus_three {detail::to_fixed_point(T{-3, -2})};
+    BOOST_TEST(minus_three.sig == static_cast<sig_type>(lower * UINT64_C(3)));
+    BOOST_TEST_EQ(minus_three.exp, -1 - working_digits);
+    BOOST_TEST(minus_three.sign);
+
+    // (1 + 10^(1 - working_digits))^2 keeps the last of the working digits, which T does not hold
+    detail::fixed_point_value<T> acc {static_cast<sig_type>(lower + sig_type{1U}), 1 - working_digits, false};
+    const auto x {acc};
+    detail::fixed_point_mul(acc, x);
+    detail::normalize_fixed_point(acc);
+    BOOST_TEST(acc.sig == static_cast<sig_type>(lower + sig_type{2U}));
+    BOOST_TEST_EQ(acc.exp, 1 - working_digits);
+
+    // Adding a value below the last working digit leaves the sum unchanged
+    auto sum {one};
+    detail::fixed_point_add(sum, detail::fixed_point_value<T>{lower, 1 - 2 * working_digits, false});
+    BOOST_TEST(sum.sig == lower);
+    BOOST_TEST_EQ(sum.exp, 1 - working_digits);
+
+    // 1 - 1 cancels to zero
+    auto diff {one};
+    detail::fixed_point_add(diff, detail::fixed_point_value<T>{lower, 1 - working_digits, true});
+    BOOST_TEST(diff.sig == 0U);
+}
+
+struct horner_point
+{
+    const char* x;
+    std::array<const char*, 5> coeffs; // Highest degree first
+    const char* result;                // The exact value rounded once
+    const char* chained;               // The result of rounding every step in T
+};
+
+// Each point is chosen so that rounding after every multiplication and addition in T ends one ulp away
+// from the exact value of the polynomial rounded once, which fixed_point_horner has to return
+template <typename T, std::size_t N>
+void test_horner_single_rounding(const std::array<horner_point, N>& points)
+{
+    for (const auto& pt : points)
+    {
+        const T x {parse<T>(pt.x)};
+
+        std::array<T, 5> coeffs {};
+        for (std::size_t i {}; i < coeffs.size(); ++i)
+        {
+            coeffs[i] = parse<T>(pt.coeffs[i]);
+        }
+
+        T chained {coeffs[0]};
+        for (std::size_t i {1U}; i < coeffs.size(); ++i)
+        {
+            chained = chained * x + coeffs[i];
+        }
+
+        BOOST_TEST_EQ(chained, parse<T>(pt.chained));
+        BOOST_TEST_EQ(detail::fixed_point_horner(x, coeffs, true), parse<T>(pt.result));
+
+        // The same coefficients from the lowest degree
+        const std::array<T, 5> reversed {{coeffs[4], coeffs[3], coeffs[2], coeffs[1], coeffs[0]}};
+        BOOST_TEST_EQ(detail::fixed_point_horner(x, reversed, false), parse<T>(pt.result));
+    }
+}
+
+template <typename T>
+void test_horner_special()
+{
+    const std::array<T, 3> coeffs {{T{2}, T{-3}, T{1}}};
+
+    // 2x^2 - 3x + 1 has the roots 1/2 and 1
+    BOOST_TEST_EQ(detail::fixed_point_horner(T{1}, coeffs, true), T{0});
+    BOOST_TEST_EQ(detail::fixed_point_horner(T{5, -1}, coeffs, true), T{0});
+    BOOST_TEST_EQ(detail::fixed_point_horner(T{0}, coeffs, true), T{1});
+    BOOST_TEST_EQ(detail::fixed_point_horner(T{-2}, coeffs, true), T{15});
+
+    // Non-finite arguments are evaluated in T
+    BOOST_TEST(isinf(detail::fixed_point_horner(std::numeric_limits<T>::infinity(), coeffs, true)));
+    BOOST_TEST(isnan(detail::fixed_point_horner(std::numeric_limits<T>::quiet_NaN(), coeffs, true)));
+}
+
+// sin(1) from the Taylor series of sin(r)/r with the exact factorials, up to the term 1/35!
+template <typename T>
+void test_factorial_series(const char* sin_one)
+{
+    const auto one {detail::to_fixed_point(T{1})};
+
+    const auto series {detail::fixed_point_factorial_series(one, 1, 18)};
+    BOOST_TEST_EQ((T{series.sig, series.exp, series.sign}), parse<T>(sin_one));
+
+    // At zero only the leading 1 remains
+    const auto at_zero {detail::fixed_point_factorial_series(detail::to_fixed_point(T{0}), 1, 18)};
+    BOOST_TEST_EQ((T{at_zero.sig, at_zero.exp, at_zero.sign}), T{1});
+}
+
+int main()
+{
+    test_working_digits<decimal32>();
+    test_working_digits<decimal64>();
+    test_working_digits<decimal128>();
+
+    const std::array<horner_point, 2> d32_points
+    {{
+        { "0.7733285", {{ "0.8488902", "0.02131866", "0.2528302", "0.01781097", "0.4932504" }}, "0.9716894", "0.9716895" },
+        { "0.3926154", {{ "0.3429276", "0.04317055", "0.03654471", "0.06355482", "0.03845174" }}, "0.07979868", "0.07979870" },
+    }};
+
+    const std::array<horner_point, 2> d64_points
+    {{
+        { "0.7630715052450545", {{ "0.2052917899457725", "0.2516660624176661", "0.4898958224531470", "0.03604306514636571", "0.08647895617417190" }}, "0.5806619691500326", "0.5806619691500327" },
+        { "0.6859740123179055", {{ "0.2271739459344652", "0.5772978023795975", "0.09859971219093991", "0.06280542754196897", "0.05562840880119726" }}, "0.3817580780972958", "0.3817580780972959" },
+    }};
+
+    const std::array<horner_point, 2> d128_points
+    {{
+        { "0.9484443007166608604477333654449540", {{ "0.5697428098352183685855685506876816", "0.05931254536937489145231122961944044", "0.7153016920313661978401551957261985", "0.4321801030701702294870039687606419", "0.8502980582948174840234519305838275" }}, "2.415274493602339829708426031821171", "2.415274493602339829708426031821172" },
+        { "0.9004135687911114388866163196139787", {{ "0.7850603598675906629494678138194137", "0.04468258323497597325973508061843356", "0.7466409400223534086460695703087162", "0.2370359772218887712112407896054443", "0.7475029810687714196827390230081346" }}, "2.114912537705754195685972402134770", "2.114912537705754195685972402134771" },
+    }};
+
+    test_horner_single_rounding<decimal32>(d32_points);
+    test_horner_single_rounding<decimal64>(d64_points);
+    test_horner_single_rounding<decimal128>(d128_points);
+
+    test_horner_special<decimal32>();
+    test_horner_special<decimal64>();
+    test_horner_special<decimal128>();
+
+    test_factorial_series<decimal32>("0.8414710");
+    test_factorial_series<decimal64>("0.8414709848078965");
+    test_factorial_series<decimal128>("0.8414709848078965066525023216302990");
+
+    return boost::report_errors();
+}
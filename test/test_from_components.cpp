@@ -0,0 +1,130 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+static_assert(from_components_unchecked<decimal64>(12345U, -2) == decimal64(12345, -2), "Wrong constexpr construction");
+static_assert(from_components_unchecked<decimal32>(7U, 0, true) == decimal32(-7), "Wrong constexpr construction");
+
+constexpr int max_exp_of(int max_biased_exp, int bias) { return max_biased_exp - bias; }
+
+// Every significand and exponent in range packs to the same value as the constructor gives
+template <typename T>
+void test_same_as_constructor(int bias, int max_biased_exp, std::uint64_t max_sig)
+{
+    using sig_type = typename T::significand_type;
+
+    std::uniform_int_distribution<std::uint64_t> sig_dist(1U, max_sig);
+    std::uniform_int_distribution<int> exp_dist(-bias, max_exp_of(max_biased_exp, bias));
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto sig {static_cast<sig_type>(sig_dist(rng))};
+        const auto exp {exp_dist(rng)};
+        const auto sign {sign_dist(rng) == 1};
+
+        const auto val {from_components_unchecked<T>(sig, exp, sign)};
+        const T expected {sig, exp, sign};
+
+        BOOST_TEST_EQ(val, expected);
+        BOOST_TEST_EQ(signbit(val), sign);
+        BOOST_TEST(isfinite(val));
+    }
+
+    // The extremes of the ranges
+    BOOST_TEST_EQ(from_components_unchecked<T>(static_cast<sig_type>(max_sig), max_exp_of(max_biased_exp, bias)),
+                  (T{static_cast<sig_type>(max_sig), max_exp_of(max_biased_exp, bias)}));
+    BOOST_TEST_EQ(from_components_unchecked<T>(1U, -bias), (T{1, -bias}));
+    BOOST_TEST_EQ(from_components_unchecked<T>(static_cast<sig_type>(max_sig), -bias, true),
+                  (T{static_cast<sig_type>(max_sig), -bias, true}));
+    BOOST_TEST_EQ(from_components_unchecked<T>(0U, 0), T{0});
+    BOOST_TEST_EQ(from_components_unchecked<T>(0U, 0, true), (T{0, 0, true}));
+}
+
+// The exponent of the components is kept, unlike a normalization
+template <typename T>
+void test_quantum()
+{
+    BOOST_TEST_EQ(quantexp(from_components_unchecked<T>(12345U, -2)), quantexp(T{12345, -2}));
+    BOOST_TEST(samequantum(from_components_unchecked<T>(1000U, -3), T{1000, -3}));
+    BOOST_TEST(!samequantum(from_components_unchecked<T>(1000U, -3), T{1, 0}));
+}
+
+template <typename T>
+void test_span(int bias, std::uint64_t max_sig)
+{
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    using sig_type = typename T::significand_type;
+
+    std::uniform_int_distribution<std::uint64_t> sig_dist(1U, max_sig);
+    std::uniform_int_distribution<int> exp_dist(-bias, bias / 2);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+
+    std::vector<sig_type> sigs(N);
+    std::vector<int> exps(N);
+    // std::vector<bool> is not contiguous
+    auto signs {std::make_unique<bool[]>(N)};
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        sigs[i] = static_cast<sig_type>(sig_dist(rng));
+        exps[i] = exp_dist(rng);
+        signs[i] = sign_dist(rng) == 1;
+    }
+
+    sigs[1] = 0U;
+    exps[1] = 0;
+
+    std::vector<T> out(N);
+    from_components_unchecked(std::span<const sig_type>(sigs), std::span<const int>(exps),
+                              std::span<const bool>(signs.get(), N), std::span<T>(out));
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(out[i], (T{sigs[i], exps[i], signs[i]}));
+    }
+
+    #else
+
+    static_cast<void>(bias);
+    static_cast<void>(max_sig);
+
+    #endif
+}
+
+int main()
+{
+    test_same_as_constructor<decimal32>(101, 191, UINT64_C(9'999'999));
+    test_same_as_constructor<decimal32_fast>(101, 191, UINT64_C(9'999'999));
+    test_same_as_constructor<decimal64>(398, 767, UINT64_C(9'999'999'999'999'999));
+    test_same_as_constructor<decimal128>(6176, 12287, UINT64_MAX);
+
+    test_quantum<decimal32>();
+    test_quantum<decimal64>();
+    test_quantum<decimal128>();
+
+    test_span<decimal32>(101, UINT64_C(9'999'999));
+    test_span<decimal64>(398, UINT64_C(9'999'999'999'999'999));
+    test_span<decimal128>(6176, UINT64_MAX);
+
+    return boost::report_errors();
+}
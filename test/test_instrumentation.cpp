@@ -0,0 +1,108 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_DECIMAL_ENABLE_INSTRUMENTATION
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <limits>
+#include <thread>
+
+using namespace boost::decimal;
+
+template <typename T>
+void test_mismatched_exponents()
+{
+    const T lhs {1, 0};
+    const T rhs {1, -1};
+    const T same {2, 0};
+
+    reset_instrumentation_counters();
+    auto res {lhs + same};
+    res = lhs - same;
+    BOOST_TEST_EQ(get_instrumentation_counters().mismatched_exponent_additions, UINT64_C(0));
+
+    res = lhs + rhs;
+    BOOST_TEST_EQ(res, T(11, -1));
+    res = lhs - rhs;
+    BOOST_TEST_EQ(res, T(9, -1));
+    BOOST_TEST_EQ(get_instrumentation_counters().mismatched_exponent_additions, UINT64_C(2));
+}
+
+template <typename T>
+void test_renormalization()
+{
+    reset_instrumentation_counters();
+    const T small_val {1234, 0};
+    BOOST_TEST_EQ(get_instrumentation_counters().constructor_renormalizations, UINT64_C(0));
+    BOOST_TEST_EQ(get_instrumentation_counters().fenv_round_calls, UINT64_C(0));
+
+    // The product has more digits than any of the types can hold
+    const T factor {UINT64_C(12345678901234567890), 0};
+    const T big_val {factor * factor};
+    BOOST_TEST_GE(get_instrumentation_counters().constructor_renormalizations, UINT64_C(1));
+    BOOST_TEST_GE(get_instrumentation_counters().fenv_round_calls, UINT64_C(1));
+
+    static_cast<void>(small_val);
+    static_cast<void>(big_val);
+}
+
+template <typename T>
+void test_non_finite()
+{
+    reset_instrumentation_counters();
+    BOOST_TEST_EQ(fpclassify(T{1}), FP_NORMAL);
+    BOOST_TEST_EQ(fpclassify(T{0}), FP_ZERO);
+    BOOST_TEST_EQ(get_instrumentation_counters().non_finite_classifications, UINT64_C(0));
+
+    BOOST_TEST_EQ(fpclassify(std::numeric_limits<T>::infinity()), FP_INFINITE);
+    BOOST_TEST_EQ(fpclassify(std::numeric_limits<T>::quiet_NaN()), FP_NAN);
+    BOOST_TEST_EQ(get_instrumentation_counters().non_finite_classifications, UINT64_C(2));
+}
+
+void test_per_thread()
+{
+    reset_instrumentation_counters();
+    BOOST_TEST_EQ(fpclassify(std::numeric_limits<decimal64>::infinity()), FP_INFINITE);
+
+    std::uint64_t other_thread_count {};
+    std::thread t {[&other_thread_count]
+    {
+        other_thread_count = get_instrumentation_counters().non_finite_classifications;
+        static_cast<void>(fpclassify(std::numeric_limits<decimal64>::quiet_NaN()));
+        static_cast<void>(fpclassify(std::numeric_limits<decimal64>::quiet_NaN()));
+    }};
+    t.join();
+
+    BOOST_TEST_EQ(other_thread_count, UINT64_C(0));
+    BOOST_TEST_EQ(get_instrumentation_counters().non_finite_classifications, UINT64_C(1));
+}
+
+// The instrumentation hooks must not interfere with constant evaluation
+#ifndef BOOST_DECIMAL_NO_CONSTEVAL_DETECTION
+static_assert(decimal32(1, 0) + decimal32(1, -1) == decimal32(11, -1), "Wrong result");
+static_assert(decimal64(UINT64_C(12345678901234567890), 0) > decimal64(1, 0), "Wrong result");
+#endif
+
+int main()
+{
+    test_mismatched_exponents<decimal32>();
+    test_mismatched_exponents<decimal64>();
+    test_mismatched_exponents<decimal128>();
+    test_mismatched_exponents<decimal32_fast>();
+
+    test_renormalization<decimal32>();
+    test_renormalization<decimal64>();
+    test_renormalization<decimal128>();
+    test_renormalization<decimal32_fast>();
+
+    test_non_finite<decimal32>();
+    test_non_finite<decimal64>();
+    test_non_finite<decimal128>();
+    test_non_finite<decimal32_fast>();
+
+    test_per_thread();
+
+    return boost::report_errors();
+}
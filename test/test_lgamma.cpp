@@ -427,6 +427,34 @@ namespace local
     return result_is_ok;
   }
 
+  template<typename DecimalType>
+  auto test_lgamma_table(const int tol_factor, const int n_max) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    const decimal_type my_tol { std::numeric_limits<decimal_type>::epsilon() * static_cast<decimal_type>(tol_factor) };
+
+    auto result_is_ok = true;
+
+    // lgamma(n) = log((n - 1)!), across the tabulated range and past its end
+    decimal_type log_factorial { 0 };
+
+    for(auto n = 1; n <= n_max; ++n)
+    {
+      const auto result_lgamma_is_ok = is_close_fraction(lgamma(decimal_type { n }), log_factorial, my_tol);
+
+      result_is_ok = (result_lgamma_is_ok && result_is_ok);
+
+      log_factorial += log(decimal_type { n });
+    }
+
+    result_is_ok = ((lgamma(decimal_type { 1 }) == 0) && (lgamma(decimal_type { 2 }) == 0) && result_is_ok);
+
+    BOOST_TEST(result_is_ok);
+
+    return result_is_ok;
+  }
+
 } // namespace local
 
 auto main() -> int
@@ -529,6 +557,14 @@ auto main() -> int
     result_is_ok = (result_edge_is_ok && result_is_ok);
   }
 
+  {
+    const auto result_table32_is_ok  = local::test_lgamma_table<boost::decimal::decimal32>(256, 100);
+    const auto result_table64_is_ok  = local::test_lgamma_table<boost::decimal::decimal64>(1024, 300);
+    const auto result_table128_is_ok = local::test_lgamma_table<boost::decimal::decimal128>(4096, 300);
+
+    result_is_ok = (result_table32_is_ok && result_table64_is_ok && result_table128_is_ok && result_is_ok);
+  }
+
   {
     const auto result_lgamma128_is_ok   = local::test_lgamma_128(4096);
 
@@ -3,7 +3,9 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -442,6 +444,56 @@ namespace local
 
     return result_is_ok;
   }
+
+  struct log_point
+  {
+    const char* x;
+    const char* result;
+  };
+
+  // log(x) to 40 digits, e.g. N[Log[{1/4, 0.8804150}], 40], which have to be within two ulp.
+  // Arguments in [0.1, 1) used to be reflected to log(1/x), which rounded 1/x first and cost up to nine ulp.
+  template<typename DecimalType, std::size_t N>
+  auto test_log_accuracy(const std::array<log_point, N>& points) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(const auto& pt : points)
+    {
+      decimal_type x { };
+      static_cast<void>(from_chars(pt.x, pt.x + std::strlen(pt.x), x));
+
+      const decimal_type val { log(x) };
+
+      decimal_type ref { };
+      static_cast<void>(from_chars(pt.result, pt.result + std::strlen(pt.result), ref));
+
+      int ref_exp { };
+      static_cast<void>(frexp10(ref, &ref_exp));
+
+      const decimal_type tol { 2, ref_exp };
+
+      const auto result_point_is_ok = (fabs(val - ref) <= tol);
+
+      // LCOV_EXCL_START
+      if (!result_point_is_ok)
+      {
+        std::cerr << std::setprecision(std::numeric_limits<decimal_type>::digits10)
+                  << "log(" << x << ")"
+                  << "\nval: " << val
+                  << "\nref: " << ref << std::endl;
+      }
+      // LCOV_EXCL_STOP
+
+      BOOST_TEST(result_point_is_ok);
+
+      result_is_ok = (result_point_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
 } // namespace local
 
 auto main() -> int
@@ -486,6 +538,91 @@ auto main() -> int
     result_is_ok = (result_pos128_is_ok && result_is_ok);
   }
 
+  {
+    using decimal_type = boost::decimal::decimal32;
+
+    constexpr std::array<local::log_point, 17U> points
+    {{
+      { "1E-1", "-2.302585092994045684017991454684364207601E+0" },
+      { "2.5E-1", "-1.386294361119890618834464242916353136151E+0" },
+      { "5E-1", "-6.931471805599453094172321214581765680755E-1" },
+      { "7.5E-1", "-2.876820724517809274392190059938274315035E-1" },
+      { "1.102997E-1", "-2.204554072581320147482174767734638862471E+0" },
+      { "4.939107E-1", "-7.054005473657104705242880177491814581371E-1" },
+      { "1.942869E-1", "-1.638419346384799063784119006207820858940E+0" },
+      { "7.408702E-1", "-2.999298377208353401235561586869892213029E-1" },
+      { "4.295358E-1", "-8.450501882957340121584808419690865038230E-1" },
+      { "2.181579E-1", "-1.522536166453730101659920299550631264853E+0" },
+      { "5.890121E-1", "-5.293085522478427482310650324679704274861E-1" },
+      { "8.625523E-1", "-1.478594942338526812165339382108924255702E-1" },
+      { "3.539466E-1", "-1.038609224684611760741966415606267996973E+0" },
+      { "8.804150E-1", "-1.273618917648388263860850052161992013735E-1" },
+      { "1.725920E-3", "-6.361995037337155178892825580025108789860E+0" },
+      { "3.326847E+3", "8.109780287585010502786879581462927733757E+0" },
+      { "2.886489E-26", "-5.880717153317718004473262625023033368266E+1" },
+    }};
+
+    const auto test_log_accuracy_is_ok = local::test_log_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log_accuracy_is_ok && result_is_ok);
+  }
+
+  {
+    using decimal_type = boost::decimal::decimal64;
+
+    constexpr std::array<local::log_point, 16U> points
+    {{
+      { "1E-1", "-2.302585092994045684017991454684364207601E+0" },
+      { "2.5E-1", "-1.386294361119890618834464242916353136151E+0" },
+      { "5E-1", "-6.931471805599453094172321214581765680755E-1" },
+      { "7.5E-1", "-2.876820724517809274392190059938274315035E-1" },
+      { "3.087888980519368E-1", "-1.175097413382150890836160894260797113000E+0" },
+      { "7.823786966256260E-1", "-2.454163888714552802729332866926609364698E-1" },
+      { "2.327669480015632E-1", "-1.457717549142694274055666761423500271479E+0" },
+      { "7.671230888420617E-1", "-2.651080096013021974574592590679956062819E-1" },
+      { "6.964266607363116E-1", "-3.617927881673830452848883833630619842159E-1" },
+      { "2.230186268106135E-1", "-1.500499982711597143750645595665201452775E+0" },
+      { "5.869863794639738E-1", "-5.327536630621353979771375105829950055201E-1" },
+      { "8.800335010118762E-1", "-1.277953029028260124687966860198505175404E-1" },
+      { "3.436626608311463E-1", "-1.068094739866653129051379105804232632272E+0" },
+      { "5.824812634367966E-3", "-5.145628445821442125799139203677956741927E+0" },
+      { "5.032981731432711E+3", "8.523767877012711213423593515926094414503E+0" },
+      { "4.716102453230533E-26", "-5.831622971080244853085020384770891470277E+1" },
+    }};
+
+    const auto test_log_accuracy_is_ok = local::test_log_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log_accuracy_is_ok && result_is_ok);
+  }
+
+  {
+    using decimal_type = boost::decimal::decimal128;
+
+    constexpr std::array<local::log_point, 16U> points
+    {{
+      { "1E-1", "-2.302585092994045684017991454684364207601E+0" },
+      { "2.5E-1", "-1.386294361119890618834464242916353136151E+0" },
+      { "5E-1", "-6.931471805599453094172321214581765680755E-1" },
+      { "7.5E-1", "-2.876820724517809274392190059938274315035E-1" },
+      { "1.966947484078921985318691089562080E-1", "-1.626102252429085167086492261826037870266E+0" },
+      { "3.061306163184438609336542563288906E-1", "-1.183743417390737430038593892014724149919E+0" },
+      { "4.789276381228422886264152222313811E-1", "-7.362057616203101829990459607547942105222E-1" },
+      { "3.184181518952656451723365603580239E-1", "-1.144389816915589805400638145057098512026E+0" },
+      { "7.073980836669970912252589327671967E-1", "-3.461617111952048830973236909860638702862E-1" },
+      { "4.691729712888257918830881673528248E-1", "-7.567837698108971814526039449326257725891E-1" },
+      { "5.660692395175475112861392672530518E-1", "-5.690388769577303285571830063546932438885E-1" },
+      { "8.443357728644205274047151500575593E-1", "-1.692050283541819438099758507036999174480E-1" },
+      { "3.397098323264629054158381390682974E-1", "-1.079663460088276169672556072221650127034E+0" },
+      { "9.685795152499742472142128634813414E-3", "-4.637094884047809327695218532772052841448E+0" },
+      { "1.315357909243970889517728489189579E+3", "7.181864081909167268399132063210593537919E+0" },
+      { "3.267574096759433299305833882803932E-26", "-5.868316457468952816753397324031565604480E+1" },
+    }};
+
+    const auto test_log_accuracy_is_ok = local::test_log_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log_accuracy_is_ok && result_is_ok);
+  }
+
   result_is_ok = ((boost::report_errors() == 0) && result_is_ok);
 
   return (result_is_ok ? 0 : -1);
@@ -3,7 +3,9 @@
 // Distributed under the Boost Software License, Version 1.0.
 // https://www.boost.org/LICENSE_1_0.txt
 
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <limits>
@@ -363,6 +365,55 @@ namespace local
     return result_is_ok;
   }
 
+  struct log10_point
+  {
+    const char* x;
+    const char* result;
+  };
+
+  // log10(x) to 40 digits, e.g. N[Log10[{1/4, 0.8804150}], 40], which have to be within six ulp.
+  // Arguments in [0.1, 1) used to be reflected to log10(1/x), which cost up to forty ulp.
+  template<typename DecimalType, std::size_t N>
+  auto test_log10_accuracy(const std::array<log10_point, N>& points) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(const auto& pt : points)
+    {
+      decimal_type x { };
+      static_cast<void>(from_chars(pt.x, pt.x + std::strlen(pt.x), x));
+
+      const decimal_type val { log10(x) };
+
+      decimal_type ref { };
+      static_cast<void>(from_chars(pt.result, pt.result + std::strlen(pt.result), ref));
+
+      int ref_exp { };
+      static_cast<void>(frexp10(ref, &ref_exp));
+
+      const decimal_type tol { 6, ref_exp };
+
+      const auto result_point_is_ok = (fabs(val - ref) <= tol);
+
+      // LCOV_EXCL_START
+      if (!result_point_is_ok)
+      {
+        std::cerr << std::setprecision(std::numeric_limits<decimal_type>::digits10)
+                  << "log10(" << x << ")"
+                  << "\nval: " << val
+                  << "\nref: " << ref << std::endl;
+      }
+      // LCOV_EXCL_STOP
+
+      BOOST_TEST(result_point_is_ok);
+
+      result_is_ok = (result_point_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
 } // namespace local
 
 auto main() -> int
@@ -421,6 +472,91 @@ auto main() -> int
     result_is_ok = (result_pos128_is_ok && result_is_ok);
   }
 
+  {
+    using decimal_type = boost::decimal::decimal32;
+
+    constexpr std::array<local::log10_point, 17U> points
+    {{
+      { "1E-1", "-1.000000000000000000000000000000000000000E+0" },
+      { "2.5E-1", "-6.020599913279623904274777894489860535364E-1" },
+      { "5E-1", "-3.010299956639811952137388947244930267682E-1" },
+      { "7.5E-1", "-1.249387366082999531324498861938707443363E-1" },
+      { "1.102997E-1", "-9.574256687794082589604314867628682611512E-1" },
+      { "4.939107E-1", "-3.063515652524614796267961780264088851850E-1" },
+      { "1.942869E-1", "-7.115564811784508047764476769777412898920E-1" },
+      { "7.408702E-1", "-1.302578734802965810138693257300884460469E-1" },
+      { "4.295358E-1", "-3.670006337081412043594675053348703240132E-1" },
+      { "2.181579E-1", "-6.612290555889859000287474783583742479415E-1" },
+      { "5.890121E-1", "-2.298757834654371669218610808997871002430E-1" },
+      { "8.625523E-1", "-6.421456244276790122169204750391295597848E-2" },
+      { "3.539466E-1", "-4.510622551343415337296260527067271414471E-1" },
+      { "8.804150E-1", "-5.531256679822871366368982815203178604338E-2" },
+      { "1.725920E-3", "-2.762979338611399075415919421032133568797E+0" },
+      { "3.326847E+3", "3.522032828345936746297635547203799544048E+0" },
+      { "2.886489E-26", "-2.553963009319684285490644171616445593168E+1" },
+    }};
+
+    const auto test_log10_accuracy_is_ok = local::test_log10_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log10_accuracy_is_ok && result_is_ok);
+  }
+
+  {
+    using decimal_type = boost::decimal::decimal64;
+
+    constexpr std::array<local::log10_point, 16U> points
+    {{
+      { "1E-1", "-1.000000000000000000000000000000000000000E+0" },
+      { "2.5E-1", "-6.020599913279623904274777894489860535364E-1" },
+      { "5E-1", "-3.010299956639811952137388947244930267682E-1" },
+      { "7.5E-1", "-1.249387366082999531324498861938707443363E-1" },
+      { "3.087888980519368E-1", "-5.103383223306525621049201013401475376038E-1" },
+      { "7.823786966256260E-1", "-1.065829834554956484445252581174252648148E-1" },
+      { "2.327669480015632E-1", "-6.330786877662044451549404998636352379287E-1" },
+      { "7.671230888420617E-1", "-1.151349456781998489662760316159733862507E-1" },
+      { "6.964266607363116E-1", "-1.571246114934865579233865620892416403092E-1" },
+      { "2.230186268106135E-1", "-6.516588625875714060010064881424936458056E-1" },
+      { "5.869863794639738E-1", "-2.313719760816296832649169144470048876403E-1" },
+      { "8.800335010118762E-1", "-5.550079486385195743064280209681350812693E-2" },
+      { "3.436626608311463E-1", "-4.638676516739766557775062595503046359572E-1" },
+      { "5.824812634367966E-3", "-2.234718039944658124797329473685154252735E+0" },
+      { "5.032981731432711E+3", "3.701825354010816160222394247757708857280E+0" },
+      { "4.716102453230533E-26", "-2.532641676880397054624017864723606239549E+1" },
+    }};
+
+    const auto test_log10_accuracy_is_ok = local::test_log10_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log10_accuracy_is_ok && result_is_ok);
+  }
+
+  {
+    using decimal_type = boost::decimal::decimal128;
+
+    constexpr std::array<local::log10_point, 16U> points
+    {{
+      { "1E-1", "-1.000000000000000000000000000000000000000E+0" },
+      { "2.5E-1", "-6.020599913279623904274777894489860535364E-1" },
+      { "5E-1", "-3.010299956639811952137388947244930267682E-1" },
+      { "7.5E-1", "-1.249387366082999531324498861938707443363E-1" },
+      { "1.966947484078921985318691089562080E-1", "-7.062072352404003633988150057417363171511E-1" },
+      { "3.061306163184438609336542563288906E-1", "-5.140932341620950916140616725022277610767E-1" },
+      { "4.789276381228422886264152222313811E-1", "-3.197300998170815296954222037857507622254E-1" },
+      { "3.184181518952656451723365603580239E-1", "-4.970021826327132890197084410944957947682E-1" },
+      { "7.073980836669970912252589327671967E-1", "-1.503361210182645926933289299436318555691E-1" },
+      { "4.691729712888257918830881673528248E-1", "-3.286670152228133827817255779098847130167E-1" },
+      { "5.660692395175475112861392672530518E-1", "-2.471304442511657575953170623844230359438E-1" },
+      { "8.443357728644205274047151500575593E-1", "-7.348481012450448257520055572818086718915E-2" },
+      { "3.397098323264629054158381390682974E-1", "-4.688918830289101068654878124272387844067E-1" },
+      { "9.685795152499742472142128634813414E-3", "-2.013864720203762960166237368223938304584E+0" },
+      { "1.315357909243970889517728489189579E+3", "3.119043940552315145898041138932131891141E+0" },
+      { "3.267574096759433299305833882803932E-26", "-2.548577455540805002609434774148660908797E+1" },
+    }};
+
+    const auto test_log10_accuracy_is_ok = local::test_log10_accuracy<decimal_type>(points);
+
+    result_is_ok = (test_log10_accuracy_is_ok && result_is_ok);
+  }
+
   result_is_ok = ((boost::report_errors() == 0) && result_is_ok);
 
   return (result_is_ok ? 0 : -1);
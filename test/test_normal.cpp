@@ -0,0 +1,214 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <cmath>
+
+#if defined(__clang__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wfloat-equal"
+#elif defined(__GNUC__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+
+using namespace boost::decimal;
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+void test_special_values()
+{
+    constexpr T zero {0, 0};
+    constexpr T half {5, -1};
+    constexpr T one {1, 0};
+
+    const T inf {std::numeric_limits<T>::infinity()};
+    const T nan {std::numeric_limits<T>::quiet_NaN()};
+
+    BOOST_TEST(isnan(normal_pdf(nan)));
+    BOOST_TEST_EQ(normal_pdf(inf), zero);
+    BOOST_TEST_EQ(normal_pdf(-inf), zero);
+    BOOST_TEST_EQ(normal_pdf(T{1, 3}), zero);
+
+    BOOST_TEST(isnan(normal_cdf(nan)));
+    BOOST_TEST_EQ(normal_cdf(inf), one);
+    BOOST_TEST_EQ(normal_cdf(-inf), zero);
+    BOOST_TEST_EQ(normal_cdf(zero), half);
+    BOOST_TEST_EQ(normal_cdf(-zero), half);
+    BOOST_TEST_EQ(normal_cdf(T{1, 3}), one);
+    BOOST_TEST_EQ(normal_cdf(T{-1, 3}), zero);
+
+    BOOST_TEST(isnan(normal_quantile(nan)));
+    BOOST_TEST(isnan(normal_quantile(-one)));
+    BOOST_TEST(isnan(normal_quantile(T{2})));
+    BOOST_TEST(isnan(normal_quantile(inf)));
+    BOOST_TEST(isinf(normal_quantile(zero)) && signbit(normal_quantile(zero)));
+    BOOST_TEST(isinf(normal_quantile(one)) && !signbit(normal_quantile(one)));
+    BOOST_TEST_EQ(normal_quantile(half), zero);
+}
+
+// The double formulation loses its relative accuracy in the far tails,
+// so it is only compared where it is reliable
+template <typename T>
+void test_against_double(double tol)
+{
+    std::uniform_real_distribution<double> dist(-5.0, 5.0);
+
+    for (int i {}; i < 128; ++i)
+    {
+        const T dec_val {dist(rng)};
+        const auto val {static_cast<double>(dec_val)};
+
+        const auto cdf {0.5 * std::erfc(-val / std::sqrt(2.0))};
+        const auto pdf {std::exp(-val * val / 2) / std::sqrt(2 * 3.14159265358979323846)};
+
+        const auto dec_cdf {static_cast<double>(normal_cdf(dec_val))};
+        const auto dec_pdf {static_cast<double>(normal_pdf(dec_val))};
+
+        if (!BOOST_TEST(std::fabs(dec_cdf - cdf) <= tol * cdf))
+        {
+            std::cerr << "x: " << val << "\ncdf: " << cdf << "\ndec: " << dec_cdf << std::endl; // LCOV_EXCL_LINE
+        }
+
+        if (!BOOST_TEST(std::fabs(dec_pdf - pdf) <= tol * pdf))
+        {
+            std::cerr << "x: " << val << "\npdf: " << pdf << "\ndec: " << dec_pdf << std::endl; // LCOV_EXCL_LINE
+        }
+
+        const auto p {normal_cdf(dec_val)};
+
+        if (p > T{0} && p < T{1})
+        {
+            const auto x {static_cast<double>(normal_quantile(p))};
+
+            if (!BOOST_TEST(std::fabs(x - val) <= tol * 1e3 * (std::fabs(val) + 1)))
+            {
+                std::cerr << "x: " << val << "\nquantile: " << x << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+template <typename T>
+auto close_fraction(T val, T ref, T tol) -> bool
+{
+    if (!(abs(val - ref) <= tol * abs(ref)))
+    {
+        // LCOV_EXCL_START
+        int val_exp {};
+        int ref_exp {};
+        const auto val_sig {frexp10(val, &val_exp)};
+        const auto ref_sig {frexp10(ref, &ref_exp)};
+
+        std::cerr << "Val: " << val_sig << "e" << val_exp
+                  << "\nRef: " << ref_sig << "e" << ref_exp << std::endl;
+
+        return false;
+        // LCOV_EXCL_STOP
+    }
+
+    return true;
+}
+
+// Reference values computed with 100 digits
+template <typename T>
+void test_spot_values(T tol)
+{
+    struct point { decimal128 x; decimal128 ref; };
+
+    const point cdf_points[] = {
+        {"-37.5"_DL, "4.605353009581954843827969097610896238921e-308"_DL},
+        {"-20"_DL,   "2.753624118606233695075622780857465332807e-89"_DL},
+        {"-8"_DL,    "6.220960574271784123515995172588188422489e-16"_DL},
+        {"-3"_DL,    "1.349898031630094526651814767594977377829e-3"_DL},
+        {"-1"_DL,    "1.586552539314570514147674543679620775221e-1"_DL},
+        {"-0.5"_DL,  "3.085375387259868963622953893916622601164e-1"_DL},
+        {"-0.1"_DL,  "4.601721627229710185345953817608179169859e-1"_DL},
+        {"0.3"_DL,   "6.179114221889526373065289631214176480512e-1"_DL},
+        {"1"_DL,     "8.413447460685429485852325456320379224779e-1"_DL},
+        {"2"_DL,     "9.772498680518207927997173628334665625282e-1"_DL},
+        {"7.5"_DL,   "9.999999999999680910832708910377223271166e-1"_DL}
+    };
+
+    for (const auto& pt : cdf_points)
+    {
+        BOOST_TEST(close_fraction(normal_cdf(static_cast<T>(pt.x)), static_cast<T>(pt.ref), tol));
+    }
+
+    const point pdf_points[] = {
+        {"0"_DL,    "3.989422804014326779399460599343818684759e-1"_DL},
+        {"1"_DL,    "2.419707245191433497978301929355606548287e-1"_DL},
+        {"-2.5"_DL, "1.752830049356853736215832216674858614851e-2"_DL},
+        {"10"_DL,   "7.694598626706419346339033580041877235359e-23"_DL},
+        {"-25"_DL,  "7.653929736419392659649689886516383303972e-137"_DL}
+    };
+
+    for (const auto& pt : pdf_points)
+    {
+        BOOST_TEST(close_fraction(normal_pdf(static_cast<T>(pt.x)), static_cast<T>(pt.ref), tol));
+    }
+
+    const point quantile_points[] = {
+        {"1e-300"_DL,   "-37.04709629936119923722296250786043684435"_DL},
+        {"1e-20"_DL,    "-9.262340089798407573717356977875325117536"_DL},
+        {"1e-5"_DL,     "-4.264890793922824628498524698906344629356"_DL},
+        {"0.01"_DL,     "-2.326347874040841100885606163346911723352"_DL},
+        {"0.3"_DL,      "-0.5244005127080407840382893250251225543254"_DL},
+        {"0.75"_DL,     "0.6744897501960817432022270145413071853869"_DL},
+        {"0.975"_DL,    "1.959963984540054235524594430520551527956"_DL},
+        {"0.999999"_DL, "4.753424308822898948193988187004275005642"_DL}
+    };
+
+    for (const auto& pt : quantile_points)
+    {
+        BOOST_TEST(close_fraction(normal_quantile(static_cast<T>(pt.x)), static_cast<T>(pt.ref), tol));
+    }
+}
+
+// Beyond z = 110 the lower tail of decimal128 is still representable, while the tails of decimal32
+// and decimal64 leave the normal range much earlier and are then flushed to zero
+void test_far_tail()
+{
+    constexpr decimal32 zero32 {0, 0};
+    constexpr decimal64 zero64 {0, 0};
+    constexpr decimal128 zero128 {0, 0};
+    constexpr decimal128 one128 {1, 0};
+
+    BOOST_TEST(close_fraction(normal_cdf("-156"_DL), "8.175452973841845156714378133369272107196e-5288"_DL, decimal128{1, -31}));
+    BOOST_TEST(close_fraction(normal_cdf("-165"_DL), "3.546298293021307580552220439901296043907e-5915"_DL, decimal128{1, -31}));
+    BOOST_TEST(close_fraction(normal_cdf("-168"_DL), "4.091257169290870949213543164263690522201e-6132"_DL, decimal128{1, -31}));
+    BOOST_TEST_EQ(normal_cdf("-170"_DL), zero128);
+    BOOST_TEST_EQ(normal_cdf("170"_DL), one128);
+
+    BOOST_TEST(close_fraction(normal_cdf("-38"_DD), "2.885428360068784308350970481566904094662e-316"_DD, decimal64{1, -14}));
+    BOOST_TEST(close_fraction(normal_cdf("-41.5"_DD), "1.001784800828510720043459023690110537070e-376"_DD, decimal64{1, -14}));
+    BOOST_TEST_EQ(normal_cdf("-42.5"_DD), zero64);
+
+    BOOST_TEST(close_fraction(normal_cdf("-20"_DF), "2.753624118606233695075622780857465332808e-89"_DF, decimal32{1, -5}));
+    BOOST_TEST(close_fraction(normal_cdf("-20.5"_DF), "1.076467325879096033530686650202128124671e-93"_DF, decimal32{1, -5}));
+    BOOST_TEST_EQ(normal_cdf("-21"_DF), zero32);
+}
+
+int main()
+{
+    test_special_values<decimal32>();
+    test_special_values<decimal64>();
+    test_special_values<decimal128>();
+
+    test_against_double<decimal32>(1e-5);
+    test_against_double<decimal64>(1e-13);
+    test_against_double<decimal128>(1e-13);
+
+    test_spot_values<decimal64>(decimal64{1, -14});
+    test_spot_values<decimal128>(decimal128{1, -31});
+
+    test_far_tail();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,205 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/decimal/detail/div_pow10.hpp>
+#include <boost/decimal/detail/integer_search_trees.hpp>
+#include <boost/decimal/detail/power_tables.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+using namespace boost::decimal;
+using detail::uint128;
+using detail::uint256_t;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+static_assert(detail::num_digits(UINT32_C(0)) == 1, "Wrong constexpr digit count");
+static_assert(detail::num_digits(UINT32_C(4294967295)) == 10, "Wrong constexpr digit count");
+static_assert(detail::num_digits(UINT64_C(9999999999999999999)) == 19, "Wrong constexpr digit count");
+static_assert(detail::num_digits(UINT64_C(10000000000000000000)) == 20, "Wrong constexpr digit count");
+static_assert(detail::num_digits(detail::powers_of_10_u128[38]) == 39, "Wrong constexpr digit count");
+static_assert(detail::num_digits(detail::powers_of_10_u256[77]) == 78, "Wrong constexpr digit count");
+static_assert(detail::div_pow10(detail::powers_of_10_u256[77], 77) == uint256_t {uint128 {1U}}, "Wrong constexpr division");
+
+// The digits counted by repeated division by 10
+template <typename T>
+int reference_num_digits(T x)
+{
+    int digits {1};
+    while (x >= T {10U})
+    {
+        x = static_cast<T>(x / T {10U});
+        ++digits;
+    }
+
+    return digits;
+}
+
+uint128 random_u128()
+{
+    return uint128 {rng() >> (rng() % 64U), rng()};
+}
+
+uint256_t random_u256()
+{
+    return uint256_t {uint128 {rng() >> (rng() % 64U), rng()}, uint128 {rng(), rng()}};
+}
+
+void test_tables()
+{
+    for (std::size_t i {}; i < 20U; ++i)
+    {
+        BOOST_TEST(detail::powers_of_10_u128[i] == uint128 {detail::powers_of_10[i]});
+        BOOST_TEST(detail::powers_of_10_u256[i] == uint256_t {uint128 {detail::powers_of_10[i]}});
+    }
+
+    for (std::size_t i {1}; i < 39U; ++i)
+    {
+        BOOST_TEST(detail::powers_of_10_u128[i] == detail::powers_of_10_u128[i - 1U] * UINT64_C(10));
+        BOOST_TEST(detail::pow10(uint128 {i}) == detail::powers_of_10_u128[i]);
+    }
+
+    for (std::size_t i {1}; i < 78U; ++i)
+    {
+        BOOST_TEST(detail::powers_of_10_u256[i] == detail::powers_of_10_u256[i - 1U] * UINT64_C(10));
+    }
+
+    BOOST_TEST(detail::powers_of_10_u256[38] == uint256_t {detail::powers_of_10_u128[38]});
+}
+
+// Every power of 10, and the values on either side of it, are where the count changes
+void test_boundaries()
+{
+    for (int i {1}; i < 20; ++i)
+    {
+        const auto p {detail::powers_of_10[static_cast<std::size_t>(i)]};
+        BOOST_TEST_EQ(detail::num_digits(p), i + 1);
+        BOOST_TEST_EQ(detail::num_digits(p - 1U), i);
+        BOOST_TEST_EQ(detail::num_digits(p + 1U), i + 1);
+
+        if (i < 10)
+        {
+            BOOST_TEST_EQ(detail::num_digits(static_cast<std::uint32_t>(p)), i + 1);
+            BOOST_TEST_EQ(detail::num_digits(static_cast<std::uint32_t>(p - 1U)), i);
+        }
+    }
+
+    for (int i {1}; i < 39; ++i)
+    {
+        const auto p {detail::powers_of_10_u128[static_cast<std::size_t>(i)]};
+        BOOST_TEST_EQ(detail::num_digits(p), i + 1);
+        BOOST_TEST_EQ(detail::num_digits(p - uint128 {1U}), i);
+        BOOST_TEST_EQ(detail::num_digits(uint256_t {p}), i + 1);
+
+        #ifdef BOOST_DECIMAL_HAS_INT128
+        BOOST_TEST_EQ(detail::num_digits(static_cast<detail::uint128_t>(p)), i + 1);
+        BOOST_TEST_EQ(detail::num_digits(static_cast<detail::uint128_t>(p - uint128 {1U})), i);
+        #endif
+    }
+
+    for (int i {1}; i < 78; ++i)
+    {
+        const auto p {detail::powers_of_10_u256[static_cast<std::size_t>(i)]};
+        BOOST_TEST_EQ(detail::num_digits(p), i + 1);
+        BOOST_TEST_EQ(detail::num_digits(p - uint256_t {uint128 {1U}}), i);
+    }
+
+    BOOST_TEST_EQ(detail::num_digits(UINT64_C(0)), 1);
+    BOOST_TEST_EQ(detail::num_digits(uint128 {0U}), 1);
+    BOOST_TEST_EQ(detail::num_digits(uint256_t {}), 1);
+    BOOST_TEST_EQ(detail::num_digits(UINT64_MAX), 20);
+    BOOST_TEST_EQ(detail::num_digits(uint128 {UINT64_MAX, UINT64_MAX}), 39);
+    BOOST_TEST_EQ(detail::num_digits(uint256_t {uint128 {UINT64_MAX, UINT64_MAX}, uint128 {UINT64_MAX, UINT64_MAX}}), 78);
+}
+
+void test_random_num_digits()
+{
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto x64 {rng() >> (rng() % 64U)};
+        BOOST_TEST_EQ(detail::num_digits(x64), reference_num_digits(x64));
+        BOOST_TEST_EQ(detail::num_digits(static_cast<std::uint32_t>(x64)), reference_num_digits(static_cast<std::uint32_t>(x64)));
+
+        const auto x128 {random_u128()};
+        BOOST_TEST_EQ(detail::num_digits(x128), reference_num_digits(x128));
+
+        const auto x256 {random_u256()};
+        BOOST_TEST_EQ(detail::num_digits(x256), reference_num_digits(x256));
+    }
+}
+
+// The division by the reciprocals gives the same quotients as the long division
+void test_div_pow10()
+{
+    std::uniform_int_distribution<int> digits_128(0, 38);
+    std::uniform_int_distribution<int> digits_256(0, 77);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto x128 {random_u128()};
+        const auto k128 {digits_128(rng)};
+        BOOST_TEST(detail::div_pow10(x128, k128) == x128 / detail::powers_of_10_u128[static_cast<std::size_t>(k128)]);
+
+        const auto x256 {random_u256()};
+        const auto k256 {digits_256(rng)};
+        BOOST_TEST(detail::div_pow10(x256, k256) == x256 / detail::powers_of_10_u256[static_cast<std::size_t>(k256)]);
+    }
+
+    // The largest remainders
+    for (std::size_t i {1}; i < 78U; ++i)
+    {
+        const auto p {detail::powers_of_10_u256[i]};
+        BOOST_TEST(detail::div_pow10(p - uint256_t {uint128 {1U}}, static_cast<int>(i)) == uint256_t {});
+        BOOST_TEST(detail::div_pow10(p, static_cast<int>(i)) == uint256_t {uint128 {1U}});
+    }
+}
+
+// The significands of decimal128 above 2^64 are printed in blocks of 19 digits
+void test_decimal128_to_chars()
+{
+    std::uniform_int_distribution<int> exp_dist(-50, 50);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const decimal128 val {uint128 {rng() % UINT64_C(500000000000000), rng()}, exp_dist(rng)};
+
+        char buffer[64] {};
+        const auto r_to {to_chars(buffer, buffer + sizeof(buffer), val, chars_format::scientific)};
+        BOOST_TEST(r_to);
+
+        decimal128 parsed {};
+        const auto r_from {from_chars(buffer, r_to.ptr, parsed, chars_format::scientific)};
+        BOOST_TEST(r_from);
+        BOOST_TEST_EQ(parsed, val);
+    }
+
+    // The inner zeros of a block are kept
+    const decimal128 val {uint128 {UINT64_C(54210108624275), UINT64_C(4089650035136921601)}, 0};
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), val, chars_format::scientific)};
+    BOOST_TEST(r);
+    *r.ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, "1.000000000000000000000000000000001e+33");
+}
+
+int main()
+{
+    test_tables();
+    test_boundaries();
+    test_random_num_digits();
+    test_div_pow10();
+    test_decimal128_to_chars();
+
+    return boost::report_errors();
+}
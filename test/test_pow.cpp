@@ -1031,6 +1031,101 @@ namespace local
 
     return result_is_ok;
   }
+
+  template<typename DecimalType>
+  auto test_pow_exact() -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    // Integral powers whose exact results fit into the significand are returned exactly
+    const bool result_int_is_ok =
+    (
+         (pow(decimal_type { 3 }, 13)       == decimal_type { 1594323 })
+      && (pow(decimal_type { -2 }, 7)       == decimal_type { -128 })
+      && (pow(decimal_type { 15, -1 }, 4)   == decimal_type { 50625, -4 })
+      && (pow(decimal_type { -5 }, -3)      == decimal_type { -8, -3 })
+      && (pow(decimal_type { 25, -2 }, -5)  == decimal_type { 1024 })
+    );
+
+    BOOST_TEST(result_int_is_ok);
+
+    // Powers of ten only edit the exponent, and keep the sign of odd powers
+    const bool result_p10_is_ok =
+    (
+         (pow(decimal_type { -10 }, 3)      == decimal_type { -1000 })
+      && (pow(decimal_type { -10 }, 2)      == decimal_type { 100 })
+      && (pow(decimal_type { 100 }, -3)     == decimal_type { 1, -6 })
+      && (pow(decimal_type { 1, 1 }, std::numeric_limits<decimal_type>::max_exponent10 + 1) == std::numeric_limits<decimal_type>::infinity())
+      && (pow(decimal_type { 1, 1 }, std::numeric_limits<decimal_type>::min_exponent10 - std::numeric_limits<decimal_type>::digits10 - 1) == decimal_type { 0 })
+      && (pow(decimal_type { 1, 1 }, 2147483647) == std::numeric_limits<decimal_type>::infinity())
+    );
+
+    BOOST_TEST(result_p10_is_ok);
+
+    // A power of one half is a square root
+    const bool result_sqrt_is_ok =
+    (
+         (pow(decimal_type { 2 }, decimal_type { 5, -1 })       == sqrt(decimal_type { 2 }))
+      && (pow(decimal_type { 12345, -2 }, decimal_type { 5, -1 }) == sqrt(decimal_type { 12345, -2 }))
+      && isnan(pow(decimal_type { -2 }, decimal_type { 5, -1 }))
+    );
+
+    BOOST_TEST(result_sqrt_is_ok);
+
+    result_is_ok = (result_int_is_ok && result_p10_is_ok && result_sqrt_is_ok && result_is_ok);
+
+    return result_is_ok;
+  }
+
+  // Compounding at a monthly rate over 30 years, and discounting over a year,
+  // against the correctly rounded results
+  template<typename DecimalType>
+  auto test_pow_compound(const DecimalType& ctrl_compound, const DecimalType& ctrl_discount) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    const decimal_type compound { pow(decimal_type { 10005, -4 }, 360) };
+    const decimal_type discount { pow(decimal_type { 99, -2 }, -12) };
+
+    const bool result_compound_is_ok { compound == ctrl_compound };
+    const bool result_discount_is_ok { discount == ctrl_discount };
+
+    BOOST_TEST(result_compound_is_ok);
+    BOOST_TEST(result_discount_is_ok);
+
+    return (result_compound_is_ok && result_discount_is_ok);
+  }
+
+  // Large powers, whose partial powers are truncated many times before the final rounding,
+  // and a power that falls into the subnormal range, against the correctly rounded results
+  auto test_pow_large_n() -> bool
+  {
+    using boost::decimal::decimal32;
+    using boost::decimal::decimal64;
+    using boost::decimal::decimal128;
+    using boost::decimal::detail::uint128;
+
+    const decimal128 x128_near_one { uint128 { UINT64_C(0x1ED09BEAD8466), UINT64_C(0xF182A0F096A83FB1) }, -34 };
+
+    const bool result_is_ok =
+    (
+         (pow(decimal32 { 9999702, -7 }, 100001) == decimal32 { 5078907, -8 })
+      && (pow(decimal32 { 124, -35 }, 3) == decimal32 { 191, -101 })
+      && (pow(decimal64 { UINT64_C(1038618374849410), -15 }, 180) == decimal64 { UINT64_C(9163899266167044), -13 })
+      && (pow(decimal64 { UINT64_C(1038618374849410), -15 }, 360) == decimal64 { UINT64_C(8397704976045689), -10 })
+      && (pow(decimal64 { 10001, -4 }, -1234567) == decimal64 { UINT64_C(2432859817949775), -69 })
+      && (pow(decimal128 { uint128 { UINT64_C(0x3197FC6D2DFF), UINT64_C(0x23DABB1B74977F1) }, -33 }, 360)
+            == decimal128 { uint128 { UINT64_C(0x196DCCBCB09F6), UINT64_C(0x14A804D5443B82CC) }, -33 })
+      && (pow(x128_near_one, INT64_C(12345678901)) == decimal128 { uint128 { UINT64_C(0x1E38173989DBB), UINT64_C(0xF44A91FC4FBDB087) }, -34 })
+      && (pow(decimal128 { 10001, -4 }, -1234567) == decimal128 { uint128 { UINT64_C(0x77F3020A77A3), UINT64_C(0xBF0C263FB8D96799) }, -87 })
+    );
+
+    BOOST_TEST(result_is_ok);
+
+    return result_is_ok;
+  }
 }
 
 template<typename DecimalType> auto my_ten () -> DecimalType&
@@ -1079,6 +1174,40 @@ auto main() -> int
     result_is_ok = (test_pow_pos_is_ok && test_pow_is_neg_ok && result_is_ok);
   }
 
+  {
+    const auto test_pow_exact_is_ok =
+    (
+         local::test_pow_exact<boost::decimal::decimal32>()
+      && local::test_pow_exact<boost::decimal::decimal64>()
+      && local::test_pow_exact<boost::decimal::decimal128>()
+    );
+
+    result_is_ok = (test_pow_exact_is_ok && result_is_ok);
+  }
+
+  {
+    using boost::decimal::decimal32;
+    using boost::decimal::decimal64;
+    using boost::decimal::decimal128;
+    using boost::decimal::detail::uint128;
+
+    const auto test_pow_compound_is_ok =
+    (
+         local::test_pow_compound(decimal32 { 1197164, -6 }, decimal32 { 1128178, -6 })
+      && local::test_pow_compound(decimal64 { UINT64_C(1197163507503355), -15 }, decimal64 { UINT64_C(1128178099501970), -15 })
+      && local::test_pow_compound(decimal128 { uint128 { UINT64_C(0x3B0653EB7677), UINT64_C(0x35CE6078C5DF1E86) }, -33 },
+                                  decimal128 { uint128 { UINT64_C(0x379F9C0B6A3A), UINT64_C(0x28F82888341229F0) }, -33 })
+    );
+
+    result_is_ok = (test_pow_compound_is_ok && result_is_ok);
+  }
+
+  {
+    const auto test_pow_large_n_is_ok = local::test_pow_large_n();
+
+    result_is_ok = (test_pow_large_n_is_ok && result_is_ok);
+  }
+
   result_is_ok = ((boost::report_errors() == 0) && result_is_ok);
 
   return (result_is_ok ? 0 : -1);
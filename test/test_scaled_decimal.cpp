@@ -0,0 +1,316 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+using cents = scaled_decimal<std::int64_t, -2>;
+using basis_points = scaled_decimal<std::int32_t, -4>;
+
+void test_construction()
+{
+    BOOST_TEST_EQ(cents{}.ticks(), 0);
+    BOOST_TEST_EQ(cents{12}.ticks(), 1200);
+    BOOST_TEST_EQ(cents{-3}.ticks(), -300);
+    BOOST_TEST_EQ(cents::from_ticks(12345).ticks(), 12345);
+    BOOST_TEST_EQ(cents::scale(), -2);
+    BOOST_TEST_EQ(basis_points{1}.ticks(), 10000);
+
+    static_assert(cents::from_ticks(150) + cents{1} == cents::from_ticks(250), "Wrong constexpr addition");
+    static_assert(sizeof(cents) == sizeof(std::int64_t), "Wrong size");
+}
+
+template <typename Decimal>
+void test_decimal_roundtrip(int max_digits)
+{
+    std::int64_t max_ticks {1};
+    for (int i {}; i < max_digits; ++i)
+    {
+        max_ticks *= 10;
+    }
+
+    std::uniform_int_distribution<std::int64_t> dist(-(max_ticks - 1), max_ticks - 1);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto ticks {dist(rng)};
+        const auto val {cents::from_ticks(ticks)};
+
+        const auto dec {static_cast<Decimal>(val)};
+        BOOST_TEST_EQ(dec, (Decimal{ticks, -2}));
+        BOOST_TEST_EQ(cents{dec}.ticks(), ticks);
+    }
+}
+
+void test_from_decimal()
+{
+    // Fewer decimal places are exact
+    BOOST_TEST_EQ(cents(decimal64(5, -1)).ticks(), 50);
+    BOOST_TEST_EQ(cents(decimal64(-7, 3)).ticks(), -700000);
+    BOOST_TEST_EQ(cents(decimal32(0, 5)).ticks(), 0);
+
+    // More decimal places round once, according to the rounding mode
+    BOOST_TEST_EQ(cents(decimal64(12345, -3)).ticks(), 1235);
+    BOOST_TEST_EQ(cents(decimal64(-12345, -3)).ticks(), -1235);
+    BOOST_TEST_EQ(cents(decimal64(123449999, -7)).ticks(), 1234);
+    BOOST_TEST_EQ(cents(decimal128(1, -30)).ticks(), 0);
+
+    const auto current_mode {boost::decimal::fegetround()};
+    boost::decimal::fesetround(rounding_mode::fe_dec_to_nearest);
+    BOOST_TEST_EQ(cents(decimal64(12345, -3)).ticks(), 1234);
+    BOOST_TEST_EQ(cents(decimal64(12355, -3)).ticks(), 1236);
+    BOOST_TEST_EQ(cents(decimal64(123451, -4)).ticks(), 1235);
+    boost::decimal::fesetround(rounding_mode::fe_dec_upward);
+    BOOST_TEST_EQ(cents(decimal128(1, -30)).ticks(), 1);
+    BOOST_TEST_EQ(cents(decimal128(-1, -30)).ticks(), 0);
+    boost::decimal::fesetround(current_mode);
+
+    // Out of range and non-finite values saturate, and NaN converts to zero
+    BOOST_TEST_EQ(cents(decimal64(1, 30)).ticks(), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ(cents(decimal64(-1, 30)).ticks(), (std::numeric_limits<std::int64_t>::min)());
+    BOOST_TEST_EQ(cents{std::numeric_limits<decimal64>::infinity()}.ticks(), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ(cents{-std::numeric_limits<decimal64>::infinity()}.ticks(), (std::numeric_limits<std::int64_t>::min)());
+    BOOST_TEST_EQ(cents{std::numeric_limits<decimal64>::quiet_NaN()}.ticks(), 0);
+    BOOST_TEST_EQ(basis_points(decimal32(3, 6)).ticks(), (std::numeric_limits<std::int32_t>::max)());
+}
+
+void test_arithmetic()
+{
+    std::uniform_int_distribution<std::int64_t> dist(-999'999'999, 999'999'999);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto a {dist(rng)};
+        const auto b {dist(rng)};
+        const auto lhs {cents::from_ticks(a)};
+        const auto rhs {cents::from_ticks(b)};
+
+        BOOST_TEST_EQ((lhs + rhs).ticks(), a + b);
+        BOOST_TEST_EQ((lhs - rhs).ticks(), a - b);
+        BOOST_TEST_EQ((-lhs).ticks(), -a);
+        BOOST_TEST_EQ(lhs < rhs, a < b);
+        BOOST_TEST_EQ(lhs <= rhs, a <= b);
+        BOOST_TEST_EQ(lhs > rhs, a > b);
+        BOOST_TEST_EQ(lhs >= rhs, a >= b);
+        BOOST_TEST_EQ(lhs == rhs, a == b);
+        BOOST_TEST_EQ(lhs != rhs, a != b);
+
+        // The products and quotients are rounded once, as the exact value converted from decimal128
+        const decimal128 dec_lhs {a, -2};
+        const decimal128 dec_rhs {b, -2};
+        BOOST_TEST_EQ((lhs * rhs).ticks(), cents{dec_lhs * dec_rhs}.ticks());
+
+        if (b != 0)
+        {
+            BOOST_TEST_EQ((lhs / rhs).ticks(), cents{dec_lhs / dec_rhs}.ticks());
+        }
+
+        BOOST_TEST_EQ((lhs * 3).ticks(), a * 3);
+        BOOST_TEST_EQ((3 * lhs).ticks(), a * 3);
+    }
+
+    // Halfway cases
+    BOOST_TEST_EQ((cents::from_ticks(5) * cents::from_ticks(50)).ticks(), 3);
+    BOOST_TEST_EQ((cents::from_ticks(-5) * cents::from_ticks(50)).ticks(), -3);
+    BOOST_TEST_EQ((cents{1} / cents{3}).ticks(), 33);
+    BOOST_TEST_EQ((cents{2} / cents{3}).ticks(), 67);
+    BOOST_TEST_EQ((cents{-2} / 3).ticks(), -67);
+    BOOST_TEST_EQ((cents{100} / 7).ticks(), 1429);
+    BOOST_TEST_EQ((basis_points::from_ticks(12345) * basis_points::from_ticks(20000)).ticks(), 24690);
+
+    // Division by zero saturates
+    BOOST_TEST_EQ((cents{1} / cents{}).ticks(), (std::numeric_limits<std::int64_t>::max)());
+    BOOST_TEST_EQ((cents{-1} / 0).ticks(), (std::numeric_limits<std::int64_t>::min)());
+    BOOST_TEST_EQ((cents{} / cents{}).ticks(), 0);
+
+    auto val {cents{10}};
+    val += cents::from_ticks(5);
+    val -= cents{1};
+    val *= cents{2};
+    val /= 4;
+    BOOST_TEST_EQ(val.ticks(), 453);
+}
+
+template <typename Int, int Scale>
+void test_to_chars(scaled_decimal<Int, Scale> val, const char* expected)
+{
+    char buffer[64] {};
+    const auto r {to_chars(buffer, buffer + sizeof(buffer), val)};
+    BOOST_TEST(r);
+    *r.ptr = '\0';
+    BOOST_TEST_CSTR_EQ(buffer, expected);
+
+    // Too small buffer
+    const auto len {static_cast<std::ptrdiff_t>(std::strlen(expected))};
+    BOOST_TEST(to_chars(buffer, buffer + len - 1, val).ec == std::errc::value_too_large);
+}
+
+void test_charconv()
+{
+    test_to_chars(cents::from_ticks(12345), "123.45");
+    test_to_chars(cents::from_ticks(-12340), "-123.40");
+    test_to_chars(cents::from_ticks(5), "0.05");
+    test_to_chars(cents::from_ticks(-5), "-0.05");
+    test_to_chars(cents{}, "0.00");
+    test_to_chars(cents::from_ticks((std::numeric_limits<std::int64_t>::min)()), "-92233720368547758.08");
+    test_to_chars(scaled_decimal<std::int32_t, 0>::from_ticks(-42), "-42");
+
+    cents val {};
+    const char* str {"-123.456"};
+    auto r {from_chars(str, str + std::strlen(str), val)};
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.ptr, str + std::strlen(str));
+    BOOST_TEST_EQ(val.ticks(), -12346);
+
+    str = "1.5e2";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), 15000);
+
+    str = "1e30";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(val.ticks(), 15000);
+
+    str = "inf";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    str = "nan";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    str = "abc";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(val.ticks(), 15000);
+
+    // Overflow to infinity as a decimal128 is still out of range
+    str = "-1e99999";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(r.ptr, str + std::strlen(str));
+    BOOST_TEST_EQ(val.ticks(), 15000);
+
+    str = "-inf";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(val.ticks(), 15000);
+
+    str = "1e-99999";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), 0);
+
+    str = "1.5e";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.ptr, str + 3);
+    BOOST_TEST_EQ(val.ticks(), 150);
+
+    str = "1.5";
+    r = from_chars(str, str + std::strlen(str), val, chars_format::scientific);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    str = "1.5e2";
+    r = from_chars(str, str + std::strlen(str), val, chars_format::fixed);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(r.ptr, str + 3);
+    BOOST_TEST_EQ(val.ticks(), 150);
+
+    str = ".125";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), 13);
+
+    // More digits than a decimal128 holds are rounded once, and not to 34 digits first
+    str = "0.12499999999999999999999999999999999999999";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), 12);
+
+    str = "-1234567890123456.7849999999999999999999999999999999999999e1";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), INT64_C(-1234567890123456785));
+
+    str = "0.00000000000000000000000000000000000000001";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), 0);
+
+    const auto current_mode {boost::decimal::fegetround()};
+
+    boost::decimal::fesetround(rounding_mode::fe_dec_to_nearest);
+    str = "0.125";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST_EQ(val.ticks(), 12);
+
+    str = "0.1250000000000000000000000000000000000000000001";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST_EQ(val.ticks(), 13);
+
+    boost::decimal::fesetround(rounding_mode::fe_dec_upward);
+    str = "0.00000000000000000000000000000000000000001";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST_EQ(val.ticks(), 1);
+
+    boost::decimal::fesetround(current_mode);
+
+    // The largest values are parsed exactly
+    str = "-92233720368547758.08";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r);
+    BOOST_TEST_EQ(val.ticks(), (std::numeric_limits<std::int64_t>::min)());
+
+    str = "92233720368547758.08";
+    r = from_chars(str, str + std::strlen(str), val);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Round trip
+    std::uniform_int_distribution<std::int64_t> dist((std::numeric_limits<std::int64_t>::min)(), (std::numeric_limits<std::int64_t>::max)());
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto expected {cents::from_ticks(dist(rng))};
+        char buffer[64] {};
+        const auto to_r {to_chars(buffer, buffer + sizeof(buffer), expected)};
+        BOOST_TEST(to_r);
+
+        cents parsed {};
+        const auto from_r {from_chars(buffer, to_r.ptr, parsed)};
+        BOOST_TEST(from_r);
+        BOOST_TEST_EQ(parsed.ticks(), expected.ticks());
+    }
+}
+
+int main()
+{
+    test_construction();
+
+    test_decimal_roundtrip<decimal32>(7);
+    test_decimal_roundtrip<decimal32_fast>(7);
+    test_decimal_roundtrip<decimal64>(16);
+    test_decimal_roundtrip<decimal128>(18);
+
+    test_from_decimal();
+    test_arithmetic();
+    test_charconv();
+
+    return boost::report_errors();
+}
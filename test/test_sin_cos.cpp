@@ -28,6 +28,7 @@
 #include <iostream>
 #include <random>
 #include <cmath>
+#include <iomanip>
 
 #if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
 static constexpr auto N = static_cast<std::size_t>(128U); // Number of trials
@@ -135,76 +136,156 @@ void test_cos()
     }
 }
 
+// Reduced arguments of large and nearly singular values computed with 6400 digits of pi
 template <typename T>
-void print_value(T value, const char* str)
+void test_reduction(T tol)
 {
-    int ptr;
-    const auto sig_val = frexp10(value, &ptr);
-    std::cerr << std::setprecision(std::numeric_limits<T>::digits10) << str << ": " << value
-              << "\nSig: " << sig_val.high << " " << sig_val.low
-              << "\nExp: " << ptr << "\n" << std::endl;
+    struct point { decimal128 x; int quadrant; decimal128 r; };
+
+    const point points[] = {
+        {"355"_DL,     2, "3.014435336405372129768941617408571985787e-05"_DL},
+        {"5419351"_DL, 2, "3.820047507089661120930116470427948776308e-08"_DL},
+        {"8629649e58"_DL, 0, "-5.959795535296595574687719327672290121595e-01"_DL},
+        {"1e90"_DL,    3, "1.021211508755237672885023956582290277435e-01"_DL},
+        {"1e22"_DL,    3, "5.506189342358096459131197063585869868345e-01"_DL},
+        {"1e300"_DL,   3, "-1.690180212691715362690897056917683415138e-01"_DL},
+        {"6134899525417045"_DL, 2, "-9.495905770584395894044583460012818470847e-17"_DL},
+        {"4881129429929450e264"_DL, 1, "9.953899667137410556899138552527871272996e-02"_DL},
+        {"1e6000"_DL,  3, "-7.598684190013564940802018836237456903787e-01"_DL},
+        {"7e6110"_DL,  0, "6.807282016673434028270587896501537696738e-01"_DL},
+        {"576158399707529532856928653334013"_DL, 1, "-1.145396105280687769804074025092908606375e-33"_DL}
+    };
+
+    for (const auto& pt : points)
+    {
+        if (pt.x > static_cast<decimal128>(std::numeric_limits<T>::max()) ||
+            static_cast<decimal128>(static_cast<T>(pt.x)) != pt.x)
+        {
+            continue;
+        }
+
+        int quadrant {};
+        const auto r {detail::trig_reduce(static_cast<T>(pt.x), &quadrant)};
+        const auto ref {static_cast<T>(pt.r)};
+
+        BOOST_TEST_EQ(quadrant, pt.quadrant);
+
+        if (!BOOST_TEST(abs(r - ref) <= tol * abs(ref)))
+        {
+            std::cerr << "x: " << pt.x << "\nr: " << r << "\nref: " << ref << std::endl; // LCOV_EXCL_LINE
+        }
+    }
 }
 
-int main()
+template <typename T>
+void test_sincos()
 {
-    #ifdef BOOST_DECIMAL_GENERATE_CONSTANT_SIGS
-    std::cerr << "----- Sin Coeffs -----" << '\n';
-    print_value("1.5699342435209476025651717041741222e-19"_DL, "a0");
-    print_value("-8.8132732956573375066199565461908719e-18"_DL, "a1");
-    print_value("1.3863524195221541686408628558203953e-18"_DL, "a2");
-    print_value("2.8092138674699095038603966669197672e-15"_DL, "a3");
-    print_value("2.6602926311836597886374265715483009e-18"_DL, "a4");
-    print_value("-7.647187644614729441998912554111624e-13"_DL, "a5");
-    print_value("1.6631026334876884745954474452210885e-18"_DL, "a6");
-    print_value("1.6059043746245914318033425521094091e-10"_DL, "a7");
-    print_value("3.8855818741866909397363716405229141e-19"_DL, "a8");
-    print_value("-2.5052108385573133011847226381434009e-08"_DL, "a9");
-    print_value("3.4914886265734843190231514748823632e-20"_DL, "a10");
-    print_value("2.7557319223985818369477273553859578e-06"_DL, "a11");
-    print_value("1.1508316403034518496534319639927136e-21"_DL, "a12");
-    print_value("-0.00019841269841269841283663285131581154"_DL, "a13");
-    print_value("1.2185770421264807218078195121820301e-23"_DL, "a14");
-    print_value("0.0083333333333333333333325747157858247"_DL, "a15");
-    print_value("3.151985000765337776035625655498396e-26"_DL, "a16");
-    print_value("-0.166666666666666666666666667468363"_DL, "a17");
-    print_value("1.0798913896208528750785230421502658e-29"_DL, "a18");
-    print_value("0.9999999999999999999999999999994222"_DL, "a19");
-    print_value("5.142496035903513218983541015724909e-35"_DL, "a20");
-
-    std::cerr << "\n----- Cos Coeffs -----" << '\n';
-    print_value("3.7901566851452528911995533679050154e-19"_DL, "a0");
-    print_value("1.6306031360068815018052629353024035e-19"_DL, "a1");
-    print_value("-1.5662432214968104749920975944134976e-16"_DL, "a2");
-    print_value("7.4986543056686147173668341796175043e-19"_DL, "a3");
-    print_value("4.7793843527366502077270638230621663e-14"_DL, "a4");
-    print_value("8.6228514128460838465953643567304485e-19"_DL, "a5");
-    print_value("-1.1470746211515679895911787383100785e-11"_DL, "a6");
-    print_value("3.4035901048127981461895025346148961e-19"_DL, "a7");
-    print_value("2.0876756986386685705585269979282106e-09"_DL, "a8");
-    print_value("5.0707181385354000943766543756900133e-20"_DL, "a9");
-    print_value("-2.7557319223987251623517450696484143e-07"_DL, "a10");
-    print_value("2.842434434652202240144372150674076e-21"_DL, "a11");
-    print_value("2.4801587301587301131235298728224135-05"_DL, "a12");
-    print_value("5.5157104597335436534512866304911642e-23"_DL, "a13");
-    print_value("-0.0013888888888888888888937824839517112"_DL, "a14");
-    print_value("3.0643338914793183455023135450473855e-25"_DL, "a15");
-    print_value("0.0416666666666666666666666538646346421"_DL, "a16");
-    print_value("3.2731904841623917801666953504570181e-28"_DL, "a17");
-    print_value("-0.50000000000000000000000000000443128"_DL, "a18");
-    print_value("2.3830720519892726434235205129382137e-32"_DL, "a19");
-    print_value("1"_DL, "a20");
-
-    throw;
-    #endif
+    std::uniform_int_distribution<int> exp_dist(-20, std::numeric_limits<T>::max_exponent10 - std::numeric_limits<T>::digits10);
+    std::uniform_int_distribution<std::uint32_t> sig_dist(1000000U, 9999999U);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const T x {sig_dist(rng), exp_dist(rng), n % 2U == 1U};
+
+        T s {};
+        T c {};
+        sincos(x, &s, &c);
+
+        BOOST_TEST_EQ(s, sin(x));
+        BOOST_TEST_EQ(c, cos(x));
+    }
+
+    const T specials[] = {
+        T{0}, -T{0}, std::numeric_limits<T>::epsilon() / 2, T{1, -1}, T{-3},
+        std::numeric_limits<T>::max(), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity()
+    };
+
+    for (const auto x : specials)
+    {
+        T s {};
+        T c {};
+        sincos(x, &s, &c);
+
+        BOOST_TEST_EQ(s, sin(x));
+        BOOST_TEST_EQ(c, cos(x));
+    }
 
+    T s {};
+    T c {};
+    sincos(std::numeric_limits<T>::quiet_NaN(), &s, &c);
+    BOOST_TEST(isnan(s) && isnan(c));
+}
+
+// sin(x) and cos(x) to 40 digits, e.g. N[{Sin[355], Cos[355]}, 40]
+template <typename T>
+void test_sin_cos_values()
+{
+    struct point { T x; decimal128 sin_x; decimal128 cos_x; };
+
+    const point points[] = {
+        {T{5, -1}, "4.794255386042030002732879352155713880818e-1"_DL, "8.775825618903727161162815826038296519916e-1"_DL},
+        {T{1}, "8.414709848078965066525023216302989996226e-1"_DL, "5.403023058681397174009366074429766037323e-1"_DL},
+        {T{2}, "9.092974268256816953960198659117448427023e-1"_DL, "-4.161468365471423869975682295007621897660e-1"_DL},
+        {T{3}, "1.411200080598672221007448028081102798469e-1"_DL, "-9.899924966004454572715727947312613023937e-1"_DL},
+        {T{10}, "-5.440211108893698134047476618513772816836e-1"_DL, "-8.390715290764524522588639478240648345199e-1"_DL},
+        {T{100}, "-5.063656411097587936565576104597854320650e-1"_DL, "8.623188722876839341019385139508425355101e-1"_DL},
+        {T{355}, "-3.014435335948844921433028000865009959026e-5"_DL, "-9.999999995456589801659358416927540811238e-1"_DL},
+        {T{-25, -2}, "-2.474039592545229295968487048493891958934e-1"_DL, "9.689124217106447841445954494941891998041e-1"_DL},
+        {T{15, -6}, "1.499999999943750000000632812499996609933e-5"_DL, "9.999999998875000000021093749999841796875e-1"_DL},
+        {T{1, 6}, "-3.499935021712929521176524867807714690614e-1"_DL, "9.367521275331447869385325350749187757081e-1"_DL}
+    };
+
+    // Within one unit in the last place of the rounded reference value
+    const auto check = [](T val, decimal128 ref_val, T x)
+    {
+        const auto ref {static_cast<T>(ref_val)};
+
+        int exp {};
+        frexp10(ref, &exp);
+        const T ulp {1, exp};
+
+        if (!BOOST_TEST(abs(val - ref) <= ulp))
+        {
+            // LCOV_EXCL_START
+            std::cerr << std::setprecision(std::numeric_limits<T>::digits10)
+                      << "x: " << x
+                      << "\nVal: " << val
+                      << "\nRef: " << ref << std::endl;
+            // LCOV_EXCL_STOP
+        }
+    };
+
+    for (const auto& pt : points)
+    {
+        check(sin(pt.x), pt.sin_x, pt.x);
+        check(cos(pt.x), pt.cos_x, pt.x);
+        check(sin(-pt.x), -pt.sin_x, -pt.x);
+        check(cos(-pt.x), pt.cos_x, -pt.x);
+    }
+}
+
+int main()
+{
     test_sin<decimal32>();
     test_cos<decimal32>();
     test_sin<decimal64>();
     test_cos<decimal64>();
 
+    test_reduction<decimal32>(decimal32{1, -6});
+    test_reduction<decimal64>(decimal64{1, -15});
+    test_reduction<decimal128>(decimal128{1, -32});
+
+    test_sincos<decimal32>();
+    test_sincos<decimal64>();
+    test_sincos<decimal128>();
+
+    test_sin_cos_values<decimal32>();
+    test_sin_cos_values<decimal64>();
+    test_sin_cos_values<decimal128>();
+
     #if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
-    //test_sin<decimal128>();
-    //test_cos<decimal128>();
+    test_sin<decimal128>();
+    test_cos<decimal128>();
     #endif
 
     return boost::report_errors();
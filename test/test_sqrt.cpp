@@ -127,6 +127,27 @@ namespace local
     return result_is_ok;
   }
 
+  template<typename DecimalType>
+  auto test_sqrt_exact(const DecimalType& ctrl_sqrt2) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    // Exact squares have exact roots, everything else is correctly rounded
+    const auto result_exact_is_ok =
+    (
+         (sqrt(decimal_type { 225, -2 }) == decimal_type { 15, -1 })
+      && (sqrt(decimal_type { 144, 20 }) == decimal_type { 12, 10 })
+      && (sqrt(decimal_type { 4, -8 })   == decimal_type { 2, -4 })
+    );
+
+    const auto result_sqrt2_is_ok = (sqrt(decimal_type { 2 }) == ctrl_sqrt2);
+
+    BOOST_TEST(result_exact_is_ok);
+    BOOST_TEST(result_sqrt2_is_ok);
+
+    return (result_exact_is_ok && result_sqrt2_is_ok);
+  }
+
   template<typename DecimalType, typename FloatType>
   auto test_sqrt_edge() -> bool
   {
@@ -160,7 +181,8 @@ namespace local
         }
         else if(np_mod2 == -1)
         {
-          decimal_type val_p10_ctrl = decimal_type { 1, np / 2 } / boost::decimal::numbers::sqrt10_v<decimal_type>;
+          // The result is the correctly rounded sqrt(10) scaled by a power of ten
+          decimal_type val_p10_ctrl = decimal_type { 1, (np - 1) / 2 } * boost::decimal::numbers::sqrt10_v<decimal_type>;
 
           result_val_p10_is_ok = (val_p10 == val_p10_ctrl);
         }
@@ -342,6 +364,32 @@ namespace local
     return result_is_ok;
   }
 
+  template<typename DecimalType>
+  auto test_sqrt_rounding(const std::array<const char*, 9U>& arg_strings, const std::array<const char*, 9U>& ctrl_strings) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < arg_strings.size(); ++i)
+    {
+      decimal_type x_arg { };
+      decimal_type ctrl { };
+
+      static_cast<void>(from_chars(arg_strings[i], arg_strings[i] + std::strlen(arg_strings[i]), x_arg));
+      static_cast<void>(from_chars(ctrl_strings[i], ctrl_strings[i] + std::strlen(ctrl_strings[i]), ctrl));
+
+      // The root is correctly rounded, so it has to match the control to the last digit
+      const auto result_sqrt_is_ok = (sqrt(x_arg) == ctrl);
+
+      BOOST_TEST(result_sqrt_is_ok);
+
+      result_is_ok = (result_sqrt_is_ok && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
 } // namespace local
 
 auto main() -> int
@@ -394,6 +442,71 @@ auto main() -> int
     result_is_ok = (result_edge_is_ok && result_is_ok);
   }
 
+  {
+    const auto result_exact32_is_ok = local::test_sqrt_exact(boost::decimal::decimal32 { UINT32_C(1414214), -6 });
+    const auto result_exact64_is_ok = local::test_sqrt_exact(boost::decimal::decimal64 { UINT64_C(1414213562373095), -15 });
+
+    result_is_ok = (result_exact32_is_ok && result_exact64_is_ok && result_is_ok);
+  }
+
+  {
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact square and four integers whose roots lie close to halfway between two representable values
+    // Table[N[Sqrt[x], 7], {x, {2, 3/10, 123456*^-20, 123456*^20, 144/100, 11239, 17760, 19069, 26853}}]
+    const auto result_rounding32_is_ok = local::test_sqrt_rounding<boost::decimal::decimal32>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "1.44", "11239", "17760", "19069", "26853" }},
+      {{
+         "1.414214E+0",
+         "5.477226E-1",
+         "3.513631E-8",
+         "3.513631E+12",
+         "1.2E+0",
+         "1.060141E+2",
+         "1.332666E+2",
+         "1.380906E+2",
+         "1.638688E+2"
+      }}
+    );
+
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact square and four integers whose roots lie close to halfway between two representable values
+    // Table[N[Sqrt[x], 16], {x, {2, 3/10, 123456*^-20, 123456*^20, 144/100, 8853, 12394, 21595, 24810}}]
+    const auto result_rounding64_is_ok = local::test_sqrt_rounding<boost::decimal::decimal64>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "1.44", "8853", "12394", "21595", "24810" }},
+      {{
+         "1.414213562373095E+0",
+         "5.477225575051661E-1",
+         "3.513630600959640E-8",
+         "3.513630600959640E+12",
+         "1.2E+0",
+         "9.409038208021052E+1",
+         "1.113283432015406E+2",
+         "1.469523732370457E+2",
+         "1.575119043120234E+2"
+      }}
+    );
+
+    // The arguments 2, 0.3, 1.23456E-15, 1.23456E25, an exact square and four integers whose roots lie close to halfway between two representable values
+    // Table[N[Sqrt[x], 34], {x, {2, 3/10, 123456*^-20, 123456*^20, 144/100, 9919, 15622, 16864, 23337}}]
+    const auto result_rounding128_is_ok = local::test_sqrt_rounding<boost::decimal::decimal128>
+    (
+      {{ "2", "0.3", "1.23456E-15", "1.23456E25", "1.44", "9919", "15622", "16864", "23337" }},
+      {{
+         "1.414213562373095048801688724209698E+0",
+         "5.477225575051661134569697828008021E-1",
+         "3.513630600959639866393338464041806E-8",
+         "3.513630600959639866393338464041806E+12",
+         "1.2E+0",
+         "9.959417653658269993658568011428728E+1",
+         "1.249879994239446973635880576714238E+2",
+         "1.298614646459834134578423878593970E+2",
+         "1.527645246776881769380524984923163E+2"
+      }}
+    );
+
+    result_is_ok = (result_rounding32_is_ok && result_rounding64_is_ok && result_rounding128_is_ok && result_is_ok);
+  }
+
   {
     const auto result_sqrt128_is_ok = local::test_sqrt_128(96);
 
@@ -231,6 +231,52 @@ namespace local
     return result_is_ok;
   }
 
+  template<typename DecimalType>
+  auto test_tgamma_table(const int tol_factor, const int n_max) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    const decimal_type my_tol { std::numeric_limits<decimal_type>::epsilon() * static_cast<decimal_type>(tol_factor) };
+
+    auto result_is_ok = true;
+
+    // Gamma(n) = (n - 1)! and Gamma(n + 1/2) = (n - 1/2) Gamma(n - 1/2),
+    // across the tabulated range and past its end
+    decimal_type factorial { 1 };
+    decimal_type half_integer_gamma { sqrt(boost::decimal::numbers::pi_v<decimal_type>) };
+
+    for(auto n = 1; n <= n_max; ++n)
+    {
+      const auto result_factorial_is_ok = is_close_fraction(tgamma(decimal_type { n }), factorial, my_tol);
+      const auto result_half_is_ok      = is_close_fraction(tgamma(decimal_type { 2 * n - 1, -1 } * 5), half_integer_gamma, my_tol);
+
+      result_is_ok = (result_factorial_is_ok && result_half_is_ok && result_is_ok);
+
+      factorial *= decimal_type { n };
+      half_integer_gamma *= decimal_type { 2 * n - 1, -1 } * 5;
+    }
+
+    // Products with few digits are exact
+    result_is_ok = ((tgamma(decimal_type { 11 }) == decimal_type { 3628800 }) && result_is_ok);
+    result_is_ok = ((tgamma(decimal_type { 5, -1 }) * tgamma(decimal_type { 5, -1 }) - boost::decimal::numbers::pi_v<decimal_type>) <= my_tol && result_is_ok);
+
+    BOOST_TEST(result_is_ok);
+
+    return result_is_ok;
+  }
+
+  template<typename DecimalType>
+  auto test_tgamma_table_end(const int n_last) -> bool
+  {
+    using decimal_type = DecimalType;
+
+    const auto result_last_is_ok = (isfinite(tgamma(decimal_type { n_last })) && isinf(tgamma(decimal_type { n_last + 1 })));
+
+    BOOST_TEST(result_last_is_ok);
+
+    return result_last_is_ok;
+  }
+
   template<typename DecimalType, typename FloatType>
   auto test_tgamma_edge() -> bool
   {
@@ -568,6 +614,18 @@ auto main() -> int
     result_is_ok = (result_ui32_is_ok && result_is_ok);
   }
 
+  {
+    const auto result_table32_is_ok  = local::test_tgamma_table<boost::decimal::decimal32>(256, 68);
+    const auto result_table64_is_ok  = local::test_tgamma_table<boost::decimal::decimal64>(1024, 204);
+    const auto result_table128_is_ok = local::test_tgamma_table<boost::decimal::decimal128>(4096, 204);
+
+    const auto result_end32_is_ok = local::test_tgamma_table_end<boost::decimal::decimal32>(69);
+    const auto result_end64_is_ok = local::test_tgamma_table_end<boost::decimal::decimal64>(205);
+
+    result_is_ok = (result_table32_is_ok && result_table64_is_ok && result_table128_is_ok && result_is_ok);
+    result_is_ok = (result_end32_is_ok && result_end64_is_ok && result_is_ok);
+  }
+
   {
     using decimal_type = boost::decimal::decimal32;
     using float_type   = float;
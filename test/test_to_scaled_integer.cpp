@@ -0,0 +1,221 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <system_error>
+#include <vector>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+static constexpr auto int64_max {(std::numeric_limits<std::int64_t>::max)()};
+static constexpr auto int64_min {(std::numeric_limits<std::int64_t>::min)()};
+
+template <typename T>
+void test_roundtrip(int max_digits)
+{
+    std::int64_t max_ticks {1};
+    for (int i {}; i < max_digits; ++i)
+    {
+        max_ticks *= 10;
+    }
+
+    std::uniform_int_distribution<std::int64_t> ticks_dist(-(max_ticks - 1), max_ticks - 1);
+    std::uniform_int_distribution<int> exp_dist(-20, 5);
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const auto ticks {ticks_dist(rng)};
+        const auto exp {exp_dist(rng)};
+
+        const auto val {from_scaled_integer<T>(ticks, exp)};
+        BOOST_TEST_EQ(val, (T{ticks, exp}));
+
+        const auto res {to_scaled_integer(val, exp)};
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.value, ticks);
+
+        // The same value at a smaller exponent is exact
+        const auto finer {to_scaled_integer(val, exp - 1)};
+        if (ticks > -max_ticks / 10 && ticks < max_ticks / 10)
+        {
+            BOOST_TEST(finer);
+            BOOST_TEST_EQ(finer.value, ticks * 10);
+        }
+    }
+}
+
+template <typename T>
+void test_rounding()
+{
+    // Exact conversions of values at other exponents
+    BOOST_TEST_EQ(to_scaled_integer(T{5, -1}, -2).value, 50);
+    BOOST_TEST_EQ(to_scaled_integer(T{-7, 3}, -2).value, -700000);
+    BOOST_TEST_EQ(to_scaled_integer(T{0, 5}, -2).value, 0);
+    BOOST_TEST_EQ(to_scaled_integer(T{12300, -4}, -2).value, 123);
+
+    // More decimal places round according to the rounding mode
+    BOOST_TEST_EQ(to_scaled_integer(T{12345, -3}, -2).value, 1235);
+    BOOST_TEST_EQ(to_scaled_integer(T{-12345, -3}, -2).value, -1235);
+    BOOST_TEST_EQ(to_scaled_integer(T{1234499, -5}, -2).value, 1234);
+    BOOST_TEST_EQ(to_scaled_integer(T{1, -30}, -2).value, 0);
+    BOOST_TEST(to_scaled_integer(T{12345, -3}, -2));
+
+    const auto current_mode {boost::decimal::fegetround()};
+    boost::decimal::fesetround(rounding_mode::fe_dec_to_nearest);
+    BOOST_TEST_EQ(to_scaled_integer(T{12345, -3}, -2).value, 1234);
+    BOOST_TEST_EQ(to_scaled_integer(T{12355, -3}, -2).value, 1236);
+    BOOST_TEST_EQ(to_scaled_integer(T{123451, -4}, -2).value, 1235);
+    boost::decimal::fesetround(rounding_mode::fe_dec_toward_zero);
+    BOOST_TEST_EQ(to_scaled_integer(T{12349, -3}, -2).value, 1234);
+    BOOST_TEST_EQ(to_scaled_integer(T{-12349, -3}, -2).value, -1234);
+    boost::decimal::fesetround(rounding_mode::fe_dec_upward);
+    BOOST_TEST_EQ(to_scaled_integer(T{1, -30}, -2).value, 1);
+    BOOST_TEST_EQ(to_scaled_integer(T{-1, -30}, -2).value, 0);
+    boost::decimal::fesetround(current_mode);
+}
+
+template <typename T>
+void test_errors()
+{
+    errno = 0;
+
+    // Out of range values saturate
+    auto res {to_scaled_integer(T{1, 30}, -2)};
+    BOOST_TEST(res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(res.value, int64_max);
+
+    res = to_scaled_integer(T{-1, 17}, -2);
+    BOOST_TEST(res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(res.value, int64_min);
+
+    res = to_scaled_integer(T{1, 18}, 0);
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.value, INT64_C(1000000000000000000));
+
+    res = to_scaled_integer(std::numeric_limits<T>::infinity(), -2);
+    BOOST_TEST(res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(res.value, int64_max);
+
+    res = to_scaled_integer(-std::numeric_limits<T>::infinity(), -2);
+    BOOST_TEST(res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(res.value, int64_min);
+
+    res = to_scaled_integer(std::numeric_limits<T>::quiet_NaN(), -2);
+    BOOST_TEST(res.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(res.value, 0);
+
+    res = to_scaled_integer(std::numeric_limits<T>::signaling_NaN(), -2);
+    BOOST_TEST(res.ec == std::errc::invalid_argument);
+
+    BOOST_TEST_EQ(errno, 0);
+}
+
+// The full range of std::int64_t needs the precision of decimal128
+void test_limits()
+{
+    auto res {to_scaled_integer(decimal128{int64_max, -4}, -4)};
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.value, int64_max);
+
+    res = to_scaled_integer(decimal128{int64_min, -4}, -4);
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.value, int64_min);
+
+    res = to_scaled_integer(decimal128{int64_min, -4} - decimal128{1, -4}, -4);
+    BOOST_TEST(res.ec == std::errc::result_out_of_range);
+    BOOST_TEST_EQ(res.value, int64_min);
+
+    res = to_scaled_integer(decimal128{int64_max, -5}, -4);
+    BOOST_TEST(res);
+    BOOST_TEST_EQ(res.value, int64_max / 10 + 1);
+
+    BOOST_TEST_EQ(from_scaled_integer<decimal128>(int64_min, -4), (decimal128{int64_min, -4}));
+}
+
+template <typename T>
+void test_span(int max_digits)
+{
+    #ifdef BOOST_DECIMAL_HAS_STD_SPAN
+
+    std::int64_t max_ticks {1};
+    for (int i {}; i < max_digits; ++i)
+    {
+        max_ticks *= 10;
+    }
+
+    std::uniform_int_distribution<std::int64_t> ticks_dist(-(max_ticks - 1), max_ticks - 1);
+
+    std::vector<std::int64_t> ticks(N);
+    for (auto& val : ticks)
+    {
+        val = ticks_dist(rng);
+    }
+
+    std::vector<T> values(N);
+    from_scaled_integer(std::span<const std::int64_t>(ticks), -4, std::span<T>(values));
+
+    std::vector<std::int64_t> back(N);
+    BOOST_TEST(to_scaled_integer(std::span<const T>(values), -4, std::span<std::int64_t>(back)) == std::errc{});
+
+    for (std::size_t i {}; i < N; ++i)
+    {
+        BOOST_TEST_EQ(values[i], (T{ticks[i], -4}));
+        BOOST_TEST_EQ(back[i], ticks[i]);
+    }
+
+    // Every element is converted, and the first failure is reported
+    values[1] = std::numeric_limits<T>::quiet_NaN();
+    values[2] = std::numeric_limits<T>::infinity();
+    BOOST_TEST(to_scaled_integer(std::span<const T>(values), -4, std::span<std::int64_t>(back)) == std::errc::invalid_argument);
+    BOOST_TEST_EQ(back[0], ticks[0]);
+    BOOST_TEST_EQ(back[1], 0);
+    BOOST_TEST_EQ(back[2], int64_max);
+    BOOST_TEST_EQ(back[3], ticks[3]);
+
+    #else
+
+    static_cast<void>(max_digits);
+
+    #endif
+}
+
+int main()
+{
+    test_roundtrip<decimal32>(7);
+    test_roundtrip<decimal32_fast>(7);
+    test_roundtrip<decimal64>(16);
+    test_roundtrip<decimal128>(18);
+
+    test_rounding<decimal32>();
+    test_rounding<decimal32_fast>();
+    test_rounding<decimal64>();
+    test_rounding<decimal128>();
+
+    test_errors<decimal32>();
+    test_errors<decimal32_fast>();
+    test_errors<decimal64>();
+    test_errors<decimal128>();
+
+    test_limits();
+
+    test_span<decimal32>(7);
+    test_span<decimal64>(16);
+    test_span<decimal128>(18);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,169 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/decimal.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <system_error>
+
+using namespace boost::decimal;
+
+#if !defined(BOOST_DECIMAL_REDUCE_TEST_DEPTH)
+static constexpr auto N = static_cast<std::size_t>(1024U); // Number of trials
+#else
+static constexpr auto N = static_cast<std::size_t>(1024U >> 4U); // Number of trials
+#endif
+
+// NOLINTNEXTLINE : Seed with a constant for repeatability
+static std::mt19937_64 rng(42); // NOSONAR : Global rng is not const
+
+static_assert(try_to_integral<int>(decimal64(123, -1)).value == 12, "Wrong constexpr conversion");
+static_assert(try_to_integral<int>(decimal64(123, -1)).ec == std::errc{}, "Wrong constexpr conversion");
+static_assert(try_to_integral<unsigned>(decimal32(-1)).ec == std::errc::result_out_of_range, "Wrong constexpr conversion");
+
+// Every value in range gives the same result as the conversion operator
+template <typename T, typename Integer>
+void test_integral_same_as_cast()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-8, 2);
+
+    errno = 0;
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const T val {sig_dist(rng), exp_dist(rng)};
+
+        const auto res {try_to_integral<Integer>(val)};
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.value, static_cast<Integer>(val));
+    }
+
+    BOOST_TEST_EQ(errno, 0);
+}
+
+template <typename T>
+void test_integral_errors()
+{
+    errno = 0;
+
+    BOOST_TEST((try_to_integral<int>(std::numeric_limits<T>::quiet_NaN()) == conversion_result<int>{0, std::errc::invalid_argument}));
+    BOOST_TEST(try_to_integral<int>(std::numeric_limits<T>::signaling_NaN()).ec == std::errc::invalid_argument);
+    BOOST_TEST((try_to_integral<int>(std::numeric_limits<T>::infinity()) == conversion_result<int>{0, std::errc::result_out_of_range}));
+    BOOST_TEST(try_to_integral<long long>(-std::numeric_limits<T>::infinity()).ec == std::errc::result_out_of_range);
+    BOOST_TEST(try_to_integral<std::int8_t>(T{128}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(try_to_integral<std::int8_t>(T{-129}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(try_to_integral<unsigned>(T{-1}).ec == std::errc::result_out_of_range);
+    BOOST_TEST(try_to_integral<unsigned>(T{-5, -1}).ec == std::errc::result_out_of_range);
+    BOOST_TEST((try_to_integral<unsigned>(-T{0}) == conversion_result<unsigned>{0U, std::errc{}}));
+    BOOST_TEST((try_to_integral<std::int8_t>(T{-128}) == conversion_result<std::int8_t>{-128, std::errc{}}));
+    BOOST_TEST((try_to_integral<long long>(T{5, -1}) == conversion_result<long long>{0, std::errc{}}));
+    BOOST_TEST(!try_to_integral<int>(std::numeric_limits<T>::max()));
+
+    BOOST_TEST_EQ(errno, 0);
+
+    // The errno reporting conversions keep their behavior
+    static_cast<void>(static_cast<int>(std::numeric_limits<T>::quiet_NaN()));
+    BOOST_TEST_EQ(errno, EINVAL);
+    errno = 0;
+    static_cast<void>(static_cast<int>(std::numeric_limits<T>::infinity()));
+    BOOST_TEST_EQ(errno, ERANGE);
+    errno = 0;
+}
+
+// Every finite value gives the same result as the conversion operator
+template <typename T, typename Float>
+void test_float_same_as_cast()
+{
+    std::uniform_int_distribution<std::int64_t> sig_dist(-9'999'999, 9'999'999);
+    std::uniform_int_distribution<int> exp_dist(-30, 30);
+
+    errno = 0;
+
+    for (std::size_t n {}; n < N; ++n)
+    {
+        const T val {sig_dist(rng), exp_dist(rng)};
+
+        const auto res {try_to_float<Float>(val)};
+        BOOST_TEST(res);
+        BOOST_TEST_EQ(res.value, static_cast<Float>(val));
+    }
+
+    BOOST_TEST_EQ(errno, 0);
+}
+
+template <typename T>
+void test_float_non_finite()
+{
+    errno = 0;
+
+    const auto inf {try_to_float<double>(std::numeric_limits<T>::infinity())};
+    BOOST_TEST(inf);
+    BOOST_TEST(std::isinf(inf.value));
+
+    const auto nan {try_to_float<double>(std::numeric_limits<T>::quiet_NaN())};
+    BOOST_TEST(nan);
+    BOOST_TEST(std::isnan(nan.value));
+
+    const auto zero {try_to_float<float>(T{0})};
+    BOOST_TEST(zero);
+    BOOST_TEST_EQ(std::fpclassify(zero.value), FP_ZERO);
+    BOOST_TEST_EQ(errno, 0);
+}
+
+// from_chars reports every failure in its result and leaves errno alone
+template <typename T>
+void test_from_chars_errno()
+{
+    errno = 0;
+
+    const char* invalid {"x1.5"};
+    T val {};
+    const auto r {from_chars(invalid, invalid + std::strlen(invalid), val)};
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+    BOOST_TEST_EQ(errno, 0);
+
+    const char* valid {"1.5"};
+    const auto r2 {from_chars(valid, valid + std::strlen(valid), val)};
+    BOOST_TEST(r2);
+    BOOST_TEST_EQ(val, T(15, -1));
+    BOOST_TEST_EQ(errno, 0);
+}
+
+int main()
+{
+    test_integral_same_as_cast<decimal32, int>();
+    test_integral_same_as_cast<decimal32, long long>();
+    test_integral_same_as_cast<decimal32_fast, int>();
+    test_integral_same_as_cast<decimal64, long long>();
+    test_integral_same_as_cast<decimal128, long long>();
+    test_integral_same_as_cast<decimal128, int>();
+
+    test_integral_errors<decimal32>();
+    test_integral_errors<decimal32_fast>();
+    test_integral_errors<decimal64>();
+    test_integral_errors<decimal128>();
+
+    test_float_same_as_cast<decimal32, float>();
+    test_float_same_as_cast<decimal32, double>();
+    test_float_same_as_cast<decimal64, double>();
+    test_float_same_as_cast<decimal128, double>();
+
+    test_float_non_finite<decimal32>();
+    test_float_non_finite<decimal32_fast>();
+    test_float_non_finite<decimal64>();
+    test_float_non_finite<decimal128>();
+
+    test_from_chars_errno<decimal32>();
+    test_from_chars_errno<decimal32_fast>();
+    test_from_chars_errno<decimal64>();
+    test_from_chars_errno<decimal128>();
+
+    return boost::report_errors();
+}